@@ -8,7 +8,8 @@
  * 
  * TBitArray is a dynamically sized array of bits with the following features:
  * - Efficient storage (1 bit per element)
- * - Fast iteration over set/unset bits
+ * - Fast iteration over set bits with TConstSetBitIterator
+ * - Word-parallel AND/OR/ANDNOT and population count for combining masks
  * - Used by TSparseArray for tracking allocated elements
  */
 
@@ -17,6 +18,7 @@
 #include "ContainerAllocationPolicies.h"
 #include "ContainerFwd.h"
 
+#include <bit>
 #include <cstring>
 
 namespace MonsterEngine
@@ -276,9 +278,30 @@ public:
      */
     void SetRange(SizeType Index, SizeType Count, bool bValue)
     {
-        for (SizeType i = 0; i < Count; ++i)
+        if (Count <= 0)
         {
-            SetBit(Index + i, bValue);
+            return;
+        }
+        
+        // Whole words in the middle, masked words at both ends
+        uint32* Data = GetData();
+        const SizeType FirstWord = Index >> PerDWORDShift;
+        const SizeType LastWord = (Index + Count - 1) >> PerDWORDShift;
+        const uint32 FirstMask = ~0u << (Index & PerDWORDMask);
+        const uint32 LastMask = ~0u >> (PerDWORDMask - ((Index + Count - 1) & PerDWORDMask));
+        
+        for (SizeType WordIndex = FirstWord; WordIndex <= LastWord; ++WordIndex)
+        {
+            uint32 Mask = ~0u;
+            if (WordIndex == FirstWord)
+            {
+                Mask &= FirstMask;
+            }
+            if (WordIndex == LastWord)
+            {
+                Mask &= LastMask;
+            }
+            Data[WordIndex] = bValue ? (Data[WordIndex] | Mask) : (Data[WordIndex] & ~Mask);
         }
     }
     
@@ -374,16 +397,8 @@ public:
         {
             if (Data[WordIndex] != 0)
             {
-                // Find first set bit in this word
-                uint32 Word = Data[WordIndex];
-                for (SizeType BitIndex = 0; BitIndex < NumBitsPerDWORD; ++BitIndex)
-                {
-                    if (Word & (1u << BitIndex))
-                    {
-                        const SizeType Index = WordIndex * NumBitsPerDWORD + BitIndex;
-                        return Index < NumBits ? Index : INDEX_NONE_VALUE;
-                    }
-                }
+                const SizeType Index = WordIndex * NumBitsPerDWORD + std::countr_zero(Data[WordIndex]);
+                return Index < NumBits ? Index : INDEX_NONE_VALUE;
             }
         }
         
@@ -403,16 +418,8 @@ public:
         {
             if (Data[WordIndex] != 0xFFFFFFFF)
             {
-                // Find first unset bit in this word
-                uint32 Word = Data[WordIndex];
-                for (SizeType BitIndex = 0; BitIndex < NumBitsPerDWORD; ++BitIndex)
-                {
-                    if (!(Word & (1u << BitIndex)))
-                    {
-                        const SizeType Index = WordIndex * NumBitsPerDWORD + BitIndex;
-                        return Index < NumBits ? Index : INDEX_NONE_VALUE;
-                    }
-                }
+                const SizeType Index = WordIndex * NumBitsPerDWORD + std::countr_one(Data[WordIndex]);
+                return Index < NumBits ? Index : INDEX_NONE_VALUE;
             }
         }
         
@@ -424,22 +431,64 @@ public:
      */
     SizeType CountSetBits() const
     {
-        SizeType Count = 0;
-        const uint32* Data = GetData();
         const SizeType NumWords = GetNumWords();
+        if (NumWords == 0)
+        {
+            return 0;
+        }
         
-        for (SizeType WordIndex = 0; WordIndex < NumWords; ++WordIndex)
+        SizeType Count = 0;
+        const uint32* Data = GetData();
+        for (SizeType WordIndex = 0; WordIndex < NumWords - 1; ++WordIndex)
         {
-            // Population count (number of set bits)
-            uint32 Word = Data[WordIndex];
-            while (Word)
-            {
-                Count += Word & 1;
-                Word >>= 1;
-            }
+            Count += std::popcount(Data[WordIndex]);
         }
         
-        return Count;
+        // Bits past Num() in the last word are not part of the array
+        return Count + std::popcount(Data[NumWords - 1] & GetLastWordMask());
+    }
+    
+    // ========================================================================
+    // Bitwise Operations
+    // ========================================================================
+    
+    /**
+     * this &= Other, one word at a time
+     * The array keeps its size; bits past Other.Num() are treated as unset.
+     */
+    template<typename OtherAllocator>
+    void CombineWithBitwiseAND(const TBitArray<OtherAllocator>& Other)
+    {
+        CombineWords(Other, [](uint32 A, uint32 B) { return A & B; });
+    }
+    
+    /**
+     * this |= Other, one word at a time
+     * The array keeps its size; bits of Other past Num() are ignored.
+     */
+    template<typename OtherAllocator>
+    void CombineWithBitwiseOR(const TBitArray<OtherAllocator>& Other)
+    {
+        CombineWords(Other, [](uint32 A, uint32 B) { return A | B; });
+    }
+    
+    /**
+     * this &= ~Other, one word at a time; clears every bit set in Other
+     * The array keeps its size; bits past Other.Num() are left unchanged.
+     */
+    template<typename OtherAllocator>
+    void CombineWithBitwiseANDNOT(const TBitArray<OtherAllocator>& Other)
+    {
+        CombineWords(Other, [](uint32 A, uint32 B) { return A & ~B; });
+    }
+    
+    /**
+     * Mask of the bits of the last word that belong to the array
+     */
+    FORCEINLINE uint32 GetLastWordMask() const
+    {
+        const uint32 UnusedBits = static_cast<uint32>(GetNumWords() * NumBitsPerDWORD - NumBits);
+        return ~0u >> UnusedBits;
     }
     
     // ========================================================================
@@ -467,6 +516,36 @@ private:
     // Internal Helpers
     // ========================================================================
     
+    /**
+     * Applies Op to every word of this and the matching word of Other
+     * Words of Other past its end read as zero; the loop body has no branches
+     * so the compiler can vectorize it.
+     */
+    template<typename OtherAllocator, typename OpType>
+    void CombineWords(const TBitArray<OtherAllocator>& Other, OpType Op)
+    {
+        uint32* Data = GetData();
+        const uint32* OtherData = Other.GetData();
+        const SizeType NumWords = GetNumWords();
+        const SizeType OtherNumWords = Other.GetNumWords();
+        const SizeType NumCommonWords = NumWords < OtherNumWords ? NumWords : OtherNumWords;
+        
+        // The last word of Other may have stale bits past its end
+        const SizeType NumFullWords = (NumCommonWords == OtherNumWords && NumCommonWords > 0) ? NumCommonWords - 1 : NumCommonWords;
+        for (SizeType WordIndex = 0; WordIndex < NumFullWords; ++WordIndex)
+        {
+            Data[WordIndex] = Op(Data[WordIndex], OtherData[WordIndex]);
+        }
+        if (NumFullWords < NumCommonWords)
+        {
+            Data[NumFullWords] = Op(Data[NumFullWords], OtherData[NumFullWords] & Other.GetLastWordMask());
+        }
+        for (SizeType WordIndex = NumCommonWords; WordIndex < NumWords; ++WordIndex)
+        {
+            Data[WordIndex] = Op(Data[WordIndex], 0u);
+        }
+    }
+    
     void Realloc(SizeType NewMaxBits)
     {
         const SizeType OldMaxWords = GetMaxWords();
@@ -491,4 +570,94 @@ private:
     typename Allocator::ForAnyElementType AllocatorInstance;
 };
 
+// ============================================================================
+// TConstSetBitIterator
+// ============================================================================
+
+/**
+ * Iterates the indices of the set bits of a bit array in ascending order
+ *
+ * Words are visited once; within a word each step finds the next set bit
+ * with count-trailing-zeros, so the cost is proportional to the number of
+ * words plus the number of set bits rather than the number of bits. Bits of
+ * the word being visited may be cleared while iterating.
+ *
+ * Usage:
+ *   for (TConstSetBitIterator<> It(BitArray); It; ++It) { It.GetIndex(); }
+ *
+ * Based on UE5's TConstSetBitIterator
+ * Reference: Engine/Source/Runtime/Core/Public/Containers/BitArray.h
+ */
+template<typename Allocator = FDefaultBitArrayAllocator>
+class TConstSetBitIterator
+{
+public:
+    explicit TConstSetBitIterator(const TBitArray<Allocator>& InArray, int32 StartIndex = 0)
+        : Data(InArray.GetData())
+        , NumBits(InArray.Num())
+        , NumWords(InArray.GetNumWords())
+        , WordIndex(StartIndex >> PerDWORDShift)
+        , RemainingBits(0)
+        , CurrentIndex(0)
+    {
+        if (StartIndex >= NumBits)
+        {
+            CurrentIndex = NumBits;
+            return;
+        }
+        RemainingBits = Data[WordIndex] & (~0u << (StartIndex & PerDWORDMask));
+        FindNextSetBit();
+    }
+    
+    FORCEINLINE TConstSetBitIterator& operator++()
+    {
+        FindNextSetBit();
+        return *this;
+    }
+    
+    /** Returns true while the iterator points at a set bit */
+    FORCEINLINE explicit operator bool() const
+    {
+        return CurrentIndex < NumBits;
+    }
+    
+    /** Index of the current set bit */
+    FORCEINLINE int32 GetIndex() const
+    {
+        return CurrentIndex;
+    }
+    
+private:
+    void FindNextSetBit()
+    {
+        while (RemainingBits == 0)
+        {
+            if (++WordIndex >= NumWords)
+            {
+                CurrentIndex = NumBits;
+                return;
+            }
+            RemainingBits = Data[WordIndex];
+        }
+        
+        CurrentIndex = (WordIndex << PerDWORDShift) + std::countr_zero(RemainingBits);
+        RemainingBits &= RemainingBits - 1;
+        
+        // Stale bits past the end of the array
+        if (CurrentIndex >= NumBits)
+        {
+            CurrentIndex = NumBits;
+            RemainingBits = 0;
+            WordIndex = NumWords;
+        }
+    }
+    
+    const uint32* Data;
+    int32 NumBits;
+    int32 NumWords;
+    int32 WordIndex;
+    uint32 RemainingBits;
+    int32 CurrentIndex;
+};
+
 } // namespace MonsterEngine
@@ -10,6 +10,7 @@
  * - TSizedDefaultAllocator: Default allocator with configurable index size
  * - TInlineAllocator: Inline storage with heap fallback
  * - TFixedAllocator: Fixed-size inline storage only
+ * - TMemStackAllocator: Per-frame storage on the calling thread's FMemStack
  * 
  * Slack calculation functions for intelligent memory management.
  */
@@ -17,9 +18,11 @@
 #include "Core/CoreTypes.h"
 #include "Core/Templates/TypeTraits.h"
 #include "ContainerFwd.h"
+#include "Core/HAL/MemStack.h"
 #include <cstdlib>
 #include <cstring>
 #include <cassert>
+#include <limits>
 #include <new>
 
 namespace MonsterEngine
@@ -506,6 +509,143 @@ public:
     };
 };
 
+// ============================================================================
+// Mem Stack Allocator
+// ============================================================================
+
+/**
+ * TMemStackAllocator - Allocates from the calling thread's FMemStack
+ * 
+ * For containers that live at most one frame, or inside an FMemMark scope:
+ * growing is a pointer bump (in place when the array is the latest allocation
+ * on the stack) and freeing is a no-op, the memory being reclaimed by the
+ * mark or at frame end.
+ * 
+ * A container kept across frames must be emptied with Empty() rather than
+ * Reset() before it is reused in a new frame, since Reset() keeps the old
+ * frame's storage; growing one that still holds elements asserts. Element
+ * destructors still run, so such containers should hold trivially
+ * destructible elements.
+ * 
+ * Reference: UE5 Engine/Source/Runtime/Core/Public/Misc/MemStack.h
+ */
+template<uint32 Alignment = DEFAULT_ALIGNMENT>
+class TMemStackAllocator
+{
+public:
+    using SizeType = int32;
+    
+    enum { NeedsElementType = false };
+    enum { RequireRangeCheck = true };
+    
+    class ForAnyElementType
+    {
+    public:
+        ForAnyElementType() = default;
+        
+        ForAnyElementType(const ForAnyElementType&) = delete;
+        ForAnyElementType& operator=(const ForAnyElementType&) = delete;
+        
+        FORCEINLINE void MoveToEmpty(ForAnyElementType& Other)
+        {
+            assert(this != &Other);
+            
+            Data = Other.Data;
+            AllocatedBytes = Other.AllocatedBytes;
+            Other.Data = nullptr;
+            Other.AllocatedBytes = 0;
+        }
+        
+        FORCEINLINE void* GetAllocation() const
+        {
+            return Data;
+        }
+        
+        void ResizeAllocation(SizeType PreviousNumElements, SizeType NumElements, size_t NumBytesPerElement, uint32 AlignmentOfElement = DEFAULT_ALIGNMENT)
+        {
+            if (NumElements <= 0)
+            {
+                Data = nullptr;
+                AllocatedBytes = 0;
+                return;
+            }
+            
+            // A block from a frame that has ended is released as soon as the stack rewinds,
+            // which the allocation below may do, so its contents cannot be carried over
+            MonsterRender::FMemStack& Mem = MonsterRender::FMemStack::Get();
+            if (Data && Mem.NeedsNewFrame())
+            {
+                assert(PreviousNumElements == 0 && "Stack-allocated container kept across frames must be emptied with Empty()");
+                Data = nullptr;
+                AllocatedBytes = 0;
+            }
+            
+            // Shrinking keeps the block; the stack cannot give the tail back
+            const size_t NewBytes = static_cast<size_t>(NumElements) * NumBytesPerElement;
+            if (NewBytes <= AllocatedBytes)
+            {
+                return;
+            }
+            
+            if (Data && Mem.TryGrowInPlace(Data, AllocatedBytes, NewBytes))
+            {
+                AllocatedBytes = NewBytes;
+                return;
+            }
+            
+            const size_t BlockAlignment = Alignment > AlignmentOfElement ? Alignment : AlignmentOfElement;
+            void* NewData = Mem.Alloc(NewBytes, BlockAlignment);
+            if (Data && PreviousNumElements > 0)
+            {
+                const SizeType NumToCopy = PreviousNumElements < NumElements ? PreviousNumElements : NumElements;
+                std::memcpy(NewData, Data, static_cast<size_t>(NumToCopy) * NumBytesPerElement);
+            }
+            Data = NewData;
+            AllocatedBytes = NewBytes;
+        }
+        
+        FORCEINLINE SizeType CalculateSlackReserve(SizeType NumElements, size_t NumBytesPerElement, uint32 AlignmentOfElement = DEFAULT_ALIGNMENT) const
+        {
+            return DefaultCalculateSlackReserve(NumElements, NumBytesPerElement, false, AlignmentOfElement);
+        }
+        
+        FORCEINLINE SizeType CalculateSlackShrink(SizeType NumElements, SizeType NumAllocatedElements, size_t NumBytesPerElement, uint32 AlignmentOfElement = DEFAULT_ALIGNMENT) const
+        {
+            // Shrinking frees nothing, so keep the capacity
+            return NumAllocatedElements;
+        }
+        
+        FORCEINLINE SizeType CalculateSlackGrow(SizeType NumElements, SizeType NumAllocatedElements, size_t NumBytesPerElement, uint32 AlignmentOfElement = DEFAULT_ALIGNMENT) const
+        {
+            return DefaultCalculateSlackGrow(NumElements, NumAllocatedElements, NumBytesPerElement, false, AlignmentOfElement);
+        }
+        
+        FORCEINLINE SizeType GetInitialCapacity() const
+        {
+            return 0;
+        }
+        
+    private:
+        void* Data = nullptr;
+        size_t AllocatedBytes = 0;
+    };
+    
+    template<typename ElementType>
+    class ForElementType : public ForAnyElementType
+    {
+    public:
+        ForElementType() = default;
+        
+        FORCEINLINE ElementType* GetAllocation() const
+        {
+            return static_cast<ElementType*>(ForAnyElementType::GetAllocation());
+        }
+    };
+};
+
+/** Allocator for containers that live for one frame of rendering (the thread's FMemStack) */
+using SceneRenderingAllocator = TMemStackAllocator<>;
+
 // ============================================================================
 // Allocator Traits Specializations
 // ============================================================================
@@ -526,4 +666,12 @@ struct TAllocatorTraitsBase<TSizedDefaultAllocator<IndexSize>>
     enum { SupportsElementAlignment = true };
 };
 
+template<uint32 Alignment>
+struct TAllocatorTraitsBase<TMemStackAllocator<Alignment>>
+{
+    enum { IsZeroConstruct = false };
+    enum { SupportsFreezeMemoryImage = false };
+    enum { SupportsElementAlignment = true };
+};
+
 } // namespace MonsterEngine
@@ -61,11 +61,20 @@ class TMap;
 template<typename KeyType, typename ValueType, typename Allocator = FDefaultAllocator, typename KeyFuncs = void>
 class TMultiMap;
 
+// TFlatSet - Open-addressing hash set
+template<typename InElementType, typename KeyFuncs = void, typename Allocator = FDefaultAllocator>
+class TFlatSet;
+
+// TFlatMap - Open-addressing hash map
+template<typename KeyType, typename ValueType, typename Allocator = FDefaultAllocator, typename KeyFuncs = void>
+class TFlatMap;
+
 // ============================================================================
 // String Forward Declarations
 // ============================================================================
 
 class FString;
+class FUtf8String;
 class FName;
 class FText;
 
@@ -22,9 +22,12 @@
 #include "SparseArray.h"
 #include "Set.h"
 #include "Map.h"
+#include "FlatSet.h"
+#include "FlatMap.h"
 
 // String types
 #include "String.h"
+#include "Utf8String.h"
 #include "Name.h"
 #include "Text.h"
 
@@ -0,0 +1,618 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+#pragma once
+
+/**
+ * @file FlatMap.h
+ * @brief Open-addressing hash map with SIMD control-byte probing
+ *
+ * TFlatMap has the TMap API on top of TFlatSet:
+ * - Key-value pairs live directly in the table slots
+ * - Lookups hash the key once and never build a temporary pair
+ * - Growth invalidates value pointers, like TArray
+ */
+
+#include "Core/CoreTypes.h"
+#include "Core/Templates/TypeTraits.h"
+#include "Core/Templates/TypeHash.h"
+#include "ContainerAllocationPolicies.h"
+#include "ContainerFwd.h"
+#include "Map.h"
+#include "FlatSet.h"
+
+#include <utility>
+
+namespace MonsterEngine
+{
+
+// ============================================================================
+// TFlatMap
+// ============================================================================
+
+/**
+ * A map from keys to values (no duplicate keys) stored in an open-addressing hash table
+ *
+ * @tparam KeyType The key type
+ * @tparam ValueType The value type
+ * @tparam Allocator The allocator policy
+ * @tparam KeyFuncs Functions for getting keys and hashing
+ */
+template<typename KeyType, typename ValueType, typename Allocator, typename KeyFuncs>
+class TFlatMap
+{
+public:
+    using ElementType = TPair<KeyType, ValueType>;
+    using SizeType = int32;
+
+private:
+    using ActualKeyFuncs = TConditional_T<
+        TIsSame<KeyFuncs, void>::Value,
+        TDefaultMapKeyFuncs<KeyType, ValueType, false>,
+        KeyFuncs
+    >;
+
+    using SetType = TFlatSet<ElementType, ActualKeyFuncs, Allocator>;
+
+public:
+    // ========================================================================
+    // Constructors and Destructor
+    // ========================================================================
+
+    /**
+     * Default constructor
+     */
+    TFlatMap() = default;
+
+    /**
+     * Constructor from initializer list
+     */
+    TFlatMap(std::initializer_list<ElementType> InitList)
+    {
+        Reserve(static_cast<SizeType>(InitList.size()));
+        for (const ElementType& Pair : InitList)
+        {
+            Add(Pair.Key, Pair.Value);
+        }
+    }
+
+    /**
+     * Copy constructor
+     */
+    TFlatMap(const TFlatMap&) = default;
+
+    /**
+     * Move constructor
+     */
+    TFlatMap(TFlatMap&&) = default;
+
+    /**
+     * Destructor
+     */
+    ~TFlatMap() = default;
+
+    // ========================================================================
+    // Assignment Operators
+    // ========================================================================
+
+    /**
+     * Copy assignment
+     */
+    TFlatMap& operator=(const TFlatMap&) = default;
+
+    /**
+     * Move assignment
+     */
+    TFlatMap& operator=(TFlatMap&&) = default;
+
+    /**
+     * Assignment from initializer list
+     */
+    TFlatMap& operator=(std::initializer_list<ElementType> InitList)
+    {
+        Empty(static_cast<SizeType>(InitList.size()));
+        for (const ElementType& Pair : InitList)
+        {
+            Add(Pair.Key, Pair.Value);
+        }
+        return *this;
+    }
+
+    // ========================================================================
+    // Size and Capacity
+    // ========================================================================
+
+    /**
+     * Returns number of elements
+     */
+    FORCEINLINE SizeType Num() const
+    {
+        return Pairs.Num();
+    }
+
+    /**
+     * Returns true if empty
+     */
+    FORCEINLINE bool IsEmpty() const
+    {
+        return Pairs.IsEmpty();
+    }
+
+    /**
+     * Returns the bytes allocated for the table
+     */
+    FORCEINLINE size_t GetAllocatedSize() const
+    {
+        return Pairs.GetAllocatedSize();
+    }
+
+    // ========================================================================
+    // Adding Elements
+    // ========================================================================
+
+    /**
+     * Adds a key-value pair
+     * @return Reference to the value
+     */
+    ValueType& Add(const KeyType& InKey, const ValueType& InValue)
+    {
+        return EmplaceImpl(InKey, InValue);
+    }
+
+    /**
+     * Adds a key-value pair (move value)
+     * @return Reference to the value
+     */
+    ValueType& Add(const KeyType& InKey, ValueType&& InValue)
+    {
+        return EmplaceImpl(InKey, std::move(InValue));
+    }
+
+    /**
+     * Adds a key with default-constructed value
+     * @return Reference to the value
+     */
+    ValueType& Add(const KeyType& InKey)
+    {
+        return EmplaceImpl(InKey);
+    }
+
+    /**
+     * Adds a key-value pair (move key)
+     * @return Reference to the value
+     */
+    ValueType& Add(KeyType&& InKey, const ValueType& InValue)
+    {
+        return EmplaceImpl(std::move(InKey), InValue);
+    }
+
+    /**
+     * Adds a key-value pair (move both)
+     * @return Reference to the value
+     */
+    ValueType& Add(KeyType&& InKey, ValueType&& InValue)
+    {
+        return EmplaceImpl(std::move(InKey), std::move(InValue));
+    }
+
+    /**
+     * Adds a key with default-constructed value (move key)
+     * @return Reference to the value
+     */
+    ValueType& Add(KeyType&& InKey)
+    {
+        return EmplaceImpl(std::move(InKey));
+    }
+
+    /**
+     * Constructs a value in place
+     * @return Reference to the value
+     */
+    template<typename... ArgsType>
+    ValueType& Emplace(const KeyType& InKey, ArgsType&&... Args)
+    {
+        return EmplaceImpl(InKey, std::forward<ArgsType>(Args)...);
+    }
+
+    /**
+     * Constructs a value in place (move key)
+     * @return Reference to the value
+     */
+    template<typename... ArgsType>
+    ValueType& Emplace(KeyType&& InKey, ArgsType&&... Args)
+    {
+        return EmplaceImpl(std::move(InKey), std::forward<ArgsType>(Args)...);
+    }
+
+    /**
+     * Finds or adds a key-value pair
+     * @return Reference to the value (existing or new)
+     */
+    ValueType& FindOrAdd(const KeyType& InKey)
+    {
+        return Pairs[Pairs.FindOrEmplaceByKey(InKey, nullptr, InKey)].Value;
+    }
+
+    /**
+     * Finds or adds a key-value pair (move key)
+     * @return Reference to the value (existing or new)
+     */
+    ValueType& FindOrAdd(KeyType&& InKey)
+    {
+        return Pairs[Pairs.FindOrEmplaceByKey(InKey, nullptr, std::move(InKey))].Value;
+    }
+
+    // ========================================================================
+    // Removing Elements
+    // ========================================================================
+
+    /**
+     * Removes a key-value pair by key
+     * @return Number of elements removed (0 or 1)
+     */
+    SizeType Remove(const KeyType& InKey)
+    {
+        return Pairs.Remove(InKey);
+    }
+
+    // ========================================================================
+    // Finding Elements
+    // ========================================================================
+
+    /**
+     * Finds a value by key
+     * @return Pointer to value, or nullptr if not found
+     */
+    FORCEINLINE ValueType* Find(const KeyType& InKey)
+    {
+        ElementType* Pair = Pairs.Find(InKey);
+        return Pair ? &Pair->Value : nullptr;
+    }
+
+    /**
+     * Finds a value by key (const)
+     */
+    FORCEINLINE const ValueType* Find(const KeyType& InKey) const
+    {
+        return const_cast<TFlatMap*>(this)->Find(InKey);
+    }
+
+    /**
+     * Finds a value by key, returns reference (asserts if not found)
+     */
+    ValueType& FindChecked(const KeyType& InKey)
+    {
+        ValueType* Value = Find(InKey);
+        // Assert that value exists
+        return *Value;
+    }
+
+    /**
+     * Finds a value by key, returns reference (const, asserts if not found)
+     */
+    const ValueType& FindChecked(const KeyType& InKey) const
+    {
+        return const_cast<TFlatMap*>(this)->FindChecked(InKey);
+    }
+
+    /**
+     * Finds a value by key, returns pointer to key if found
+     */
+    const KeyType* FindKey(const ValueType& InValue) const
+    {
+        for (const ElementType& Pair : Pairs)
+        {
+            if (Pair.Value == InValue)
+            {
+                return &Pair.Key;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Checks if map contains a key
+     */
+    FORCEINLINE bool Contains(const KeyType& InKey) const
+    {
+        return Pairs.Contains(InKey);
+    }
+
+    // ========================================================================
+    // Bracket Operator
+    // ========================================================================
+
+    /**
+     * Bracket operator - finds or adds a key
+     * @return Reference to the value
+     */
+    ValueType& operator[](const KeyType& InKey)
+    {
+        return FindOrAdd(InKey);
+    }
+
+    /**
+     * Bracket operator - finds or adds a key (move)
+     * @return Reference to the value
+     */
+    ValueType& operator[](KeyType&& InKey)
+    {
+        return FindOrAdd(std::move(InKey));
+    }
+
+    // ========================================================================
+    // Memory Management
+    // ========================================================================
+
+    /**
+     * Empties the map
+     */
+    void Empty(SizeType ExpectedNumElements = 0)
+    {
+        Pairs.Empty(ExpectedNumElements);
+    }
+
+    /**
+     * Resets the map without deallocating
+     */
+    void Reset()
+    {
+        Pairs.Reset();
+    }
+
+    /**
+     * Reserves capacity
+     */
+    void Reserve(SizeType ExpectedNumElements)
+    {
+        Pairs.Reserve(ExpectedNumElements);
+    }
+
+    /**
+     * Shrinks the map to fit its contents
+     */
+    void Shrink()
+    {
+        Pairs.Shrink();
+    }
+
+    /**
+     * Compacts the map
+     */
+    void Compact()
+    {
+        Pairs.Compact();
+    }
+
+    // ========================================================================
+    // Key/Value Arrays
+    // ========================================================================
+
+    /**
+     * Generates an array of all keys
+     */
+    TArray<KeyType> GetKeys() const
+    {
+        TArray<KeyType> Result;
+        Result.Reserve(Num());
+        for (const ElementType& Pair : Pairs)
+        {
+            Result.Add(Pair.Key);
+        }
+        return Result;
+    }
+
+    /**
+     * Appends all keys to an array
+     */
+    void GetKeys(TArray<KeyType>& OutKeys) const
+    {
+        OutKeys.Reserve(OutKeys.Num() + Num());
+        for (const ElementType& Pair : Pairs)
+        {
+            OutKeys.Add(Pair.Key);
+        }
+    }
+
+    /**
+     * Generates an array of all values
+     */
+    TArray<ValueType> GetValues() const
+    {
+        TArray<ValueType> Result;
+        Result.Reserve(Num());
+        for (const ElementType& Pair : Pairs)
+        {
+            Result.Add(Pair.Value);
+        }
+        return Result;
+    }
+
+    // ========================================================================
+    // Iteration
+    // ========================================================================
+
+    /**
+     * Iterator for map
+     */
+    class TIterator
+    {
+    public:
+        TIterator(TFlatMap& InMap)
+            : SetIt(InMap.Pairs.CreateIterator())
+        {
+        }
+
+        TIterator& operator++()
+        {
+            ++SetIt;
+            return *this;
+        }
+
+        FORCEINLINE explicit operator bool() const
+        {
+            return static_cast<bool>(SetIt);
+        }
+
+        FORCEINLINE ElementType& operator*() const
+        {
+            return *SetIt;
+        }
+
+        FORCEINLINE ElementType* operator->() const
+        {
+            return &(*SetIt);
+        }
+
+        FORCEINLINE const KeyType& Key() const
+        {
+            return (*SetIt).Key;
+        }
+
+        FORCEINLINE ValueType& Value() const
+        {
+            return (*SetIt).Value;
+        }
+
+        void RemoveCurrent()
+        {
+            SetIt.RemoveCurrent();
+        }
+
+    private:
+        typename SetType::TIterator SetIt;
+    };
+
+    /**
+     * Const iterator for map
+     */
+    class TConstIterator
+    {
+    public:
+        TConstIterator(const TFlatMap& InMap)
+            : SetIt(InMap.Pairs.CreateConstIterator())
+        {
+        }
+
+        TConstIterator& operator++()
+        {
+            ++SetIt;
+            return *this;
+        }
+
+        FORCEINLINE explicit operator bool() const
+        {
+            return static_cast<bool>(SetIt);
+        }
+
+        FORCEINLINE const ElementType& operator*() const
+        {
+            return *SetIt;
+        }
+
+        FORCEINLINE const ElementType* operator->() const
+        {
+            return &(*SetIt);
+        }
+
+        FORCEINLINE const KeyType& Key() const
+        {
+            return (*SetIt).Key;
+        }
+
+        FORCEINLINE const ValueType& Value() const
+        {
+            return (*SetIt).Value;
+        }
+
+    private:
+        typename SetType::TConstIterator SetIt;
+    };
+
+    TIterator CreateIterator()
+    {
+        return TIterator(*this);
+    }
+
+    TConstIterator CreateConstIterator() const
+    {
+        return TConstIterator(*this);
+    }
+
+    // Range-based for loop support
+    auto begin() { return Pairs.begin(); }
+    auto end() { return Pairs.end(); }
+    auto begin() const { return Pairs.begin(); }
+    auto end() const { return Pairs.end(); }
+
+    // ========================================================================
+    // STL Compatibility Methods
+    // ========================================================================
+
+    FORCEINLINE SizeType size() const { return Num(); }
+    FORCEINLINE bool empty() const { return Num() == 0; }
+    FORCEINLINE void clear() { Empty(); }
+    FORCEINLINE ValueType* find(const KeyType& Key) { return Find(Key); }
+    FORCEINLINE const ValueType* find(const KeyType& Key) const { return Find(Key); }
+    FORCEINLINE SizeType count(const KeyType& Key) const { return Contains(Key) ? 1 : 0; }
+    FORCEINLINE SizeType erase(const KeyType& Key) { return Remove(Key); }
+
+    // ========================================================================
+    // Comparison
+    // ========================================================================
+
+    /**
+     * Equality comparison
+     */
+    bool operator==(const TFlatMap& Other) const
+    {
+        if (Num() != Other.Num())
+        {
+            return false;
+        }
+
+        for (const ElementType& Pair : Pairs)
+        {
+            const ValueType* OtherValue = Other.Find(Pair.Key);
+            if (!OtherValue || !(*OtherValue == Pair.Value))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Inequality comparison
+     */
+    bool operator!=(const TFlatMap& Other) const
+    {
+        return !(*this == Other);
+    }
+
+private:
+    // ========================================================================
+    // Internal Helpers
+    // ========================================================================
+
+    template<typename KeyArg, typename... ValueArgs>
+    ValueType& EmplaceImpl(KeyArg&& InKey, ValueArgs&&... Args)
+    {
+        // One probe finds the key or the slot for the new pair
+        bool bIsAlreadyInMap = false;
+        const FSetElementId Id = Pairs.FindOrEmplaceByKey(InKey, &bIsAlreadyInMap, std::forward<KeyArg>(InKey), std::forward<ValueArgs>(Args)...);
+
+        ValueType& Value = Pairs[Id].Value;
+        if (bIsAlreadyInMap)
+        {
+            // Update existing value; Args were not consumed by the lookup
+            Value = ValueType(std::forward<ValueArgs>(Args)...);
+        }
+        return Value;
+    }
+
+private:
+    SetType Pairs;
+};
+
+} // namespace MonsterEngine
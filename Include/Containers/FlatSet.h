@@ -0,0 +1,1079 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+#pragma once
+
+/**
+ * @file FlatSet.h
+ * @brief Open-addressing hash set with SIMD control-byte probing
+ *
+ * TFlatSet is a drop-in alternative to TSet for lookup-heavy sets:
+ * - Elements live directly in one flat slot array, no hash chains
+ * - One control byte per slot holds 7 bits of the hash, so a probe tests
+ *   16 slots with a single SSE2 compare before touching any element
+ * - Removal leaves the table in place, growth rehashes it
+ *
+ * Reference: Abseil Swiss tables (absl/container/internal/raw_hash_set.h)
+ */
+
+#include "Core/CoreTypes.h"
+#include "Core/Templates/TypeTraits.h"
+#include "Core/Templates/TypeHash.h"
+#include "ContainerAllocationPolicies.h"
+#include "ContainerFwd.h"
+#include "Set.h"
+
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__)
+    #define MR_FLATHASH_USE_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define MR_FLATHASH_USE_SSE2 0
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace MonsterEngine
+{
+
+namespace FlatHashPrivate
+{
+    /** Slots probed together */
+    constexpr int32 GroupWidth = 16;
+
+    /** Control bytes: a full slot stores the 7-bit H2 of its hash, free slots have the high bit set */
+    constexpr uint8 CtrlEmpty = 0x80;
+    constexpr uint8 CtrlDeleted = 0xFE;
+
+    FORCEINLINE uint32 CountTrailingZeros(uint32 Mask)
+    {
+#if defined(_MSC_VER)
+        unsigned long Index;
+        _BitScanForward(&Index, Mask);
+        return static_cast<uint32>(Index);
+#else
+        return static_cast<uint32>(__builtin_ctz(Mask));
+#endif
+    }
+
+    /** Leading zeros of a non-zero GroupWidth-bit mask */
+    FORCEINLINE uint32 CountLeadingZerosInGroup(uint32 Mask)
+    {
+#if defined(_MSC_VER)
+        unsigned long Index;
+        _BitScanReverse(&Index, Mask);
+        return static_cast<uint32>(GroupWidth - 1) - static_cast<uint32>(Index);
+#else
+        return static_cast<uint32>(__builtin_clz(Mask)) - (32 - GroupWidth);
+#endif
+    }
+
+    /**
+     * GroupWidth consecutive control bytes; each Match returns one bit per matching slot
+     */
+    struct FGroup
+    {
+#if MR_FLATHASH_USE_SSE2
+        FORCEINLINE explicit FGroup(const uint8* Ctrl)
+            : Bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Ctrl)))
+        {
+        }
+
+        FORCEINLINE uint32 Match(uint8 H2) const
+        {
+            return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(H2)), Bytes)));
+        }
+
+        FORCEINLINE uint32 MatchEmpty() const
+        {
+            return Match(CtrlEmpty);
+        }
+
+        FORCEINLINE uint32 MatchEmptyOrDeleted() const
+        {
+            return static_cast<uint32>(_mm_movemask_epi8(Bytes));
+        }
+
+        FORCEINLINE uint32 MatchFull() const
+        {
+            return MatchEmptyOrDeleted() ^ 0xFFFFu;
+        }
+
+        __m128i Bytes;
+#else
+        FORCEINLINE explicit FGroup(const uint8* Ctrl)
+        {
+            std::memcpy(Bytes, Ctrl, GroupWidth);
+        }
+
+        FORCEINLINE uint32 Match(uint8 H2) const
+        {
+            uint32 Mask = 0;
+            for (int32 i = 0; i < GroupWidth; ++i)
+            {
+                Mask |= static_cast<uint32>(Bytes[i] == H2) << i;
+            }
+            return Mask;
+        }
+
+        FORCEINLINE uint32 MatchEmpty() const
+        {
+            return Match(CtrlEmpty);
+        }
+
+        FORCEINLINE uint32 MatchEmptyOrDeleted() const
+        {
+            uint32 Mask = 0;
+            for (int32 i = 0; i < GroupWidth; ++i)
+            {
+                Mask |= static_cast<uint32>(Bytes[i] >> 7) << i;
+            }
+            return Mask;
+        }
+
+        FORCEINLINE uint32 MatchFull() const
+        {
+            return MatchEmptyOrDeleted() ^ 0xFFFFu;
+        }
+
+        uint8 Bytes[GroupWidth];
+#endif
+    };
+}
+
+// ============================================================================
+// TFlatSet
+// ============================================================================
+
+/**
+ * A set of unique elements stored in an open-addressing hash table
+ *
+ * Has the TSet API and key functions. Differences to TSet:
+ * - Find/FindId/Contains/Remove take the key, not a whole element
+ * - Growth (Add, Emplace, Reserve) moves elements, invalidating element ids
+ *   and pointers; removal never moves elements, so ids stay valid until the
+ *   next growth and RemoveCurrent is safe while iterating
+ * - Iteration order is the slot order
+ *
+ * Layout: one allocation holding Capacity + GroupWidth control bytes followed
+ * by Capacity element slots. The first GroupWidth control bytes are mirrored
+ * after the last one so a group can be loaded at any slot without wrapping.
+ * Lookups walk groups in triangular order and stop at the first group that
+ * has an empty slot; at most 7/8 of the slots are used, so one always exists.
+ *
+ * @tparam InElementType The type of elements
+ * @tparam KeyFuncs Functions for getting keys and hashing (defaults to using element as key)
+ * @tparam Allocator The allocator policy for the table
+ */
+template<typename InElementType, typename KeyFuncs, typename Allocator>
+class TFlatSet
+{
+public:
+    using ElementType = InElementType;
+    using SizeType = int32;
+
+private:
+    // Use DefaultKeyFuncs if KeyFuncs is void
+    using ActualKeyFuncs = TConditional_T<
+        TIsSame<KeyFuncs, void>::Value,
+        DefaultKeyFuncs<ElementType>,
+        KeyFuncs
+    >;
+
+    using AllocatorType = typename Allocator::template ForElementType<uint8>;
+
+    static constexpr int32 GroupWidth = FlatHashPrivate::GroupWidth;
+    static constexpr int32 MinCapacity = GroupWidth;
+
+public:
+    using KeyInitType = typename ActualKeyFuncs::KeyInitType;
+
+    // ========================================================================
+    // Constructors and Destructor
+    // ========================================================================
+
+    /**
+     * Default constructor
+     */
+    TFlatSet() = default;
+
+    /**
+     * Constructor from initializer list
+     */
+    TFlatSet(std::initializer_list<ElementType> InitList)
+    {
+        Reserve(static_cast<SizeType>(InitList.size()));
+        for (const ElementType& Element : InitList)
+        {
+            Add(Element);
+        }
+    }
+
+    /**
+     * Copy constructor
+     */
+    TFlatSet(const TFlatSet& Other)
+    {
+        CopyElementsFrom(Other);
+    }
+
+    /**
+     * Move constructor
+     */
+    TFlatSet(TFlatSet&& Other) noexcept
+    {
+        MoveFrom(Other);
+    }
+
+    /**
+     * Destructor
+     */
+    ~TFlatSet()
+    {
+        DestructElements();
+        ReleaseTable();
+    }
+
+    // ========================================================================
+    // Assignment Operators
+    // ========================================================================
+
+    /**
+     * Copy assignment
+     */
+    TFlatSet& operator=(const TFlatSet& Other)
+    {
+        if (this != &Other)
+        {
+            Reset();
+            CopyElementsFrom(Other);
+        }
+        return *this;
+    }
+
+    /**
+     * Move assignment
+     */
+    TFlatSet& operator=(TFlatSet&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            DestructElements();
+            ReleaseTable();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+
+    /**
+     * Assignment from initializer list
+     */
+    TFlatSet& operator=(std::initializer_list<ElementType> InitList)
+    {
+        Empty(static_cast<SizeType>(InitList.size()));
+        for (const ElementType& Element : InitList)
+        {
+            Add(Element);
+        }
+        return *this;
+    }
+
+    // ========================================================================
+    // Size and Capacity
+    // ========================================================================
+
+    /**
+     * Returns number of elements
+     */
+    FORCEINLINE SizeType Num() const
+    {
+        return NumElements;
+    }
+
+    /**
+     * Returns true if empty
+     */
+    FORCEINLINE bool IsEmpty() const
+    {
+        return NumElements == 0;
+    }
+
+    /**
+     * Returns the number of slots in the table
+     */
+    FORCEINLINE SizeType GetCapacity() const
+    {
+        return Capacity;
+    }
+
+    /**
+     * Returns the bytes allocated for the table
+     */
+    size_t GetAllocatedSize() const
+    {
+        return Capacity > 0 ? GetTableBytes(Capacity) : 0;
+    }
+
+    // ========================================================================
+    // Adding Elements
+    // ========================================================================
+
+    /**
+     * Adds an element to the set
+     * @return ID of the added element (or existing element if duplicate)
+     */
+    FSetElementId Add(const ElementType& InElement, bool* bIsAlreadyInSetPtr = nullptr)
+    {
+        return FindOrEmplaceByKey(ActualKeyFuncs::GetSetKey(InElement), bIsAlreadyInSetPtr, InElement);
+    }
+
+    /**
+     * Adds an element to the set (move)
+     * @return ID of the added element (or existing element if duplicate)
+     */
+    FSetElementId Add(ElementType&& InElement, bool* bIsAlreadyInSetPtr = nullptr)
+    {
+        return FindOrEmplaceByKey(ActualKeyFuncs::GetSetKey(InElement), bIsAlreadyInSetPtr, std::move(InElement));
+    }
+
+    /**
+     * Constructs an element in place
+     * @return ID of the added element (or existing element if duplicate)
+     */
+    template<typename... ArgsType>
+    FSetElementId Emplace(ArgsType&&... Args)
+    {
+        // Construct element to get its key
+        ElementType NewElement(std::forward<ArgsType>(Args)...);
+        return FindOrEmplaceByKey(ActualKeyFuncs::GetSetKey(NewElement), nullptr, std::move(NewElement));
+    }
+
+    /**
+     * Finds the element with a key, or constructs one from Args if there is none
+     * Hashes and probes once; Args are only used when the element is added
+     * @return ID of the existing or added element
+     */
+    template<typename... ArgsType>
+    FSetElementId FindOrEmplaceByKey(KeyInitType Key, bool* bIsAlreadyInSetPtr, ArgsType&&... Args)
+    {
+        const uint64 Hash = HashKey(Key);
+
+        if (!ActualKeyFuncs::bAllowDuplicateKeys)
+        {
+            const int32 ExistingSlot = FindSlot(Key, Hash);
+            if (ExistingSlot != INDEX_NONE_VALUE)
+            {
+                if (bIsAlreadyInSetPtr)
+                {
+                    *bIsAlreadyInSetPtr = true;
+                }
+                return FSetElementId::FromInteger(ExistingSlot);
+            }
+        }
+
+        if (bIsAlreadyInSetPtr)
+        {
+            *bIsAlreadyInSetPtr = false;
+        }
+
+        const int32 Slot = PrepareInsert(Hash);
+        new (GetSlots() + Slot) ElementType(std::forward<ArgsType>(Args)...);
+        return FSetElementId::FromInteger(Slot);
+    }
+
+    // ========================================================================
+    // Removing Elements
+    // ========================================================================
+
+    /**
+     * Removes an element by key
+     * @return Number of elements removed (0 or 1)
+     */
+    SizeType Remove(KeyInitType Key)
+    {
+        const int32 Slot = FindSlot(Key, HashKey(Key));
+        if (Slot != INDEX_NONE_VALUE)
+        {
+            EraseSlot(Slot);
+            return 1;
+        }
+        return 0;
+    }
+
+    /**
+     * Removes an element by ID
+     */
+    void RemoveById(FSetElementId Id)
+    {
+        if (Id.IsValidId() && IsSlotFull(Id.AsInteger()))
+        {
+            EraseSlot(Id.AsInteger());
+        }
+    }
+
+    // ========================================================================
+    // Finding Elements
+    // ========================================================================
+
+    /**
+     * Finds an element by key
+     * @return Pointer to element, or nullptr if not found
+     */
+    FORCEINLINE ElementType* Find(KeyInitType Key)
+    {
+        const int32 Slot = FindSlot(Key, HashKey(Key));
+        return Slot != INDEX_NONE_VALUE ? GetSlots() + Slot : nullptr;
+    }
+
+    /**
+     * Finds an element by key (const)
+     */
+    FORCEINLINE const ElementType* Find(KeyInitType Key) const
+    {
+        return const_cast<TFlatSet*>(this)->Find(Key);
+    }
+
+    /**
+     * Finds the ID of an element
+     * @return ID of element, or invalid ID if not found
+     */
+    FORCEINLINE FSetElementId FindId(KeyInitType Key) const
+    {
+        const int32 Slot = FindSlot(Key, HashKey(Key));
+        return Slot != INDEX_NONE_VALUE ? FSetElementId::FromInteger(Slot) : FSetElementId();
+    }
+
+    /**
+     * Checks if set contains an element with a key
+     */
+    FORCEINLINE bool Contains(KeyInitType Key) const
+    {
+        return FindSlot(Key, HashKey(Key)) != INDEX_NONE_VALUE;
+    }
+
+    // ========================================================================
+    // Memory Management
+    // ========================================================================
+
+    /**
+     * Empties the set
+     */
+    void Empty(SizeType ExpectedNumElements = 0)
+    {
+        DestructElements();
+        ReleaseTable();
+        Reserve(ExpectedNumElements);
+    }
+
+    /**
+     * Resets the set without deallocating
+     */
+    void Reset()
+    {
+        DestructElements();
+        if (Capacity > 0)
+        {
+            std::memset(GetCtrl(), FlatHashPrivate::CtrlEmpty, static_cast<size_t>(Capacity + GroupWidth));
+        }
+        NumElements = 0;
+        GrowthLeft = GetMaxLoad(Capacity);
+    }
+
+    /**
+     * Reserves capacity
+     */
+    void Reserve(SizeType ExpectedNumElements)
+    {
+        if (ExpectedNumElements > NumElements + GrowthLeft)
+        {
+            Rehash(GetCapacityFor(ExpectedNumElements));
+        }
+    }
+
+    /**
+     * Shrinks the set to fit its contents
+     */
+    void Shrink()
+    {
+        if (NumElements == 0)
+        {
+            ReleaseTable();
+            return;
+        }
+
+        const SizeType NewCapacity = GetCapacityFor(NumElements);
+        if (NewCapacity < Capacity)
+        {
+            Rehash(NewCapacity);
+        }
+    }
+
+    /**
+     * Compacts the set, clearing the tombstones left by removals
+     */
+    void Compact()
+    {
+        if (GetMaxLoad(Capacity) - NumElements - GrowthLeft > 0)
+        {
+            Rehash(Capacity);
+        }
+    }
+
+    // ========================================================================
+    // Element Access
+    // ========================================================================
+
+    /**
+     * Accesses element by ID
+     */
+    FORCEINLINE ElementType& operator[](FSetElementId Id)
+    {
+        return GetSlots()[Id.AsInteger()];
+    }
+
+    /**
+     * Accesses element by ID (const)
+     */
+    FORCEINLINE const ElementType& operator[](FSetElementId Id) const
+    {
+        return GetSlots()[Id.AsInteger()];
+    }
+
+    // ========================================================================
+    // Iteration
+    // ========================================================================
+
+    /**
+     * Iterator for set
+     */
+    class TIterator
+    {
+    public:
+        TIterator(TFlatSet& InSet)
+            : Set(InSet)
+            , Index(InSet.FindNextFullSlot(0))
+        {
+        }
+
+        TIterator& operator++()
+        {
+            Index = Set.FindNextFullSlot(Index + 1);
+            return *this;
+        }
+
+        FORCEINLINE explicit operator bool() const
+        {
+            return Index < Set.Capacity;
+        }
+
+        FORCEINLINE ElementType& operator*() const
+        {
+            return Set.GetSlots()[Index];
+        }
+
+        FORCEINLINE ElementType* operator->() const
+        {
+            return Set.GetSlots() + Index;
+        }
+
+        FORCEINLINE FSetElementId GetId() const
+        {
+            return FSetElementId::FromInteger(Index);
+        }
+
+        void RemoveCurrent()
+        {
+            Set.RemoveById(GetId());
+        }
+
+    private:
+        TFlatSet& Set;
+        int32 Index;
+    };
+
+    /**
+     * Const iterator for set
+     */
+    class TConstIterator
+    {
+    public:
+        TConstIterator(const TFlatSet& InSet)
+            : Set(InSet)
+            , Index(InSet.FindNextFullSlot(0))
+        {
+        }
+
+        TConstIterator& operator++()
+        {
+            Index = Set.FindNextFullSlot(Index + 1);
+            return *this;
+        }
+
+        FORCEINLINE explicit operator bool() const
+        {
+            return Index < Set.Capacity;
+        }
+
+        FORCEINLINE const ElementType& operator*() const
+        {
+            return Set.GetSlots()[Index];
+        }
+
+        FORCEINLINE const ElementType* operator->() const
+        {
+            return Set.GetSlots() + Index;
+        }
+
+        FORCEINLINE FSetElementId GetId() const
+        {
+            return FSetElementId::FromInteger(Index);
+        }
+
+    private:
+        const TFlatSet& Set;
+        int32 Index;
+    };
+
+    TIterator CreateIterator()
+    {
+        return TIterator(*this);
+    }
+
+    TConstIterator CreateConstIterator() const
+    {
+        return TConstIterator(*this);
+    }
+
+    // Range-based for loop support
+    class FElementIterator
+    {
+    public:
+        FElementIterator(TFlatSet* InSet, int32 InIndex)
+            : Set(InSet)
+            , Index(InIndex)
+        {
+        }
+
+        FElementIterator& operator++()
+        {
+            Index = Set->FindNextFullSlot(Index + 1);
+            return *this;
+        }
+
+        bool operator!=(const FElementIterator& Other) const
+        {
+            return Index != Other.Index;
+        }
+
+        ElementType& operator*() const
+        {
+            return Set->GetSlots()[Index];
+        }
+
+    private:
+        TFlatSet* Set;
+        int32 Index;
+    };
+
+    class FConstElementIterator
+    {
+    public:
+        FConstElementIterator(const TFlatSet* InSet, int32 InIndex)
+            : Set(InSet)
+            , Index(InIndex)
+        {
+        }
+
+        FConstElementIterator& operator++()
+        {
+            Index = Set->FindNextFullSlot(Index + 1);
+            return *this;
+        }
+
+        bool operator!=(const FConstElementIterator& Other) const
+        {
+            return Index != Other.Index;
+        }
+
+        const ElementType& operator*() const
+        {
+            return Set->GetSlots()[Index];
+        }
+
+    private:
+        const TFlatSet* Set;
+        int32 Index;
+    };
+
+    FElementIterator begin() { return FElementIterator(this, FindNextFullSlot(0)); }
+    FElementIterator end() { return FElementIterator(this, Capacity); }
+    FConstElementIterator begin() const { return FConstElementIterator(this, FindNextFullSlot(0)); }
+    FConstElementIterator end() const { return FConstElementIterator(this, Capacity); }
+
+    // ========================================================================
+    // Set Operations
+    // ========================================================================
+
+    /**
+     * Returns intersection of this set with another
+     */
+    TFlatSet Intersect(const TFlatSet& Other) const
+    {
+        TFlatSet Result;
+        for (const ElementType& Element : *this)
+        {
+            if (Other.Contains(ActualKeyFuncs::GetSetKey(Element)))
+            {
+                Result.Add(Element);
+            }
+        }
+        return Result;
+    }
+
+    /**
+     * Returns union of this set with another
+     */
+    TFlatSet Union(const TFlatSet& Other) const
+    {
+        TFlatSet Result = *this;
+        for (const ElementType& Element : Other)
+        {
+            Result.Add(Element);
+        }
+        return Result;
+    }
+
+    /**
+     * Returns difference of this set with another (elements in this but not in other)
+     */
+    TFlatSet Difference(const TFlatSet& Other) const
+    {
+        TFlatSet Result;
+        for (const ElementType& Element : *this)
+        {
+            if (!Other.Contains(ActualKeyFuncs::GetSetKey(Element)))
+            {
+                Result.Add(Element);
+            }
+        }
+        return Result;
+    }
+
+    // ========================================================================
+    // Comparison
+    // ========================================================================
+
+    /**
+     * Equality comparison
+     */
+    bool operator==(const TFlatSet& Other) const
+    {
+        if (Num() != Other.Num())
+        {
+            return false;
+        }
+
+        for (const ElementType& Element : *this)
+        {
+            if (!Other.Contains(ActualKeyFuncs::GetSetKey(Element)))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Inequality comparison
+     */
+    bool operator!=(const TFlatSet& Other) const
+    {
+        return !(*this == Other);
+    }
+
+private:
+    // ========================================================================
+    // Internal Helpers
+    // ========================================================================
+
+    /**
+     * Spreads the 32-bit key hash over 64 bits: H1 (high half) picks the
+     * first group, H2 (7 bits below it) is stored in the control byte
+     */
+    static FORCEINLINE uint64 HashKey(KeyInitType Key)
+    {
+        return static_cast<uint64>(ActualKeyFuncs::GetKeyHash(Key)) * 0x9E3779B97F4A7C15ull;
+    }
+
+    static FORCEINLINE uint32 GetH1(uint64 Hash)
+    {
+        return static_cast<uint32>(Hash >> 32);
+    }
+
+    static FORCEINLINE uint8 GetH2(uint64 Hash)
+    {
+        return static_cast<uint8>((Hash >> 25) & 0x7F);
+    }
+
+    /** Elements a table of Capacity slots holds before it grows */
+    static FORCEINLINE SizeType GetMaxLoad(SizeType InCapacity)
+    {
+        return InCapacity - InCapacity / 8;
+    }
+
+    static SizeType GetCapacityFor(SizeType InNumElements)
+    {
+        SizeType NewCapacity = MinCapacity;
+        while (GetMaxLoad(NewCapacity) < InNumElements)
+        {
+            NewCapacity *= 2;
+        }
+        return NewCapacity;
+    }
+
+    static FORCEINLINE size_t GetSlotsOffset(SizeType InCapacity)
+    {
+        const size_t CtrlBytes = static_cast<size_t>(InCapacity + GroupWidth);
+        return (CtrlBytes + alignof(ElementType) - 1) & ~(alignof(ElementType) - 1);
+    }
+
+    static FORCEINLINE size_t GetTableBytes(SizeType InCapacity)
+    {
+        return GetSlotsOffset(InCapacity) + static_cast<size_t>(InCapacity) * sizeof(ElementType);
+    }
+
+    FORCEINLINE uint8* GetCtrl() const
+    {
+        return Data.GetAllocation();
+    }
+
+    FORCEINLINE ElementType* GetSlots() const
+    {
+        return reinterpret_cast<ElementType*>(Data.GetAllocation() + GetSlotsOffset(Capacity));
+    }
+
+    FORCEINLINE bool IsSlotFull(int32 Slot) const
+    {
+        return Slot < Capacity && GetCtrl()[Slot] < FlatHashPrivate::CtrlEmpty;
+    }
+
+    /** Writes a control byte and its mirror past the end */
+    static FORCEINLINE void SetCtrl(uint8* Ctrl, SizeType InCapacity, int32 Slot, uint8 Value)
+    {
+        Ctrl[Slot] = Value;
+        if (Slot < GroupWidth)
+        {
+            Ctrl[InCapacity + Slot] = Value;
+        }
+    }
+
+    FORCEINLINE int32 FindSlot(KeyInitType Key, uint64 Hash) const
+    {
+        if (NumElements == 0)
+        {
+            return INDEX_NONE_VALUE;
+        }
+
+        const uint8* Ctrl = GetCtrl();
+        const ElementType* Slots = GetSlots();
+        const uint32 Mask = static_cast<uint32>(Capacity - 1);
+        const uint8 H2 = GetH2(Hash);
+        uint32 Pos = GetH1(Hash) & Mask;
+        uint32 Stride = 0;
+
+        while (true)
+        {
+            const FlatHashPrivate::FGroup Group(Ctrl + Pos);
+            for (uint32 Matches = Group.Match(H2); Matches != 0; Matches &= Matches - 1)
+            {
+                const uint32 Slot = (Pos + FlatHashPrivate::CountTrailingZeros(Matches)) & Mask;
+                if (ActualKeyFuncs::Matches(ActualKeyFuncs::GetSetKey(Slots[Slot]), Key))
+                {
+                    return static_cast<int32>(Slot);
+                }
+            }
+            if (Group.MatchEmpty() != 0)
+            {
+                return INDEX_NONE_VALUE;
+            }
+            Stride += GroupWidth;
+            Pos = (Pos + Stride) & Mask;
+        }
+    }
+
+    /** First empty or deleted slot on the probe sequence of Hash */
+    static FORCEINLINE int32 FindFirstNonFull(const uint8* Ctrl, SizeType InCapacity, uint64 Hash)
+    {
+        const uint32 Mask = static_cast<uint32>(InCapacity - 1);
+        uint32 Pos = GetH1(Hash) & Mask;
+        uint32 Stride = 0;
+
+        while (true)
+        {
+            const uint32 Free = FlatHashPrivate::FGroup(Ctrl + Pos).MatchEmptyOrDeleted();
+            if (Free != 0)
+            {
+                return static_cast<int32>((Pos + FlatHashPrivate::CountTrailingZeros(Free)) & Mask);
+            }
+            Stride += GroupWidth;
+            Pos = (Pos + Stride) & Mask;
+        }
+    }
+
+    /** Claims a slot for a new element of Hash, growing first if needed */
+    int32 PrepareInsert(uint64 Hash)
+    {
+        if (Capacity == 0)
+        {
+            Rehash(MinCapacity);
+        }
+
+        int32 Slot = FindFirstNonFull(GetCtrl(), Capacity, Hash);
+
+        // Reusing a tombstone costs no growth; an empty slot needs headroom
+        if (GrowthLeft == 0 && GetCtrl()[Slot] == FlatHashPrivate::CtrlEmpty)
+        {
+            // Mostly tombstones: clean them up in place instead of doubling
+            Rehash(NumElements * 2 <= GetMaxLoad(Capacity) ? Capacity : Capacity * 2);
+            Slot = FindFirstNonFull(GetCtrl(), Capacity, Hash);
+        }
+
+        GrowthLeft -= GetCtrl()[Slot] == FlatHashPrivate::CtrlEmpty ? 1 : 0;
+        SetCtrl(GetCtrl(), Capacity, Slot, GetH2(Hash));
+        ++NumElements;
+        return Slot;
+    }
+
+    void EraseSlot(int32 Slot)
+    {
+        using namespace FlatHashPrivate;
+
+        uint8* Ctrl = GetCtrl();
+        GetSlots()[Slot].~ElementType();
+        --NumElements;
+
+        // The slot can become empty again if no probe ever passed over it, which is
+        // the case when the run of non-empty slots around it is shorter than a group
+        const uint32 Mask = static_cast<uint32>(Capacity - 1);
+        const uint32 EmptyBefore = FGroup(Ctrl + ((static_cast<uint32>(Slot) - GroupWidth) & Mask)).MatchEmpty();
+        const uint32 EmptyAfter = FGroup(Ctrl + Slot).MatchEmpty();
+        const bool bWasNeverFull = EmptyBefore != 0 && EmptyAfter != 0 &&
+            CountTrailingZeros(EmptyAfter) + CountLeadingZerosInGroup(EmptyBefore) < static_cast<uint32>(GroupWidth);
+
+        SetCtrl(Ctrl, Capacity, Slot, bWasNeverFull ? CtrlEmpty : CtrlDeleted);
+        GrowthLeft += bWasNeverFull ? 1 : 0;
+    }
+
+    int32 FindNextFullSlot(int32 Slot) const
+    {
+        while (Slot < Capacity)
+        {
+            const uint32 Full = FlatHashPrivate::FGroup(GetCtrl() + Slot).MatchFull();
+            if (Full != 0)
+            {
+                // A hit in the mirrored bytes means no full slot is left
+                const int32 Found = Slot + static_cast<int32>(FlatHashPrivate::CountTrailingZeros(Full));
+                return Found < Capacity ? Found : Capacity;
+            }
+            Slot += GroupWidth;
+        }
+        return Capacity;
+    }
+
+    /** Moves every element into a fresh table of NewCapacity slots */
+    void Rehash(SizeType NewCapacity)
+    {
+        AllocatorType NewData;
+        NewData.ResizeAllocation(0, static_cast<SizeType>(GetTableBytes(NewCapacity)), sizeof(uint8), static_cast<uint32>(alignof(ElementType)));
+
+        uint8* NewCtrl = NewData.GetAllocation();
+        ElementType* NewSlots = reinterpret_cast<ElementType*>(NewCtrl + GetSlotsOffset(NewCapacity));
+        std::memset(NewCtrl, FlatHashPrivate::CtrlEmpty, static_cast<size_t>(NewCapacity + GroupWidth));
+
+        if (NumElements > 0)
+        {
+            ElementType* Slots = GetSlots();
+            for (int32 Slot = FindNextFullSlot(0); Slot < Capacity; Slot = FindNextFullSlot(Slot + 1))
+            {
+                const uint64 Hash = HashKey(ActualKeyFuncs::GetSetKey(Slots[Slot]));
+                const int32 NewSlot = FindFirstNonFull(NewCtrl, NewCapacity, Hash);
+                SetCtrl(NewCtrl, NewCapacity, NewSlot, GetH2(Hash));
+                new (NewSlots + NewSlot) ElementType(std::move(Slots[Slot]));
+                Slots[Slot].~ElementType();
+            }
+        }
+
+        // MoveToEmpty releases the old table
+        Data.MoveToEmpty(NewData);
+        Capacity = NewCapacity;
+        GrowthLeft = GetMaxLoad(NewCapacity) - NumElements;
+    }
+
+    void DestructElements()
+    {
+        if (NumElements > 0)
+        {
+            if constexpr (!std::is_trivially_destructible_v<ElementType>)
+            {
+                ElementType* Slots = GetSlots();
+                for (int32 Slot = FindNextFullSlot(0); Slot < Capacity; Slot = FindNextFullSlot(Slot + 1))
+                {
+                    Slots[Slot].~ElementType();
+                }
+            }
+            NumElements = 0;
+        }
+    }
+
+    /** Frees the table; elements must already be destroyed */
+    void ReleaseTable()
+    {
+        if (Capacity > 0)
+        {
+            Data.ResizeAllocation(static_cast<SizeType>(GetTableBytes(Capacity)), 0, sizeof(uint8));
+        }
+        Capacity = 0;
+        GrowthLeft = 0;
+    }
+
+    void CopyElementsFrom(const TFlatSet& Other)
+    {
+        Reserve(Other.Num());
+        for (const ElementType& Element : Other)
+        {
+            const int32 Slot = PrepareInsert(HashKey(ActualKeyFuncs::GetSetKey(Element)));
+            new (GetSlots() + Slot) ElementType(Element);
+        }
+    }
+
+    void MoveFrom(TFlatSet& Other)
+    {
+        Data.MoveToEmpty(Other.Data);
+        Capacity = Other.Capacity;
+        NumElements = Other.NumElements;
+        GrowthLeft = Other.GrowthLeft;
+        Other.Capacity = 0;
+        Other.NumElements = 0;
+        Other.GrowthLeft = 0;
+    }
+
+private:
+    /** Control bytes, then element slots */
+    AllocatorType Data;
+
+    /** Number of slots, zero or a power of two of at least GroupWidth */
+    SizeType Capacity = 0;
+
+    SizeType NumElements = 0;
+
+    /** Empty slots that can still be filled before the table must grow */
+    SizeType GrowthLeft = 0;
+};
+
+} // namespace MonsterEngine
@@ -9,8 +9,8 @@
  * FName provides a globally unique, case-insensitive name system with:
  * - Flyweight pattern: All identical strings share the same entry
  * - O(1) comparison: Names are compared by index, not string content
- * - Thread-safe name table
- * - Number suffix support (e.g., "Actor_5")
+ * - Thread-safe name table with lock-free lookups
+ * - Number suffix support (e.g., "Actor_5" shares the "Actor" entry)
  */
 
 #include "Core/CoreTypes.h"
@@ -22,8 +22,8 @@
 #include "Map.h"
 
 #include <atomic>
+#include <cstring>
 #include <mutex>
-#include <shared_mutex>
 #include <string>
 
 namespace MonsterEngine
@@ -99,61 +99,61 @@ private:
 // FNameEntry
 // ============================================================================
 
+/** Maximum name length including the terminator; longer names are truncated */
+enum { NAME_SIZE = 1024 };
+
 /**
  * A global deduplicated name stored in the name table
+ *
+ * Entries live in the name pool's block arena: this header is followed by the
+ * null-terminated characters, ANSI when every character fits in a byte and
+ * wide otherwise. Entries are immutable and never freed.
  */
 class FNameEntry
 {
 public:
     /**
-     * Returns the name string
+     * Returns true if the characters are stored wide
      */
-    const std::wstring& GetString() const { return NameString; }
+    FORCEINLINE bool IsWide() const { return bIsWide != 0; }
     
     /**
-     * Returns the lowercase version for comparison
+     * Returns the name length
      */
-    const std::wstring& GetComparisonString() const { return ComparisonString; }
+    FORCEINLINE int32 GetNameLength() const { return Len; }
     
     /**
-     * Returns the name length
+     * Returns the case-insensitive hash computed when the entry was added
+     */
+    FORCEINLINE uint32 GetHash() const { return Hash; }
+    
+    /**
+     * Returns the characters of an ANSI entry
+     */
+    FORCEINLINE const ANSICHAR* GetAnsiName() const { return reinterpret_cast<const ANSICHAR*>(this + 1); }
+    
+    /**
+     * Returns the characters of a wide entry
      */
-    int32 GetNameLength() const { return static_cast<int32>(NameString.length()); }
+    FORCEINLINE const WIDECHAR* GetWideName() const { return reinterpret_cast<const WIDECHAR*>(this + 1); }
     
     /**
      * Appends name to FString
      */
-    void AppendNameToString(FString& OutString) const
-    {
-        OutString.Append(NameString.c_str());
-    }
+    void AppendNameToString(FString& OutString) const;
     
     /**
      * Returns name as FString
      */
-    FString GetPlainNameString() const
-    {
-        return FString(NameString.c_str());
-    }
+    FString GetPlainNameString() const;
     
-public:
-    // Public constructor to allow make_unique (FNamePool controls access)
-    explicit FNameEntry(const std::wstring& InName)
-        : NameString(InName)
-    {
-        // Create lowercase comparison string
-        ComparisonString = InName;
-        for (wchar_t& C : ComparisonString)
-        {
-            if (C >= L'A' && C <= L'Z')
-            {
-                C += L'a' - L'A';
-            }
-        }
-    }
+private:
+    friend class FNamePool;
     
-    std::wstring NameString;
-    std::wstring ComparisonString;
+    uint32 Hash;
+    uint16 Len;
+    uint8 bIsWide;
+    uint8 Padding;
 };
 
 // ============================================================================
@@ -162,7 +162,16 @@ public:
 
 /**
  * Global name pool (singleton)
- * Stores all unique name entries and provides thread-safe access
+ *
+ * Based on UE5's FNamePool (Engine/Source/Runtime/Core/Private/UObject/UnrealNames.cpp):
+ * - Entries are bump-allocated in 256KB blocks; an entry id is its block
+ *   index and offset, so resolving an id never takes a lock
+ * - Lookups hash the name case-insensitively once, pick one of NumShards
+ *   shards from the top hash bits and probe its open-addressing slot table
+ *   without locking; every slot holds the full hash next to the entry id
+ * - Only adding a name locks, and only its shard (plus the arena briefly).
+ *   Grown slot tables are retired, not freed, so concurrent readers that
+ *   still hold the old table stay valid
  */
 class FNamePool
 {
@@ -170,91 +179,23 @@ public:
     /**
      * Gets the singleton instance
      */
-    static FNamePool& Get()
-    {
-        static FNamePool Instance;
-        return Instance;
-    }
+    static FNamePool& Get();
     
     /**
      * Finds or adds a name entry
      * @return Entry ID for the name
      */
-    FNameEntryId FindOrAdd(const wchar_t* Name)
-    {
-        if (!Name || !*Name)
-        {
-            return FNameEntryId(); // NAME_None
-        }
-        
-        // Create comparison key (lowercase)
-        std::wstring ComparisonKey = Name;
-        for (wchar_t& C : ComparisonKey)
-        {
-            if (C >= L'A' && C <= L'Z')
-            {
-                C += L'a' - L'A';
-            }
-        }
-        
-        // Try read lock first (fast path)
-        {
-            std::shared_lock<std::shared_mutex> ReadLock(Mutex);
-            const uint32* FoundIndex = NameToIndex.Find(ComparisonKey);
-            if (FoundIndex)
-            {
-                return FNameEntryId::FromUnstableInt(*FoundIndex);
-            }
-        }
-        
-        // Need to add - acquire write lock
-        std::unique_lock<std::shared_mutex> WriteLock(Mutex);
-        
-        // Double-check after acquiring write lock
-        const uint32* FoundIndex = NameToIndex.Find(ComparisonKey);
-        if (FoundIndex)
-        {
-            return FNameEntryId::FromUnstableInt(*FoundIndex);
-        }
-        
-        // Add new entry
-        uint32 NewIndex = static_cast<uint32>(Entries.Num());
-        Entries.Add(MakeUnique<FNameEntry>(Name));
-        NameToIndex[ComparisonKey] = NewIndex;
-        
-        return FNameEntryId::FromUnstableInt(NewIndex);
-    }
+    FNameEntryId FindOrAdd(const WIDECHAR* Name);
+    FNameEntryId FindOrAdd(const ANSICHAR* Name);
+    FNameEntryId FindOrAdd(const WIDECHAR* Name, int32 Len);
+    FNameEntryId FindOrAdd(const ANSICHAR* Name, int32 Len);
     
     /**
      * Finds a name entry without adding
-     * @return Entry ID, or invalid ID if not found
+     * @return Entry ID, or NAME_None if not found
      */
-    FNameEntryId Find(const wchar_t* Name) const
-    {
-        if (!Name || !*Name)
-        {
-            return FNameEntryId();
-        }
-        
-        // Create comparison key (lowercase)
-        std::wstring ComparisonKey = Name;
-        for (wchar_t& C : ComparisonKey)
-        {
-            if (C >= L'A' && C <= L'Z')
-            {
-                C += L'a' - L'A';
-            }
-        }
-        
-        std::shared_lock<std::shared_mutex> ReadLock(Mutex);
-        const uint32* FoundIndex = NameToIndex.Find(ComparisonKey);
-        if (FoundIndex)
-        {
-            return FNameEntryId::FromUnstableInt(*FoundIndex);
-        }
-        
-        return FNameEntryId();
-    }
+    FNameEntryId Find(const WIDECHAR* Name) const;
+    FNameEntryId Find(const ANSICHAR* Name) const;
     
     /**
      * Gets entry by ID
@@ -265,14 +206,7 @@ public:
         {
             return nullptr;
         }
-        
-        std::shared_lock<std::shared_mutex> ReadLock(Mutex);
-        uint32 Index = Id.ToUnstableInt();
-        if (Index < static_cast<uint32>(Entries.Num()))
-        {
-            return Entries[Index].Get();
-        }
-        return nullptr;
+        return &Resolve(Id);
     }
     
     /**
@@ -280,26 +214,64 @@ public:
      */
     int32 GetNumNames() const
     {
-        std::shared_lock<std::shared_mutex> ReadLock(Mutex);
-        return Entries.Num();
+        return NumNames.load(std::memory_order_relaxed);
     }
     
 private:
-    FNamePool()
+    static constexpr uint32 NumShardBits = 6;
+    static constexpr uint32 NumShards = 1u << NumShardBits;
+    static constexpr uint32 InitialShardCapacity = 256;
+    
+    static constexpr uint32 EntryStride = alignof(FNameEntry);
+    static constexpr uint32 BlockOffsetBits = 16;
+    static constexpr uint32 BlockSizeBytes = EntryStride << BlockOffsetBits;
+    static constexpr uint32 MaxBlocks = 8192;
+    
+    struct FSlotTable;
+    
+    struct alignas(64) FShard
     {
-        // Reserve entry 0 for NAME_None
-        Entries.Add(MakeUnique<FNameEntry>(L"None"));
-        NameToIndex[L"none"] = 0;
-    }
+        std::atomic<FSlotTable*> Table{nullptr};
+        std::mutex WriteLock;
+        uint32 NumUsed = 0;
+        TArray<FSlotTable*> Retired;
+    };
     
-    ~FNamePool() = default;
+    FNamePool();
+    ~FNamePool();
     
     FNamePool(const FNamePool&) = delete;
     FNamePool& operator=(const FNamePool&) = delete;
     
-    mutable std::shared_mutex Mutex;
-    TArray<TUniquePtr<FNameEntry>> Entries;
-    TMap<std::wstring, uint32> NameToIndex;
+    FORCEINLINE const FNameEntry& Resolve(FNameEntryId Id) const
+    {
+        const uint32 Value = Id.ToUnstableInt();
+        const uint8* Block = Blocks[Value >> BlockOffsetBits].load(std::memory_order_acquire);
+        return *reinterpret_cast<const FNameEntry*>(Block + (Value & ((1u << BlockOffsetBits) - 1)) * EntryStride);
+    }
+    
+    template<typename CharType>
+    FNameEntryId FindOrAddImpl(const CharType* Name, int32 Len);
+    
+    template<typename CharType>
+    FNameEntryId FindImpl(const CharType* Name) const;
+    
+    template<typename CharType>
+    bool FindInTable(const FSlotTable* Table, const CharType* Name, int32 Len, uint32 Hash, FNameEntryId& OutId) const;
+    
+    template<typename CharType>
+    FNameEntryId CreateEntry(const CharType* Name, int32 Len, uint32 Hash);
+    
+    FSlotTable* GrowShard(FShard& Shard);
+    
+    FShard Shards[NumShards];
+    std::atomic<int32> NumNames{0};
+    
+    // Entry arena, appended under ArenaLock; published blocks are read without it
+    std::mutex ArenaLock;
+    uint32 CurrentBlock = 0;
+    uint32 CurrentByteCursor = 0;
+    std::atomic<uint8*> Blocks[MaxBlocks] = {};
 };
 
 // ============================================================================
@@ -338,26 +310,24 @@ public:
     /**
      * Constructor from wide string
      */
-    FName(const wchar_t* Name)
+    FName(const WIDECHAR* Name)
         : Number(0)
     {
-        Init(Name);
+        if (Name)
+        {
+            Init(Name, static_cast<int32>(std::wcslen(Name)));
+        }
     }
     
     /**
-     * Constructor from ANSI string
+     * Constructor from ANSI string, stored without widening
      */
-    FName(const char* Name)
+    FName(const ANSICHAR* Name)
         : Number(0)
     {
-        if (Name && *Name)
+        if (Name)
         {
-            std::wstring Wide;
-            while (*Name)
-            {
-                Wide += static_cast<wchar_t>(static_cast<unsigned char>(*Name++));
-            }
-            Init(Wide.c_str());
+            Init(Name, static_cast<int32>(std::strlen(Name)));
         }
     }
     
@@ -367,35 +337,46 @@ public:
     FName(const FString& Name)
         : Number(0)
     {
-        Init(*Name);
+        Init(*Name, Name.Len());
     }
     
     /**
      * Constructor from std::string
      */
     FName(const std::string& Name)
-        : FName(Name.c_str())
+        : Number(0)
     {
+        Init(Name.c_str(), static_cast<int32>(Name.length()));
     }
     
     /**
      * Constructor from std::wstring
      */
     FName(const std::wstring& Name)
-        : FName(Name.c_str())
+        : Number(0)
     {
+        Init(Name.c_str(), static_cast<int32>(Name.length()));
     }
     
     /**
      * Constructor with explicit number
      */
-    FName(const wchar_t* Name, int32 InNumber)
+    FName(const WIDECHAR* Name, int32 InNumber)
         : Number(InNumber)
     {
         // Don't parse number from string, use provided number
         ComparisonIndex = FNamePool::Get().FindOrAdd(Name);
     }
     
+    /**
+     * Constructor with explicit number (ANSI)
+     */
+    FName(const ANSICHAR* Name, int32 InNumber)
+        : Number(InNumber)
+    {
+        ComparisonIndex = FNamePool::Get().FindOrAdd(Name);
+    }
+    
     /**
      * Copy constructor
      */
@@ -575,52 +556,53 @@ public:
     }
     
 private:
-    void Init(const wchar_t* Name)
+    template<typename CharType>
+    void Init(const CharType* Name, int32 Len)
+    {
+        // "Actor_5" is stored as "Actor" with number 5, so numbered names share one entry
+        Number = SplitNumberSuffix(Name, Len);
+        ComparisonIndex = FNamePool::Get().FindOrAdd(Name, Len);
+    }
+    
+    /**
+     * Strips a "_<digits>" suffix that prints back identically
+     * (no leading zeros, fits in int32) and returns it as an internal number
+     * @return External number + 1, or 0 if the name keeps its suffix
+     */
+    template<typename CharType>
+    static int32 SplitNumberSuffix(const CharType* Name, int32& InOutLen)
     {
-        if (!Name || !*Name)
+        constexpr int32 MaxDigits = 10;
+        
+        int32 NumDigits = 0;
+        while (NumDigits < InOutLen && NumDigits <= MaxDigits &&
+               Name[InOutLen - 1 - NumDigits] >= '0' && Name[InOutLen - 1 - NumDigits] <= '9')
         {
-            ComparisonIndex = FNameEntryId();
-            Number = 0;
-            return;
+            ++NumDigits;
         }
         
-        // Check for number suffix (e.g., "Actor_5")
-        std::wstring NameStr = Name;
-        size_t UnderscorePos = NameStr.rfind(L'_');
+        const int32 UnderscoreIndex = InOutLen - 1 - NumDigits;
+        if (NumDigits == 0 || NumDigits > MaxDigits || UnderscoreIndex < 1 || Name[UnderscoreIndex] != '_')
+        {
+            return 0;
+        }
+        if (NumDigits > 1 && Name[UnderscoreIndex + 1] == '0')
+        {
+            return 0;
+        }
         
-        if (UnderscorePos != std::wstring::npos && UnderscorePos < NameStr.length() - 1)
+        int64 Value = 0;
+        for (int32 i = UnderscoreIndex + 1; i < InOutLen; ++i)
         {
-            // Check if everything after underscore is a number
-            bool bIsNumber = true;
-            int32 ParsedNumber = 0;
-            
-            for (size_t i = UnderscorePos + 1; i < NameStr.length(); ++i)
-            {
-                wchar_t C = NameStr[i];
-                if (C >= L'0' && C <= L'9')
-                {
-                    ParsedNumber = ParsedNumber * 10 + (C - L'0');
-                }
-                else
-                {
-                    bIsNumber = false;
-                    break;
-                }
-            }
-            
-            if (bIsNumber)
-            {
-                // Split name and number
-                std::wstring BaseName = NameStr.substr(0, UnderscorePos);
-                ComparisonIndex = FNamePool::Get().FindOrAdd(BaseName.c_str());
-                Number = ParsedNumber + 1; // Internal number is external + 1
-                return;
-            }
+            Value = Value * 10 + (Name[i] - '0');
+        }
+        if (Value >= 0x7FFFFFFF)
+        {
+            return 0;
         }
         
-        // No number suffix
-        ComparisonIndex = FNamePool::Get().FindOrAdd(Name);
-        Number = 0;
+        InOutLen = UnderscoreIndex;
+        return static_cast<int32>(Value) + 1;
     }
     
     FNameEntryId ComparisonIndex;
@@ -231,7 +231,7 @@ public:
  * 
  * @tparam InElementType The type of elements
  * @tparam KeyFuncs Functions for getting keys and hashing (defaults to using element as key)
- * @tparam Allocator The allocator policy
+ * @tparam Allocator The allocator policy for the elements and the hash
  */
 template<typename InElementType, typename KeyFuncs, typename Allocator>
 class TSet
@@ -249,8 +249,8 @@ private:
     >;
     
     using SetElementType = TSetElement<ElementType>;
-    using ElementArrayType = TSparseArray<SetElementType, FDefaultSparseArrayAllocator>;
-    using HashType = TArray<FSetElementId, typename Allocator::template ForElementType<FSetElementId>>;
+    using ElementArrayType = TSparseArray<SetElementType, TSparseArrayAllocator<Allocator, Allocator>>;
+    using HashType = TArray<FSetElementId, Allocator>;
     
 public:
     // ========================================================================
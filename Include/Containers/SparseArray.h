@@ -53,6 +53,17 @@ public:
     using BitArrayAllocator = FDefaultBitArrayAllocator;
 };
 
+/**
+ * Sparse array allocator built from an element and a bit array allocator policy
+ */
+template<typename InElementAllocator = FDefaultAllocator, typename InBitArrayAllocator = FDefaultBitArrayAllocator>
+class TSparseArrayAllocator
+{
+public:
+    using ElementAllocator = InElementAllocator;
+    using BitArrayAllocator = InBitArrayAllocator;
+};
+
 // ============================================================================
 // TSparseArrayElementOrFreeListLink
 // ============================================================================
@@ -0,0 +1,830 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+#pragma once
+
+/**
+ * @file Utf8String.h
+ * @brief UTF-8 string and non-owning string views following UE5 FUtf8String patterns
+ *
+ * FUtf8String stores UTF-8 code units with the following features:
+ * - Strings of up to 23 code units live inline, without a heap allocation
+ * - Always null-terminated, so operator* passes straight to printf-style
+ *   logging and to file APIs that take UTF-8 paths
+ * - Converts to std::string_view, so std::string paths and log messages
+ *   are assigned from it without re-encoding
+ * - Explicit UTF-8 <-> FString (wide) conversion where a wide string is needed
+ *
+ * TStringView is a non-owning pointer and length that is not null-terminated.
+ *
+ * Reference: UE5 Engine/Source/Runtime/Core/Public/Containers/Utf8String.h
+ *            UE5 Engine/Source/Runtime/Core/Public/Containers/StringView.h
+ */
+
+#include "Core/CoreTypes.h"
+#include "Core/Templates/TypeHash.h"
+#include "ContainerFwd.h"
+#include "String.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace MonsterEngine
+{
+
+// ============================================================================
+// TStringView
+// ============================================================================
+
+/**
+ * Non-owning view of a contiguous run of characters
+ *
+ * The viewed characters must outlive the view. Views are not null-terminated,
+ * so use GetData() with Len() rather than passing GetData() as a C string.
+ */
+template<typename CharType>
+class TStringView
+{
+public:
+    using ElementType = CharType;
+    using SizeType = int32;
+
+    constexpr TStringView() = default;
+
+    constexpr TStringView(const CharType* InData, SizeType InLen)
+        : DataPtr(InData)
+        , Length(InLen)
+    {
+    }
+
+    /** Views a null-terminated string */
+    TStringView(const CharType* InData)
+        : DataPtr(InData)
+        , Length(InData ? static_cast<SizeType>(std::char_traits<CharType>::length(InData)) : 0)
+    {
+    }
+
+    TStringView(std::basic_string_view<CharType> InView)
+        : DataPtr(InView.data())
+        , Length(static_cast<SizeType>(InView.size()))
+    {
+    }
+
+    TStringView(const std::basic_string<CharType>& InString)
+        : DataPtr(InString.data())
+        , Length(static_cast<SizeType>(InString.size()))
+    {
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    FORCEINLINE constexpr const CharType* GetData() const { return DataPtr; }
+    FORCEINLINE constexpr SizeType Len() const { return Length; }
+    FORCEINLINE constexpr bool IsEmpty() const { return Length == 0; }
+
+    FORCEINLINE const CharType& operator[](SizeType Index) const
+    {
+        return DataPtr[Index];
+    }
+
+    FORCEINLINE operator std::basic_string_view<CharType>() const
+    {
+        return std::basic_string_view<CharType>(DataPtr, static_cast<size_t>(Length));
+    }
+
+    // ========================================================================
+    // Sub-views
+    // ========================================================================
+
+    TStringView Left(SizeType Count) const
+    {
+        return TStringView(DataPtr, ClampCount(Count));
+    }
+
+    TStringView LeftChop(SizeType Count) const
+    {
+        return TStringView(DataPtr, Length - ClampCount(Count));
+    }
+
+    TStringView Right(SizeType Count) const
+    {
+        const SizeType Clamped = ClampCount(Count);
+        return TStringView(DataPtr + Length - Clamped, Clamped);
+    }
+
+    TStringView RightChop(SizeType Count) const
+    {
+        const SizeType Clamped = ClampCount(Count);
+        return TStringView(DataPtr + Clamped, Length - Clamped);
+    }
+
+    TStringView Mid(SizeType Start, SizeType Count = INT32_MAX) const
+    {
+        const SizeType ClampedStart = ClampCount(Start);
+        const SizeType Available = Length - ClampedStart;
+        return TStringView(DataPtr + ClampedStart, Count < 0 ? 0 : (Count < Available ? Count : Available));
+    }
+
+    // ========================================================================
+    // Searching and comparison
+    // ========================================================================
+
+    /** Case-sensitive comparison; returns <0, 0 or >0 */
+    int32 Compare(TStringView Other) const
+    {
+        const SizeType MinLen = Length < Other.Length ? Length : Other.Length;
+        const int Result = MinLen > 0 ? std::char_traits<CharType>::compare(DataPtr, Other.DataPtr, static_cast<size_t>(MinLen)) : 0;
+        if (Result != 0)
+        {
+            return Result;
+        }
+        return Length < Other.Length ? -1 : (Length > Other.Length ? 1 : 0);
+    }
+
+    bool Equals(TStringView Other) const
+    {
+        return Length == Other.Length && (Length == 0 || std::char_traits<CharType>::compare(DataPtr, Other.DataPtr, static_cast<size_t>(Length)) == 0);
+    }
+
+    /** Compares ASCII letters case-insensitively; other code units must match exactly */
+    bool EqualsIgnoreCase(TStringView Other) const
+    {
+        if (Length != Other.Length)
+        {
+            return false;
+        }
+        for (SizeType i = 0; i < Length; ++i)
+        {
+            if (ToLowerAscii(DataPtr[i]) != ToLowerAscii(Other.DataPtr[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool StartsWith(TStringView Prefix) const
+    {
+        return Prefix.Length <= Length && Left(Prefix.Length).Equals(Prefix);
+    }
+
+    bool EndsWith(TStringView Suffix) const
+    {
+        return Suffix.Length <= Length && Right(Suffix.Length).Equals(Suffix);
+    }
+
+    /** @return Index of the first occurrence of Search at or after StartIndex, or INDEX_NONE */
+    SizeType Find(TStringView Search, SizeType StartIndex = 0) const
+    {
+        const std::basic_string_view<CharType> Self = *this;
+        const size_t Found = Self.find(std::basic_string_view<CharType>(Search), static_cast<size_t>(StartIndex < 0 ? 0 : StartIndex));
+        return Found == std::basic_string_view<CharType>::npos ? INDEX_NONE : static_cast<SizeType>(Found);
+    }
+
+    /** @return Index of the first occurrence of Char, or INDEX_NONE */
+    SizeType FindChar(CharType Char) const
+    {
+        for (SizeType i = 0; i < Length; ++i)
+        {
+            if (DataPtr[i] == Char)
+            {
+                return i;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    bool Contains(TStringView Search) const
+    {
+        return Find(Search) != INDEX_NONE;
+    }
+
+    friend bool operator==(TStringView A, TStringView B) { return A.Equals(B); }
+    friend bool operator<(TStringView A, TStringView B) { return A.Compare(B) < 0; }
+
+    /** FNV-1a over the code units; matches GetTypeHash of the null-terminated string */
+    friend uint32 GetTypeHash(TStringView View)
+    {
+        uint32 Hash = 2166136261u;
+        for (SizeType i = 0; i < View.Length; ++i)
+        {
+            Hash ^= static_cast<uint32>(View.DataPtr[i]);
+            Hash *= 16777619u;
+        }
+        return Hash;
+    }
+
+    // ========================================================================
+    // Iteration
+    // ========================================================================
+
+    FORCEINLINE const CharType* begin() const { return DataPtr; }
+    FORCEINLINE const CharType* end() const { return DataPtr + Length; }
+
+private:
+    FORCEINLINE SizeType ClampCount(SizeType Count) const
+    {
+        return Count < 0 ? 0 : (Count < Length ? Count : Length);
+    }
+
+    static FORCEINLINE CharType ToLowerAscii(CharType Char)
+    {
+        return (Char >= 'A' && Char <= 'Z') ? static_cast<CharType>(Char + ('a' - 'A')) : Char;
+    }
+
+    const CharType* DataPtr = nullptr;
+    SizeType Length = 0;
+};
+
+using FUtf8StringView = TStringView<UTF8CHAR>;
+using FWideStringView = TStringView<WIDECHAR>;
+using FStringView = TStringView<TCHAR>;
+
+// ============================================================================
+// UTF-8 Transcoding
+// ============================================================================
+
+namespace StringConv
+{
+    /** Replacement for code units that do not form a valid code point */
+    constexpr uint32 UnicodeReplacementChar = 0xFFFD;
+
+    /** Number of UTF-8 bytes needed to encode a code point */
+    FORCEINLINE int32 GetUtf8EncodedLength(uint32 CodePoint)
+    {
+        return CodePoint < 0x80 ? 1 : (CodePoint < 0x800 ? 2 : (CodePoint < 0x10000 ? 3 : 4));
+    }
+
+    /**
+     * Encodes a code point as UTF-8
+     * @return Number of bytes written to Dest (1-4)
+     */
+    FORCEINLINE int32 EncodeUtf8(uint32 CodePoint, UTF8CHAR* Dest)
+    {
+        if (CodePoint < 0x80)
+        {
+            Dest[0] = static_cast<UTF8CHAR>(CodePoint);
+            return 1;
+        }
+        if (CodePoint < 0x800)
+        {
+            Dest[0] = static_cast<UTF8CHAR>(0xC0 | (CodePoint >> 6));
+            Dest[1] = static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F));
+            return 2;
+        }
+        if (CodePoint < 0x10000)
+        {
+            Dest[0] = static_cast<UTF8CHAR>(0xE0 | (CodePoint >> 12));
+            Dest[1] = static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 6) & 0x3F));
+            Dest[2] = static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F));
+            return 3;
+        }
+        Dest[0] = static_cast<UTF8CHAR>(0xF0 | (CodePoint >> 18));
+        Dest[1] = static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 12) & 0x3F));
+        Dest[2] = static_cast<UTF8CHAR>(0x80 | ((CodePoint >> 6) & 0x3F));
+        Dest[3] = static_cast<UTF8CHAR>(0x80 | (CodePoint & 0x3F));
+        return 4;
+    }
+
+    /**
+     * Decodes one code point from UTF-8
+     * Overlong, surrogate and truncated sequences decode to U+FFFD and consume one byte.
+     * @param InOutIndex Index of the first byte; advanced past the decoded sequence
+     */
+    inline uint32 DecodeUtf8(const UTF8CHAR* Src, int32 Len, int32& InOutIndex)
+    {
+        const uint8 Lead = static_cast<uint8>(Src[InOutIndex]);
+        if (Lead < 0x80)
+        {
+            ++InOutIndex;
+            return Lead;
+        }
+
+        int32 NumTrail;
+        uint32 CodePoint;
+        uint32 MinCodePoint;
+        if ((Lead & 0xE0) == 0xC0)
+        {
+            NumTrail = 1; CodePoint = Lead & 0x1F; MinCodePoint = 0x80;
+        }
+        else if ((Lead & 0xF0) == 0xE0)
+        {
+            NumTrail = 2; CodePoint = Lead & 0x0F; MinCodePoint = 0x800;
+        }
+        else if ((Lead & 0xF8) == 0xF0)
+        {
+            NumTrail = 3; CodePoint = Lead & 0x07; MinCodePoint = 0x10000;
+        }
+        else
+        {
+            ++InOutIndex;
+            return UnicodeReplacementChar;
+        }
+
+        if (InOutIndex + NumTrail >= Len)
+        {
+            ++InOutIndex;
+            return UnicodeReplacementChar;
+        }
+        for (int32 i = 1; i <= NumTrail; ++i)
+        {
+            const uint8 Trail = static_cast<uint8>(Src[InOutIndex + i]);
+            if ((Trail & 0xC0) != 0x80)
+            {
+                ++InOutIndex;
+                return UnicodeReplacementChar;
+            }
+            CodePoint = (CodePoint << 6) | (Trail & 0x3F);
+        }
+        if (CodePoint < MinCodePoint || CodePoint > 0x10FFFF || (CodePoint >= 0xD800 && CodePoint <= 0xDFFF))
+        {
+            ++InOutIndex;
+            return UnicodeReplacementChar;
+        }
+        InOutIndex += NumTrail + 1;
+        return CodePoint;
+    }
+} // namespace StringConv
+
+// ============================================================================
+// FUtf8String
+// ============================================================================
+
+/**
+ * FUtf8String - Null-terminated UTF-8 string with inline storage for short strings
+ *
+ * Len() counts code units (bytes), not code points. Strings of up to
+ * InlineCapacity code units never allocate; longer ones grow geometrically
+ * on the heap and keep their capacity until Empty() or Shrink().
+ */
+class FUtf8String
+{
+public:
+    using ElementType = UTF8CHAR;
+    using SizeType = int32;
+
+    /** Code units stored without a heap allocation, excluding the terminator */
+    static constexpr SizeType InlineCapacity = 23;
+
+    // ========================================================================
+    // Constructors
+    // ========================================================================
+
+    FUtf8String()
+    {
+        InlineData[0] = '\0';
+    }
+
+    FUtf8String(const UTF8CHAR* Str)
+        : FUtf8String(FUtf8StringView(Str))
+    {
+    }
+
+    FUtf8String(const UTF8CHAR* Str, SizeType InLen)
+        : FUtf8String(FUtf8StringView(Str, InLen))
+    {
+    }
+
+    FUtf8String(FUtf8StringView View)
+    {
+        InlineData[0] = '\0';
+        Append(View);
+    }
+
+    FUtf8String(std::string_view Str)
+        : FUtf8String(FUtf8StringView(Str))
+    {
+    }
+
+    FUtf8String(const std::string& Str)
+        : FUtf8String(FUtf8StringView(Str))
+    {
+    }
+
+    /** Encodes a wide (UTF-16 or UTF-32, depending on wchar_t) string as UTF-8 */
+    explicit FUtf8String(FWideStringView Wide)
+    {
+        InlineData[0] = '\0';
+        AppendWide(Wide);
+    }
+
+    explicit FUtf8String(const WIDECHAR* Wide)
+        : FUtf8String(FWideStringView(Wide))
+    {
+    }
+
+    explicit FUtf8String(const FString& Str)
+        : FUtf8String(FWideStringView(*Str, Str.Len()))
+    {
+    }
+
+    FUtf8String(const FUtf8String& Other)
+        : FUtf8String(Other.ToView())
+    {
+    }
+
+    FUtf8String(FUtf8String&& Other) noexcept
+    {
+        MoveFrom(Other);
+    }
+
+    ~FUtf8String()
+    {
+        if (bOnHeap)
+        {
+            std::free(Heap.Data);
+        }
+    }
+
+    FUtf8String& operator=(const FUtf8String& Other)
+    {
+        if (this != &Other)
+        {
+            Assign(Other.ToView());
+        }
+        return *this;
+    }
+
+    FUtf8String& operator=(FUtf8String&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            if (bOnHeap)
+            {
+                std::free(Heap.Data);
+            }
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+
+    FUtf8String& operator=(FUtf8StringView View)
+    {
+        Assign(View);
+        return *this;
+    }
+
+    FUtf8String& operator=(const UTF8CHAR* Str)
+    {
+        Assign(FUtf8StringView(Str));
+        return *this;
+    }
+
+    FUtf8String& operator=(const std::string& Str)
+    {
+        Assign(FUtf8StringView(Str));
+        return *this;
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    /** @return Null-terminated UTF-8 characters, valid until the string is modified */
+    FORCEINLINE const UTF8CHAR* operator*() const { return GetData(); }
+
+    FORCEINLINE const UTF8CHAR* GetCharArray() const { return GetData(); }
+    FORCEINLINE UTF8CHAR* GetCharArray() { return GetData(); }
+
+    /** @return Number of code units, excluding the terminator */
+    FORCEINLINE SizeType Len() const { return Length; }
+    FORCEINLINE bool IsEmpty() const { return Length == 0; }
+
+    /** @return Code units that fit before the string allocates (again) */
+    FORCEINLINE SizeType GetCapacity() const { return bOnHeap ? Heap.Capacity : InlineCapacity; }
+
+    /** @return Heap bytes owned by the string */
+    FORCEINLINE SIZE_T GetAllocatedSize() const { return bOnHeap ? static_cast<SIZE_T>(Heap.Capacity) + 1 : 0; }
+
+    FORCEINLINE bool IsValidIndex(SizeType Index) const { return Index >= 0 && Index < Length; }
+
+    FORCEINLINE UTF8CHAR& operator[](SizeType Index)
+    {
+        return GetData()[Index];
+    }
+
+    FORCEINLINE const UTF8CHAR& operator[](SizeType Index) const
+    {
+        return GetData()[Index];
+    }
+
+    FORCEINLINE FUtf8StringView ToView() const { return FUtf8StringView(GetData(), Length); }
+    FORCEINLINE operator FUtf8StringView() const { return ToView(); }
+
+    /** Lets std::string parameters (file paths, log text) be assigned without re-encoding */
+    FORCEINLINE operator std::string_view() const { return std::string_view(GetData(), static_cast<size_t>(Length)); }
+
+    std::string ToStdString() const { return std::string(GetData(), static_cast<size_t>(Length)); }
+
+    /** Decodes to a wide FString; invalid sequences become U+FFFD */
+    FString ToString() const
+    {
+        std::wstring Wide;
+        Wide.reserve(static_cast<size_t>(Length));
+        for (SizeType Index = 0; Index < Length;)
+        {
+            const uint32 CodePoint = StringConv::DecodeUtf8(GetData(), Length, Index);
+            if (sizeof(WIDECHAR) == 2 && CodePoint >= 0x10000)
+            {
+                Wide.push_back(static_cast<WIDECHAR>(0xD800 + ((CodePoint - 0x10000) >> 10)));
+                Wide.push_back(static_cast<WIDECHAR>(0xDC00 + ((CodePoint - 0x10000) & 0x3FF)));
+            }
+            else
+            {
+                Wide.push_back(static_cast<WIDECHAR>(CodePoint));
+            }
+        }
+        return FString(std::wstring_view(Wide));
+    }
+
+    // ========================================================================
+    // Modification
+    // ========================================================================
+
+    /** Ensures room for NumChars code units without reallocating */
+    void Reserve(SizeType NumChars)
+    {
+        if (NumChars > GetCapacity())
+        {
+            Realloc(NumChars);
+        }
+    }
+
+    /** Clears the string, keeping at most Slack code units of capacity */
+    void Empty(SizeType Slack = 0)
+    {
+        Length = 0;
+        if (bOnHeap && Slack <= InlineCapacity)
+        {
+            std::free(Heap.Data);
+            bOnHeap = false;
+        }
+        else if (Slack > InlineCapacity && Slack != GetCapacity())
+        {
+            Realloc(Slack);
+        }
+        GetData()[0] = '\0';
+    }
+
+    /** Clears the string, keeping its capacity */
+    void Reset()
+    {
+        Length = 0;
+        GetData()[0] = '\0';
+    }
+
+    /** Releases unused heap capacity, moving back inline when the string fits */
+    void Shrink()
+    {
+        if (bOnHeap && Length < Heap.Capacity)
+        {
+            if (Length <= InlineCapacity)
+            {
+                UTF8CHAR* OldData = Heap.Data;
+                std::memcpy(InlineData, OldData, static_cast<size_t>(Length) + 1);
+                std::free(OldData);
+                bOnHeap = false;
+            }
+            else
+            {
+                Realloc(Length);
+            }
+        }
+    }
+
+    FUtf8String& Append(FUtf8StringView View)
+    {
+        const SizeType AppendLen = View.Len();
+        if (AppendLen > 0)
+        {
+            const SizeType NewLen = Length + AppendLen;
+            if (NewLen > GetCapacity())
+            {
+                // The view may point into this string; grow before copying only when it does not
+                if (View.GetData() >= GetData() && View.GetData() <= GetData() + Length)
+                {
+                    FUtf8String Copy(View);
+                    return Append(Copy.ToView());
+                }
+                Grow(NewLen);
+            }
+            std::memmove(GetData() + Length, View.GetData(), static_cast<size_t>(AppendLen));
+            Length = NewLen;
+            GetData()[Length] = '\0';
+        }
+        return *this;
+    }
+
+    FUtf8String& Append(const UTF8CHAR* Str, SizeType Count)
+    {
+        return Append(FUtf8StringView(Str, Count));
+    }
+
+    FUtf8String& AppendChar(UTF8CHAR Char)
+    {
+        if (Length + 1 > GetCapacity())
+        {
+            Grow(Length + 1);
+        }
+        UTF8CHAR* Data = GetData();
+        Data[Length++] = Char;
+        Data[Length] = '\0';
+        return *this;
+    }
+
+    /** Appends a code point as UTF-8 */
+    FUtf8String& AppendCodePoint(uint32 CodePoint)
+    {
+        UTF8CHAR Encoded[4];
+        const int32 EncodedLen = StringConv::EncodeUtf8(CodePoint, Encoded);
+        return Append(FUtf8StringView(Encoded, EncodedLen));
+    }
+
+    /** Appends a wide string, encoding it as UTF-8; unpaired surrogates become U+FFFD */
+    FUtf8String& AppendWide(FWideStringView Wide)
+    {
+        SizeType EncodedLen = 0;
+        for (SizeType i = 0; i < Wide.Len(); ++i)
+        {
+            EncodedLen += StringConv::GetUtf8EncodedLength(static_cast<uint32>(Wide[i]));
+        }
+        Reserve(Length + EncodedLen);
+
+        for (SizeType i = 0; i < Wide.Len(); ++i)
+        {
+            uint32 CodePoint = static_cast<uint32>(Wide[i]);
+            if (CodePoint >= 0xD800 && CodePoint <= 0xDFFF)
+            {
+                const bool bHighSurrogate = CodePoint <= 0xDBFF;
+                const uint32 Next = i + 1 < Wide.Len() ? static_cast<uint32>(Wide[i + 1]) : 0;
+                if (sizeof(WIDECHAR) == 2 && bHighSurrogate && Next >= 0xDC00 && Next <= 0xDFFF)
+                {
+                    CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Next - 0xDC00);
+                    ++i;
+                }
+                else
+                {
+                    CodePoint = StringConv::UnicodeReplacementChar;
+                }
+            }
+            else if (CodePoint > 0x10FFFF)
+            {
+                CodePoint = StringConv::UnicodeReplacementChar;
+            }
+            AppendCodePoint(CodePoint);
+        }
+        return *this;
+    }
+
+    FUtf8String& operator+=(FUtf8StringView View) { return Append(View); }
+    FUtf8String& operator+=(const FUtf8String& Other) { return Append(Other.ToView()); }
+    FUtf8String& operator+=(const UTF8CHAR* Str) { return Append(FUtf8StringView(Str)); }
+    FUtf8String& operator+=(UTF8CHAR Char) { return AppendChar(Char); }
+
+    friend FUtf8String operator+(const FUtf8String& A, FUtf8StringView B)
+    {
+        FUtf8String Result;
+        Result.Reserve(A.Len() + B.Len());
+        Result.Append(A.ToView());
+        Result.Append(B);
+        return Result;
+    }
+
+    friend FUtf8String operator+(FUtf8String&& A, FUtf8StringView B)
+    {
+        A.Append(B);
+        return std::move(A);
+    }
+
+    friend FUtf8String operator+(FUtf8StringView A, const FUtf8String& B)
+    {
+        FUtf8String Result;
+        Result.Reserve(A.Len() + B.Len());
+        Result.Append(A);
+        Result.Append(B.ToView());
+        return Result;
+    }
+
+    // ========================================================================
+    // Searching and comparison
+    // ========================================================================
+
+    bool Equals(FUtf8StringView Other) const { return ToView().Equals(Other); }
+    bool EqualsIgnoreCase(FUtf8StringView Other) const { return ToView().EqualsIgnoreCase(Other); }
+    int32 Compare(FUtf8StringView Other) const { return ToView().Compare(Other); }
+
+    bool StartsWith(FUtf8StringView Prefix) const { return ToView().StartsWith(Prefix); }
+    bool EndsWith(FUtf8StringView Suffix) const { return ToView().EndsWith(Suffix); }
+    bool Contains(FUtf8StringView Search) const { return ToView().Contains(Search); }
+    SizeType Find(FUtf8StringView Search, SizeType StartIndex = 0) const { return ToView().Find(Search, StartIndex); }
+
+    FUtf8String Left(SizeType Count) const { return FUtf8String(ToView().Left(Count)); }
+    FUtf8String Right(SizeType Count) const { return FUtf8String(ToView().Right(Count)); }
+    FUtf8String Mid(SizeType Start, SizeType Count = INT32_MAX) const { return FUtf8String(ToView().Mid(Start, Count)); }
+
+    friend bool operator==(const FUtf8String& A, FUtf8StringView B) { return A.Equals(B); }
+    friend bool operator==(const FUtf8String& A, const UTF8CHAR* B) { return A.Equals(FUtf8StringView(B)); }
+    friend bool operator<(const FUtf8String& A, const FUtf8String& B) { return A.Compare(B.ToView()) < 0; }
+
+    friend uint32 GetTypeHash(const FUtf8String& Str) { return GetTypeHash(Str.ToView()); }
+
+    // ========================================================================
+    // Iteration
+    // ========================================================================
+
+    FORCEINLINE UTF8CHAR* begin() { return GetData(); }
+    FORCEINLINE const UTF8CHAR* begin() const { return GetData(); }
+    FORCEINLINE UTF8CHAR* end() { return GetData() + Length; }
+    FORCEINLINE const UTF8CHAR* end() const { return GetData() + Length; }
+
+private:
+    FORCEINLINE UTF8CHAR* GetData() { return bOnHeap ? Heap.Data : InlineData; }
+    FORCEINLINE const UTF8CHAR* GetData() const { return bOnHeap ? Heap.Data : InlineData; }
+
+    void Assign(FUtf8StringView View)
+    {
+        // Keep the existing buffer; a view into this string is handled by memmove
+        if (View.Len() > GetCapacity())
+        {
+            FUtf8String Copy(View);
+            *this = std::move(Copy);
+            return;
+        }
+        std::memmove(GetData(), View.GetData(), static_cast<size_t>(View.Len()));
+        Length = View.Len();
+        GetData()[Length] = '\0';
+    }
+
+    void Grow(SizeType MinCapacity)
+    {
+        const SizeType Current = GetCapacity();
+        const SizeType Geometric = Current + Current / 2 + 16;
+        Realloc(MinCapacity > Geometric ? MinCapacity : Geometric);
+    }
+
+    void Realloc(SizeType NewCapacity)
+    {
+        if (bOnHeap)
+        {
+            UTF8CHAR* NewData = static_cast<UTF8CHAR*>(std::realloc(Heap.Data, static_cast<size_t>(NewCapacity) + 1));
+            Heap.Data = NewData;
+        }
+        else
+        {
+            UTF8CHAR* NewData = static_cast<UTF8CHAR*>(std::malloc(static_cast<size_t>(NewCapacity) + 1));
+            std::memcpy(NewData, InlineData, static_cast<size_t>(Length) + 1);
+            Heap.Data = NewData;
+            bOnHeap = true;
+        }
+        Heap.Capacity = NewCapacity;
+    }
+
+    void MoveFrom(FUtf8String& Other)
+    {
+        Length = Other.Length;
+        bOnHeap = Other.bOnHeap;
+        if (bOnHeap)
+        {
+            Heap.Data = Other.Heap.Data;
+            Heap.Capacity = Other.Heap.Capacity;
+        }
+        else
+        {
+            std::memcpy(InlineData, Other.InlineData, static_cast<size_t>(Length) + 1);
+        }
+        Other.bOnHeap = false;
+        Other.Length = 0;
+        Other.InlineData[0] = '\0';
+    }
+
+    union
+    {
+        UTF8CHAR InlineData[InlineCapacity + 1];
+        struct
+        {
+            UTF8CHAR* Data;
+            SizeType Capacity;
+        } Heap;
+    };
+    SizeType Length = 0;
+    bool bOnHeap = false;
+};
+
+static_assert(sizeof(FUtf8String) <= 32, "FUtf8String should stay within half a cache line");
+
+} // namespace MonsterEngine
+
+// ============================================================================
+// Logging interop
+// ============================================================================
+
+namespace MonsterRender {
+namespace Private {
+    /** Lets MR_LOG_INFO(Utf8Str) and friends log an FUtf8String without conversion */
+    inline const char* ToLogString(const MonsterEngine::FUtf8String& str) { return *str; }
+} // namespace Private
+} // namespace MonsterRender
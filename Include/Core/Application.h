@@ -101,6 +101,9 @@ namespace MonsterRender {
         bool m_shouldExit = false;
         bool m_minimized = false;
         
+        // Whether initialize() started the task graph, so shutdown() stops it
+        bool m_ownsTaskGraph = false;
+        
         // Timing
         float32 m_deltaTime = 0.0f;
         float32 m_lastFrameTime = 0.0f;
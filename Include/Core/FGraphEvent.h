@@ -9,6 +9,28 @@
 
 namespace MonsterEngine {
 
+/**
+ * Base class for work that waits on graph events
+ * 
+ * A task registers itself as a subsequent of each of its prerequisites.
+ * Every prerequisite calls OnPrerequisiteCompleted() exactly once when it
+ * completes, so the task can count down and dispatch itself without
+ * blocking a thread.
+ * 
+ * Based on UE5's FBaseGraphTask
+ * Reference: Engine/Source/Runtime/Core/Public/Async/TaskGraphInterfaces.h
+ */
+class FBaseGraphTask {
+public:
+    virtual ~FBaseGraphTask() = default;
+    
+    /**
+     * Called by a prerequisite event when it completes
+     * May be called from any thread
+     */
+    virtual void OnPrerequisiteCompleted() = 0;
+};
+
 /**
  * Graph event for task synchronization
  * 
@@ -67,6 +89,16 @@ public:
      */
     void AddSubsequent(TSharedPtr<FGraphEvent> Subsequent);
     
+    /**
+     * Add subsequent task
+     * The task's OnPrerequisiteCompleted() is called when this event completes
+     * 
+     * @param Task - Task waiting on this event
+     * @return False if the event has already completed (the task is not added
+     *         and will not be notified)
+     */
+    bool AddSubsequent(FBaseGraphTask* Task);
+    
     /**
      * Mark event as complete
      * This will dispatch all subsequent events
@@ -78,6 +110,13 @@ public:
      */
     uint32 GetNumSubsequents() const;
     
+    /**
+     * Tracer id of the task completing this event (0 when not traced)
+     * Lets dependent tasks record dependency edges in FTaskTracer
+     */
+    uint64 GetTraceId() const { return m_traceId; }
+    void SetTraceId(uint64 InTraceId) { m_traceId = InTraceId; }
+    
 private:
     /** Whether the event has completed */
     std::atomic<bool> m_isComplete{false};
@@ -85,6 +124,21 @@ private:
     /** List of subsequent events to trigger when this completes */
     TArray<TSharedPtr<FGraphEvent>> m_subsequents;
     
+    /** Number of subsequent tasks stored inline before spilling to m_subsequentTasks */
+    static constexpr int32 kNumInlineSubsequentTasks = 4;
+    
+    /** First subsequent tasks, stored inline so typical events never allocate */
+    FBaseGraphTask* m_inlineSubsequentTasks[kNumInlineSubsequentTasks] = {};
+    
+    /** Number of valid entries in m_inlineSubsequentTasks */
+    int32 m_numInlineSubsequentTasks = 0;
+    
+    /** Subsequent tasks beyond the inline capacity */
+    TArray<FBaseGraphTask*> m_subsequentTasks;
+    
+    /** FTaskTracer task id, set once before the event is shared */
+    uint64 m_traceId = 0;
+    
     /** Mutex for protecting subsequent list */
     mutable std::mutex m_mutex;
     
@@ -105,11 +159,14 @@ using FGraphEventArray = TArray<FGraphEventRef>;
 
 /**
  * Helper function to create a graph event
+ * Event storage comes from a per-thread cached pool, so steady-state
+ * event creation does not hit the system allocator.
  * 
  * @return New graph event reference
  */
 inline FGraphEventRef MakeGraphEvent() {
-    return MakeShared<FGraphEvent>();
+    // Pooled controller storage: events are created and released at task rate
+    return MakeSharedPooled<FGraphEvent>();
 }
 
 /**
@@ -6,16 +6,90 @@
 #include "Core/FGraphEvent.h"
 #include "Core/FRunnable.h"
 #include "Core/FRunnableThread.h"
-#include <queue>
+#include "Core/TWorkStealingQueue.h"
+#include "Core/TFixedSizeAllocatorTLSCache.h"
+#include "Core/Templates/InlineFunction.h"
 #include <functional>
+#include <condition_variable>
 
 namespace MonsterEngine {
 
 /**
  * Task delegate type
- * Function that will be executed by the task graph
+ * Function that will be executed by the task graph. Move-only; captures up
+ * to 64 bytes are stored inline in the task entry, larger ones fall back
+ * to the heap.
  */
-using FTaskDelegate = TFunction<void()>;
+using FTaskDelegate = TInlineFunction<void(), 64>;
+
+/**
+ * Scheduling priority of a task
+ * 
+ * Workers always take the highest-priority task available. Background
+ * tasks are additionally limited to all but one worker, so a burst of
+ * background work can delay a high-priority task by at most the slice of
+ * the task that is currently running on a worker. With a single worker,
+ * background tasks run one at a time and only while no other task is
+ * pending, so higher-priority work waits for at most one background slice.
+ */
+enum class ETaskPriority : uint8 {
+    /** Frame-critical work: visibility, mesh draw setup */
+    High,
+    
+    /** Default priority */
+    Normal,
+    
+    /** Latency-tolerant work: texture decode, shader compile, streaming */
+    Background,
+    
+    Num
+};
+
+/**
+ * Thread a task is routed to
+ * 
+ * AnyThread tasks run on task graph workers. Named-thread tasks are queued
+ * for a specific thread, which runs them when it calls
+ * FTaskGraph::ProcessThreadUntilIdle(). A named thread that has not been
+ * attached forwards its tasks: RHIThread -> RenderThread -> GameThread.
+ * 
+ * Based on UE5's ENamedThreads
+ * Reference: Engine/Source/Runtime/Core/Public/Async/TaskGraphInterfaces.h
+ */
+enum class ENamedThread : uint8 {
+    AnyThread,
+    GameThread,
+    RenderThread,
+    RHIThread,
+    
+    Num
+};
+
+/**
+ * Task graph scheduling statistics
+ * Aggregated over all workers since Initialize() or the last ResetStats()
+ */
+struct FTaskGraphStats {
+    /** Tasks executed by worker threads */
+    uint64 NumTasksExecuted = 0;
+    
+    /** Tasks popped from the owning worker's local deque */
+    uint64 NumLocalPops = 0;
+    
+    /** Tasks taken from the shared injection queue */
+    uint64 NumGlobalPops = 0;
+    
+    /** Attempts to steal from another worker's deque */
+    uint64 NumStealAttempts = 0;
+    
+    /** Successful steals */
+    uint64 NumSteals = 0;
+    
+    /** Fraction of executed tasks that were obtained by stealing */
+    double GetStealRate() const {
+        return NumTasksExecuted > 0 ? static_cast<double>(NumSteals) / static_cast<double>(NumTasksExecuted) : 0.0;
+    }
+};
 
 /**
  * Task graph system for parallel task execution
@@ -24,6 +98,12 @@ using FTaskDelegate = TFunction<void()>;
  * Tasks can have prerequisites (other tasks that must complete first)
  * and can return graph events for tracking completion.
  * 
+ * Scheduling uses per-worker work-stealing deques: tasks queued from a
+ * worker go to that worker's deque (LIFO pop by the owner, FIFO steal by
+ * idle workers), tasks queued from any other thread go to a shared
+ * injection queue. The shared mutex is therefore only touched by
+ * external submissions and idle workers, not by the hot fork/join path.
+ * 
  * Based on UE5's FTaskGraphInterface
  * Reference: Engine/Source/Runtime/Core/Public/Async/TaskGraphInterfaces.h
  */
@@ -56,26 +136,101 @@ public:
      */
     static FGraphEventRef QueueTask(
         FTaskDelegate&& Task,
-        const FGraphEventArray& Prerequisites = {}
+        const FGraphEventArray& Prerequisites = {},
+        ETaskPriority Priority = ETaskPriority::Normal,
+        ENamedThread Thread = ENamedThread::AnyThread
     );
     
     /**
      * Queue a task for execution with a name (for debugging)
      * 
-     * @param TaskName - Name for debugging
+     * @param TaskName - Name for debugging; must have static storage
+     *                   duration (string literal), it is not copied
      * @param Task - Task delegate to execute
      * @param Prerequisites - Tasks that must complete before this task
+     * @param Priority - Scheduling priority
+     * @param Thread - Thread to run on (AnyThread = task graph workers)
      * @return Graph event for tracking completion
      */
     static FGraphEventRef QueueNamedTask(
-        const String& TaskName,
+        const char* TaskName,
         FTaskDelegate&& Task,
-        const FGraphEventArray& Prerequisites = {}
+        const FGraphEventArray& Prerequisites = {},
+        ETaskPriority Priority = ETaskPriority::Normal,
+        ENamedThread Thread = ENamedThread::AnyThread
     );
     
+    /** Callback invoked (on the queuing thread) when a task is queued for a named thread */
+    using FNamedThreadWakeup = void (*)();
+    
+    /**
+     * Register the calling thread as a named thread
+     * Tasks targeting it are no longer forwarded to the fallback thread.
+     * May be called before Initialize().
+     * 
+     * @param Thread - Named thread the caller becomes
+     * @param OnTaskQueued - Optional callback to wake the thread when it sleeps on its own event
+     */
+    static void AttachToThread(ENamedThread Thread, FNamedThreadWakeup OnTaskQueued = nullptr);
+    
+    /**
+     * Unregister a named thread
+     * Tasks queued afterwards are forwarded to the fallback thread
+     */
+    static void DetachFromThread(ENamedThread Thread);
+    
+    /**
+     * Run all tasks queued for a named thread, highest priority first
+     * Must be called from the thread that owns the queue. Tasks queued while
+     * processing are run as well.
+     * 
+     * @return Number of tasks executed
+     */
+    static uint32 ProcessThreadUntilIdle(ENamedThread Thread);
+    
+    /**
+     * Check whether a named thread has queued tasks (non-blocking)
+     */
+    static bool HasPendingThreadTasks(ENamedThread Thread);
+    
+    /**
+     * Execute Body(Index) for every Index in [0, Num) on the worker threads
+     * 
+     * The range is split lazily: each participant owns a sub-range and grabs
+     * batches from its front, idle participants steal the back half of the
+     * largest remaining sub-range, so ranges are halved recursively only
+     * when there is someone to take them. The calling thread participates
+     * and the call returns once every index has been processed. No heap
+     * allocation is made per batch.
+     * 
+     * Runs inline when the task graph is not initialized or Num <= MinBatchSize.
+     * 
+     * Based on UE5's ParallelFor
+     * Reference: Engine/Source/Runtime/Core/Public/Async/ParallelFor.h
+     * 
+     * @param Num - Number of indices
+     * @param Body - Callable invoked as Body(int32 Index)
+     * @param MinBatchSize - Smallest number of consecutive indices handed to one participant
+     */
+    template<typename BodyType>
+    static void ParallelFor(int32 Num, BodyType&& Body, int32 MinBatchSize = 1) {
+        using FBody = std::remove_reference_t<BodyType>;
+        
+        auto invokeRange = [](void* Context, int32 Start, int32 End) {
+            FBody& body = *static_cast<FBody*>(Context);
+            for (int32 Index = Start; Index < End; ++Index) {
+                body(Index);
+            }
+        };
+        
+        ParallelForInternal(Num, MinBatchSize, invokeRange, const_cast<void*>(static_cast<const void*>(&Body)));
+    }
+    
     /**
      * Wait for all queued tasks to complete
-     * Blocks until the task queue is empty
+     * Blocks until no worker task is waiting, queued or running. Tasks
+     * routed to named threads are not waited for, since the caller may be
+     * the thread that has to run them.
      */
     static void WaitForAllTasks();
     
@@ -89,6 +244,23 @@ public:
      */
     static uint32 GetNumPendingTasks();
     
+    /**
+     * Get index of the worker running on the calling thread
+     * 
+     * @return Worker index, or -1 if the caller is not a task graph worker
+     */
+    static int32 GetCurrentWorkerIndex();
+    
+    /**
+     * Get aggregated scheduling statistics
+     */
+    static FTaskGraphStats GetStats();
+    
+    /**
+     * Reset scheduling statistics
+     */
+    static void ResetStats();
+    
     /**
      * Constructor (public for TUniquePtr)
      */
@@ -121,22 +293,121 @@ private:
     
     /**
      * Task entry in the queue
+     * 
+     * Registered as a subsequent of each unfinished prerequisite. It is only
+     * enqueued once the last prerequisite completes, so a task with
+     * dependencies never occupies a worker while it waits.
+     * 
+     * Entries are recycled through a per-thread cached pool, so queuing a
+     * task does not touch the system allocator in steady state.
      */
-    struct FTaskEntry {
+    struct FTaskEntry : public FBaseGraphTask {
         FTaskDelegate task;
         FGraphEventRef completionEvent;
-        FGraphEventArray prerequisites;
-        String taskName;
+        const char* taskName = nullptr;
+        
+        /** Link in the injection or named-thread queue */
+        FTaskEntry* nextInQueue = nullptr;
+        
+        /** Scheduling priority */
+        ETaskPriority priority = ETaskPriority::Normal;
+        
+        /** Target thread */
+        ENamedThread thread = ENamedThread::AnyThread;
+        
+        /** Prerequisites not yet completed, plus one hold released after setup */
+        std::atomic<int32> numPrerequisitesOutstanding{0};
         
         FTaskEntry() = default;
         
-        FTaskEntry(FTaskDelegate&& InTask, FGraphEventRef InEvent, 
-                  const FGraphEventArray& InPrereqs, const String& InName)
+        FTaskEntry(FTaskDelegate&& InTask, FGraphEventRef InEvent, const char* InName,
+                   ETaskPriority InPriority = ETaskPriority::Normal, ENamedThread InThread = ENamedThread::AnyThread)
             : task(std::move(InTask))
-            , completionEvent(InEvent)
-            , prerequisites(InPrereqs)
+            , completionEvent(std::move(InEvent))
             , taskName(InName)
+            , priority(InPriority)
+            , thread(InThread)
         {}
+        
+        static void* operator new(size_t) {
+            return TFixedSizeAllocatorTLSCache<sizeof(FTaskEntry), alignof(FTaskEntry)>::Allocate();
+        }
+        
+        static void operator delete(void* Ptr) {
+            TFixedSizeAllocatorTLSCache<sizeof(FTaskEntry), alignof(FTaskEntry)>::Free(Ptr);
+        }
+        
+        /** Count down and enqueue the task when the last prerequisite completes */
+        virtual void OnPrerequisiteCompleted() override;
+    };
+    
+    /**
+     * Intrusive FIFO of task entries (caller provides locking)
+     */
+    struct FTaskList {
+        FTaskEntry* Head = nullptr;
+        FTaskEntry* Tail = nullptr;
+        
+        void Push(FTaskEntry* Entry) {
+            Entry->nextInQueue = nullptr;
+            if (Tail) {
+                Tail->nextInQueue = Entry;
+            } else {
+                Head = Entry;
+            }
+            Tail = Entry;
+        }
+        
+        FTaskEntry* Pop() {
+            FTaskEntry* entry = Head;
+            if (entry) {
+                Head = entry->nextInQueue;
+                if (!Head) {
+                    Tail = nullptr;
+                }
+            }
+            return entry;
+        }
+    };
+    
+    static constexpr uint32 kNumPriorities = static_cast<uint32>(ETaskPriority::Num);
+    static constexpr uint32 kNumNamedThreads = static_cast<uint32>(ENamedThread::Num);
+    
+    /**
+     * Queue of tasks for one named thread
+     */
+    struct FNamedThreadQueue {
+        std::mutex Mutex;
+        FTaskList Lists[kNumPriorities];
+        std::atomic<uint32> NumQueued{0};
+    };
+    
+    /** Range callback used by ParallelFor: processes [Start, End) */
+    using FParallelForInvoke = void (*)(void* Context, int32 Start, int32 End);
+    
+    /** Non-template part of ParallelFor */
+    static void ParallelForInternal(int32 Num, int32 MinBatchSize, FParallelForInvoke Invoke, void* Context);
+    
+    /** Capacity of each worker's local deque; overflow goes to the injection queue */
+    static constexpr uint32 kLocalQueueCapacity = 4096;
+    
+    /**
+     * Per-worker scheduling state
+     * Cache-line aligned so workers never false-share counters
+     */
+    struct alignas(64) FWorkerQueue {
+        /** Local deques owned by the worker, one per priority */
+        TWorkStealingQueue<FTaskEntry, kLocalQueueCapacity> LocalQueues[kNumPriorities];
+        
+        /** Statistics (written by the owner only) */
+        std::atomic<uint64> NumTasksExecuted{0};
+        std::atomic<uint64> NumLocalPops{0};
+        std::atomic<uint64> NumGlobalPops{0};
+        std::atomic<uint64> NumStealAttempts{0};
+        std::atomic<uint64> NumSteals{0};
+        
+        /** Victim selection random state */
+        uint32 RandomState = 0;
     };
     
 private:
@@ -148,17 +419,74 @@ private:
     
     /**
      * Worker thread function
-     * Processes tasks from the queue
+     * Processes tasks from the queues
      */
     void ProcessTasks(uint32 WorkerIndex);
     
     /**
-     * Try to get next task from queue
+     * Release prerequisite holds on a task and enqueue it if none remain
+     * 
+     * @param Entry - Task entry
+     * @param NumCompleted - Number of outstanding prerequisites that completed
+     */
+    void ReleasePrerequisites(FTaskEntry* Entry, int32 NumCompleted);
+    
+    /**
+     * Make a ready task visible to the workers
+     * Pushes to the caller's local deque when called from a worker,
+     * otherwise to the shared injection queue
+     */
+    void EnqueueTask(FTaskEntry* Entry);
+    
+    /**
+     * Queue a ready task for a named thread (or its fallback)
+     */
+    void EnqueueNamedThreadTask(FTaskEntry* Entry);
+    
+    /**
+     * Resolve a named thread to the one that will actually run its tasks
+     */
+    static ENamedThread ResolveNamedThread(ENamedThread Thread);
+    
+    /**
+     * Find the next task for a worker
+     * Priorities are searched High to Background; within a priority the
+     * order is own deque (LIFO), injection queue, steal from other workers (FIFO)
      * 
-     * @param OutTask - Output task entry
-     * @return True if a task was retrieved
+     * @param WorkerIndex - Index of the calling worker
+     * @return Task entry or nullptr if no work was found
+     */
+    FTaskEntry* FindWork(uint32 WorkerIndex);
+    
+    /**
+     * Find a task of one priority for a worker
+     */
+    FTaskEntry* FindWorkAtPriority(uint32 WorkerIndex, uint32 Priority);
+    
+    /**
+     * Try to steal a task of one priority from another worker's deque
      */
-    bool TryGetNextTask(FTaskEntry& OutTask);
+    FTaskEntry* TrySteal(uint32 WorkerIndex, uint32 Priority);
+    
+    /**
+     * Whether a sleeping worker has something it is allowed to run
+     */
+    bool HasRunnableWork() const;
+    
+    /**
+     * Number of background tasks allowed to run at once right now
+     */
+    uint32 GetMaxActiveBackgroundTasks() const;
+    
+    /**
+     * Execute a task entry and release it
+     */
+    void ExecuteTask(FTaskEntry* Entry);
+    
+    /**
+     * Wake one sleeping worker, if any
+     */
+    void WakeWorker();
     
     /**
      * Check if task prerequisites are complete
@@ -174,21 +502,54 @@ private:
     /** Worker runnable objects */
     TArray<TUniquePtr<FTaskWorker>> m_workers;
     
-    /** Task queue */
-    std::queue<FTaskEntry> m_taskQueue;
+    /** Per-worker deques, indexed by worker index */
+    TArray<TUniquePtr<FWorkerQueue>> m_workerQueues;
+    
+    /**
+     * Injection queues for tasks queued from non-worker threads, one per priority
+     * Guarded by m_queueMutex
+     */
+    FTaskList m_injectionQueues[kNumPriorities];
+    
+    /** Queues of named-thread tasks, indexed by ENamedThread */
+    FNamedThreadQueue m_namedThreadQueues[kNumNamedThreads];
     
-    /** Mutex for task queue */
+    /** Whether a thread is attached for each ENamedThread */
+    static std::atomic<bool> s_namedThreadAttached[kNumNamedThreads];
+    
+    /** Wakeup callbacks for attached named threads */
+    static std::atomic<FNamedThreadWakeup> s_namedThreadWakeups[kNumNamedThreads];
+    
+    /** Mutex for the injection queue and for sleeping */
     std::mutex m_queueMutex;
     
     /** Condition variable for task availability */
     std::condition_variable m_queueCV;
     
+    /** Number of tasks queued but not yet picked up by a worker */
+    std::atomic<uint32> m_numPendingTasks{0};
+    
+    /** Number of background tasks among m_numPendingTasks */
+    std::atomic<uint32> m_numPendingBackgroundTasks{0};
+    
+    /** Number of workers currently running a background task */
+    std::atomic<uint32> m_numActiveBackgroundTasks{0};
+    
+    /** Maximum number of workers running background tasks at once; 0 with a single worker */
+    uint32 m_maxBackgroundWorkers = 1;
+    
+    /** Number of workers blocked on m_queueCV */
+    std::atomic<uint32> m_numSleepingWorkers{0};
+    
     /** Whether the task graph is shutting down */
     std::atomic<bool> m_isShuttingDown{false};
     
     /** Number of active tasks being processed */
     std::atomic<uint32> m_activeTasks{0};
     
+    /** Number of tasks waiting for prerequisites (not yet enqueued) */
+    std::atomic<uint32> m_numWaitingTasks{0};
+    
     /** Total tasks queued */
     std::atomic<uint32> m_totalTasksQueued{0};
     
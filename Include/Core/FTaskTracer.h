@@ -0,0 +1,173 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Compile the task tracer in (1) or out (0)
+ * When compiled in, tracing is still off until FTaskTracer::SetEnabled(true);
+ * a disabled tracer costs one relaxed atomic load per traced scope.
+ */
+#ifndef MR_TASK_TRACE_ENABLED
+#define MR_TASK_TRACE_ENABLED 1
+#endif
+
+namespace MonsterEngine {
+
+/**
+ * Low-overhead timeline tracer for tasks and thread work
+ *
+ * Every thread records into its own fixed-size ring buffer, so recording
+ * takes no lock and never allocates after the thread's first event; when a
+ * buffer is full the oldest events are overwritten. A buffer outlives its
+ * thread so exports still show it, and is freed by Reset() or Shutdown(). Each record is one
+ * completed scope (start, end, name, task id, worker index) or one
+ * dependency edge between two task ids.
+ *
+ * ExportChromeTrace() writes all buffers as Chrome trace event JSON, which
+ * loads in chrome://tracing and ui.perfetto.dev. Dependency edges become
+ * flow arrows from the end of the prerequisite to the start of the
+ * dependent task. Export while threads are recording is allowed but may
+ * drop or tear events being written at that moment.
+ *
+ * Based on UE5's Trace / TaskTrace
+ * Reference: Engine/Source/Runtime/Core/Public/Async/TaskTrace.h
+ * Reference: Chrome Trace Event Format (docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU)
+ */
+class FTaskTracer {
+public:
+    /** Number of records per thread ring buffer */
+    static constexpr uint32 kRingBufferCapacity = 1 << 14;
+
+    /**
+     * Enable or disable recording at runtime
+     */
+    static void SetEnabled(bool bEnabled);
+
+    /**
+     * Check if recording is enabled (cheap, safe to call on hot paths)
+     */
+    static FORCEINLINE bool IsEnabled() {
+#if MR_TASK_TRACE_ENABLED
+        return s_enabled.load(std::memory_order_relaxed);
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Name the calling thread in exported traces (e.g. "GameThread", "RHIThread")
+     * Cheap and allocation-free; may be called before tracing is enabled.
+     *
+     * @param Name - Copied, truncated to 63 characters
+     * @param SortIndex - Row order in the viewer, lower first
+     */
+    static void SetThreadName(const char* Name, int32 SortIndex = 0);
+
+    /**
+     * Allocate a unique id for a task, used to connect dependency edges
+     */
+    static uint64 AllocateTaskId();
+
+    /**
+     * Current time in the tracer's clock (nanoseconds)
+     */
+    static uint64 GetTimestamp();
+
+    /**
+     * Record a completed scope on the calling thread
+     *
+     * @param Name - Must have static storage duration
+     * @param StartTime - From GetTimestamp() when the scope began
+     * @param TaskId - Task id, or 0 for plain scopes
+     * @param WorkerIndex - Task graph worker index, or -1
+     */
+    static void RecordScope(const char* Name, uint64 StartTime, uint64 TaskId = 0, int32 WorkerIndex = -1);
+
+    /**
+     * Record that task To waits for task From
+     */
+    static void RecordDependency(uint64 FromTaskId, uint64 ToTaskId);
+
+    /**
+     * Write all recorded events as Chrome trace JSON
+     *
+     * @param FilePath - Output file
+     * @return True on success
+     */
+    static bool ExportChromeTrace(const String& FilePath);
+
+    /**
+     * Discard all recorded events (thread names are kept) and free the
+     * buffers of threads that have exited
+     * Must not race with recording threads
+     */
+    static void Reset();
+
+    /**
+     * Stop recording and free the buffers of exited threads and the calling thread
+     * Threads still running free their buffer when they exit. Call after the
+     * task graph and other traced threads have been shut down.
+     */
+    static void Shutdown();
+
+    /**
+     * Number of events currently held across all buffers
+     */
+    static uint64 GetNumRecordedEvents();
+
+    /**
+     * Number of thread buffers currently allocated, including those of exited threads
+     */
+    static uint32 GetNumThreadBuffers();
+
+private:
+#if MR_TASK_TRACE_ENABLED
+    static std::atomic<bool> s_enabled;
+#endif
+};
+
+/**
+ * Records the enclosing scope as one slice on the calling thread's timeline
+ */
+class FScopedTaskTrace {
+public:
+    FORCEINLINE explicit FScopedTaskTrace(const char* InName, uint64 InTaskId = 0, int32 InWorkerIndex = -1)
+        : m_name(nullptr)
+    {
+        if (FTaskTracer::IsEnabled()) {
+            m_name = InName;
+            m_taskId = InTaskId;
+            m_workerIndex = InWorkerIndex;
+            m_startTime = FTaskTracer::GetTimestamp();
+        }
+    }
+
+    FORCEINLINE ~FScopedTaskTrace() {
+        if (m_name) {
+            FTaskTracer::RecordScope(m_name, m_startTime, m_taskId, m_workerIndex);
+        }
+    }
+
+    FScopedTaskTrace(const FScopedTaskTrace&) = delete;
+    FScopedTaskTrace& operator=(const FScopedTaskTrace&) = delete;
+
+private:
+    const char* m_name;
+    uint64 m_taskId = 0;
+    uint64 m_startTime = 0;
+    int32 m_workerIndex = -1;
+};
+
+} // namespace MonsterEngine
+
+#if MR_TASK_TRACE_ENABLED
+    #define MR_TRACE_CONCAT_INNER(A, B) A##B
+    #define MR_TRACE_CONCAT(A, B) MR_TRACE_CONCAT_INNER(A, B)
+    /** Trace the enclosing scope under a static name */
+    #define MR_TRACE_SCOPE(Name) ::MonsterEngine::FScopedTaskTrace MR_TRACE_CONCAT(TraceScope_, __LINE__)(Name)
+#else
+    #define MR_TRACE_SCOPE(Name)
+#endif
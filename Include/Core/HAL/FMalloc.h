@@ -31,6 +31,15 @@ public:
      */
     virtual void* Malloc(SIZE_T Size, uint32 Alignment = DEFAULT_ALIGNMENT) = 0;
 
+    /**
+     * Allocates a large staging buffer (texture or mesh data on its way to the GPU)
+     * Allocators may back these with huge pages. Freed with Free().
+     * @param Size - Number of bytes to allocate
+     * @param Alignment - Required alignment (must be power of 2)
+     * @return Pointer to allocated memory, or nullptr on failure
+     */
+    virtual void* MallocStaging(SIZE_T Size, uint32 Alignment = DEFAULT_ALIGNMENT) { return Malloc(Size, Alignment); }
+
     /**
      * Reallocates memory to a new size
      * @param Original - Pointer to original allocation
@@ -77,6 +86,17 @@ public:
         uint64 TotalReserved;
         uint64 AllocationCount;
         uint64 FreeCount;
+
+        // Waste report (allocators that do not track it leave these at 0)
+        uint64 InternalWaste = 0;   // Live bytes lost rounding requests up to size classes (estimated)
+        uint64 ExternalWaste = 0;   // Reserved bytes not in live blocks: free slots, page headers and tails
+
+        // Large-block cache (allocators without one leave these at 0)
+        uint64 LargeCacheHits = 0;      // Large allocations served from cached blocks
+        uint64 LargeCacheMisses = 0;    // Large allocations that had to map new memory
+        uint64 LargeCachedBytes = 0;    // Address space held by cached free blocks
+        uint64 LargeCacheRssSaved = 0;  // Cached bytes returned to the OS while keeping their mapping
+        uint64 HugePageBytes = 0;       // Live bytes advised to use transparent huge pages
     };
 
     virtual void GetMemoryStats(FMemoryStats& OutStats) {
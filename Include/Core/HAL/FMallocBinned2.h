@@ -12,15 +12,27 @@ namespace MonsterRender {
 
 /**
  * FMallocBinned2 - Fast multi-threaded allocator for small objects
- * 
+ *
  * Reference: UE5 Engine/Source/Runtime/Core/Public/HAL/MallocBinned2.h
- * 
+ * Reference: mimalloc (Leijen et al., "Mimalloc: Free List Sharding in Action")
+ *
  * Features:
- * - Per-size-class bins (16B to 1024B)
- * - Thread-local caching for lock-free fast path
- * - Per-bin locks for scalability
- * - Page-based allocation with free lists
- * - Large allocations fall back to OS allocator
+ * - 40 size classes from 16B to 32KB: 16-byte steps up to 128B, then four
+ *   classes per power of two, so rounding wastes at most 20% of a block
+ * - Pages of 64KB (larger for big classes) found through a global page map,
+ *   which also tells binned blocks from large allocations
+ * - Every page is owned by one thread heap; the owner allocates and frees
+ *   through the page's local free list without locks or atomics
+ * - Frees from other threads go to the page's lock-free remote-free list,
+ *   batched per page so one CAS returns many blocks; the owner reclaims the
+ *   whole list with a single exchange when the page runs dry
+ * - Bin locks are only taken to adopt pages abandoned by exited threads
+ * - Large allocations on Linux are mmap'd blocks with a header in front;
+ *   freed blocks go to a size-bucketed cache instead of munmap, and cached
+ *   blocks beyond a resident budget release their pages but keep their
+ *   mapping. Staging allocations of 2MB or more are 2MB-aligned and advised
+ *   MADV_HUGEPAGE. Other platforms use the OS allocator.
+ * - Allocations are reported to FLowLevelMemTracker when it is enabled
  */
 class FMallocBinned2 : public FMalloc {
 public:
@@ -29,6 +41,7 @@ public:
 
     // FMalloc interface
     virtual void* Malloc(SIZE_T Size, uint32 Alignment = DEFAULT_ALIGNMENT) override;
+    virtual void* MallocStaging(SIZE_T Size, uint32 Alignment = DEFAULT_ALIGNMENT) override;
     virtual void* Realloc(void* Original, SIZE_T Size, uint32 Alignment = DEFAULT_ALIGNMENT) override;
     virtual void Free(void* Original) override;
     virtual SIZE_T GetAllocationSize(void* Original) override;
@@ -37,58 +50,171 @@ public:
     virtual void Trim() override;
     virtual void GetMemoryStats(FMemoryStats& OutStats) override;
 
+    /**
+     * Log per-size-class usage and waste
+     */
+    void LogWasteReport();
+
 private:
     // Constants (matching UE5)
-    static constexpr uint32 NUM_SMALL_BINS = 7;      // 16, 32, 64, 128, 256, 512, 1024
-    static constexpr SIZE_T SMALL_BIN_MAX_SIZE = 1024;
-    static constexpr SIZE_T PAGE_SIZE = 64 * 1024;   // 64KB pages
-    static constexpr uint32 TLS_CACHE_SIZE = 16;     // Items per bin in TLS cache
-    static constexpr uint32 EMPTY_PAGE_THRESHOLD = 4; // Trim threshold
-
-    // Page header for small bins
-    struct FPageHeader {
-        void* FreeList;           // LIFO free list
+    static constexpr uint32 NUM_SMALL_BINS = 40;     // 16..128 step 16, then 4 per power of two
+    static constexpr SIZE_T SMALL_BIN_MAX_SIZE = 32 * 1024;
+    static constexpr SIZE_T PAGE_SIZE = 64 * 1024;   // 64KB page granularity
+    static constexpr uint32 MIN_BLOCKS_PER_PAGE = 8;  // Larger classes use larger pages
+    static constexpr SIZE_T MAX_BLOCK_ALIGNMENT = 4096; // Highest alignment served from bins
+    static constexpr SIZE_T EMPTY_PAGE_BYTES_THRESHOLD = 4 * PAGE_SIZE; // Empty pages kept per bin by Trim
+    static constexpr uint32 REMOTE_FREE_BATCH_SIZE = 32; // Remote frees pushed per CAS
+    static constexpr SIZE_T REMOTE_FREE_BATCH_BYTES = 64 * 1024; // Cap on bytes held in a batch
+    static constexpr uint32 MAX_THREAD_HEAP_SLOTS = 4;   // Allocator instances cached per thread
+    static constexpr SIZE_T HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+    static constexpr uint32 NUM_LARGE_BUCKETS = 48;      // 64KB steps to 1MB, then 4 per power of two to 256MB
+    static constexpr SIZE_T LARGE_CACHE_MAX_BYTES = 256 * 1024 * 1024;      // Address space kept by the cache
+    static constexpr SIZE_T LARGE_CACHE_RESIDENT_BYTES = 32 * 1024 * 1024;  // Cached bytes left resident
+
+    struct FThreadHeap;
+
+    // Page header for small bins, stored at the start of each page
+    struct alignas(64) FPageHeader {
+        void* FreeList;           // Owner-only LIFO free list
         uint32 ElementSize;       // Size of elements in this page
         uint32 ElementCount;      // Total elements in page
-        uint32 FreeCount;         // Number of free elements
-        FPageHeader* NextPage;    // Link to next page in bin
+        uint32 UsedCount;         // Blocks not on FreeList (includes pending remote frees)
+        uint32 BinIndex;          // Owning bin
+        FPageHeader* NextPage;    // Link in the owner's page list or the bin's abandoned list
+        FMallocBinned2* Allocator; // Allocator the page belongs to
+        std::atomic<FThreadHeap*> Owner; // Owning thread heap, null while abandoned
+
+        // Blocks freed by other threads, on its own cache line
+        alignas(64) std::atomic<void*> RemoteFreeList;
     };
 
     // Per-size bin
     struct FBin {
         uint32 ElementSize;
-        std::vector<FPageHeader*> Pages;
+        uint32 PageSize;          // Multiple of PAGE_SIZE
+        uint32 BlockAlignment;    // Alignment every block in this bin has
+        uint32 RemoteBatchLimit;  // Remote frees chained before pushing
+        uint32 EmptyPagesToKeep;  // Empty pages Trim leaves in place
+        std::atomic<uint32> NumPages{0};
+        FPageHeader* AbandonedPages = nullptr; // Pages of exited threads, guarded by Mutex
         std::mutex Mutex;
-        std::atomic<uint64> AllocCount{0};
-        std::atomic<uint64> FreeCount{0};
     };
 
-    // Thread-local cache for lock-free fast path
-    struct alignas(64) FThreadCache {  // Cache-line aligned
-        void* Cache[NUM_SMALL_BINS][TLS_CACHE_SIZE];
-        uint32 Count[NUM_SMALL_BINS];
-        uint64 Hits;
-        uint64 Misses;
+    // Header at the start of each large block mapping
+    struct alignas(64) FLargeBlockHeader {
+        FMallocBinned2* Allocator;
+        SIZE_T MappedSize;          // Whole mapping, header included
+        SIZE_T RequestedSize;       // Size of the live allocation
+        void* UserPtr;              // Start of the live allocation
+        FLargeBlockHeader* Prev;    // Live list, or cache bucket list (Next only)
+        FLargeBlockHeader* Next;
+        uint32 BucketIndex;         // NUM_LARGE_BUCKETS if the block is never cached
+        bool bHugePages;            // Advised MADV_HUGEPAGE
+        bool bDecommitted;          // Pages released while cached
+    };
+
+    // Remote frees to one page, pushed together
+    struct FRemoteFreeBatch {
+        FPageHeader* Page = nullptr;
+        void* Head = nullptr;
+        void* Tail = nullptr;
+        uint32 Count = 0;
+    };
+
+    // Per-thread heap, one per thread and allocator instance
+    struct alignas(64) FThreadHeap {
+        struct FHeapBin {
+            FPageHeader* Pages = nullptr;     // Pages that may have free blocks, current first
+            FPageHeader* FullPages = nullptr; // Pages found full, rechecked before growing
+            FRemoteFreeBatch RemoteBatch;
+
+            // Statistics, written only by the owning thread
+            std::atomic<uint64> AllocCount{0};
+            std::atomic<uint64> FreeCount{0};
+            std::atomic<uint64> RequestedBytes{0}; // Sum of requested sizes over all allocations
+        };
+
+        FHeapBin Bins[NUM_SMALL_BINS];
+
+        FThreadHeap* NextHeap = nullptr;    // All heaps of the allocator
+        FThreadHeap* NextRetired = nullptr; // Heaps of exited threads, ready for reuse
+    };
+
+    // Unique id per instance, keys the per-thread heap slots
+    static uint64 AllocateInstanceId();
+
+    // Per-bin totals summed over all thread heaps
+    struct FBinTotals {
+        uint64 AllocCount = 0;
+        uint64 FreeCount = 0;
+        uint64 RequestedBytes = 0;
     };
 
     // Member variables
     FBin SmallBins[NUM_SMALL_BINS];
-    
-    std::atomic<uint64> TotalAllocated{0};
+
+    // Bin index for each 16-byte size step up to SMALL_BIN_MAX_SIZE
+    uint8 SizeToBinIndex[SMALL_BIN_MAX_SIZE / 16];
+
+    const uint64 InstanceId;
+
+    std::mutex HeapsMutex;
+    FThreadHeap* Heaps = nullptr;
+    FThreadHeap* RetiredHeaps = nullptr;
+
+    std::mutex PagesMutex;
+    std::vector<FPageHeader*> AllPages;
+
     std::atomic<uint64> TotalReserved{0};
-    std::atomic<uint64> CacheHits{0};
-    std::atomic<uint64> CacheMisses{0};
 
-    static thread_local FThreadCache* TLSCache;
+    // Large blocks, guarded by LargeMutex
+    std::mutex LargeMutex;
+    FLargeBlockHeader* LiveLargeBlocks = nullptr;
+    FLargeBlockHeader* LargeCache[NUM_LARGE_BUCKETS] = {};
+    uint64 LargeAllocCount = 0;
+    uint64 LargeFreeCount = 0;
+    uint64 LargeLiveBytes = 0;         // Requested bytes of live blocks
+    uint64 LargeMappedBytes = 0;       // Live and cached mappings
+    uint64 LargeCachedBytes = 0;
+    uint64 LargeCachedResidentBytes = 0;
+    uint64 LargeDecommittedBytes = 0;
+    uint64 LargeCacheHits = 0;
+    uint64 LargeCacheMisses = 0;
+    uint64 HugePageBytes = 0;
+
+    // Allocation entry points without memory tracking
+    void* MallocInternal(SIZE_T Size, uint32 Alignment);
+    void* MallocStagingInternal(SIZE_T Size, uint32 Alignment);
+    void* ReallocInternal(void* Original, SIZE_T Size, uint32 Alignment);
+    void FreeInternal(void* Original);
 
     // Helper methods
     uint32 SelectBinIndex(SIZE_T Size);
-    FPageHeader* AllocatePage(uint32 ElementSize);
-    void* AllocateFromBin(FBin& Bin, uint32 Alignment, FThreadCache* Cache);
-    void FreeToBin(FBin& Bin, void* Ptr, FThreadCache* Cache);
-    FThreadCache* GetTLSCache();
-    void ReleaseTLSCache(FThreadCache* Cache);
+    FPageHeader* AllocatePage(uint32 BinIndex);
+    void ReleasePage(FPageHeader* Page);
+    FPageHeader* FindPage(void* Ptr) const;
+
+    void GatherBinTotals(FBinTotals* OutTotals);
+
+    void* AllocateFromBin(FThreadHeap* Heap, uint32 BinIndex, SIZE_T Size);
+    void* AllocateSlow(FThreadHeap* Heap, uint32 BinIndex, SIZE_T Size);
+    void FreeToPage(FThreadHeap* Heap, FPageHeader* Page, void* Ptr);
+
+    void* AllocateLarge(SIZE_T Size, uint32 Alignment, bool bHugePages);
+    void FreeLarge(FLargeBlockHeader* Block);
+    void ReleaseLargeBlock(FLargeBlockHeader* Block);
+    void TrimLargeCache();
+    static uint32 SelectLargeBucket(SIZE_T& InOutMappedSize);
+
+    static uint32 CollectRemoteFrees(FPageHeader* Page);
+    static void FlushRemoteBatch(FRemoteFreeBatch& Batch);
+
+    FThreadHeap* GetThreadHeap();
+    FThreadHeap* CreateThreadHeap();
+    void ReleaseThreadHeap(FThreadHeap* Heap);
+    void TrimHeap(FThreadHeap* Heap);
+
+    friend struct FBinnedThreadHeapSlots;
 };
 
 } // namespace MonsterRender
-
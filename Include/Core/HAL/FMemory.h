@@ -33,6 +33,13 @@ struct FMemoryStats {
     uint64 TotalReserved = 0;
     uint64 AllocationCount = 0;
     uint64 FreeCount = 0;
+    uint64 InternalWaste = 0;   // Live bytes lost to size-class rounding (estimated)
+    uint64 ExternalWaste = 0;   // Reserved bytes not in live blocks
+    uint64 LargeCacheHits = 0;
+    uint64 LargeCacheMisses = 0;
+    uint64 LargeCachedBytes = 0;
+    uint64 LargeCacheRssSaved = 0;  // Cached large blocks returned to the OS
+    uint64 HugePageBytes = 0;
 };
 
 /**
@@ -75,6 +82,7 @@ public:
 
     // Memory allocation (delegates to global allocator)
     static void* Malloc(SIZE_T Count, uint32 Alignment = DEFAULT_ALIGNMENT);
+    static void* MallocStaging(SIZE_T Count, uint32 Alignment = DEFAULT_ALIGNMENT);  // Texture/mesh staging, may use huge pages
     static void* Realloc(void* Original, SIZE_T Count, uint32 Alignment = DEFAULT_ALIGNMENT);
     static void Free(void* Original);
     static SIZE_T GetAllocSize(void* Original);
@@ -0,0 +1,171 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// MonsterEngine - Low Level Memory Tracker (UE5-style)
+
+#pragma once
+
+#include "Core/CoreTypes.h"
+#include <atomic>
+
+/**
+ * Compile the memory tracker in (1) or out (0)
+ * When compiled in, tracking is still off until FLowLevelMemTracker::SetEnabled(true);
+ * a disabled tracker costs one relaxed atomic load per allocation, and LLM_SCOPE
+ * a thread-local push and pop (scopes stay balanced if tracking is toggled inside them).
+ */
+#ifndef MR_LLM_ENABLED
+#define MR_LLM_ENABLED 1
+#endif
+
+namespace MonsterRender {
+
+/**
+ * Subsystems that memory is attributed to
+ */
+enum class ELLMTag : uint8 {
+    Untagged = 0,
+    EngineMisc,
+    TaskGraph,
+    Logging,
+    Renderer,
+    Scene,
+    Meshes,
+    MeshBuilder,
+    Textures,
+    Shaders,
+    RHI,
+
+    Count
+};
+
+/**
+ * Memory kinds tracked separately
+ */
+enum class ELLMTracker : uint8 {
+    Default = 0,    // CPU memory: FMallocBinned2, MemorySystem
+    GPU,            // Device memory: FVulkanMemoryManager
+
+    Count
+};
+
+/**
+ * FLowLevelMemTracker - Attributes allocations to subsystem tags
+ *
+ * Each thread keeps a stack of tags pushed by LLM_SCOPE; an allocation is
+ * charged to the tag on top of the allocating thread's stack (Untagged if
+ * empty) and the free is charged back to the same tag, whichever thread
+ * frees it. CPU allocators report pointers and the tracker remembers each
+ * pointer's size and tag; allocators that keep the tag themselves (GPU
+ * allocations) report amounts directly.
+ *
+ * Only allocations made while tracking is enabled are counted. Per-tag
+ * current and peak bytes are available through GetTagStats, LogReport,
+ * and a CSV capture that samples current bytes at a fixed interval on a
+ * background thread, for soak runs.
+ *
+ * Based on UE5's Low Level Memory Tracker
+ * Reference: Engine/Source/Runtime/Core/Public/HAL/LowLevelMemTracker.h
+ */
+class FLowLevelMemTracker {
+public:
+    struct FTagStats {
+        int64 CurrentBytes = 0;
+        int64 PeakBytes = 0;
+        uint64 AllocationCount = 0;
+    };
+
+    /**
+     * Enable or disable tracking at runtime
+     * Disabling forgets all tracked allocations and resets the counters.
+     */
+    static void SetEnabled(bool bEnabled);
+
+    /**
+     * Check if tracking is enabled (cheap, safe to call on hot paths)
+     */
+    static FORCEINLINE bool IsEnabled() {
+#if MR_LLM_ENABLED
+        return s_enabled.load(std::memory_order_relaxed);
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * Tag on top of the calling thread's stack
+     */
+    static ELLMTag GetActiveTag();
+
+    static void PushTag(ELLMTag Tag);
+    static void PopTag();
+
+    /**
+     * Record an allocation at Ptr, charged to the active tag
+     */
+    static void OnAlloc(ELLMTracker Tracker, const void* Ptr, uint64 Size);
+
+    /**
+     * Record the free of a tracked pointer; unknown pointers are ignored
+     */
+    static void OnFree(ELLMTracker Tracker, const void* Ptr);
+
+    /**
+     * Record the free of every tracked pointer in [Start, Start + Size)
+     */
+    static void OnFreeRange(ELLMTracker Tracker, const void* Start, uint64 Size);
+
+    /**
+     * Charge or credit an amount for allocators that keep the tag themselves
+     */
+    static void OnAllocTagged(ELLMTracker Tracker, ELLMTag Tag, uint64 Size);
+    static void OnFreeTagged(ELLMTracker Tracker, ELLMTag Tag, uint64 Size);
+
+    static FTagStats GetTagStats(ELLMTracker Tracker, ELLMTag Tag);
+
+    /**
+     * Log current and peak bytes of every tag with tracked memory
+     */
+    static void LogReport();
+
+    /**
+     * Append one row of current bytes per tag every IntervalSeconds to a CSV file
+     * @return False if the file cannot be opened or a capture is already running
+     */
+    static bool StartCsvCapture(const String& FilePath, float IntervalSeconds = 1.0f);
+    static void StopCsvCapture();
+
+    static const char* GetTagName(ELLMTag Tag);
+    static const char* GetTrackerName(ELLMTracker Tracker);
+
+private:
+#if MR_LLM_ENABLED
+    static std::atomic<bool> s_enabled;
+#endif
+};
+
+/**
+ * Pushes a tag for the enclosing scope
+ */
+class FLLMScope {
+public:
+    FORCEINLINE explicit FLLMScope(ELLMTag Tag) {
+        FLowLevelMemTracker::PushTag(Tag);
+    }
+
+    FORCEINLINE ~FLLMScope() {
+        FLowLevelMemTracker::PopTag();
+    }
+
+    FLLMScope(const FLLMScope&) = delete;
+    FLLMScope& operator=(const FLLMScope&) = delete;
+};
+
+} // namespace MonsterRender
+
+#if MR_LLM_ENABLED
+    #define LLM_CONCAT_INNER(A, B) A##B
+    #define LLM_CONCAT(A, B) LLM_CONCAT_INNER(A, B)
+    /** Charge allocations in the enclosing scope to a tag, e.g. LLM_SCOPE(ELLMTag::Meshes) */
+    #define LLM_SCOPE(Tag) ::MonsterRender::FLLMScope LLM_CONCAT(LLMScope_, __LINE__)(::MonsterRender::Tag)
+#else
+    #define LLM_SCOPE(Tag)
+#endif
@@ -0,0 +1,166 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// MonsterEngine - Per-thread Frame Memory Stack (UE5-style)
+
+#pragma once
+
+#include "Core/HAL/FMemory.h"
+#include <atomic>
+
+namespace MonsterRender {
+
+/**
+ * FMemStack - Per-thread stack allocator for memory that lives at most one frame
+ *
+ * Each thread owns one stack, returned by Get(). Allocation bumps a pointer
+ * inside 64KB chunks (larger requests get a chunk of their own, a multiple
+ * of 64KB); nothing is freed individually. Memory is reclaimed two ways:
+ * - FMemMark saves the stack top and frees everything allocated after it
+ *   when it goes out of scope
+ * - EndFrame() ends the frame for every thread; each stack rewinds to empty
+ *   the next time it is used outside any mark, keeping its chunks for reuse
+ *
+ * Freed chunks of either kind are cached until Trim(), so in steady state
+ * the frame allocates nothing from the heap. Memory allocated outside a
+ * mark is valid until EndFrame; EndFrame must be called by the thread
+ * driving the frame once all work of the frame has finished.
+ *
+ * Based on UE5's FMemStack
+ * Reference: Engine/Source/Runtime/Core/Public/Misc/MemStack.h
+ */
+class FMemStack {
+public:
+    static constexpr SIZE_T CHUNK_SIZE = 64 * 1024;
+
+    struct FStats {
+        uint64 ChunkAllocations = 0;  // Chunks taken from the heap, all threads
+        uint64 ReservedBytes = 0;     // Chunk memory currently held, all threads
+    };
+
+    /**
+     * Stack of the calling thread
+     */
+    static FMemStack& Get();
+
+    /**
+     * End the current frame; every stack rewinds on its next use outside a mark
+     */
+    static void EndFrame();
+
+    static uint64 GetFrameNumber() {
+        return FrameNumber.load(std::memory_order_relaxed);
+    }
+
+    static FStats GetStats();
+
+    FMemStack() = default;
+    ~FMemStack();
+
+    FMemStack(const FMemStack&) = delete;
+    FMemStack& operator=(const FMemStack&) = delete;
+
+    /**
+     * Allocate Size bytes aligned to Alignment (a power of two)
+     */
+    FORCEINLINE void* Alloc(SIZE_T Size, SIZE_T Alignment = DEFAULT_ALIGNMENT) {
+        if (NeedsNewFrame()) {
+            BeginFrame();
+        }
+
+        uint8* Result = AlignPtr(Top, Alignment);
+        if (Result && Result + Size <= End) {
+            Top = Result + Size;
+            return Result;
+        }
+        return AllocateNewChunk(Size, Alignment);
+    }
+
+    template<typename T>
+    FORCEINLINE T* AllocArray(SIZE_T Count) {
+        return static_cast<T*>(Alloc(Count * sizeof(T), alignof(T)));
+    }
+
+    /**
+     * Grow the latest allocation in place if nothing was allocated after it
+     * @return True if [Ptr, Ptr + NewSize) is now allocated
+     */
+    bool TryGrowInPlace(void* Ptr, SIZE_T OldSize, SIZE_T NewSize);
+
+    /**
+     * Free chunks cached for reuse
+     */
+    void Trim();
+
+    /**
+     * Bytes in use since the stack was last empty, including padding and chunk tails
+     */
+    SIZE_T GetByteCount() const;
+
+    /**
+     * True if the next allocation rewinds the stack, releasing everything allocated before the last EndFrame
+     */
+    FORCEINLINE bool NeedsNewFrame() const {
+        return NumMarks == 0 && LocalFrame != FrameNumber.load(std::memory_order_relaxed);
+    }
+
+    bool IsEmpty() const { return TopChunk == nullptr; }
+    int32 GetNumMarks() const { return NumMarks; }
+
+private:
+    // Header at the start of each chunk, followed by its data
+    struct alignas(16) FChunk {
+        FChunk* Next;       // Chunk below on the stack, or next cached chunk
+        SIZE_T DataSize;
+    };
+
+    static FORCEINLINE uint8* AlignPtr(uint8* Ptr, SIZE_T Alignment) {
+        return reinterpret_cast<uint8*>((reinterpret_cast<uintptr_t>(Ptr) + Alignment - 1) & ~(uintptr_t)(Alignment - 1));
+    }
+
+    static FORCEINLINE uint8* ChunkData(FChunk* Chunk) {
+        return reinterpret_cast<uint8*>(Chunk + 1);
+    }
+
+    void* AllocateNewChunk(SIZE_T Size, SIZE_T Alignment);
+    void FreeChunks(FChunk* NewTopChunk);
+    void BeginFrame();
+
+    uint8* Top = nullptr;
+    uint8* End = nullptr;
+    FChunk* TopChunk = nullptr;
+    FChunk* UnusedChunks = nullptr;       // Regular-size chunks kept for reuse
+    FChunk* UnusedLargeChunks = nullptr;  // Oversized chunks kept for reuse
+    int32 NumMarks = 0;
+    uint64 LocalFrame = 0;
+
+    static std::atomic<uint64> FrameNumber;
+
+    friend class FMemMark;
+};
+
+/**
+ * FMemMark - Frees everything allocated on a stack after the mark when it goes out of scope
+ */
+class FMemMark {
+public:
+    explicit FMemMark(FMemStack& InMem);
+
+    ~FMemMark() {
+        Pop();
+    }
+
+    /**
+     * Free the memory early; the mark does nothing after this
+     */
+    void Pop();
+
+    FMemMark(const FMemMark&) = delete;
+    FMemMark& operator=(const FMemMark&) = delete;
+
+private:
+    FMemStack& Mem;
+    uint8* SavedTop;
+    FMemStack::FChunk* SavedChunk;
+    bool bPopped = false;
+};
+
+} // namespace MonsterRender
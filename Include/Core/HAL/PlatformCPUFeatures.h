@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// MonsterEngine - Runtime CPU Feature Detection (UE5-style)
+
+#pragma once
+
+#include "Core/CoreTypes.h"
+
+namespace MonsterRender {
+
+/**
+ * FPlatformCPUFeatures - Instruction set extensions the running CPU and OS support
+ *
+ * Queried once with CPUID (and XGETBV for the register state the OS saves)
+ * and cached. A feature is only reported when the OS also preserves its
+ * registers across context switches, so AVX needs YMM state and AVX-512
+ * needs opmask/ZMM state enabled in XCR0. Non-x86 builds report nothing.
+ *
+ * Based on UE5's FPlatformMisc CPU queries
+ * Reference: Engine/Source/Runtime/Core/Private/Windows/WindowsPlatformMisc.cpp
+ */
+class FPlatformCPUFeatures {
+public:
+    enum EFeature : uint32 {
+        SSE2     = 1u << 0,
+        SSE41    = 1u << 1,
+        SSE42    = 1u << 2,
+        POPCNT   = 1u << 3,
+        AVX      = 1u << 4,
+        AVX2     = 1u << 5,
+        FMA3     = 1u << 6,
+        BMI2     = 1u << 7,
+        AVX512F  = 1u << 8,
+        AVX512BW = 1u << 9,
+        AVX512DQ = 1u << 10,
+        AVX512VL = 1u << 11,
+    };
+
+    /**
+     * Bitmask of EFeature values supported by this CPU and OS
+     */
+    static uint32 GetFeatureBits();
+
+    /**
+     * True if every feature in Features is supported
+     */
+    static bool HasFeatures(uint32 Features) {
+        return (GetFeatureBits() & Features) == Features;
+    }
+
+    /**
+     * Space-separated names of the supported features, for logging
+     */
+    static const char* GetFeatureString();
+};
+
+} // namespace MonsterRender
@@ -0,0 +1,136 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// MonsterEngine - Two-Level Segregated Fit Range Allocator
+
+#pragma once
+
+#include "Core/CoreTypes.h"
+#include <vector>
+
+namespace MonsterRender {
+
+/**
+ * Range handed out by FTLSFAllocator
+ */
+struct FTLSFAllocation {
+    static constexpr uint32 INVALID_HANDLE = ~0u;
+
+    uint64 Offset = 0;
+    uint64 Size = 0;                    // Size of the block, at least the requested size
+    uint32 Handle = INVALID_HANDLE;     // Passed back to Free
+
+    bool IsValid() const { return Handle != INVALID_HANDLE; }
+};
+
+/**
+ * FTLSFAllocator - Constant-time allocator for ranges of a memory region
+ *
+ * Manages offsets into a region it does not touch, so the region can be a
+ * CPU buffer or device memory. Free blocks are kept in size-segregated
+ * lists, 32 lists per power of two, found through two levels of bitmaps:
+ * allocation is a few bit scans and a split, and a free merges the block
+ * with its free neighbours immediately, so the region never needs a
+ * separate compaction pass.
+ *
+ * Block bookkeeping lives in a node array outside the region; handles are
+ * indices into it and are reused once freed. Sizes and offsets are rounded
+ * to the granularity given at initialization. Not thread-safe.
+ *
+ * Reference: M. Masmano et al., "TLSF: a New Dynamic Memory Allocator for
+ * Real-Time Systems", ECRTS 2004
+ */
+class FTLSFAllocator {
+public:
+    FTLSFAllocator() = default;
+    explicit FTLSFAllocator(uint64 Size, uint64 Granularity = DEFAULT_GRANULARITY);
+
+    FTLSFAllocator(const FTLSFAllocator&) = delete;
+    FTLSFAllocator& operator=(const FTLSFAllocator&) = delete;
+
+    static constexpr uint64 DEFAULT_GRANULARITY = 16;
+
+    /**
+     * Manage [0, Size) as one free block, dropping all allocations
+     * @param Granularity Power of two all offsets and sizes are multiples of
+     */
+    void Initialize(uint64 Size, uint64 Granularity = DEFAULT_GRANULARITY);
+
+    /**
+     * Free every allocation at once
+     */
+    void Reset();
+
+    /**
+     * Allocate Size bytes at an offset aligned to Alignment (a power of two)
+     * @return Invalid allocation if no free block is large enough
+     */
+    FTLSFAllocation Allocate(uint64 Size, uint64 Alignment = 1);
+
+    /**
+     * Free an allocation, merging it with adjacent free blocks
+     */
+    void Free(uint32 Handle);
+
+    void Free(const FTLSFAllocation& Allocation) {
+        Free(Allocation.Handle);
+    }
+
+    uint64 GetTotalSize() const { return TotalSize; }
+    uint64 GetUsedSize() const { return UsedSize; }
+    uint64 GetFreeSize() const { return TotalSize - UsedSize; }
+    uint32 GetNumAllocations() const { return NumAllocations; }
+    uint32 GetNumFreeBlocks() const { return NumFreeBlocks; }
+
+    /**
+     * Size of the largest free block (scans one free list)
+     */
+    uint64 GetLargestFreeBlock() const;
+
+    /**
+     * Share of free space outside the largest free block, 0 when the free space is contiguous
+     */
+    float GetFragmentation() const;
+
+    /**
+     * Check block links, free lists and bitmaps against each other
+     */
+    bool Validate() const;
+
+private:
+    static constexpr uint32 SL_BITS = 5;
+    static constexpr uint32 SL_COUNT = 1u << SL_BITS;   // Second-level lists per first level
+    static constexpr uint32 FL_COUNT = 64 - SL_BITS + 1;
+    static constexpr uint32 NONE = ~0u;
+
+    struct FBlock {
+        uint64 Offset;
+        uint64 Size;
+        uint32 PrevPhysical;    // Neighbours in the region
+        uint32 NextPhysical;
+        uint32 PrevFree;        // Links in the free list, when free
+        uint32 NextFree;
+        bool bFree;
+    };
+
+    static void MappingInsert(uint64 Size, uint32& OutFL, uint32& OutSL);
+
+    uint32 CreateBlock(uint64 Offset, uint64 Size);
+    void ReleaseBlock(uint32 Index);
+    uint32 FindFreeBlock(uint64 Size) const;
+    void InsertFreeBlock(uint32 Index);
+    void RemoveFreeBlock(uint32 Index);
+
+    std::vector<FBlock> Blocks;
+    std::vector<uint32> UnusedBlocks;
+
+    uint64 FLBitmap = 0;
+    uint32 SLBitmap[FL_COUNT] = {};
+    uint32 FreeHeads[FL_COUNT][SL_COUNT];
+
+    uint64 TotalSize = 0;
+    uint64 UsedSize = 0;
+    uint64 Granularity = DEFAULT_GRANULARITY;
+    uint32 NumAllocations = 0;
+    uint32 NumFreeBlocks = 0;
+};
+
+} // namespace MonsterRender
@@ -48,6 +48,18 @@ public:
     // Submit async read request (returns request ID)
     uint64 ReadAsync(const FReadRequest& Request);
 
+    // Result of an awaited read
+    struct FReadResult {
+        bool bSuccess = false;
+        SIZE_T BytesRead = 0;
+    };
+
+    // Awaitable read for TTask coroutines, defined in Core/IO/FAsyncFileIOTask.h
+    class FReadAwaiter;
+
+    // Awaitable async read: co_await FAsyncFileIO::Get().AwaitRead(Request)
+    FReadAwaiter AwaitRead(const FReadRequest& Request);
+
     // Wait for specific request to complete
     bool WaitForRequest(uint64 RequestID);
 
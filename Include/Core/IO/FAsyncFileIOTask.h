@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// MonsterEngine - Async File IO awaitable for TTask coroutines
+
+#pragma once
+
+#include "Core/IO/FAsyncFileIO.h"
+#include "Core/TTask.h"
+
+namespace MonsterRender {
+
+/**
+ * Awaitable read for TTask coroutines
+ * Submits the request on first suspension and resumes the coroutine on a
+ * task graph worker when the read finishes; no thread waits meanwhile.
+ * The request's own OnComplete, if any, still runs first.
+ *
+ * Kept apart from FAsyncFileIO.h so plain file I/O users do not pull in the
+ * task graph and coroutine headers.
+ */
+class FAsyncFileIO::FReadAwaiter {
+public:
+    FReadAwaiter(FAsyncFileIO& InFileIO, const FReadRequest& InRequest)
+        : FileIO(InFileIO)
+        , Request(InRequest)
+    {}
+
+    bool await_ready() const { return false; }
+
+    bool await_suspend(std::coroutine_handle<> Handle) {
+        FReadRequest request = Request;
+        request.OnComplete = [this, Handle](bool Success, SIZE_T BytesRead) {
+            if (Request.OnComplete) {
+                Request.OnComplete(Success, BytesRead);
+            }
+            Result.bSuccess = Success;
+            Result.BytesRead = BytesRead;
+            MonsterEngine::ResumeOnTaskGraph(Handle);
+        };
+
+        // Not submitted (IO system not initialized): resume immediately with failure
+        return FileIO.ReadAsync(request) != 0;
+    }
+
+    FReadResult await_resume() const { return Result; }
+
+private:
+    FAsyncFileIO& FileIO;
+    FReadRequest Request;
+    FReadResult Result;
+};
+
+inline FAsyncFileIO::FReadAwaiter FAsyncFileIO::AwaitRead(const FReadRequest& Request) {
+    return FReadAwaiter(*this, Request);
+}
+
+} // namespace MonsterRender
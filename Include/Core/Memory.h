@@ -2,11 +2,14 @@
 
 #include "Core/CoreMinimal.h"
 #include "Core/Templates/UniquePtr.h"
+#include "Core/HAL/TLSFAllocator.h"
 #include "Containers/Array.h"
+#include "Containers/Map.h"
 
 namespace MonsterRender {
 // Use MonsterEngine containers and smart pointers
 using MonsterEngine::TArray;
+using MonsterEngine::TMap;
 using MonsterEngine::TUniquePtr;
 using MonsterEngine::MakeUnique;
 }
@@ -32,7 +35,7 @@ namespace MonsterRender {
 	 * Unified memory system providing pooled allocators with advanced features.
 	 * - Small object pool (binned allocator, per-bin locks, TLS caching)
 	 * - Frame scratch pool (per-frame linear allocator, lock-free)
-	 * - Texture buffer pool (large block suballocator with free-list merging)
+	 * - Texture buffer pool (large blocks suballocated by TLSF: O(1) alloc/free, merged on free)
 	 * - Page recycling and defragmentation
 	 * - Comprehensive statistics and observability
 	 *
@@ -58,14 +61,14 @@ namespace MonsterRender {
 		void* frameAllocate(size_t size, size_t alignment = alignof(std::max_align_t));
 		void  frameReset();
 
-		// Texture buffer pool (large transient/staging buffers with free-list)
+		// Texture buffer pool (large transient/staging buffers, suballocated by TLSF)
 		void* textureAllocate(size_t size, size_t alignment = 256);
 		void  textureReleaseAll();
 		void  textureFree(void* ptr);  // Free specific allocation
 
 		// Maintenance & Defragmentation
 		void  trimEmptyPages();  // Release empty pages back to system
-		void  compactTextureBlocks();  // Merge free regions
+		void  compactTextureBlocks();  // No-op: free regions are merged as they are freed
 
 		// Huge Pages Support
 		bool  isHugePagesAvailable() const;  // Check if huge pages are supported
@@ -158,24 +161,23 @@ namespace MonsterRender {
 			std::atomic<uint64> allocations{0};
 		};
 
-		// Free region in texture block (for sub-allocation)
-		struct TextureFreeRegion {
-			uint64 offset;
-			uint64 size;
-			TextureFreeRegion* next = nullptr;
-		};
-
 		struct TextureBlock {
 			TUniquePtr<uint8[]> buffer;
 			uint8* rawHugePagePtr = nullptr;  // Huge page raw pointer (if used)
+			uint8* base = nullptr;  // Start of the range the allocator manages, 64KB aligned
 			uint64 capacity = 0;
-			std::atomic<uint64> offset{0};  // Bump allocator offset
-			TextureFreeRegion* freeList = nullptr;  // Linked list of free regions
-			std::mutex mutex;  // Per-block lock for free-list
+			FTLSFAllocator allocator;  // Ranges of the block
 			std::atomic<uint64> usedBytes{0};
 			bool usesHugePages = false;  // Track if this block uses huge pages
 		};
 
+		// Live texture allocation, for textureFree
+		struct TextureAllocation {
+			uint32 blockIndex = 0;
+			uint32 handle = FTLSFAllocation::INVALID_HANDLE;
+			uint64 size = 0;
+		};
+
 	private:
 		// Small bins for sizes up to 1024 bytes (power-of-two buckets)
 		static constexpr uint32 kNumSmallBins = 7; // 16,32,64,128,256,512,1024
@@ -194,7 +196,8 @@ namespace MonsterRender {
 		// Texture buffer pool
 		uint64 m_textureBlockSize = 0;
 		TArray<TUniquePtr<TextureBlock>> m_textureBlocks;
-		std::mutex m_textureBlocksMutex;
+		TMap<void*, TextureAllocation> m_textureLiveAllocations;
+		mutable std::mutex m_textureBlocksMutex;  // Guards the blocks, their allocators and the live allocations
 		std::atomic<uint64> m_textureReservedBytes{0};
 		std::atomic<uint64> m_textureUsedBytes{0};
 		std::atomic<uint64> m_textureAllocations{0};
@@ -217,10 +220,8 @@ namespace MonsterRender {
 		ThreadLocalCache* getTLSCache();
 		void releaseTLSCache(ThreadLocalCache* cache);
 		
-		// Texture free-list helpers
-		void* allocateFromFreeList(TextureBlock& block, size_t size, size_t alignment);
-		void addToFreeList(TextureBlock& block, void* ptr, size_t size);
-		void mergeFreeRegions(TextureBlock& block);
+		// Texture block helpers (m_textureBlocksMutex held)
+		void* allocateFromTextureBlock(uint32 blockIndex, size_t size, size_t alignment);
 
 		// Huge pages platform-specific helpers
 		bool detectHugePagesSupport();
@@ -0,0 +1,176 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+#pragma once
+
+#include "Core/CoreTypes.h"
+#include <atomic>
+#include <mutex>
+#include <new>
+
+namespace MonsterEngine {
+
+/**
+ * Fixed-size block allocator with per-thread caches
+ *
+ * Each thread keeps two bundles of free blocks. Allocate and Free only
+ * touch the calling thread's bundles; a full bundle is handed to (or a
+ * new one taken from) a global bundle list under a mutex, so the lock is
+ * taken at most once per BundleSize operations. Blocks freed on a thread
+ * other than the one that allocated them simply migrate into that
+ * thread's cache. Slabs are never returned to the system.
+ *
+ * All state is static: every instantiation with the same block size and
+ * alignment shares one pool.
+ *
+ * Based on UE5's TLockFreeFixedSizeAllocator_TLSCache
+ * Reference: Engine/Source/Runtime/Core/Public/Containers/LockFreeFixedSizeAllocator.h
+ *
+ * @tparam BlockSize - Size of each block in bytes
+ * @tparam BlockAlignment - Alignment of each block
+ * @tparam BundleSize - Number of blocks moved between a thread cache and the global list at once
+ */
+template<SIZE_T BlockSize, SIZE_T BlockAlignment = alignof(std::max_align_t), uint32 BundleSize = 64>
+class TFixedSizeAllocatorTLSCache {
+    /** Free block header, overlaid on the block memory */
+    struct FFreeBlock {
+        /** Next block in the same bundle */
+        FFreeBlock* Next;
+
+        /** Next bundle in the global list (head block of a bundle only) */
+        FFreeBlock* NextBundle;
+
+        /** Number of blocks in the bundle (head block of a bundle only) */
+        uint32 BundleCount;
+    };
+
+    static constexpr SIZE_T kAlignment = BlockAlignment > alignof(FFreeBlock) ? BlockAlignment : alignof(FFreeBlock);
+    static constexpr SIZE_T kMinSize = BlockSize > sizeof(FFreeBlock) ? BlockSize : sizeof(FFreeBlock);
+    static constexpr SIZE_T kBlockStride = (kMinSize + kAlignment - 1) & ~(kAlignment - 1);
+
+    static_assert((kAlignment & (kAlignment - 1)) == 0, "BlockAlignment must be a power of two");
+    static_assert(BundleSize > 0, "BundleSize must be positive");
+
+public:
+    /**
+     * Allocate one block
+     */
+    static void* Allocate() {
+        FThreadCache& cache = GetThreadCache();
+
+        if (cache.PartialBundle == nullptr) {
+            if (cache.FullBundle != nullptr) {
+                cache.PartialBundle = cache.FullBundle;
+                cache.NumPartial = BundleSize;
+                cache.FullBundle = nullptr;
+            } else {
+                cache.PartialBundle = GetGlobalState().PopBundle(cache.NumPartial);
+            }
+        }
+
+        FFreeBlock* block = cache.PartialBundle;
+        cache.PartialBundle = block->Next;
+        --cache.NumPartial;
+        return block;
+    }
+
+    /**
+     * Return a block to the calling thread's cache
+     *
+     * @param Ptr - Block from Allocate(), may come from any thread
+     */
+    static void Free(void* Ptr) {
+        if (Ptr == nullptr) {
+            return;
+        }
+
+        FThreadCache& cache = GetThreadCache();
+
+        if (cache.NumPartial >= BundleSize) {
+            if (cache.FullBundle != nullptr) {
+                GetGlobalState().PushBundle(cache.FullBundle, BundleSize);
+            }
+            cache.FullBundle = cache.PartialBundle;
+            cache.PartialBundle = nullptr;
+            cache.NumPartial = 0;
+        }
+
+        FFreeBlock* block = static_cast<FFreeBlock*>(Ptr);
+        block->Next = cache.PartialBundle;
+        cache.PartialBundle = block;
+        ++cache.NumPartial;
+    }
+
+    /**
+     * Number of blocks obtained from the system so far
+     */
+    static uint64 GetNumBlocksAllocated() {
+        return GetGlobalState().NumBlocksAllocated.load(std::memory_order_relaxed);
+    }
+
+private:
+    /** Global list of free bundles and slab allocation */
+    struct FGlobalState {
+        std::mutex Mutex;
+        FFreeBlock* Bundles = nullptr;
+        std::atomic<uint64> NumBlocksAllocated{0};
+
+        void PushBundle(FFreeBlock* Bundle, uint32 Count) {
+            Bundle->BundleCount = Count;
+            std::lock_guard<std::mutex> lock(Mutex);
+            Bundle->NextBundle = Bundles;
+            Bundles = Bundle;
+        }
+
+        FFreeBlock* PopBundle(uint32& OutCount) {
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+                if (Bundles != nullptr) {
+                    FFreeBlock* bundle = Bundles;
+                    Bundles = bundle->NextBundle;
+                    OutCount = bundle->BundleCount;
+                    return bundle;
+                }
+            }
+
+            // No free bundle anywhere, carve a new slab
+            uint8* slab = static_cast<uint8*>(::operator new(kBlockStride * BundleSize, std::align_val_t(kAlignment)));
+            FFreeBlock* head = nullptr;
+            for (uint32 i = BundleSize; i > 0; --i) {
+                FFreeBlock* block = reinterpret_cast<FFreeBlock*>(slab + (i - 1) * kBlockStride);
+                block->Next = head;
+                head = block;
+            }
+            NumBlocksAllocated.fetch_add(BundleSize, std::memory_order_relaxed);
+            OutCount = BundleSize;
+            return head;
+        }
+    };
+
+    /** Per-thread cache, returned to the global list on thread exit */
+    struct FThreadCache {
+        FFreeBlock* PartialBundle = nullptr;
+        FFreeBlock* FullBundle = nullptr;
+        uint32 NumPartial = 0;
+
+        ~FThreadCache() {
+            if (PartialBundle != nullptr) {
+                GetGlobalState().PushBundle(PartialBundle, NumPartial);
+            }
+            if (FullBundle != nullptr) {
+                GetGlobalState().PushBundle(FullBundle, BundleSize);
+            }
+        }
+    };
+
+    static FGlobalState& GetGlobalState() {
+        static FGlobalState s_state;
+        return s_state;
+    }
+
+    static FThreadCache& GetThreadCache() {
+        static thread_local FThreadCache t_cache;
+        return t_cache;
+    }
+};
+
+} // namespace MonsterEngine
@@ -0,0 +1,310 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+#pragma once
+
+#include "Core/CoreMinimal.h"
+#include "Core/FGraphEvent.h"
+#include "Core/FTaskGraph.h"
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+
+namespace MonsterEngine {
+
+template<typename ResultType = void>
+class TTask;
+
+/**
+ * Resume a suspended coroutine on a task graph worker
+ * Resumes inline when the task graph is not running. Custom awaitables
+ * call this from their completion callback.
+ */
+inline void ResumeOnTaskGraph(std::coroutine_handle<> Handle) {
+    if (FTaskGraph::IsInitialized()) {
+        FGraphEventRef event = FTaskGraph::QueueNamedTask("CoroutineResume", [Handle]() {
+            Handle.resume();
+        });
+        if (event) {
+            return;
+        }
+    }
+    Handle.resume();
+}
+
+namespace TaskPrivate {
+
+/**
+ * Shared completion state of a TTask
+ * Outlives the coroutine frame, which destroys itself on completion
+ */
+template<typename ResultType>
+struct TTaskState {
+    FGraphEventRef CompletionEvent = MakeGraphEvent();
+    std::optional<ResultType> Result;
+    std::exception_ptr Exception;
+
+    ResultType& GetResult() {
+        if (Exception) {
+            std::rethrow_exception(Exception);
+        }
+        return *Result;
+    }
+};
+
+template<>
+struct TTaskState<void> {
+    FGraphEventRef CompletionEvent = MakeGraphEvent();
+    std::exception_ptr Exception;
+
+    void GetResult() {
+        if (Exception) {
+            std::rethrow_exception(Exception);
+        }
+    }
+};
+
+/**
+ * Awaiter that suspends until a graph event completes
+ *
+ * Registers itself as a subsequent of the event, so no thread blocks while
+ * the coroutine is suspended. The coroutine is resumed on a task graph
+ * worker once the event completes.
+ */
+class FGraphEventAwaiter : public FBaseGraphTask {
+public:
+    explicit FGraphEventAwaiter(FGraphEventRef InEvent)
+        : m_event(std::move(InEvent))
+    {}
+
+    bool await_ready() const {
+        return !m_event || m_event->IsComplete();
+    }
+
+    bool await_suspend(std::coroutine_handle<> Handle) {
+        m_handle = Handle;
+        // False when the event completed in the meantime: resume immediately
+        return m_event->AddSubsequent(this);
+    }
+
+    void await_resume() const {}
+
+    virtual void OnPrerequisiteCompleted() override {
+        // The awaiter lives in the coroutine frame; do not touch it after resuming
+        ResumeOnTaskGraph(m_handle);
+    }
+
+private:
+    FGraphEventRef m_event;
+    std::coroutine_handle<> m_handle;
+};
+
+template<typename Type>
+struct TIsTask : std::false_type {};
+
+template<typename ResultType>
+struct TIsTask<TTask<ResultType>> : std::true_type {};
+
+/**
+ * Promise type shared by all TTask instantiations
+ */
+template<typename ResultType>
+class TTaskPromiseBase {
+public:
+    /** Start the coroutine body on a task graph worker */
+    struct FScheduleAwaiter {
+        bool await_ready() const {
+            return !FTaskGraph::IsInitialized();
+        }
+
+        void await_suspend(std::coroutine_handle<> Handle) const {
+            ResumeOnTaskGraph(Handle);
+        }
+
+        void await_resume() const {}
+    };
+
+    /** Destroy the frame, then signal completion */
+    struct FFinalAwaiter {
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        template<typename PromiseType>
+        void await_suspend(std::coroutine_handle<PromiseType> Handle) const noexcept {
+            // Keep the state alive past the frame and complete last, so waiters
+            // never observe a half-destroyed coroutine
+            TSharedPtr<TTaskState<ResultType>> state = Handle.promise().m_state;
+            Handle.destroy();
+            state->CompletionEvent->Complete();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    FScheduleAwaiter initial_suspend() noexcept {
+        return {};
+    }
+
+    FFinalAwaiter final_suspend() noexcept {
+        return {};
+    }
+
+    void unhandled_exception() {
+        m_state->Exception = std::current_exception();
+    }
+
+    /** co_await on a graph event */
+    FGraphEventAwaiter await_transform(FGraphEventRef Event) {
+        return FGraphEventAwaiter(std::move(Event));
+    }
+
+    /** co_await on another task, yields its result */
+    template<typename OtherResultType>
+    auto await_transform(const TTask<OtherResultType>& Task) {
+        struct FTaskAwaiter : FGraphEventAwaiter {
+            TSharedPtr<TTaskState<OtherResultType>> State;
+
+            explicit FTaskAwaiter(TSharedPtr<TTaskState<OtherResultType>> InState)
+                : FGraphEventAwaiter(InState->CompletionEvent)
+                , State(std::move(InState))
+            {}
+
+            decltype(auto) await_resume() const {
+                return State->GetResult();
+            }
+        };
+        return FTaskAwaiter(Task.m_state);
+    }
+
+    /** Any other awaitable (e.g. FAsyncFileIO reads) passes through unchanged */
+    template<typename AwaitableType,
+             typename = std::enable_if_t<!TIsTask<std::decay_t<AwaitableType>>::value &&
+                                         !std::is_same_v<std::decay_t<AwaitableType>, FGraphEventRef>>>
+    AwaitableType&& await_transform(AwaitableType&& Awaitable) {
+        return std::forward<AwaitableType>(Awaitable);
+    }
+
+protected:
+    TSharedPtr<TTaskState<ResultType>> m_state = MakeShared<TTaskState<ResultType>>();
+};
+
+template<typename ResultType>
+class TTaskPromise : public TTaskPromiseBase<ResultType> {
+public:
+    TTask<ResultType> get_return_object();
+
+    template<typename ValueType>
+    void return_value(ValueType&& Value) {
+        this->m_state->Result.emplace(std::forward<ValueType>(Value));
+    }
+};
+
+template<>
+class TTaskPromise<void> : public TTaskPromiseBase<void> {
+public:
+    TTask<void> get_return_object();
+
+    void return_void() {}
+};
+
+} // namespace TaskPrivate
+
+/**
+ * Coroutine task scheduled on FTaskGraph workers
+ *
+ * A function returning TTask<T> is a C++20 coroutine. Its body starts on a
+ * task graph worker and may co_await:
+ * - an FGraphEventRef (e.g. from FTaskGraph::QueueTask),
+ * - another TTask<U>, yielding its result,
+ * - an FAsyncFileIO read (FAsyncFileIO::AwaitRead, in Core/IO/FAsyncFileIOTask.h).
+ * While suspended it occupies no thread; it resumes on a worker when the
+ * awaited operation completes. This lets multi-stage pipelines
+ * (read -> decode -> build -> upload) be written as straight-line code.
+ *
+ * The coroutine frame frees itself on completion. The TTask handle only
+ * shares the completion state, so it may be dropped at any time (fire and
+ * forget) or kept to wait on / chain from.
+ *
+ * Exceptions thrown by the body are captured and rethrown by GetResult()
+ * and by co_await.
+ *
+ * Based on UE5's UE::Tasks::TTask
+ * Reference: Engine/Source/Runtime/Core/Public/Tasks/Task.h
+ *
+ * Example:
+ *   TTask<int32> LoadAsset(const char* Path) {
+ *       auto read = co_await FAsyncFileIO::Get().AwaitRead(Request);
+ *       FDecoded decoded = co_await DecodeTask(buffer);
+ *       co_return Build(decoded);
+ *   }
+ */
+template<typename ResultType>
+class TTask {
+public:
+    using promise_type = TaskPrivate::TTaskPromise<ResultType>;
+
+    TTask() = default;
+
+    /** Whether this handle refers to a task */
+    bool IsValid() const {
+        return m_state.IsValid();
+    }
+
+    /** Whether the task has finished (non-blocking) */
+    bool IsCompleted() const {
+        return m_state && m_state->CompletionEvent->IsComplete();
+    }
+
+    /**
+     * Block until the task has finished
+     * Prefer co_await inside other tasks; this blocks the calling thread
+     */
+    void Wait() const {
+        if (m_state) {
+            m_state->CompletionEvent->Wait();
+        }
+    }
+
+    /**
+     * Wait for the task and return its result
+     * Rethrows an exception thrown by the task body
+     */
+    decltype(auto) GetResult() const {
+        Wait();
+        return m_state->GetResult();
+    }
+
+    /**
+     * Completion event, usable as a prerequisite for FTaskGraph tasks
+     */
+    FGraphEventRef GetCompletionEvent() const {
+        return m_state ? m_state->CompletionEvent : FGraphEventRef();
+    }
+
+private:
+    template<typename> friend class TaskPrivate::TTaskPromise;
+    template<typename> friend class TaskPrivate::TTaskPromiseBase;
+
+    explicit TTask(TSharedPtr<TaskPrivate::TTaskState<ResultType>> InState)
+        : m_state(std::move(InState))
+    {}
+
+    /** Completion state shared with the coroutine frame */
+    TSharedPtr<TaskPrivate::TTaskState<ResultType>> m_state;
+};
+
+namespace TaskPrivate {
+
+template<typename ResultType>
+TTask<ResultType> TTaskPromise<ResultType>::get_return_object() {
+    return TTask<ResultType>(this->m_state);
+}
+
+inline TTask<void> TTaskPromise<void>::get_return_object() {
+    return TTask<void>(this->m_state);
+}
+
+} // namespace TaskPrivate
+
+} // namespace MonsterEngine
@@ -0,0 +1,132 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+#pragma once
+
+#include "Core/CoreTypes.h"
+#include <atomic>
+
+namespace MonsterEngine {
+
+/**
+ * Bounded lock-free work-stealing deque (Chase-Lev)
+ *
+ * The owning worker pushes and pops at the bottom (LIFO, cache-warm),
+ * other workers steal from the top (FIFO, oldest work first).
+ * Only the owner thread may call Push/Pop; any thread may call Steal.
+ *
+ * Based on UE5's TWorkStealingQueueBase2
+ * Reference: Engine/Source/Runtime/Core/Public/Async/Fundamental/LocalQueue.h
+ * Reference: Le, Pop, Cohen, Zappa Nardelli - "Correct and Efficient
+ *            Work-Stealing for Weak Memory Models" (PPoPP 2013)
+ *
+ * @tparam ItemType - Element type, stored by pointer
+ * @tparam Capacity - Number of slots, must be a power of two
+ */
+template<typename ItemType, uint32 Capacity>
+class TWorkStealingQueue {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    TWorkStealingQueue() {
+        for (uint32 i = 0; i < Capacity; ++i) {
+            m_items[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    TWorkStealingQueue(const TWorkStealingQueue&) = delete;
+    TWorkStealingQueue& operator=(const TWorkStealingQueue&) = delete;
+
+    /**
+     * Push an item at the bottom (owner thread only)
+     *
+     * @param Item - Item to push, must not be null
+     * @return False if the queue is full
+     */
+    bool Push(ItemType* Item) {
+        const int64 bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64 top = m_top.load(std::memory_order_acquire);
+
+        if (bottom - top >= static_cast<int64>(Capacity)) {
+            return false;
+        }
+
+        m_items[bottom & kIndexMask].store(Item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * Pop the most recently pushed item (owner thread only)
+     *
+     * @return Item or nullptr if the queue is empty
+     */
+    ItemType* Pop() {
+        const int64 bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64 top = m_top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            // Queue was empty
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        ItemType* item = m_items[bottom & kIndexMask].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // Last item, race against thieves for it
+            if (!m_top.compare_exchange_strong(top, top + 1,
+                    std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item = nullptr;
+            }
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return item;
+    }
+
+    /**
+     * Steal the oldest item (any thread)
+     *
+     * @return Item or nullptr if the queue is empty or the race was lost
+     */
+    ItemType* Steal() {
+        int64 top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64 bottom = m_bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return nullptr;
+        }
+
+        ItemType* item = m_items[top & kIndexMask].load(std::memory_order_relaxed);
+        if (!m_top.compare_exchange_strong(top, top + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return item;
+    }
+
+    /**
+     * Approximate number of queued items (racy, for statistics only)
+     */
+    uint32 Num() const {
+        const int64 bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64 top = m_top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<uint32>(bottom - top) : 0;
+    }
+
+private:
+    static constexpr int64 kIndexMask = static_cast<int64>(Capacity) - 1;
+
+    /** Steal end, written by thieves (separate cache line from bottom) */
+    alignas(64) std::atomic<int64> m_top{0};
+
+    /** Owner end */
+    alignas(64) std::atomic<int64> m_bottom{0};
+
+    /** Ring buffer of item slots */
+    alignas(64) std::atomic<ItemType*> m_items[Capacity];
+};
+
+} // namespace MonsterEngine
@@ -0,0 +1,195 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+#pragma once
+
+/**
+ * @file InlineFunction.h
+ * @brief Move-only function wrapper with inline storage
+ *
+ * TInlineFunction stores callables up to InlineSize bytes inside the object
+ * itself and only falls back to the heap for larger captures. Used for task
+ * delegates where std::function would allocate for most non-trivial lambdas.
+ *
+ * Based on UE5's TUniqueFunction with inline allocator
+ * Reference: Engine/Source/Runtime/Core/Public/Templates/Function.h
+ */
+
+#include "Core/CoreTypes.h"
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace MonsterEngine
+{
+
+template<typename FuncType, uint32 InlineSize = 64>
+class TInlineFunction;
+
+/**
+ * TInlineFunction - Move-only callable wrapper
+ *
+ * @tparam Ret Return type
+ * @tparam ParamTypes Parameter types
+ * @tparam InlineSize Bytes of inline storage for the callable
+ */
+template<typename Ret, typename... ParamTypes, uint32 InlineSize>
+class TInlineFunction<Ret(ParamTypes...), InlineSize>
+{
+    /** Type-erased operations for the stored callable */
+    struct FOps
+    {
+        Ret (*Invoke)(void* Storage, ParamTypes&&... Params);
+        void (*MoveConstruct)(void* Dest, void* Src);
+        void (*Destroy)(void* Storage);
+    };
+
+    template<typename FunctorType>
+    static constexpr bool FitsInline =
+        sizeof(FunctorType) <= InlineSize &&
+        alignof(FunctorType) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<FunctorType>;
+
+    /** Ops for callables stored in the inline buffer */
+    template<typename FunctorType>
+    struct TInlineOps
+    {
+        static Ret Invoke(void* Storage, ParamTypes&&... Params)
+        {
+            return (*static_cast<FunctorType*>(Storage))(std::forward<ParamTypes>(Params)...);
+        }
+
+        static void MoveConstruct(void* Dest, void* Src)
+        {
+            new (Dest) FunctorType(std::move(*static_cast<FunctorType*>(Src)));
+            static_cast<FunctorType*>(Src)->~FunctorType();
+        }
+
+        static void Destroy(void* Storage)
+        {
+            static_cast<FunctorType*>(Storage)->~FunctorType();
+        }
+
+        static constexpr FOps Ops = { &Invoke, &MoveConstruct, &Destroy };
+    };
+
+    /** Ops for callables too large for the inline buffer (buffer holds a pointer) */
+    template<typename FunctorType>
+    struct THeapOps
+    {
+        static Ret Invoke(void* Storage, ParamTypes&&... Params)
+        {
+            return (**static_cast<FunctorType**>(Storage))(std::forward<ParamTypes>(Params)...);
+        }
+
+        static void MoveConstruct(void* Dest, void* Src)
+        {
+            *static_cast<FunctorType**>(Dest) = *static_cast<FunctorType**>(Src);
+            *static_cast<FunctorType**>(Src) = nullptr;
+        }
+
+        static void Destroy(void* Storage)
+        {
+            delete *static_cast<FunctorType**>(Storage);
+        }
+
+        static constexpr FOps Ops = { &Invoke, &MoveConstruct, &Destroy };
+    };
+
+public:
+    TInlineFunction() = default;
+
+    TInlineFunction(std::nullptr_t)
+    {
+    }
+
+    /**
+     * Construct from any callable
+     * Callables up to InlineSize bytes are stored inline, larger ones on the heap
+     */
+    template<typename FunctorType,
+             typename = std::enable_if_t<!std::is_same_v<std::decay_t<FunctorType>, TInlineFunction> &&
+                                         !std::is_same_v<std::decay_t<FunctorType>, std::nullptr_t>>>
+    TInlineFunction(FunctorType&& Functor)
+    {
+        using FDecayedFunctor = std::decay_t<FunctorType>;
+
+        if constexpr (FitsInline<FDecayedFunctor>)
+        {
+            new (Storage) FDecayedFunctor(std::forward<FunctorType>(Functor));
+            Ops = &TInlineOps<FDecayedFunctor>::Ops;
+        }
+        else
+        {
+            *reinterpret_cast<FDecayedFunctor**>(Storage) = new FDecayedFunctor(std::forward<FunctorType>(Functor));
+            Ops = &THeapOps<FDecayedFunctor>::Ops;
+        }
+    }
+
+    TInlineFunction(TInlineFunction&& Other) noexcept
+    {
+        MoveFrom(Other);
+    }
+
+    TInlineFunction& operator=(TInlineFunction&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            Reset();
+            MoveFrom(Other);
+        }
+        return *this;
+    }
+
+    TInlineFunction(const TInlineFunction&) = delete;
+    TInlineFunction& operator=(const TInlineFunction&) = delete;
+
+    ~TInlineFunction()
+    {
+        Reset();
+    }
+
+    /** Destroy the stored callable */
+    void Reset()
+    {
+        if (Ops)
+        {
+            Ops->Destroy(Storage);
+            Ops = nullptr;
+        }
+    }
+
+    /** Invoke the stored callable (must be bound) */
+    FORCEINLINE Ret operator()(ParamTypes... Params) const
+    {
+        return Ops->Invoke(Storage, std::forward<ParamTypes>(Params)...);
+    }
+
+    FORCEINLINE bool IsSet() const
+    {
+        return Ops != nullptr;
+    }
+
+    FORCEINLINE explicit operator bool() const
+    {
+        return Ops != nullptr;
+    }
+
+private:
+    void MoveFrom(TInlineFunction& Other)
+    {
+        if (Other.Ops)
+        {
+            Other.Ops->MoveConstruct(Storage, Other.Storage);
+            Ops = Other.Ops;
+            Other.Ops = nullptr;
+        }
+    }
+
+    /** Operations for the stored callable, null when unbound */
+    const FOps* Ops = nullptr;
+
+    /** Inline callable storage (or pointer to heap callable) */
+    alignas(std::max_align_t) mutable uint8 Storage[InlineSize];
+};
+
+} // namespace MonsterEngine
@@ -0,0 +1,258 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+#pragma once
+
+/**
+ * @file RadixSort.h
+ * @brief LSD radix sort for arrays sorted by an integral or floating-point key
+ *
+ * RadixSort orders elements by the key a functor extracts from each of them:
+ * - Unsigned, signed and floating-point keys of 8 to 64 bits are supported;
+ *   signed and float keys are remapped to unsigned integers of the same order
+ * - One 8-bit digit per pass; passes on which every key shares the digit are
+ *   skipped, so 64-bit keys with unused high bits cost only the bits they use
+ * - Stable, and O(N) instead of O(N log N) comparisons
+ * - Optionally splits the histogram and scatter of each pass over the task graph
+ * - Scratch and histograms are taken from the calling thread's FMemStack under
+ *   a mark, so a sort makes no heap allocations once the stack is warm
+ *
+ * Elements are moved with memcpy, so they must be trivially copyable.
+ *
+ * Based on UE5's RadixSort32/RadixSort64
+ * Reference: Engine/Source/Runtime/Core/Public/Templates/Sorting.h
+ */
+
+#include "Core/CoreTypes.h"
+#include "Core/FTaskGraph.h"
+#include "Core/HAL/MemStack.h"
+#include "Containers/Array.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace MonsterEngine
+{
+
+namespace RadixSortPrivate
+{
+    /** Digits are 8 bits wide, so each pass has 256 buckets */
+    constexpr int32 NumBuckets = 256;
+
+    /** Arrays this small are sorted with a comparison sort instead */
+    constexpr int32 MinRadixSortNum = 256;
+
+    /** Fewest elements worth handing to one task per pass */
+    constexpr int32 MinElementsPerChunk = 16 * 1024;
+
+    /** Upper bound on the number of chunks, matching ParallelFor's participant limit */
+    constexpr int32 MaxChunks = 64;
+
+    /**
+     * Maps a key to an unsigned integer with the same ordering
+     * - signed integers: flip the sign bit
+     * - floats: flip the sign bit of positive values, all bits of negative ones
+     */
+    template<typename KeyType>
+    FORCEINLINE auto ToRadixKey(KeyType Key)
+    {
+        static_assert(std::is_arithmetic_v<KeyType>, "Radix sort keys must be integral or floating-point");
+
+        if constexpr (std::is_floating_point_v<KeyType>)
+        {
+            using FBits = std::conditional_t<sizeof(KeyType) == 4, uint32, uint64>;
+            static_assert(sizeof(KeyType) == sizeof(FBits), "Unsupported floating-point key size");
+            FBits Bits;
+            std::memcpy(&Bits, &Key, sizeof(Bits));
+            constexpr FBits SignBit = FBits(1) << (sizeof(FBits) * 8 - 1);
+            const FBits Mask = (Bits & SignBit) ? ~FBits(0) : SignBit;
+            return static_cast<FBits>(Bits ^ Mask);
+        }
+        else
+        {
+            using FBits = std::conditional_t<(sizeof(KeyType) <= 4), uint32, uint64>;
+            if constexpr (std::is_signed_v<KeyType>)
+            {
+                // Sign-extend to the full width first so every width maps the same way
+                using FSigned = std::make_signed_t<FBits>;
+                constexpr FBits SignBit = FBits(1) << (sizeof(FBits) * 8 - 1);
+                return static_cast<FBits>(static_cast<FBits>(static_cast<FSigned>(Key)) ^ SignBit);
+            }
+            else
+            {
+                return static_cast<FBits>(Key);
+            }
+        }
+    }
+
+    /** Number of chunks each pass is split into; 1 runs the passes on the calling thread */
+    inline int32 GetNumChunks(int32 Num, bool bParallel)
+    {
+        if (!bParallel || !FTaskGraph::IsInitialized())
+        {
+            return 1;
+        }
+        const int32 NumThreads = static_cast<int32>(FTaskGraph::GetNumWorkerThreads()) + 1;
+        return std::max(1, std::min({NumThreads, Num / MinElementsPerChunk, MaxChunks}));
+    }
+} // namespace RadixSortPrivate
+
+/**
+ * Sorts Num elements of Data by ascending KeyFunc(Element)
+ *
+ * @param Data - Elements to sort
+ * @param Scratch - Buffer of at least Num elements; its contents are overwritten
+ * @param Num - Number of elements
+ * @param KeyFunc - Callable returning the sort key of an element; called once per element per pass
+ * @param bParallel - Split each pass over the task graph when the array is large enough
+ */
+template<typename ElementType, typename KeyFuncType>
+void RadixSort(ElementType* Data, ElementType* Scratch, int32 Num, KeyFuncType KeyFunc, bool bParallel = false)
+{
+    static_assert(std::is_trivially_copyable_v<ElementType>, "RadixSort moves elements with memcpy");
+
+    using namespace RadixSortPrivate;
+    using FKey = decltype(ToRadixKey(KeyFunc(*Data)));
+    constexpr int32 NumPasses = static_cast<int32>(sizeof(FKey));
+
+    if (Num < MinRadixSortNum)
+    {
+        std::stable_sort(Data, Data + Num, [&KeyFunc](const ElementType& A, const ElementType& B)
+        {
+            return ToRadixKey(KeyFunc(A)) < ToRadixKey(KeyFunc(B));
+        });
+        return;
+    }
+
+    const int32 NumChunks = GetNumChunks(Num, bParallel);
+    auto ChunkBegin = [Num, NumChunks](int32 Chunk)
+    {
+        return static_cast<int32>(static_cast<int64>(Num) * Chunk / NumChunks);
+    };
+
+    // Histograms live until the end of the sort; the mark is declared first so it pops last
+    MonsterRender::FMemMark Mark(MonsterRender::FMemStack::Get());
+
+    // Counts[Chunk][Pass][Bucket]: every digit of every key is counted in one read
+    TArray<uint32, TMemStackAllocator<>> Counts;
+    Counts.SetNumZeroed(NumChunks * NumPasses * NumBuckets);
+    FTaskGraph::ParallelFor(NumChunks, [&](int32 Chunk)
+    {
+        uint32* ChunkCounts = Counts.GetData() + Chunk * NumPasses * NumBuckets;
+        const int32 End = ChunkBegin(Chunk + 1);
+        for (int32 Index = ChunkBegin(Chunk); Index < End; ++Index)
+        {
+            const FKey Key = ToRadixKey(KeyFunc(Data[Index]));
+            for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+            {
+                ++ChunkCounts[Pass * NumBuckets + ((Key >> (Pass * 8)) & 0xFF)];
+            }
+        }
+    });
+
+    // Offsets[Chunk][Bucket]: next write position of each chunk in the current pass
+    TArray<uint32, TMemStackAllocator<>> Offsets;
+    Offsets.SetNumUninitialized(NumChunks * NumBuckets);
+
+    ElementType* Src = Data;
+    ElementType* Dst = Scratch;
+    bool bFirstPass = true;
+
+    for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+    {
+        const int32 Shift = Pass * 8;
+
+        // Skip digits every key shares; chunk counts of a pass sum to the same totals in any order
+        bool bTrivial = false;
+        for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+        {
+            uint32 Total = 0;
+            for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+            {
+                Total += Counts[(Chunk * NumPasses + Pass) * NumBuckets + Bucket];
+            }
+            if (Total != 0)
+            {
+                bTrivial = Total == static_cast<uint32>(Num);
+                break;
+            }
+        }
+        if (bTrivial)
+        {
+            continue;
+        }
+
+        // The up-front counts split by chunk only describe the original order;
+        // later passes recount their digit in the current order
+        if (!bFirstPass && NumChunks > 1)
+        {
+            FTaskGraph::ParallelFor(NumChunks, [&](int32 Chunk)
+            {
+                uint32* ChunkCounts = Counts.GetData() + (Chunk * NumPasses + Pass) * NumBuckets;
+                std::memset(ChunkCounts, 0, NumBuckets * sizeof(uint32));
+                const int32 End = ChunkBegin(Chunk + 1);
+                for (int32 Index = ChunkBegin(Chunk); Index < End; ++Index)
+                {
+                    ++ChunkCounts[(ToRadixKey(KeyFunc(Src[Index])) >> Shift) & 0xFF];
+                }
+            });
+        }
+
+        // Bucket-major prefix sum keeps equal digits in chunk order, so the sort stays stable
+        uint32 Offset = 0;
+        for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+        {
+            for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+            {
+                Offsets[Chunk * NumBuckets + Bucket] = Offset;
+                Offset += Counts[(Chunk * NumPasses + Pass) * NumBuckets + Bucket];
+            }
+        }
+
+        FTaskGraph::ParallelFor(NumChunks, [&](int32 Chunk)
+        {
+            uint32* ChunkOffsets = Offsets.GetData() + Chunk * NumBuckets;
+            const int32 End = ChunkBegin(Chunk + 1);
+            for (int32 Index = ChunkBegin(Chunk); Index < End; ++Index)
+            {
+                const uint32 Bucket = static_cast<uint32>((ToRadixKey(KeyFunc(Src[Index])) >> Shift) & 0xFF);
+                std::memcpy(static_cast<void*>(&Dst[ChunkOffsets[Bucket]++]), &Src[Index], sizeof(ElementType));
+            }
+        });
+
+        std::swap(Src, Dst);
+        bFirstPass = false;
+    }
+
+    if (Src != Data)
+    {
+        std::memcpy(static_cast<void*>(Data), Src, static_cast<size_t>(Num) * sizeof(ElementType));
+    }
+}
+
+/**
+ * Sorts an array by ascending KeyFunc(Element)
+ * For descending order, negate float keys or invert unsigned ones in KeyFunc.
+ * The scratch copy is taken from the calling thread's FMemStack and released
+ * before returning.
+ *
+ * @param Array - Array to sort
+ * @param KeyFunc - Callable returning the sort key of an element
+ * @param bParallel - Split each pass over the task graph when the array is large enough
+ */
+template<typename ElementType, typename AllocatorType, typename KeyFuncType>
+void RadixSort(TArray<ElementType, AllocatorType>& Array, KeyFuncType KeyFunc, bool bParallel = false)
+{
+    if (Array.Num() < RadixSortPrivate::MinRadixSortNum)
+    {
+        RadixSort(Array.GetData(), static_cast<ElementType*>(nullptr), Array.Num(), KeyFunc, bParallel);
+        return;
+    }
+
+    MonsterRender::FMemStack& Mem = MonsterRender::FMemStack::Get();
+    MonsterRender::FMemMark Mark(Mem);
+    ElementType* Scratch = Mem.AllocArray<ElementType>(static_cast<SIZE_T>(Array.Num()));
+    RadixSort(Array.GetData(), Scratch, Array.Num(), KeyFunc, bParallel);
+}
+
+} // namespace MonsterEngine
@@ -18,6 +18,7 @@
 #include "Core/CoreTypes.h"
 #include "Core/Templates/SharedPointerFwd.h"
 #include "Core/HAL/FMemory.h"
+#include "Core/TFixedSizeAllocatorTLSCache.h"
 
 #include <atomic>
 #include <type_traits>
@@ -331,22 +332,30 @@ struct DefaultDeleter
  * TReferenceControllerPool - Memory pool for reference controllers
  * 
  * Provides efficient allocation/deallocation of reference controllers
- * by reusing freed memory blocks. Thread-safe for ThreadSafe mode.
+ * by reusing freed memory blocks.
+ * 
+ * ThreadSafe mode is backed by TFixedSizeAllocatorTLSCache: allocations
+ * and frees hit a per-thread cache and never return memory to the system,
+ * so controllers can be created and released on different threads without
+ * contention (and without the ABA hazard of a shared lock-free free list).
+ * NotThreadSafe mode keeps a single free list capped at MaxPoolSize.
+ * 
+ * The free list controls (GetPooledCount, SetMaxPoolSize, Clear) only
+ * exist in NotThreadSafe mode; using them on a ThreadSafe pool is a
+ * compile error, since the thread caches have no cap and cannot be trimmed.
  * 
  * Based on UE5's object pool patterns for high-frequency allocations.
  */
 template<typename ControllerType, ESPMode Mode>
 class TReferenceControllerPool
 {
-    // Use atomic or regular pointer based on thread safety mode
-    using NodePtrType = std::conditional_t<Mode == ESPMode::ThreadSafe, 
-                                            std::atomic<void*>, void*>;
-
     struct FreeNode
     {
         FreeNode* Next;
     };
 
+    using FThreadSafeAllocator = TFixedSizeAllocatorTLSCache<sizeof(ControllerType), alignof(ControllerType)>;
+
 public:
     static TReferenceControllerPool& Get()
     {
@@ -359,33 +368,22 @@ public:
     {
         if constexpr (Mode == ESPMode::ThreadSafe)
         {
-            // Lock-free pop from free list
-            void* Head = FreeList.load(std::memory_order_acquire);
-            while (Head != nullptr)
-            {
-                FreeNode* Node = static_cast<FreeNode*>(Head);
-                if (FreeList.compare_exchange_weak(Head, Node->Next,
-                    std::memory_order_release, std::memory_order_relaxed))
-                {
-                    PooledCount.fetch_sub(1, std::memory_order_relaxed);
-                    return Head;
-                }
-            }
+            return FThreadSafeAllocator::Allocate();
         }
         else
         {
             if (FreeList != nullptr)
             {
-                void* Result = FreeList;
-                FreeList = static_cast<FreeNode*>(FreeList)->Next;
+                FreeNode* Result = FreeList;
+                FreeList = Result->Next;
                 --PooledCount;
                 return Result;
             }
-        }
 
-        // No pooled memory available, allocate new
-        TotalAllocated.fetch_add(1, std::memory_order_relaxed);
-        return MonsterRender::FMemory::Malloc(sizeof(ControllerType), alignof(ControllerType));
+            // No pooled memory available, allocate new
+            ++TotalAllocated;
+            return MonsterRender::FMemory::Malloc(sizeof(ControllerType), alignof(ControllerType));
+        }
     }
 
     /** Return memory to the pool */
@@ -396,129 +394,91 @@ public:
             return;
         }
 
-        // Check if we should pool or actually free
-        int32 CurrentPooled;
         if constexpr (Mode == ESPMode::ThreadSafe)
         {
-            CurrentPooled = PooledCount.load(std::memory_order_relaxed);
+            FThreadSafeAllocator::Free(Ptr);
         }
         else
         {
-            CurrentPooled = PooledCount;
-        }
-
-        if (CurrentPooled >= MaxPoolSize)
-        {
-            // Pool is full, actually free the memory
-            MonsterRender::FMemory::Free(Ptr);
-            TotalAllocated.fetch_sub(1, std::memory_order_relaxed);
-            return;
-        }
-
-        // Add to free list
-        FreeNode* Node = static_cast<FreeNode*>(Ptr);
-        
-        if constexpr (Mode == ESPMode::ThreadSafe)
-        {
-            // Lock-free push to free list
-            void* Head = FreeList.load(std::memory_order_relaxed);
-            do
+            if (PooledCount >= MaxPoolSize)
             {
-                Node->Next = static_cast<FreeNode*>(Head);
-            } while (!FreeList.compare_exchange_weak(Head, Node,
-                std::memory_order_release, std::memory_order_relaxed));
-            
-            PooledCount.fetch_add(1, std::memory_order_relaxed);
-        }
-        else
-        {
-            Node->Next = static_cast<FreeNode*>(FreeList);
+                // Pool is full, actually free the memory
+                MonsterRender::FMemory::Free(Ptr);
+                --TotalAllocated;
+                return;
+            }
+
+            FreeNode* Node = static_cast<FreeNode*>(Ptr);
+            Node->Next = FreeList;
             FreeList = Node;
             ++PooledCount;
         }
     }
 
-    /** Get statistics */
+    /** Get number of free blocks held by the pool (NotThreadSafe mode only) */
     int32 GetPooledCount() const
+    {
+        static_assert(Mode == ESPMode::NotThreadSafe, "ThreadSafe pools keep free blocks in per-thread caches");
+        return PooledCount;
+    }
+
+    /** Get number of blocks obtained from the underlying allocator */
+    int32 GetTotalAllocated() const
     {
         if constexpr (Mode == ESPMode::ThreadSafe)
         {
-            return PooledCount.load(std::memory_order_relaxed);
+            return static_cast<int32>(FThreadSafeAllocator::GetNumBlocksAllocated());
         }
         else
         {
-            return PooledCount;
+            return TotalAllocated;
         }
     }
 
-    int32 GetTotalAllocated() const
-    {
-        return TotalAllocated.load(std::memory_order_relaxed);
-    }
-
-    /** Set maximum pool size */
+    /** Set maximum pool size (NotThreadSafe mode only) */
     void SetMaxPoolSize(int32 NewMaxSize)
     {
+        static_assert(Mode == ESPMode::NotThreadSafe, "ThreadSafe pools have no size cap");
         MaxPoolSize = NewMaxSize;
     }
 
-    /** Clear the pool (free all pooled memory) */
+    /** Clear the pool (free all pooled memory, NotThreadSafe mode only) */
     void Clear()
     {
-        if constexpr (Mode == ESPMode::ThreadSafe)
-        {
-            void* Head = FreeList.exchange(nullptr, std::memory_order_acquire);
-            while (Head != nullptr)
-            {
-                FreeNode* Node = static_cast<FreeNode*>(Head);
-                Head = Node->Next;
-                MonsterRender::FMemory::Free(Node);
-                TotalAllocated.fetch_sub(1, std::memory_order_relaxed);
-            }
-            PooledCount.store(0, std::memory_order_relaxed);
-        }
-        else
-        {
-            while (FreeList != nullptr)
-            {
-                FreeNode* Node = static_cast<FreeNode*>(FreeList);
-                FreeList = Node->Next;
-                MonsterRender::FMemory::Free(Node);
-                TotalAllocated.fetch_sub(1, std::memory_order_relaxed);
-            }
-            PooledCount = 0;
-        }
+        static_assert(Mode == ESPMode::NotThreadSafe, "ThreadSafe pools never return memory to the system");
+        ReleaseFreeList();
     }
 
 private:
     TReferenceControllerPool()
         : MaxPoolSize(1024)  // Default max pool size
     {
-        if constexpr (Mode == ESPMode::ThreadSafe)
-        {
-            FreeList.store(nullptr, std::memory_order_relaxed);
-            PooledCount.store(0, std::memory_order_relaxed);
-        }
-        else
-        {
-            FreeList = nullptr;
-            PooledCount = 0;
-        }
-        TotalAllocated.store(0, std::memory_order_relaxed);
     }
 
     ~TReferenceControllerPool()
     {
-        Clear();
+        ReleaseFreeList();
+    }
+
+    void ReleaseFreeList()
+    {
+        while (FreeList != nullptr)
+        {
+            FreeNode* Node = FreeList;
+            FreeList = Node->Next;
+            MonsterRender::FMemory::Free(Node);
+            --TotalAllocated;
+        }
+        PooledCount = 0;
     }
 
     // Non-copyable
     TReferenceControllerPool(const TReferenceControllerPool&) = delete;
     TReferenceControllerPool& operator=(const TReferenceControllerPool&) = delete;
 
-    NodePtrType FreeList;
-    std::conditional_t<Mode == ESPMode::ThreadSafe, std::atomic<int32>, int32> PooledCount;
-    std::atomic<int32> TotalAllocated;
+    FreeNode* FreeList = nullptr;
+    int32 PooledCount = 0;
+    int32 TotalAllocated = 0;
     int32 MaxPoolSize;
 };
 
@@ -549,7 +509,7 @@ public:
     }
 
     // Custom new/delete using pool
-    static void* operator new(size_t Size)
+    static void* operator new(size_t)
     {
         return PoolType::Get().Allocate();
     }
@@ -593,7 +553,7 @@ public:
     }
 
     // Custom new/delete using pool
-    static void* operator new(size_t Size)
+    static void* operator new(size_t)
     {
         return PoolType::Get().Allocate();
     }
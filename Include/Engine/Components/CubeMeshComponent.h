@@ -76,6 +76,9 @@ public:
      */
     FBox GetLocalBounds() const;
 
+    /** Local bounds for the scene proxy, same as GetLocalBounds() */
+    virtual FBox CalcLocalBounds() const override { return GetLocalBounds(); }
+
     // ========================================================================
     // Textures
     // ========================================================================
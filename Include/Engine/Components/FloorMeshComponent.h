@@ -64,6 +64,9 @@ public:
      */
     FBox GetLocalBounds() const;
 
+    /** Local bounds for the scene proxy, same as GetLocalBounds() */
+    virtual FBox CalcLocalBounds() const override { return GetLocalBounds(); }
+
     // ========================================================================
     // Texture Settings
     // ========================================================================
@@ -203,7 +203,7 @@ public:
     /**
      * Updates the primitive's transform
      * @param NewLocalToWorld The new local to world transform
-     * @param NewBounds The new world-space bounds
+     * @param NewBounds The new world-space bounds, stored as given
      */
     void UpdateTransform(const FMatrix& NewLocalToWorld, const FBoxSphereBounds& NewBounds);
 
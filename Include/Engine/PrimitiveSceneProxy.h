@@ -14,6 +14,7 @@
 #include "SceneTypes.h"
 #include "Math/Matrix.h"
 #include "Math/Box.h"
+#include "Math/RenderTransform.h"
 
 namespace MonsterEngine
 {
@@ -73,12 +74,27 @@ public:
     /** Get the local to world transform matrix */
     const FMatrix& GetLocalToWorld() const { return LocalToWorld; }
 
+    /** Get the world to local transform matrix, cached when LocalToWorld changes */
+    const FMatrix& GetWorldToLocal() const { return WorldToLocal; }
+
     /** Set the local to world transform matrix */
     void SetLocalToWorld(const FMatrix& InLocalToWorld);
 
+    /** Set the local to world transform together with world bounds the caller already computed */
+    void SetLocalToWorldAndBounds(const FMatrix& InLocalToWorld, const FBoxSphereBounds& InBounds);
+
+    /** Shift the transform and world bounds by InOffset (world origin rebasing) */
+    virtual void ApplyWorldOffset(const FVector& InOffset);
+
     /** Get the world position */
     FVector GetActorPosition() const { return LocalToWorld.GetOrigin(); }
 
+    /** Get the origin uniform buffers are made relative to: the scene's render origin, or zero outside a scene */
+    FVector GetRenderOrigin() const;
+
+    /** Get the local to world transform as float 3x4 relative to GetRenderOrigin() */
+    Math::FRenderTransform GetRenderTransform() const { return Math::FRenderTransform(LocalToWorld, GetRenderOrigin()); }
+
     /** Check if the proxy has a dynamic transform that changes frequently */
     bool HasDynamicTransform() const { return bHasDynamicTransform; }
 
@@ -233,6 +249,9 @@ protected:
     /** Local to world transform matrix */
     FMatrix LocalToWorld;
 
+    /** Inverse of LocalToWorld, so per-frame users don't invert it again */
+    FMatrix WorldToLocal;
+
     /** World-space bounds */
     FBoxSphereBounds Bounds;
 
@@ -299,6 +299,9 @@ protected:
      */
     static void MatrixToFloatArray(const FMatrix& Matrix, float* OutArray);
 
+    /** Convert FMatrix44f to float array (column-major for GPU) */
+    static void MatrixToFloatArray(const FMatrix44f& Matrix, float* OutArray);
+
 protected:
     /** RHI device */
     MonsterRender::RHI::IRHIDevice* Device;
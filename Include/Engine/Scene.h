@@ -15,6 +15,7 @@
 #include "SceneTypes.h"
 #include "SceneOctree.h"
 #include "RenderCommandQueue.h"
+#include "Math/RenderTransform.h"
 #include "Containers/Array.h"
 #include "Containers/Map.h"
 #include "Containers/SparseArray.h"
@@ -79,6 +80,18 @@ struct FLightSceneInfoCompact
     void Init(FLightSceneInfo* InLightSceneInfo);
 };
 
+/**
+ * New transform for one primitive in a batched transform update
+ */
+struct FPrimitiveTransformUpdate
+{
+    /** Index of the primitive in the scene's packed arrays */
+    int32 PackedIndex;
+
+    /** New local-to-world transform */
+    FMatrix LocalToWorld;
+};
+
 /**
  * Renderer scene which is private to the renderer module
  * 
@@ -116,6 +129,19 @@ public:
     virtual void UpdatePrimitiveAttachment(UPrimitiveComponent* Primitive) override;
     virtual FPrimitiveSceneInfo* GetPrimitiveSceneInfo(int32 PrimitiveIndex) override;
 
+    /**
+     * Move many primitives at once
+     * 
+     * World bounds are recomputed from each proxy's local bounds with the SIMD
+     * structure-of-arrays bounds kernel (Arvo's method), 64 primitives per
+     * call, and the packed transform and bounds arrays (including the render
+     * origin relative ones) are written in the same pass. Updates whose
+     * PackedIndex is out of range are ignored.
+     * 
+     * @param Updates Packed index and new transform of each moved primitive
+     */
+    void UpdatePrimitiveTransforms(const TArray<FPrimitiveTransformUpdate>& Updates);
+
     // ========================================================================
     // FSceneInterface Implementation - Light Management
     // ========================================================================
@@ -192,12 +218,25 @@ public:
     /** Get all primitives */
     const TArray<FPrimitiveSceneInfo*>& GetPrimitives() const { return Primitives; }
 
-    /** Get all primitive transforms */
-    const TArray<FMatrix>& GetPrimitiveTransforms() const { return PrimitiveTransforms; }
+    /** Get all primitive transforms, relative to the render origin */
+    const TArray<Math::FRenderTransform>& GetPrimitiveTransforms() const { return PrimitiveTransforms; }
 
     /** Get all primitive bounds */
     const TArray<FPrimitiveBounds>& GetPrimitiveBounds() const { return PrimitiveBounds; }
 
+    /** Get all primitive bounds as float, relative to the render origin */
+    const TArray<Math::FRenderBounds>& GetPrimitiveRenderBounds() const { return PrimitiveRenderBounds; }
+
+    /** Get the origin the packed transforms and render bounds are relative to */
+    const FVector& GetRenderOrigin() const { return RenderOrigin; }
+
+    /**
+     * Move the render origin to the tile containing a view
+     * Rebuilds the relative transforms and bounds only when the tile changes.
+     * @param ViewOrigin World position of the primary view
+     */
+    void UpdateRenderOrigin(const FVector& ViewOrigin);
+
     /** Get all primitive proxies */
     const TArray<FPrimitiveSceneProxy*>& GetPrimitiveSceneProxies() const { return PrimitiveSceneProxies; }
 
@@ -218,6 +257,14 @@ protected:
      */
     void AddPrimitiveSceneInfo_RenderThread(FPrimitiveSceneInfo* PrimitiveSceneInfo);
 
+    /**
+     * Writes a primitive's packed transform and render bounds relative to RenderOrigin
+     * @param PackedIndex Index of the primitive in the packed arrays
+     * @param LocalToWorld World transform of the primitive
+     * @param Bounds World bounds of the primitive
+     */
+    void SetPrimitiveRenderData(int32 PackedIndex, const FMatrix& LocalToWorld, const FBoxSphereBounds& Bounds);
+
     /**
      * Removes a primitive from the scene on the render thread
      * @param PrimitiveSceneInfo The primitive scene info to remove
@@ -253,8 +300,11 @@ public:
     /** Packed array of primitives in the scene */
     TArray<FPrimitiveSceneInfo*> Primitives;
 
-    /** Packed array of all transforms in the scene */
-    TArray<FMatrix> PrimitiveTransforms;
+    /**
+     * Packed array of all transforms in the scene, as float 3x4 relative to
+     * RenderOrigin. Proxies keep the double precision FMatrix.
+     */
+    TArray<Math::FRenderTransform> PrimitiveTransforms;
 
     /** Packed array of primitive scene proxies in the scene */
     TArray<FPrimitiveSceneProxy*> PrimitiveSceneProxies;
@@ -262,6 +312,12 @@ public:
     /** Packed array of primitive bounds */
     TArray<FPrimitiveBounds> PrimitiveBounds;
 
+    /** Packed array of primitive bounds as float, relative to RenderOrigin */
+    TArray<Math::FRenderBounds> PrimitiveRenderBounds;
+
+    /** Origin of PrimitiveTransforms and PrimitiveRenderBounds, snapped to Math::RenderTileSize */
+    FVector RenderOrigin;
+
     /** Packed array of primitive flags */
     TArray<FPrimitiveFlagsCompact> PrimitiveFlagsCompact;
 
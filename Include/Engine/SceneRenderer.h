@@ -128,17 +128,17 @@ struct FViewInfo : public FSceneView
     /** Visibility results for this view */
     FViewVisibilityResult VisibilityResult;
 
-    /** Visible primitives sorted by material/state */
-    TArray<FPrimitiveSceneInfo*> VisibleStaticPrimitives;
+    /** Visible primitives sorted by material/state (valid for the frame being rendered) */
+    TArray<FPrimitiveSceneInfo*, SceneRenderingAllocator> VisibleStaticPrimitives;
     
     /** Visible dynamic primitives */
-    TArray<FPrimitiveSceneInfo*> VisibleDynamicPrimitives;
+    TArray<FPrimitiveSceneInfo*, SceneRenderingAllocator> VisibleDynamicPrimitives;
 
     /** Visible translucent primitives */
-    TArray<FPrimitiveSceneInfo*> VisibleTranslucentPrimitives;
+    TArray<FPrimitiveSceneInfo*, SceneRenderingAllocator> VisibleTranslucentPrimitives;
 
     /** Visible lights affecting this view */
-    TArray<FLightSceneInfo*> VisibleLights;
+    TArray<FLightSceneInfo*, SceneRenderingAllocator> VisibleLights;
 
     /** Whether visibility has been computed */
     bool bVisibilityComputed = false;
@@ -193,6 +193,9 @@ struct FMeshDrawCommand
     }
 };
 
+/** Draw commands built and submitted within one pass, allocated from the frame stack */
+using FMeshCommandOneFrameArray = TArray<FMeshDrawCommand, SceneRenderingAllocator>;
+
 // ============================================================================
 // Scene Renderer
 // ============================================================================
@@ -313,14 +316,14 @@ protected:
      * @param Pass - Render pass type
      * @param OutCommands - Array to receive draw commands
      */
-    virtual void GenerateDrawCommands(int32 ViewIndex, ERenderPass Pass, TArray<FMeshDrawCommand>& OutCommands);
+    virtual void GenerateDrawCommands(int32 ViewIndex, ERenderPass Pass, FMeshCommandOneFrameArray& OutCommands);
 
     /**
      * Submits draw commands to the RHI
      * @param RHICmdList - RHI command list
      * @param Commands - Draw commands to submit
      */
-    virtual void SubmitDrawCommands(IRHICommandList& RHICmdList, const TArray<FMeshDrawCommand>& Commands);
+    virtual void SubmitDrawCommands(IRHICommandList& RHICmdList, const FMeshCommandOneFrameArray& Commands);
 
 protected:
     /** The scene being rendered */
@@ -9,6 +9,8 @@
  * This file defines the TMatrix<T> template class for 4x4 matrix operations.
  * Used for transformations, projections, and coordinate space conversions.
  * Supports both float and double precision following UE5's LWC pattern.
+ * Multiply, inverse, transpose and vector transforms run on the
+ * VectorRegister layer (SSE/AVX, or the FPU fallback).
  */
 
 #include "MathFwd.h"
@@ -17,6 +19,7 @@
 #include "Vector4.h"
 #include "Rotator.h"
 #include "Quat.h"
+#include "VectorRegister.h"
 #include <cmath>
 #include <cstring>
 #include <string>
@@ -166,26 +169,17 @@ public:
     }
 
     /** Matrix multiplication */
-    MR_NODISCARD TMatrix<T> operator*(const TMatrix<T>& Other) const
+    MR_NODISCARD FORCEINLINE TMatrix<T> operator*(const TMatrix<T>& Other) const
     {
         TMatrix<T> Result;
-        for (int32_t i = 0; i < 4; ++i)
-        {
-            for (int32_t j = 0; j < 4; ++j)
-            {
-                Result.M[i][j] = M[i][0] * Other.M[0][j] +
-                                 M[i][1] * Other.M[1][j] +
-                                 M[i][2] * Other.M[2][j] +
-                                 M[i][3] * Other.M[3][j];
-            }
-        }
+        VectorMatrixMultiply(&Result.M[0][0], &M[0][0], &Other.M[0][0]);
         return Result;
     }
 
     /** Matrix multiplication assignment */
     FORCEINLINE void operator*=(const TMatrix<T>& Other)
     {
-        *this = *this * Other;
+        VectorMatrixMultiply(&M[0][0], &M[0][0], &Other.M[0][0]);
     }
 
     /** Matrix addition */
@@ -270,12 +264,9 @@ public:
     /** Transform a 4D vector */
     MR_NODISCARD FORCEINLINE TVector4<T> TransformFVector4(const TVector4<T>& V) const
     {
-        return TVector4<T>(
-            M[0][0] * V.X + M[1][0] * V.Y + M[2][0] * V.Z + M[3][0] * V.W,
-            M[0][1] * V.X + M[1][1] * V.Y + M[2][1] * V.Z + M[3][1] * V.W,
-            M[0][2] * V.X + M[1][2] * V.Y + M[2][2] * V.Z + M[3][2] * V.W,
-            M[0][3] * V.X + M[1][3] * V.Y + M[2][3] * V.Z + M[3][3] * V.W
-        );
+        T Result[4];
+        VectorStore(VectorTransformVector(VectorSet(V.X, V.Y, V.Z, V.W), &M[0][0]), Result);
+        return TVector4<T>(Result[0], Result[1], Result[2], Result[3]);
     }
 
     /** Transform a position (applies translation) */
@@ -290,14 +281,19 @@ public:
         return TransformFVector4(TVector4<T>(V.X, V.Y, V.Z, T(0)));
     }
 
-    /** Inverse transform a position */
+    /**
+     * Inverse transform a position
+     * Inverts the matrix on every call; code transforming many points by the
+     * same matrix should keep Inverse() around instead, as
+     * FPrimitiveSceneProxy::GetWorldToLocal() does.
+     */
     MR_NODISCARD FORCEINLINE TVector<T> InverseTransformPosition(const TVector<T>& V) const
     {
         TMatrix<T> InvSelf = Inverse();
         return InvSelf.TransformPosition(V).GetXYZ();
     }
 
-    /** Inverse transform a direction */
+    /** Inverse transform a direction (inverts the matrix on every call, see InverseTransformPosition) */
     MR_NODISCARD FORCEINLINE TVector<T> InverseTransformVector(const TVector<T>& V) const
     {
         TMatrix<T> InvSelf = Inverse();
@@ -313,13 +309,7 @@ public:
     MR_NODISCARD FORCEINLINE TMatrix<T> GetTransposed() const
     {
         TMatrix<T> Result;
-        for (int32_t i = 0; i < 4; ++i)
-        {
-            for (int32_t j = 0; j < 4; ++j)
-            {
-                Result.M[i][j] = M[j][i];
-            }
-        }
+        VectorMatrixTranspose(&Result.M[0][0], &M[0][0]);
         return Result;
     }
 
@@ -349,40 +339,14 @@ public:
             );
     }
 
-    /** Calculate the inverse of this matrix */
+    /** Calculate the inverse of this matrix; returns Identity if it is singular */
     MR_NODISCARD TMatrix<T> Inverse() const
     {
         TMatrix<T> Result;
-
-        T Det = Determinant();
-        if (std::abs(Det) < MR_SMALL_NUMBER)
+        if (!VectorMatrixInverse(&Result.M[0][0], &M[0][0]))
         {
             return Identity;
         }
-
-        T InvDet = T(1) / Det;
-
-        // Calculate cofactor matrix and transpose
-        Result.M[0][0] = InvDet * (M[1][1] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) - M[2][1] * (M[1][2] * M[3][3] - M[1][3] * M[3][2]) + M[3][1] * (M[1][2] * M[2][3] - M[1][3] * M[2][2]));
-        Result.M[0][1] = InvDet * -(M[0][1] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) - M[2][1] * (M[0][2] * M[3][3] - M[0][3] * M[3][2]) + M[3][1] * (M[0][2] * M[2][3] - M[0][3] * M[2][2]));
-        Result.M[0][2] = InvDet * (M[0][1] * (M[1][2] * M[3][3] - M[1][3] * M[3][2]) - M[1][1] * (M[0][2] * M[3][3] - M[0][3] * M[3][2]) + M[3][1] * (M[0][2] * M[1][3] - M[0][3] * M[1][2]));
-        Result.M[0][3] = InvDet * -(M[0][1] * (M[1][2] * M[2][3] - M[1][3] * M[2][2]) - M[1][1] * (M[0][2] * M[2][3] - M[0][3] * M[2][2]) + M[2][1] * (M[0][2] * M[1][3] - M[0][3] * M[1][2]));
-
-        Result.M[1][0] = InvDet * -(M[1][0] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) - M[2][0] * (M[1][2] * M[3][3] - M[1][3] * M[3][2]) + M[3][0] * (M[1][2] * M[2][3] - M[1][3] * M[2][2]));
-        Result.M[1][1] = InvDet * (M[0][0] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) - M[2][0] * (M[0][2] * M[3][3] - M[0][3] * M[3][2]) + M[3][0] * (M[0][2] * M[2][3] - M[0][3] * M[2][2]));
-        Result.M[1][2] = InvDet * -(M[0][0] * (M[1][2] * M[3][3] - M[1][3] * M[3][2]) - M[1][0] * (M[0][2] * M[3][3] - M[0][3] * M[3][2]) + M[3][0] * (M[0][2] * M[1][3] - M[0][3] * M[1][2]));
-        Result.M[1][3] = InvDet * (M[0][0] * (M[1][2] * M[2][3] - M[1][3] * M[2][2]) - M[1][0] * (M[0][2] * M[2][3] - M[0][3] * M[2][2]) + M[2][0] * (M[0][2] * M[1][3] - M[0][3] * M[1][2]));
-
-        Result.M[2][0] = InvDet * (M[1][0] * (M[2][1] * M[3][3] - M[2][3] * M[3][1]) - M[2][0] * (M[1][1] * M[3][3] - M[1][3] * M[3][1]) + M[3][0] * (M[1][1] * M[2][3] - M[1][3] * M[2][1]));
-        Result.M[2][1] = InvDet * -(M[0][0] * (M[2][1] * M[3][3] - M[2][3] * M[3][1]) - M[2][0] * (M[0][1] * M[3][3] - M[0][3] * M[3][1]) + M[3][0] * (M[0][1] * M[2][3] - M[0][3] * M[2][1]));
-        Result.M[2][2] = InvDet * (M[0][0] * (M[1][1] * M[3][3] - M[1][3] * M[3][1]) - M[1][0] * (M[0][1] * M[3][3] - M[0][3] * M[3][1]) + M[3][0] * (M[0][1] * M[1][3] - M[0][3] * M[1][1]));
-        Result.M[2][3] = InvDet * -(M[0][0] * (M[1][1] * M[2][3] - M[1][3] * M[2][1]) - M[1][0] * (M[0][1] * M[2][3] - M[0][3] * M[2][1]) + M[2][0] * (M[0][1] * M[1][3] - M[0][3] * M[1][1]));
-
-        Result.M[3][0] = InvDet * -(M[1][0] * (M[2][1] * M[3][2] - M[2][2] * M[3][1]) - M[2][0] * (M[1][1] * M[3][2] - M[1][2] * M[3][1]) + M[3][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1]));
-        Result.M[3][1] = InvDet * (M[0][0] * (M[2][1] * M[3][2] - M[2][2] * M[3][1]) - M[2][0] * (M[0][1] * M[3][2] - M[0][2] * M[3][1]) + M[3][0] * (M[0][1] * M[2][2] - M[0][2] * M[2][1]));
-        Result.M[3][2] = InvDet * -(M[0][0] * (M[1][1] * M[3][2] - M[1][2] * M[3][1]) - M[1][0] * (M[0][1] * M[3][2] - M[0][2] * M[3][1]) + M[3][0] * (M[0][1] * M[1][2] - M[0][2] * M[1][1]));
-        Result.M[3][3] = InvDet * (M[0][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1]) - M[1][0] * (M[0][1] * M[2][2] - M[0][2] * M[2][1]) + M[2][0] * (M[0][1] * M[1][2] - M[0][2] * M[1][1]));
-
         return Result;
     }
 
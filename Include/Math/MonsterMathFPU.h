@@ -259,6 +259,18 @@ FORCEINLINE VectorRegister4Double VectorSetDouble1(double Value)
     return VectorRegister4Double(Value);
 }
 
+/** Load one float and replicate it to all 4 components */
+FORCEINLINE VectorRegister4Float VectorLoadReplicate(const float* Ptr)
+{
+    return VectorRegister4Float(*Ptr);
+}
+
+/** Load one double and replicate it to all 4 components */
+FORCEINLINE VectorRegister4Double VectorLoadReplicate(const double* Ptr)
+{
+    return VectorRegister4Double(*Ptr);
+}
+
 // ============================================================================
 // Store Operations
 // ============================================================================
@@ -353,6 +365,17 @@ FORCEINLINE VectorRegister4Float VectorNegate(const VectorRegister4Float& Vec)
     return VectorRegister4Float(-Vec.V[0], -Vec.V[1], -Vec.V[2], -Vec.V[3]);
 }
 
+/** Multiply and add float vectors: Vec1 * Vec2 + Acc */
+FORCEINLINE VectorRegister4Float VectorMultiplyAdd(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2, const VectorRegister4Float& Acc)
+{
+    return VectorRegister4Float(
+        Vec1.V[0] * Vec2.V[0] + Acc.V[0],
+        Vec1.V[1] * Vec2.V[1] + Acc.V[1],
+        Vec1.V[2] * Vec2.V[2] + Acc.V[2],
+        Vec1.V[3] * Vec2.V[3] + Acc.V[3]
+    );
+}
+
 // ============================================================================
 // Arithmetic Operations - Double
 // ============================================================================
@@ -407,6 +430,17 @@ FORCEINLINE VectorRegister4Double VectorNegate(const VectorRegister4Double& Vec)
     return VectorRegister4Double(-Vec.V[0], -Vec.V[1], -Vec.V[2], -Vec.V[3]);
 }
 
+/** Multiply and add double vectors: Vec1 * Vec2 + Acc */
+FORCEINLINE VectorRegister4Double VectorMultiplyAdd(const VectorRegister4Double& Vec1, const VectorRegister4Double& Vec2, const VectorRegister4Double& Acc)
+{
+    return VectorRegister4Double(
+        Vec1.V[0] * Vec2.V[0] + Acc.V[0],
+        Vec1.V[1] * Vec2.V[1] + Acc.V[1],
+        Vec1.V[2] * Vec2.V[2] + Acc.V[2],
+        Vec1.V[3] * Vec2.V[3] + Acc.V[3]
+    );
+}
+
 // ============================================================================
 // Math Operations - Float
 // ============================================================================
@@ -659,5 +693,33 @@ FORCEINLINE VectorRegister4Double VectorReplicateW(const VectorRegister4Double&
     return VectorRegister4Double(Vec.V[3], Vec.V[3], Vec.V[3], Vec.V[3]);
 }
 
+/** Swizzle components (float): Result = (Vec[X], Vec[Y], Vec[Z], Vec[W]) */
+template<int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Float VectorSwizzle(const VectorRegister4Float& Vec)
+{
+    return VectorRegister4Float(Vec.V[X], Vec.V[Y], Vec.V[Z], Vec.V[W]);
+}
+
+/** Swizzle components (double): Result = (Vec[X], Vec[Y], Vec[Z], Vec[W]) */
+template<int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Double VectorSwizzle(const VectorRegister4Double& Vec)
+{
+    return VectorRegister4Double(Vec.V[X], Vec.V[Y], Vec.V[Z], Vec.V[W]);
+}
+
+/** Shuffle two vectors (float): Result = (Vec1[X], Vec1[Y], Vec2[Z], Vec2[W]) */
+template<int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Float VectorShuffle(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return VectorRegister4Float(Vec1.V[X], Vec1.V[Y], Vec2.V[Z], Vec2.V[W]);
+}
+
+/** Shuffle two vectors (double): Result = (Vec1[X], Vec1[Y], Vec2[Z], Vec2[W]) */
+template<int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Double VectorShuffle(const VectorRegister4Double& Vec1, const VectorRegister4Double& Vec2)
+{
+    return VectorRegister4Double(Vec1.V[X], Vec1.V[Y], Vec2.V[Z], Vec2.V[W]);
+}
+
 } // namespace Math
 } // namespace MonsterEngine
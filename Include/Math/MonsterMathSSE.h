@@ -280,6 +280,24 @@ FORCEINLINE VectorRegister4Double VectorSetDouble1(double Value)
 #endif
 }
 
+/** Load one float and replicate it to all 4 components */
+FORCEINLINE VectorRegister4Float VectorLoadReplicate(const float* Ptr)
+{
+    return _mm_load1_ps(Ptr);
+}
+
+/** Load one double and replicate it to all 4 components */
+FORCEINLINE VectorRegister4Double VectorLoadReplicate(const double* Ptr)
+{
+#if MR_PLATFORM_MATH_USE_AVX
+    VectorRegister4Double Result;
+    Result.XYZW = _mm256_broadcast_sd(Ptr);
+    return Result;
+#else
+    return VectorRegister4Double(_mm_load1_pd(Ptr), _mm_load1_pd(Ptr));
+#endif
+}
+
 // ============================================================================
 // Store Operations
 // ============================================================================
@@ -352,6 +370,12 @@ FORCEINLINE VectorRegister4Float VectorNegate(const VectorRegister4Float& Vec)
     return _mm_sub_ps(_mm_setzero_ps(), Vec);
 }
 
+/** Multiply and add float vectors: Vec1 * Vec2 + Acc */
+FORCEINLINE VectorRegister4Float VectorMultiplyAdd(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2, const VectorRegister4Float& Acc)
+{
+    return _mm_add_ps(_mm_mul_ps(Vec1, Vec2), Acc);
+}
+
 // ============================================================================
 // Arithmetic Operations - Double
 // ============================================================================
@@ -431,6 +455,21 @@ FORCEINLINE VectorRegister4Double VectorNegate(const VectorRegister4Double& Vec)
 #endif
 }
 
+/** Multiply and add double vectors: Vec1 * Vec2 + Acc */
+FORCEINLINE VectorRegister4Double VectorMultiplyAdd(const VectorRegister4Double& Vec1, const VectorRegister4Double& Vec2, const VectorRegister4Double& Acc)
+{
+#if MR_PLATFORM_MATH_USE_AVX
+    VectorRegister4Double Result;
+    Result.XYZW = _mm256_add_pd(_mm256_mul_pd(Vec1.XYZW, Vec2.XYZW), Acc.XYZW);
+    return Result;
+#else
+    return VectorRegister4Double(
+        _mm_add_pd(_mm_mul_pd(Vec1.XY, Vec2.XY), Acc.XY),
+        _mm_add_pd(_mm_mul_pd(Vec1.ZW, Vec2.ZW), Acc.ZW)
+    );
+#endif
+}
+
 // ============================================================================
 // Comparison Operations - Float
 // ============================================================================
@@ -652,6 +691,58 @@ FORCEINLINE VectorRegister4Float VectorReplicateW(const VectorRegister4Float& Ve
     return _mm_shuffle_ps(Vec, Vec, _MM_SHUFFLE(3, 3, 3, 3));
 }
 
+/**
+ * Swizzle components (float): Result = (Vec[X], Vec[Y], Vec[Z], Vec[W])
+ */
+template<int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Float VectorSwizzle(const VectorRegister4Float& Vec)
+{
+    static_assert(X >= 0 && X <= 3 && Y >= 0 && Y <= 3 && Z >= 0 && Z <= 3 && W >= 0 && W <= 3, "Swizzle index out of range");
+    return _mm_shuffle_ps(Vec, Vec, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+/**
+ * Shuffle two vectors (float): Result = (Vec1[X], Vec1[Y], Vec2[Z], Vec2[W])
+ */
+template<int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Float VectorShuffle(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    static_assert(X >= 0 && X <= 3 && Y >= 0 && Y <= 3 && Z >= 0 && Z <= 3 && W >= 0 && W <= 3, "Shuffle index out of range");
+    return _mm_shuffle_ps(Vec1, Vec2, _MM_SHUFFLE(W, Z, Y, X));
+}
+
+/**
+ * Shuffle two vectors (double): Result = (Vec1[X], Vec1[Y], Vec2[Z], Vec2[W])
+ * Each output half picks its two lanes from the 128-bit halves that hold them.
+ */
+template<int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Double VectorShuffle(const VectorRegister4Double& Vec1, const VectorRegister4Double& Vec2)
+{
+    static_assert(X >= 0 && X <= 3 && Y >= 0 && Y <= 3 && Z >= 0 && Z <= 3 && W >= 0 && W <= 3, "Shuffle index out of range");
+    const VectorRegister2Double Halves1[2] = { Vec1.GetXY(), Vec1.GetZW() };
+    const VectorRegister2Double Halves2[2] = { Vec2.GetXY(), Vec2.GetZW() };
+    return VectorRegister4Double(
+        _mm_shuffle_pd(Halves1[X >> 1], Halves1[Y >> 1], (X & 1) | ((Y & 1) << 1)),
+        _mm_shuffle_pd(Halves2[Z >> 1], Halves2[W >> 1], (Z & 1) | ((W & 1) << 1))
+    );
+}
+
+/**
+ * Swizzle components (double): Result = (Vec[X], Vec[Y], Vec[Z], Vec[W])
+ */
+template<int X, int Y, int Z, int W>
+FORCEINLINE VectorRegister4Double VectorSwizzle(const VectorRegister4Double& Vec)
+{
+#if MR_PLATFORM_MATH_USE_AVX2
+    static_assert(X >= 0 && X <= 3 && Y >= 0 && Y <= 3 && Z >= 0 && Z <= 3 && W >= 0 && W <= 3, "Swizzle index out of range");
+    VectorRegister4Double Result;
+    Result.XYZW = _mm256_permute4x64_pd(Vec.XYZW, _MM_SHUFFLE(W, Z, Y, X));
+    return Result;
+#else
+    return VectorShuffle<X, Y, Z, W>(Vec, Vec);
+#endif
+}
+
 // ============================================================================
 // Bitwise Operations
 // ============================================================================
@@ -0,0 +1,164 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+#pragma once
+
+/**
+ * @file RenderTransform.h
+ * @brief Compact float transforms and bounds relative to a render origin
+ *
+ * FVector and FMatrix are double precision, so scene arrays of them cost
+ * 128 bytes per transform and 56 bytes per FBoxSphereBounds. Renderers only
+ * need float precision near the camera, so render-side copies store:
+ * - FRenderTransform: 3x4 float affine transform (48 bytes)
+ * - FRenderBounds: float box and sphere bounds (28 bytes)
+ *
+ * Both are relative to a render origin, snapped to a grid of RenderTileSize
+ * so that it only changes when the camera crosses a tile. Positions are
+ * subtracted from the origin in double before rounding, which keeps full
+ * float precision around the camera however far it is from the world origin.
+ *
+ * Based on UE5's FRenderTransform, FRenderBounds and large world coordinate tiles
+ * Reference: Engine/Source/Runtime/Core/Public/Math/LargeWorldRenderPosition.h
+ */
+
+#include "MathFwd.h"
+#include "Vector.h"
+#include "Matrix.h"
+#include <cfloat>
+#include <cmath>
+
+namespace MonsterEngine
+{
+namespace Math
+{
+
+/** Edge length of the grid render origins snap to (2^18 units) */
+constexpr double RenderTileSize = 262144.0;
+
+/**
+ * Render origin for a view at Position: the nearest multiple of RenderTileSize
+ * on each axis, so coordinates around the view stay within half a tile of zero
+ */
+FORCEINLINE FVector GetRenderTileOrigin(const FVector& Position)
+{
+    return FVector(
+        std::floor(Position.X / RenderTileSize + 0.5) * RenderTileSize,
+        std::floor(Position.Y / RenderTileSize + 0.5) * RenderTileSize,
+        std::floor(Position.Z / RenderTileSize + 0.5) * RenderTileSize);
+}
+
+/**
+ * @brief Affine transform as three float rows and an origin
+ *
+ * Holds rows 0-2 of a row-vector FMatrix plus its translation row, with the
+ * translation made relative to a render origin.
+ */
+struct FRenderTransform
+{
+    /** Rows of the upper 3x3 (X, Y and Z axes of the transform) */
+    FVector3f TransformRows[3];
+
+    /** Translation relative to the render origin */
+    FVector3f Origin;
+
+    /** Identity transform */
+    FORCEINLINE FRenderTransform()
+        : Origin(0.0f, 0.0f, 0.0f)
+    {
+        TransformRows[0] = FVector3f(1.0f, 0.0f, 0.0f);
+        TransformRows[1] = FVector3f(0.0f, 1.0f, 0.0f);
+        TransformRows[2] = FVector3f(0.0f, 0.0f, 1.0f);
+    }
+
+    /**
+     * Constructor from a world transform
+     * @param LocalToWorld Affine world transform; the projective column is ignored
+     * @param RelativeTo Render origin the translation is made relative to
+     */
+    FORCEINLINE FRenderTransform(const FMatrix& LocalToWorld, const FVector& RelativeTo)
+    {
+        for (int32_t Row = 0; Row < 3; ++Row)
+        {
+            TransformRows[Row] = FVector3f(
+                static_cast<float>(LocalToWorld.M[Row][0]),
+                static_cast<float>(LocalToWorld.M[Row][1]),
+                static_cast<float>(LocalToWorld.M[Row][2]));
+        }
+        Origin = FVector3f(
+            static_cast<float>(LocalToWorld.M[3][0] - RelativeTo.X),
+            static_cast<float>(LocalToWorld.M[3][1] - RelativeTo.Y),
+            static_cast<float>(LocalToWorld.M[3][2] - RelativeTo.Z));
+    }
+
+    /** Transform a local position into render-origin-relative space */
+    FORCEINLINE FVector3f TransformPosition(const FVector3f& Position) const
+    {
+        return TransformRows[0] * Position.X + TransformRows[1] * Position.Y + TransformRows[2] * Position.Z + Origin;
+    }
+
+    /** Expand to a 4x4 float matrix, for uniform buffers */
+    FORCEINLINE FMatrix44f ToMatrix44f() const
+    {
+        return FMatrix44f(TransformRows[0], TransformRows[1], TransformRows[2], Origin);
+    }
+};
+
+/**
+ * @brief Box and sphere bounds in float, relative to a render origin
+ *
+ * Conversion is conservative: the extent grows by the rounding error of the
+ * origin and is rounded up, so the float box always contains the double one
+ * and culling against it never rejects a visible primitive.
+ */
+struct FRenderBounds
+{
+    /** Center of the box and sphere, relative to the render origin */
+    FVector3f Origin;
+
+    /** Radius of the bounding sphere */
+    float SphereRadius;
+
+    /** Half-extents of the box */
+    FVector3f BoxExtent;
+
+    /** Empty bounds at the render origin */
+    FORCEINLINE FRenderBounds()
+        : Origin(0.0f, 0.0f, 0.0f)
+        , SphereRadius(0.0f)
+        , BoxExtent(0.0f, 0.0f, 0.0f)
+    {
+    }
+
+    /**
+     * Constructor from world bounds
+     * @param WorldOrigin Center of the bounds in world space
+     * @param WorldBoxExtent Half-extents of the box
+     * @param InSphereRadius Radius of the bounding sphere
+     * @param RelativeTo Render origin the center is made relative to
+     */
+    FRenderBounds(const FVector& WorldOrigin, const FVector& WorldBoxExtent, double InSphereRadius, const FVector& RelativeTo)
+    {
+        const FVector Relative = WorldOrigin - RelativeTo;
+        Origin = FVector3f(static_cast<float>(Relative.X), static_cast<float>(Relative.Y), static_cast<float>(Relative.Z));
+
+        const double ErrorX = std::abs(static_cast<double>(Origin.X) - Relative.X);
+        const double ErrorY = std::abs(static_cast<double>(Origin.Y) - Relative.Y);
+        const double ErrorZ = std::abs(static_cast<double>(Origin.Z) - Relative.Z);
+        BoxExtent = FVector3f(
+            RoundUp(WorldBoxExtent.X + ErrorX),
+            RoundUp(WorldBoxExtent.Y + ErrorY),
+            RoundUp(WorldBoxExtent.Z + ErrorZ));
+        SphereRadius = RoundUp(InSphereRadius + ErrorX + ErrorY + ErrorZ);
+    }
+
+private:
+    /** Smallest float not less than Value */
+    static FORCEINLINE float RoundUp(double Value)
+    {
+        const float Rounded = static_cast<float>(Value);
+        return static_cast<double>(Rounded) < Value ? std::nextafter(Rounded, FLT_MAX) : Rounded;
+    }
+};
+
+} // namespace Math
+} // namespace MonsterEngine
@@ -0,0 +1,188 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+#pragma once
+
+/**
+ * @file VectorKernels.h
+ * @brief Bulk math kernels with runtime instruction set dispatch
+ *
+ * VectorRegister.h picks one SIMD backend when the engine is compiled, which
+ * limits shipped binaries to the oldest CPU they must run on. The kernels
+ * here process whole arrays and are compiled once per instruction set:
+ * - Scalar: reference implementation, used on every platform
+ * - SSE4.2: 4 floats per instruction
+ * - AVX2: 8 floats per instruction
+ * - AVX-512 (F/BW/DQ/VL): 16 floats per instruction
+ *
+ * FVectorKernels::Get() returns the table for the best set the CPU supports,
+ * chosen once on first use. Every variant produces the same results as the
+ * scalar one: transforms up to float rounding, culling and downsampling
+ * exactly.
+ *
+ * Arrays are structure-of-arrays float streams, or blocks of 8 boxes for
+ * culling, and need no alignment.
+ *
+ * Based on UE5's FPlatformMisc feature queries and ISPC kernel dispatch
+ * Reference: Engine/Source/Runtime/Core/Public/Math/VectorRegister.h
+ */
+
+#include "MathFwd.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace MonsterEngine
+{
+namespace Math
+{
+
+/** Instruction sets kernels are compiled for, in increasing order of width */
+enum class EVectorISA : uint8_t
+{
+    Scalar = 0,
+    SSE42,
+    AVX2,
+    AVX512,
+    Num
+};
+
+/** Display name of an instruction set */
+const char* GetVectorISAName(EVectorISA ISA);
+
+/**
+ * Read-only structure-of-arrays view of axis-aligned boxes
+ * Box i has center (Center[0][i], Center[1][i], Center[2][i]) and half-size Extent likewise.
+ */
+struct FConstBoxStreams
+{
+    const float* Center[3];
+    const float* Extent[3];
+};
+
+/** Writable structure-of-arrays view of axis-aligned boxes */
+struct FBoxStreams
+{
+    float* Center[3];
+    float* Extent[3];
+
+    operator FConstBoxStreams() const
+    {
+        return FConstBoxStreams{ { Center[0], Center[1], Center[2] }, { Extent[0], Extent[1], Extent[2] } };
+    }
+};
+
+/**
+ * Eight axis-aligned boxes, structure-of-arrays within the block
+ * Box i of an array of blocks is lane i % 8 of block i / 8. One block is 192
+ * bytes, so a group of boxes is read from three adjacent cache lines where six
+ * separate streams would touch six, and an 8-wide register is one aligned row.
+ */
+struct FBoxBlock8
+{
+    float Center[3][8];
+    float Extent[3][8];
+};
+
+/**
+ * @brief Table of bulk kernels compiled for one instruction set
+ *
+ * Matrices are 16 row-major floats (the layout of FMatrix44f::M) applied to
+ * row vectors, so translation is in elements 12..14.
+ */
+struct FVectorKernels
+{
+    /**
+     * Transform positions: Out[i] = (In[i], 1) * Matrix, ignoring the projective row
+     * Out may alias In.
+     */
+    void (*TransformPositions)(const float* Matrix, const float* const In[3], float* const Out[3], int32_t Num);
+
+    /**
+     * Transform boxes by an affine matrix (Arvo's method)
+     * Centers are transformed as positions; each new half-size axis is the sum of
+     * the old half-sizes weighted by the absolute matrix column. Out may alias In.
+     */
+    void (*TransformBounds)(const float* Matrix, const FConstBoxStreams& In, const FBoxStreams& Out, int32_t Num);
+
+    /**
+     * Transform boxes, each by its own linear transform (Arvo's method)
+     * Linear holds nine streams, Linear[Row * 3 + Column][i] being the upper 3x3 of
+     * box i's matrix. Translation is left to the caller so it can be added at the
+     * caller's precision. Out may alias In.
+     */
+    void (*TransformBoundsPerBox)(const float* const Linear[9], const FConstBoxStreams& In, const FBoxStreams& Out, int32_t Num);
+
+    /**
+     * Test boxes against outward-facing planes (X, Y, Z, W), FConvexVolume convention
+     * Box i is culled when for some plane dot(N, Center) - W > dot(|N|, Extent).
+     * Writes (Num + 31) / 32 words; bit i of the output is set if box i is visible.
+     */
+    void (*CullBoxes)(const float* Planes, int32_t NumPlanes, const FConstBoxStreams& Boxes, int32_t Num, uint32_t* OutVisibleWords);
+
+    /**
+     * CullBoxes over Num boxes stored in (Num + 7) / 8 blocks
+     * Each block is tested against all planes at once. Writes (Num + 31) / 32 words;
+     * bits of lanes past Num are cleared, whatever the unused lanes hold.
+     */
+    void (*CullBoxBlocks)(const float* Planes, int32_t NumPlanes, const FBoxBlock8* Blocks, int32_t Num, uint32_t* OutVisibleWords);
+
+    /**
+     * Halve an RGBA8 image with a 2x2 box filter, rounding down
+     * Dst is max(1, Width / 2) x max(1, Height / 2); edge pixels are clamped for 1-wide sources.
+     */
+    void (*DownsampleRGBA8)(const uint8_t* Src, uint32_t SrcWidth, uint32_t SrcHeight, uint8_t* Dst);
+
+    /** Instruction set this table was compiled for */
+    EVectorISA ISA;
+
+    /**
+     * Kernels for the widest instruction set this CPU supports, chosen on first call
+     */
+    static const FVectorKernels& Get();
+
+    /**
+     * Kernels for a specific instruction set
+     * @return nullptr if the CPU does not support it or the build does not include it
+     */
+    static const FVectorKernels* GetForISA(EVectorISA ISA);
+};
+
+namespace VectorKernelsPrivate
+{
+    /** Per-instruction-set tables; a variant returns nullptr when the build does not include it */
+    const FVectorKernels* GetScalarKernels();
+    const FVectorKernels* GetSSE42Kernels();
+    const FVectorKernels* GetAVX2Kernels();
+    const FVectorKernels* GetAVX512Kernels();
+
+    /** Scalar kernels, which the wider variants also use for their remainders */
+    void TransformPositionsScalar(const float* Matrix, const float* const In[3], float* const Out[3], int32_t Num);
+    void TransformBoundsScalar(const float* Matrix, const FConstBoxStreams& In, const FBoxStreams& Out, int32_t Num);
+    void TransformBoundsPerBoxScalar(const float* const Linear[9], const FConstBoxStreams& In, const FBoxStreams& Out, int32_t Num);
+    void CullBoxesScalar(const float* Planes, int32_t NumPlanes, const FConstBoxStreams& Boxes, int32_t Num, uint32_t* OutVisibleWords);
+    void CullBoxBlocksScalar(const float* Planes, int32_t NumPlanes, const FBoxBlock8* Blocks, int32_t Num, uint32_t* OutVisibleWords);
+    void DownsampleRGBA8Scalar(const uint8_t* Src, uint32_t SrcWidth, uint32_t SrcHeight, uint8_t* Dst);
+
+    /** Streams advanced by Offset elements, for handing a remainder to the scalar kernels */
+    inline FConstBoxStreams OffsetStreams(const FConstBoxStreams& Streams, int32_t Offset)
+    {
+        return FConstBoxStreams{
+            { Streams.Center[0] + Offset, Streams.Center[1] + Offset, Streams.Center[2] + Offset },
+            { Streams.Extent[0] + Offset, Streams.Extent[1] + Offset, Streams.Extent[2] + Offset } };
+    }
+
+    inline FBoxStreams OffsetStreams(const FBoxStreams& Streams, int32_t Offset)
+    {
+        return FBoxStreams{
+            { Streams.Center[0] + Offset, Streams.Center[1] + Offset, Streams.Center[2] + Offset },
+            { Streams.Extent[0] + Offset, Streams.Extent[1] + Offset, Streams.Extent[2] + Offset } };
+    }
+
+    /** Bits of the first Num lanes of a visibility word, Num in [0, 32] */
+    inline uint32_t LowBitsMask(int32_t Num)
+    {
+        return Num >= 32 ? ~0u : (1u << Num) - 1u;
+    }
+} // namespace VectorKernelsPrivate
+
+} // namespace Math
+} // namespace MonsterEngine
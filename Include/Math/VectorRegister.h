@@ -13,6 +13,7 @@
 
 #include "MathFwd.h"
 #include "MathUtility.h"
+#include <cmath>
 
 // ============================================================================
 // Platform Detection and SIMD Capability Flags
@@ -162,5 +163,161 @@ struct TAlignOfTransform<double>
     static constexpr size_t Value = SIMD_DOUBLE_ALIGNMENT;
 };
 
+// ============================================================================
+// Matrix Operations
+// ============================================================================
+
+/*
+ * 4x4 matrix kernels shared by every platform layer. Matrices are 16
+ * contiguous row-major values, the layout of TMatrix<T>::M, and are accessed
+ * with unaligned loads so double matrices need not be 32-byte aligned.
+ * Based on UE5's VectorMatrixMultiply / VectorMatrixInverse.
+ * Reference: Engine/Source/Runtime/Core/Public/Math/UnrealMathSSE.h
+ */
+
+/**
+ * Multiplies two 4x4 matrices: Result = Matrix1 * Matrix2
+ * Each result row is the rows of Matrix2 weighted by the matching row of Matrix1.
+ * Result may alias either input.
+ */
+template<typename T>
+FORCEINLINE void VectorMatrixMultiply(T* Result, const T* Matrix1, const T* Matrix2)
+{
+    using RegisterType = typename TVectorRegisterType<T>::Type;
+
+    const RegisterType Row0 = VectorLoad(Matrix2);
+    const RegisterType Row1 = VectorLoad(Matrix2 + 4);
+    const RegisterType Row2 = VectorLoad(Matrix2 + 8);
+    const RegisterType Row3 = VectorLoad(Matrix2 + 12);
+
+    for (int32_t RowIndex = 0; RowIndex < 4; ++RowIndex)
+    {
+        const T* Weights = Matrix1 + RowIndex * 4;
+        RegisterType Acc = VectorMultiply(VectorLoadReplicate(Weights), Row0);
+        Acc = VectorMultiplyAdd(VectorLoadReplicate(Weights + 1), Row1, Acc);
+        Acc = VectorMultiplyAdd(VectorLoadReplicate(Weights + 2), Row2, Acc);
+        Acc = VectorMultiplyAdd(VectorLoadReplicate(Weights + 3), Row3, Acc);
+        VectorStore(Acc, Result + RowIndex * 4);
+    }
+}
+
+/**
+ * Transforms a row vector by a 4x4 matrix: Result = Vec * Matrix
+ */
+template<typename T>
+FORCEINLINE typename TVectorRegisterType<T>::Type VectorTransformVector(
+    const typename TVectorRegisterType<T>::Type& Vec, const T* Matrix)
+{
+    using RegisterType = typename TVectorRegisterType<T>::Type;
+
+    RegisterType Acc = VectorMultiply(VectorSwizzle<0, 0, 0, 0>(Vec), VectorLoad(Matrix));
+    Acc = VectorMultiplyAdd(VectorSwizzle<1, 1, 1, 1>(Vec), VectorLoad(Matrix + 4), Acc);
+    Acc = VectorMultiplyAdd(VectorSwizzle<2, 2, 2, 2>(Vec), VectorLoad(Matrix + 8), Acc);
+    Acc = VectorMultiplyAdd(VectorSwizzle<3, 3, 3, 3>(Vec), VectorLoad(Matrix + 12), Acc);
+    return Acc;
+}
+
+/**
+ * Transposes a 4x4 matrix. Result may alias Matrix.
+ */
+template<typename T>
+FORCEINLINE void VectorMatrixTranspose(T* Result, const T* Matrix)
+{
+    using RegisterType = typename TVectorRegisterType<T>::Type;
+
+    const RegisterType A = VectorLoad(Matrix);
+    const RegisterType B = VectorLoad(Matrix + 4);
+    const RegisterType C = VectorLoad(Matrix + 8);
+    const RegisterType D = VectorLoad(Matrix + 12);
+
+    // (a0 a1 b0 b1), (a2 a3 b2 b3), (c0 c1 d0 d1), (c2 c3 d2 d3)
+    const RegisterType AB01 = VectorShuffle<0, 1, 0, 1>(A, B);
+    const RegisterType AB23 = VectorShuffle<2, 3, 2, 3>(A, B);
+    const RegisterType CD01 = VectorShuffle<0, 1, 0, 1>(C, D);
+    const RegisterType CD23 = VectorShuffle<2, 3, 2, 3>(C, D);
+
+    VectorStore(VectorShuffle<0, 2, 0, 2>(AB01, CD01), Result);
+    VectorStore(VectorShuffle<1, 3, 1, 3>(AB01, CD01), Result + 4);
+    VectorStore(VectorShuffle<0, 2, 0, 2>(AB23, CD23), Result + 8);
+    VectorStore(VectorShuffle<1, 3, 1, 3>(AB23, CD23), Result + 12);
+}
+
+/**
+ * Inverts a 4x4 matrix through the adjugate built from 2x2 sub-determinants
+ *
+ * With rows a, b, c, d, every cofactor is a sum of three products of one
+ * element with a 2x2 determinant of either rows (a, b) or rows (c, d) over
+ * the same pair of columns. Lanes are ordered so one register holds column
+ * j of rows (b, a, d, c) and another the matching (c, d) and (a, b)
+ * determinants, which turns the adjugate into 12 multiply-adds.
+ *
+ * @return false if the matrix is singular; Result is left unchanged
+ */
+template<typename T>
+bool VectorMatrixInverse(T* Result, const T* Matrix)
+{
+    using RegisterType = typename TVectorRegisterType<T>::Type;
+
+    const RegisterType A = VectorLoad(Matrix);
+    const RegisterType B = VectorLoad(Matrix + 4);
+    const RegisterType C = VectorLoad(Matrix + 8);
+    const RegisterType D = VectorLoad(Matrix + 12);
+
+    // Column j of rows (b, a, d, c)
+    const RegisterType BA01 = VectorShuffle<0, 1, 0, 1>(B, A);
+    const RegisterType BA23 = VectorShuffle<2, 3, 2, 3>(B, A);
+    const RegisterType DC01 = VectorShuffle<0, 1, 0, 1>(D, C);
+    const RegisterType DC23 = VectorShuffle<2, 3, 2, 3>(D, C);
+    const RegisterType Col0 = VectorShuffle<0, 2, 0, 2>(BA01, DC01);
+    const RegisterType Col1 = VectorShuffle<1, 3, 1, 3>(BA01, DC01);
+    const RegisterType Col2 = VectorShuffle<0, 2, 0, 2>(BA23, DC23);
+    const RegisterType Col3 = VectorShuffle<1, 3, 1, 3>(BA23, DC23);
+
+    // (c_j c_j a_j a_j) and (d_j d_j b_j b_j)
+    const RegisterType CA0 = VectorSwizzle<3, 3, 1, 1>(Col0);
+    const RegisterType CA1 = VectorSwizzle<3, 3, 1, 1>(Col1);
+    const RegisterType CA2 = VectorSwizzle<3, 3, 1, 1>(Col2);
+    const RegisterType DB0 = VectorSwizzle<2, 2, 0, 0>(Col0);
+    const RegisterType DB1 = VectorSwizzle<2, 2, 0, 0>(Col1);
+    const RegisterType DB2 = VectorSwizzle<2, 2, 0, 0>(Col2);
+    const RegisterType DB3 = VectorSwizzle<2, 2, 0, 0>(Col3);
+
+    // 2x2 determinants of columns (p, q): (cd_pq cd_pq ab_pq ab_pq)
+    const RegisterType Det01 = VectorSubtract(VectorMultiply(CA0, DB1), VectorMultiply(CA1, DB0));
+    const RegisterType Det02 = VectorSubtract(VectorMultiply(CA0, DB2), VectorMultiply(CA2, DB0));
+    const RegisterType Det03 = VectorSubtract(VectorMultiply(CA0, DB3), VectorMultiply(VectorSwizzle<3, 3, 1, 1>(Col3), DB0));
+    const RegisterType Det12 = VectorSubtract(VectorMultiply(CA1, DB2), VectorMultiply(CA2, DB1));
+    const RegisterType Det13 = VectorSubtract(VectorMultiply(CA1, DB3), VectorMultiply(VectorSwizzle<3, 3, 1, 1>(Col3), DB1));
+    const RegisterType Det23 = VectorSubtract(VectorMultiply(CA2, DB3), VectorMultiply(VectorSwizzle<3, 3, 1, 1>(Col3), DB2));
+
+    // Adjugate rows before the alternating lane signs
+    const RegisterType Row0 = VectorMultiplyAdd(Col3, Det12, VectorSubtract(VectorMultiply(Col1, Det23), VectorMultiply(Col2, Det13)));
+    const RegisterType Row1 = VectorSubtract(VectorSubtract(VectorMultiply(Col2, Det03), VectorMultiply(Col0, Det23)), VectorMultiply(Col3, Det02));
+    const RegisterType Row2 = VectorMultiplyAdd(Col3, Det01, VectorSubtract(VectorMultiply(Col0, Det13), VectorMultiply(Col1, Det03)));
+    const RegisterType Row3 = VectorSubtract(VectorSubtract(VectorMultiply(Col1, Det02), VectorMultiply(Col0, Det12)), VectorMultiply(Col2, Det01));
+
+    // Lane 0 of a * adjugate is the determinant
+    RegisterType DetVector = VectorMultiply(VectorLoadReplicate(Matrix), Row0);
+    DetVector = VectorMultiplyAdd(VectorLoadReplicate(Matrix + 1), Row1, DetVector);
+    DetVector = VectorMultiplyAdd(VectorLoadReplicate(Matrix + 2), Row2, DetVector);
+    DetVector = VectorMultiplyAdd(VectorLoadReplicate(Matrix + 3), Row3, DetVector);
+
+    T DetComponents[4];
+    VectorStore(DetVector, DetComponents);
+    const T Det = DetComponents[0];
+    if (std::abs(Det) < MR_SMALL_NUMBER)
+    {
+        return false;
+    }
+
+    const T InvDet = T(1) / Det;
+    const RegisterType Scale = VectorSet(InvDet, -InvDet, InvDet, -InvDet);
+    VectorStore(VectorMultiply(Row0, Scale), Result);
+    VectorStore(VectorMultiply(Row1, Scale), Result + 4);
+    VectorStore(VectorMultiply(Row2, Scale), Result + 8);
+    VectorStore(VectorMultiply(Row3, Scale), Result + 12);
+    return true;
+}
+
 } // namespace Math
 } // namespace MonsterEngine
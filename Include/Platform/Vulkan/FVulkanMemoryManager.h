@@ -7,7 +7,9 @@
 #pragma once
 
 #include "Core/CoreTypes.h"
+#include "Core/HAL/LowLevelMemTracker.h"
 #include "Platform/Vulkan/VulkanRHI.h"
+#include "RHI/RHISubAllocator.h"
 #include "Containers/Array.h"
 #include <mutex>
 #include <atomic>
@@ -41,7 +43,11 @@ struct FVulkanAllocation {
     
     // Internal tracking (for sub-allocation)
     FVulkanMemoryPool* Pool;            // Owning memory pool
-    void* AllocationHandle;             // Internal allocation handle (points to FMemoryBlock)             
+    uint32 AllocationHandle;            // Sub-allocator handle, passed back to the pool on free
+    
+    // Memory tracking
+    ELLMTag LLMTag;                     // Tag charged for this allocation
+    bool bLLMTracked;                   // Allocated while the tracker was enabled
     
     FVulkanAllocation()
         : DeviceMemory(VK_NULL_HANDLE)
@@ -52,7 +58,9 @@ struct FVulkanAllocation {
         , bDedicated(false)
         , bMapped(false)
         , Pool(nullptr)
-        , AllocationHandle(nullptr)
+        , AllocationHandle(FRHISubAllocation::INVALID_HANDLE)
+        , LLMTag(ELLMTag::Untagged)
+        , bLLMTracked(false)
     {}
     
     // Check if allocation is valid
@@ -62,7 +70,9 @@ struct FVulkanAllocation {
 /**
  * FVulkanMemoryPool - GPU Memory Pool
  * 
- * Manages VkDeviceMemory large blocks for specific memory type, using Free-List algorithm for sub-allocation.
+ * Manages VkDeviceMemory large blocks for specific memory type. Placement is
+ * delegated to a device-independent FRHISubAllocator: TLSF for general
+ * resources, or a ring for per-frame transient data.
  * Each Pool corresponds to one VkDeviceMemory object (default 64MB).
  * 
  * Reference UE5: FVulkanResourceHeap
@@ -75,8 +85,10 @@ public:
      * @param PoolSize Pool size (bytes)
      * @param MemoryTypeIndex Memory type index
      * @param bHostVisible Whether it's Host-visible memory (mappable)
+     * @param Mode Sub-allocation policy
      */
-    FVulkanMemoryPool(VkDevice Device, VkDeviceSize PoolSize, uint32 MemoryTypeIndex, bool bHostVisible);
+    FVulkanMemoryPool(VkDevice Device, VkDeviceSize PoolSize, uint32 MemoryTypeIndex, bool bHostVisible,
+                      ESubAllocatorMode Mode = ESubAllocatorMode::TLSF);
     ~FVulkanMemoryPool();
     
     // Non-copyable
@@ -120,28 +132,25 @@ public:
     uint32 GetMemoryTypeIndex() const { return MemoryTypeIndex; }
     bool IsHostVisible() const { return bHostVisible; }
     
+    ESubAllocatorMode GetMode() const { return SubAllocator.GetMode(); }
+    VkDeviceSize GetLargestFreeBlock();
+    
     /**
-     * Defragmentation: Merge adjacent free blocks
+     * Ring pools: close the current frame, released once the GPU reaches FenceValue
      */
-    void Defragment();
-
-private:
+    void EndFrame(uint64 FenceValue);
+    
     /**
-     * FMemoryBlock - Memory block node (Free-List linked list)
-     * 
-     * Each block represents a memory region in the pool, can be free or allocated.
+     * Ring pools: release frames whose fence value is at most CompletedFenceValue
      */
-    struct FMemoryBlock {
-        VkDeviceSize Offset;            // Offset in pool
-        VkDeviceSize Size;              // Block size
-        bool bFree;                     // Whether free
-        FMemoryBlock* Next;             // Next node in list
-        FMemoryBlock* Prev;             // Previous node in list
-        
-        FMemoryBlock(VkDeviceSize InOffset, VkDeviceSize InSize, bool InFree)
-            : Offset(InOffset), Size(InSize), bFree(InFree), Next(nullptr), Prev(nullptr) {}
-    };
+    void ReleaseCompletedFrames(uint64 CompletedFenceValue);
     
+    /**
+     * Defragmentation: no-op, free blocks are merged as they are freed
+     */
+    void Defragment();
+
+private:
     // Vulkan objects
     VkDevice Device;                    // Logical device
     VkDeviceMemory DeviceMemory;        // Large block memory handle
@@ -154,12 +163,8 @@ private:
     
     // Allocation tracking
     std::atomic<VkDeviceSize> UsedSize; // Used size (atomic operation)
-    FMemoryBlock* FreeList;             // Free list head
+    FRHISubAllocator SubAllocator;      // Placement within DeviceMemory
     std::mutex PoolMutex;               // Thread-safe lock
-    
-    // Internal helper functions
-    void MergeFreeBlocks();             // Merge adjacent free blocks
-    FMemoryBlock* FindFirstFit(VkDeviceSize Size, VkDeviceSize Alignment);  // First-Fit search
 };
 
 /**
@@ -186,7 +191,7 @@ private:
     │     FVulkanMemoryPool (内存池)                       │
     │                                                      │
     │  - 管理单个 VkDeviceMemory (64MB)                   │
-    │  - Free-List 子分配算法                              │
+    │  - TLSF / Ring 子分配 (FRHISubAllocator)             │
     │  - 持久映射 (Host可见)                               │
     │  - 碎片整理                                          │
     └─────────────────────┬───────────────────────────────┘
@@ -321,6 +326,9 @@ private:
     std::atomic<uint32> DedicatedAllocationCount;
     std::atomic<VkDeviceSize> TotalAllocatedMemory;
     
+    // Charge a new allocation to the active memory tag
+    static void TrackAllocation(FVulkanAllocation& Allocation);
+    
     // Per-type pool mutex
     std::mutex PoolsMutex[VK_MAX_MEMORY_TYPES];
     
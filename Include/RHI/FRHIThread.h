@@ -24,6 +24,10 @@ namespace MonsterEngine {
  * - RHI thread translates and submits them to the GPU
  * - This separation allows parallel work and better CPU utilization
  * 
+ * The dedicated RHI thread is attached to the task graph as
+ * ENamedThread::RHIThread, so FTaskGraph tasks routed there run on it
+ * between its own queued tasks.
+ * 
  * Reference: UE5 RHICommandList.h, RHICommandList.cpp
  */
 class FRHIThread : public FRunnable {
@@ -98,6 +102,11 @@ private:
      */
     bool TryGetNextTask(FRHIThreadTask& OutTask, FGraphEventRef& OutEvent);
 
+    /**
+     * Wake the RHI thread when a task graph task is routed to it
+     */
+    static void OnTaskGraphTaskQueued();
+
 private:
     /** Singleton instance */
     static TUniquePtr<FRHIThread> s_instance;
@@ -0,0 +1,117 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// MonsterEngine - Incremental GPU memory defragmentation planner
+//
+// Reference: UE5 Engine/Source/Runtime/VulkanRHI/Private/VulkanMemory.cpp (FVulkanResourceHeap::DefragTick)
+
+#pragma once
+
+#include "Core/CoreTypes.h"
+#include "RHI/RHISubAllocator.h"
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+
+namespace MonsterRender {
+namespace RHI {
+
+using MonsterEngine::TMap;
+
+/**
+ * One copy the GPU has to perform for a defragmentation step
+ */
+struct FRHIDefragMove {
+    uint64 UserId = 0;                  // Id the allocation was registered with
+    uint32 SrcBlock = 0;
+    uint64 SrcOffset = 0;
+    uint32 DstBlock = 0;
+    FRHISubAllocation DstAllocation;    // New range, owned by the allocation once the step completes
+    uint64 Size = 0;                    // Bytes to copy
+};
+
+/**
+ * FRHIDefragPlanner - Relocates live allocations to close holes in GPU memory blocks
+ *
+ * The planner works on the TLSF sub-allocators of a set of blocks and the
+ * live allocations registered with it, and never touches memory itself.
+ * Each step:
+ * - PlanStep() picks allocations to move under a byte budget, reserves
+ *   their destinations and returns the copies to record
+ * - once the GPU has finished the copies, CompleteStep() frees the source
+ *   ranges and updates the registered allocations; the caller rebinds its
+ *   resources from the returned moves. CancelStep() undoes the step instead.
+ *
+ * Moves first evacuate the least occupied block into the others, so whole
+ * blocks can be released, then slide allocations of each block into lower
+ * holes, so the free space gathers at the end. Sources and destinations are
+ * both allocated during a step, so the copies of one step never overlap.
+ *
+ * Not thread-safe; the owner serializes it with allocations in the blocks.
+ */
+class FRHIDefragPlanner {
+public:
+    FRHIDefragPlanner() = default;
+
+    FRHIDefragPlanner(const FRHIDefragPlanner&) = delete;
+    FRHIDefragPlanner& operator=(const FRHIDefragPlanner&) = delete;
+
+    /**
+     * Register a TLSF block
+     * @return Index of the block in moves
+     */
+    uint32 AddBlock(FRHISubAllocator* Block);
+
+    /**
+     * Register a live allocation of a block as a move candidate
+     */
+    void AddAllocation(uint64 UserId, uint32 BlockIndex, const FRHISubAllocation& Allocation, uint64 Alignment);
+
+    /**
+     * Stop tracking an allocation the caller is about to free; a pending move of it is dropped
+     */
+    void RemoveAllocation(uint64 UserId);
+
+    /**
+     * Plan the next step, moving at most MaxBytes
+     * @return Copies to perform, empty when there is nothing left to gain
+     */
+    const TArray<FRHIDefragMove>& PlanStep(uint64 MaxBytes);
+
+    /**
+     * Commit the planned moves after the GPU copies have finished
+     * @return The committed moves; each allocation now lives at its DstBlock and DstAllocation
+     */
+    const TArray<FRHIDefragMove>& CompleteStep();
+
+    /**
+     * Abandon the planned moves, releasing their destinations
+     */
+    void CancelStep();
+
+    /**
+     * Current range of a registered allocation
+     */
+    const FRHISubAllocation* FindAllocation(uint64 UserId, uint32* OutBlockIndex = nullptr) const;
+
+    bool IsStepPending() const { return bStepPending; }
+    int32 GetNumAllocations() const { return Candidates.Num(); }
+
+private:
+    struct FCandidate {
+        uint64 UserId;
+        uint32 Block;
+        FRHISubAllocation Allocation;
+        uint64 Alignment;
+        int32 MoveIndex;        // Pending move, or INDEX_NONE
+    };
+
+    bool TryMove(int32 CandidateIndex, uint32 DstBlock, bool bRequireLowerOffset, uint64& InOutBudget);
+    void RemoveCandidate(int32 CandidateIndex);
+
+    TArray<FRHISubAllocator*> Blocks;
+    TArray<FCandidate> Candidates;
+    TMap<uint64, int32> CandidateIndices;
+    TArray<FRHIDefragMove> Moves;
+    TArray<int32> MoveCandidates;       // Candidate of each move
+    bool bStepPending = false;
+};
+
+}} // namespace MonsterRender::RHI
@@ -0,0 +1,131 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// MonsterEngine - Device-independent GPU memory sub-allocator
+//
+// Reference: UE5 Engine/Source/Runtime/VulkanRHI/Private/VulkanMemory.h (FVulkanSubresourceAllocator)
+
+#pragma once
+
+#include "Core/CoreTypes.h"
+#include "Core/HAL/TLSFAllocator.h"
+#include "Containers/Array.h"
+
+namespace MonsterRender {
+namespace RHI {
+
+using MonsterEngine::TArray;
+
+/**
+ * Placement policy of a sub-allocator
+ */
+enum class ESubAllocatorMode : uint8 {
+    TLSF,       // General allocations, freed individually in any order
+    Ring,       // Per-frame transient data, released a whole frame at a time
+};
+
+/**
+ * Range of a memory block handed out by FRHISubAllocator
+ */
+struct FRHISubAllocation {
+    static constexpr uint32 INVALID_HANDLE = ~0u;
+
+    uint64 Offset = 0;
+    uint64 Size = 0;
+    uint32 Handle = INVALID_HANDLE;     // TLSF block handle; unused in ring mode
+
+    bool IsValid() const { return Size != 0; }
+};
+
+/**
+ * FRHISubAllocator - Sub-allocation policy for one block of GPU memory
+ *
+ * Works purely on offsets into a block it never touches, so the same policy
+ * backs device memory of any RHI and runs without a device (tests and
+ * benchmarks). Two modes:
+ * - TLSF: constant-time allocation and free with immediate coalescing
+ * - Ring: linear allocation that wraps around; allocations are not freed
+ *   individually, instead EndFrame() closes the current frame under a fence
+ *   value and ReleaseCompletedFrames() gives back every frame whose fence
+ *   the GPU has passed
+ *
+ * Not thread-safe; the owning pool locks around it.
+ */
+class FRHISubAllocator {
+public:
+    static constexpr uint64 DEFAULT_GRANULARITY = 256;
+
+    FRHISubAllocator(uint64 Size, ESubAllocatorMode Mode, uint64 Granularity = DEFAULT_GRANULARITY);
+
+    FRHISubAllocator(const FRHISubAllocator&) = delete;
+    FRHISubAllocator& operator=(const FRHISubAllocator&) = delete;
+
+    /**
+     * Allocate Size bytes at an offset aligned to Alignment (a power of two)
+     * @return Whether a range was found
+     */
+    bool Allocate(uint64 Size, uint64 Alignment, FRHISubAllocation& OutAllocation);
+
+    /**
+     * Free a TLSF allocation; ignored in ring mode
+     */
+    void Free(const FRHISubAllocation& Allocation);
+
+    /**
+     * Ring mode: close the current frame; it is released once CompletedFenceValue reaches FenceValue
+     */
+    void EndFrame(uint64 FenceValue);
+
+    /**
+     * Ring mode: release every closed frame whose fence value is at most CompletedFenceValue
+     */
+    void ReleaseCompletedFrames(uint64 CompletedFenceValue);
+
+    /**
+     * Drop every allocation
+     */
+    void Reset();
+
+    ESubAllocatorMode GetMode() const { return Mode; }
+    uint64 GetTotalSize() const { return TotalSize; }
+
+    /**
+     * Bytes unavailable for allocation, including ring padding and wrap-around waste
+     */
+    uint64 GetUsedSize() const;
+    uint64 GetFreeSize() const { return TotalSize - GetUsedSize(); }
+    uint64 GetLargestFreeBlock() const;
+
+    /**
+     * Share of free space outside the largest free block
+     */
+    float GetFragmentation() const;
+
+    uint32 GetNumAllocations() const;
+
+private:
+    struct FFrame {
+        uint64 EndOffset;       // Head when the frame was closed
+        uint64 Bytes;           // Bytes the frame consumed, padding included
+        uint64 FenceValue;
+        uint32 NumAllocations;
+    };
+
+    bool AllocateRing(uint64 Size, uint64 Alignment, FRHISubAllocation& OutAllocation);
+
+    ESubAllocatorMode Mode;
+    uint64 TotalSize;
+    uint64 Granularity;
+
+    // TLSF mode
+    FTLSFAllocator Ranges;
+
+    // Ring mode: [Tail, Head) is live, wrapping at TotalSize
+    uint64 Head = 0;
+    uint64 Tail = 0;
+    uint64 RingUsedSize = 0;
+    uint64 CurrentFrameBytes = 0;
+    uint32 CurrentFrameAllocations = 0;
+    uint32 RingAllocations = 0;
+    TArray<FFrame> Frames;      // Closed frames, oldest first
+};
+
+}} // namespace MonsterRender::RHI
@@ -5,6 +5,7 @@
 
 #include "Core/CoreTypes.h"
 #include "Core/Templates/UniquePtr.h"
+#include "Core/HAL/TLSFAllocator.h"
 #include "Containers/Array.h"
 #include "Containers/Map.h"
 #include <mutex>
@@ -109,7 +110,9 @@ private:
  * 
  * Reference: UE5 Engine/Source/Runtime/RenderCore/Public/TextureResource.h
  * 
- * Pre-allocated GPU memory pool for texture streaming
+ * Pre-allocated GPU memory pool for texture streaming. Ranges come from a
+ * TLSF allocator: allocation and free take constant time and free blocks
+ * are merged as they are freed.
  */
 class FTexturePool {
 public:
@@ -130,33 +133,26 @@ public:
     SIZE_T GetUsedSize() const { return UsedSize; }
     SIZE_T GetFreeSize() const { return TotalSize - UsedSize; }
 
-    // Defragmentation
+    // Fragmentation: share of free memory outside the largest free block
+    float GetFragmentation();
+    SIZE_T GetLargestFreeBlock();
+
+    // Defragmentation (free blocks are already merged on free; only logs the free block layout)
     void Compact();
 
 private:
-    struct FFreeRegion {
-        SIZE_T Offset;
-        SIZE_T Size;
-        FFreeRegion* Next;
-    };
-
     struct FAllocation {
-        SIZE_T Offset;
-        SIZE_T Size;
+        SIZE_T Size;        // Size of the TLSF block, at least the aligned request
+        uint32 Handle;      // TLSF block
     };
 
     void* PoolMemory;
     SIZE_T TotalSize;
     SIZE_T UsedSize;
     
-    FFreeRegion* FreeList;
+    FTLSFAllocator RangeAllocator;
     TMap<void*, FAllocation> Allocations;
     std::mutex PoolMutex;
-
-    // Internal helpers
-    void* AllocateFromFreeList(SIZE_T Size, SIZE_T Alignment);
-    void AddToFreeList(SIZE_T Offset, SIZE_T Size);
-    void MergeFreeRegions();
 };
 
 } // namespace MonsterRender
@@ -432,7 +432,7 @@ protected:
      */
     virtual void SortPrimitives(
         FRenderPassContext& Context,
-        TArray<FPrimitiveSceneInfo*>& Primitives);
+        TArray<FPrimitiveSceneInfo*, SceneRenderingAllocator>& Primitives);
     
     /**
      * Render a single transparent primitive
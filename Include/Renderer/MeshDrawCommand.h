@@ -361,8 +361,11 @@ struct FMeshDrawCommandPassSetupTaskContext
     /** Dynamic mesh elements to process */
     const TArray<FMeshBatchAndRelevance>* DynamicMeshElements;
     
-    /** Output: visible mesh draw commands */
-    TArray<FVisibleMeshDrawCommand> VisibleMeshDrawCommands;
+    /** Generated mesh draw commands referenced by VisibleMeshDrawCommands (capacity kept across frames) */
+    TArray<FMeshDrawCommand> MeshDrawCommandStorage;
+    
+    /** Output: visible mesh draw commands, valid for the frame being rendered */
+    TArray<FVisibleMeshDrawCommand, SceneRenderingAllocator> VisibleMeshDrawCommands;
     
     /** Output: number of dynamic mesh draw commands generated */
     int32 NumDynamicMeshCommandsGenerated;
@@ -395,6 +398,7 @@ struct FMeshDrawCommandPassSetupTaskContext
      */
     void Reset()
     {
+        MeshDrawCommandStorage.Reset();
         VisibleMeshDrawCommands.Empty();
         NumDynamicMeshCommandsGenerated = 0;
     }
@@ -507,7 +511,7 @@ public:
     /**
      * Get visible mesh draw commands
      */
-    TArray<FVisibleMeshDrawCommand>& GetVisibleMeshDrawCommands() 
+    TArray<FVisibleMeshDrawCommand, SceneRenderingAllocator>& GetVisibleMeshDrawCommands() 
     { 
         return TaskContext.VisibleMeshDrawCommands; 
     }
@@ -425,13 +425,13 @@ struct FRenderPassContext
     float TotalTime = 0.0f;
     
     /** Visible opaque primitives for this view */
-    TArray<FPrimitiveSceneInfo*>* VisibleOpaquePrimitives = nullptr;
+    TArray<FPrimitiveSceneInfo*, SceneRenderingAllocator>* VisibleOpaquePrimitives = nullptr;
     
     /** Visible transparent primitives for this view (sorted back-to-front) */
-    TArray<FPrimitiveSceneInfo*>* VisibleTransparentPrimitives = nullptr;
+    TArray<FPrimitiveSceneInfo*, SceneRenderingAllocator>* VisibleTransparentPrimitives = nullptr;
     
     /** Visible lights affecting this view */
-    TArray<FLightSceneInfo*>* VisibleLights = nullptr;
+    TArray<FLightSceneInfo*, SceneRenderingAllocator>* VisibleLights = nullptr;
     
     /** Viewport dimensions */
     int32 ViewportX = 0;
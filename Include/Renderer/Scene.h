@@ -626,11 +626,46 @@ public:
      */
     const TArray<uint8>& GetPrimitiveOcclusionFlags() const { return PrimitiveOcclusionFlags; }
     
+    /**
+     * Get the mask of primitives with EOcclusionFlags::CanBeOccluded
+     */
+    const FSceneBitArray& GetPrimitivesCanBeOccludedMap() const { return PrimitivesCanBeOccludedMap; }
+    
     /**
      * Get the primitive component IDs array
      */
     const TArray<uint32>& GetPrimitiveComponentIds() const { return PrimitiveComponentIds; }
     
+    /**
+     * Get the primitive transforms relative to the render origin
+     */
+    const TArray<Math::FRenderTransform>& GetPrimitiveRenderTransforms() const { return PrimitiveRenderTransforms; }
+    
+    /**
+     * Get the primitive bounds relative to the render origin, for culling
+     */
+    const TArray<Math::FRenderBounds>& GetPrimitiveRenderBounds() const { return PrimitiveRenderBounds; }
+    
+    /**
+     * Get the render bounds boxes in blocks of 8, for culling 8 primitives at a time
+     * Primitive i is lane i % 8 of block i / 8; lanes past the last primitive are unused.
+     */
+    const TArray<Math::FBoxBlock8>& GetPrimitiveBoundsBlocks() const { return PrimitiveBoundsBlocks; }
+    
+    /**
+     * Get the origin the render transforms and bounds are relative to
+     */
+    const Math::FVector& GetRenderOrigin() const { return RenderOrigin; }
+    
+    /**
+     * Move the render origin to the tile containing a view
+     * 
+     * Rebuilds the render transforms and bounds when the tile changes, which
+     * only happens when the view crosses a tile boundary.
+     * @param ViewOrigin World position of the primary view
+     */
+    void UpdateRenderOrigin(const Math::FVector& ViewOrigin);
+    
     // ========================================================================
     // Frame Management
     // ========================================================================
@@ -680,9 +715,24 @@ public:
     /** Primitive occlusion flags */
     TArray<uint8> PrimitiveOcclusionFlags;
     
+    /** CanBeOccluded bit of PrimitiveOcclusionFlags, for combining with visibility masks */
+    FSceneBitArray PrimitivesCanBeOccludedMap;
+    
     /** Primitive component IDs */
     TArray<uint32> PrimitiveComponentIds;
     
+    /** Primitive transforms as float 3x4, relative to RenderOrigin */
+    TArray<Math::FRenderTransform> PrimitiveRenderTransforms;
+    
+    /** Primitive bounds as float, relative to RenderOrigin (read by frustum culling) */
+    TArray<Math::FRenderBounds> PrimitiveRenderBounds;
+    
+    /** Origin and extent of PrimitiveRenderBounds in structure-of-arrays blocks of 8 */
+    TArray<Math::FBoxBlock8> PrimitiveBoundsBlocks;
+    
+    /** Origin of the render transforms and bounds, snapped to Math::RenderTileSize */
+    Math::FVector RenderOrigin;
+    
     /** All lights in the scene */
     TArray<FLightSceneInfo*> Lights;
     
@@ -703,6 +753,16 @@ private:
      */
     void RemovePrimitiveFromArrays(FPrimitiveSceneInfo* PrimitiveSceneInfo);
     
+    /**
+     * Write a primitive's render transform and bounds from its proxy
+     */
+    void UpdatePrimitiveRenderData(int32 Index);
+    
+    /**
+     * Copy a primitive's render bounds into its lane of PrimitiveBoundsBlocks
+     */
+    void WritePrimitiveBoundsBlock(int32 Index);
+    
     /** RHI device for resource creation */
     MonsterRender::RHI::IRHIDevice* m_rhiDevice = nullptr;
 };
@@ -19,6 +19,8 @@
 #include "Math/Box.h"
 #include "Math/Sphere.h"
 #include "Math/Plane.h"
+#include "Math/RenderTransform.h"
+#include "Math/VectorKernels.h"
 #include <cmath>
 
 // Forward declarations for RHI types (in MonsterRender::RHI namespace)
@@ -531,6 +533,100 @@ struct FConvexVolume
     int32 GetNumPlanes() const { return Planes.Num(); }
 };
 
+// ============================================================================
+// FRenderConvexVolume - Convex Volume Relative to a Render Origin
+// ============================================================================
+
+/**
+ * @struct FRenderConvexVolume
+ * @brief Float planes of a convex volume, moved to a render origin
+ *
+ * Tests FRenderBounds without converting them back to world space. For a
+ * world point P = R + Origin, dot(N, P) - W = dot(N, R) - (W - dot(N, Origin)),
+ * so only W changes; it is computed in double before rounding to float.
+ * Reference: UE5 FConvexVolume with large world coordinate view tiles
+ */
+struct FRenderConvexVolume
+{
+    /** Planes with W relative to the render origin */
+    TArray<Math::FPlane4f> Planes;
+
+    /**
+     * Build from a world-space volume
+     * @param Volume World-space convex volume
+     * @param RelativeTo Render origin the bounds being tested are relative to
+     */
+    FRenderConvexVolume(const FConvexVolume& Volume, const Math::FVector& RelativeTo)
+    {
+        Planes.Reserve(Volume.Planes.Num());
+        for (const Math::FPlane& Plane : Volume.Planes)
+        {
+            const double RelativeW = Plane.W - (Plane.X * RelativeTo.X + Plane.Y * RelativeTo.Y + Plane.Z * RelativeTo.Z);
+            Planes.Add(Math::FPlane4f(
+                static_cast<float>(Plane.X), static_cast<float>(Plane.Y),
+                static_cast<float>(Plane.Z), static_cast<float>(RelativeW)));
+        }
+    }
+
+    /**
+     * Test if a relative sphere intersects the volume
+     */
+    bool IntersectSphere(const Math::FVector3f& Center, float Radius) const
+    {
+        for (const Math::FPlane4f& Plane : Planes)
+        {
+            const float Distance = Plane.X * Center.X + Plane.Y * Center.Y + Plane.Z * Center.Z - Plane.W;
+            if (Distance > Radius)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Test if a relative box intersects the volume
+     */
+    bool IntersectBox(const Math::FVector3f& Origin, const Math::FVector3f& Extent) const
+    {
+        for (const Math::FPlane4f& Plane : Planes)
+        {
+            const float Distance = Plane.X * Origin.X + Plane.Y * Origin.Y + Plane.Z * Origin.Z - Plane.W;
+            const float EffectiveRadius =
+                std::abs(Plane.X) * Extent.X +
+                std::abs(Plane.Y) * Extent.Y +
+                std::abs(Plane.Z) * Extent.Z;
+            if (Distance > EffectiveRadius)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Test if relative bounds intersect the volume (sphere, then box)
+     */
+    bool IntersectBounds(const Math::FRenderBounds& Bounds) const
+    {
+        return IntersectSphere(Bounds.Origin, Bounds.SphereRadius) &&
+               IntersectBox(Bounds.Origin, Bounds.BoxExtent);
+    }
+
+    /**
+     * Test relative boxes in blocks of 8 with the widest culling kernel the CPU supports
+     * @param Blocks (NumBoxes + 7) / 8 blocks of box origins and extents
+     * @param NumBoxes Number of boxes
+     * @param OutVisibleWords Receives (NumBoxes + 31) / 32 words; bit i is set if box i intersects
+     */
+    void IntersectBoxBlocks(const Math::FBoxBlock8* Blocks, int32 NumBoxes, uint32* OutVisibleWords) const
+    {
+        static_assert(sizeof(Math::FPlane4f) == 4 * sizeof(float), "Kernels read planes as packed X, Y, Z, W floats");
+        Math::FVectorKernels::Get().CullBoxBlocks(reinterpret_cast<const float*>(Planes.GetData()), Planes.Num(),
+                                                  Blocks, NumBoxes, OutVisibleWords);
+    }
+};
+
 // ============================================================================
 // EOcclusionFlags - Occlusion Query Flags
 // ============================================================================
@@ -143,7 +143,9 @@ struct FViewMatrices
         ViewProjectionMatrix = ViewMatrix * ProjectionMatrix;
         InvViewMatrix = ViewMatrix.Inverse();
         InvProjectionMatrix = ProjectionMatrix.Inverse();
-        InvViewProjectionMatrix = ViewProjectionMatrix.Inverse();
+        
+        // (V * P)^-1 = P^-1 * V^-1, reusing the inverses just computed
+        InvViewProjectionMatrix = InvProjectionMatrix * InvViewMatrix;
     }
     
     /**
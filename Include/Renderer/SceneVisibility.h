@@ -72,9 +72,6 @@ struct FPrimitiveCullingFlags
     /** Whether to also use sphere test before box test */
     uint32 bAlsoUseSphereTest : 1;
     
-    /** Whether to use SIMD-optimized 8-plane intersection */
-    uint32 bUseFastIntersect : 1;
-    
     /** Whether to use visibility octree for acceleration */
     uint32 bUseVisibilityOctree : 1;
     
@@ -92,7 +89,6 @@ struct FPrimitiveCullingFlags
         : bShouldVisibilityCull(true)
         , bUseCustomCulling(false)
         , bAlsoUseSphereTest(false)
-        , bUseFastIntersect(true)
         , bUseVisibilityOctree(false)
         , bNaniteAlwaysVisible(false)
         , bHasHiddenPrimitives(false)
@@ -110,7 +106,7 @@ struct FPrimitiveCullingFlags
  * @brief Performs frustum culling for scene primitives
  * 
  * Tests primitive bounds against the view frustum to determine visibility.
- * Supports SIMD-optimized intersection tests and parallel processing.
+ * Box tests run 8 primitives at a time on the scene's bounds blocks, in parallel.
  * Reference: UE5 PrimitiveCull, IntersectBox8Plane
  */
 class FFrustumCuller
@@ -131,63 +127,24 @@ public:
      */
     int32 CullPrimitives(const FScene* Scene, FViewInfo& View, const FPrimitiveCullingFlags& Flags);
     
-    /**
-     * Test if a primitive is visible in the frustum
-     * @param View The view
-     * @param Bounds The primitive bounds
-     * @param Flags Culling flags
-     * @return True if the primitive is visible
-     */
-    bool IsPrimitiveVisible(const FViewInfo& View, const FPrimitiveBounds& Bounds, 
-                           const FPrimitiveCullingFlags& Flags) const;
-    
-    /**
-     * Test box-frustum intersection using 8 permuted planes (SIMD optimized)
-     * @param Origin Box center
-     * @param Extent Box half-extents
-     * @param PermutedPlanes Array of 8 permuted planes
-     * @return True if the box intersects the frustum
-     */
-    static bool IntersectBox8Plane(const Math::FVector& Origin, const Math::FVector& Extent,
-                                   const Math::FPlane* PermutedPlanes);
-    
-    /**
-     * Test box-frustum intersection (standard method)
-     * @param Origin Box center
-     * @param Extent Box half-extents
-     * @param Planes Frustum planes
-     * @param NumPlanes Number of planes
-     * @return True if the box intersects the frustum
-     */
-    static bool IntersectBoxPlanes(const Math::FVector& Origin, const Math::FVector& Extent,
-                                   const Math::FPlane* Planes, int32 NumPlanes);
-    
-    /**
-     * Test sphere-frustum intersection
-     * @param Center Sphere center
-     * @param Radius Sphere radius
-     * @param Planes Frustum planes
-     * @param NumPlanes Number of planes
-     * @return True if the sphere intersects the frustum
-     */
-    static bool IntersectSpherePlanes(const Math::FVector& Center, float Radius,
-                                      const Math::FPlane* Planes, int32 NumPlanes);
-    
 private:
     /**
-     * Perform culling for a range of primitives (used for parallel processing)
+     * Perform culling for a range of at most 32 primitives (one visibility word)
+     * 
+     * Box tests read the scene's bounds blocks and run 8 primitives at a time;
+     * the optional sphere test only runs on primitives that pass them.
      * @param Scene The scene
-     * @param View The view
+     * @param RenderFrustum View frustum moved to the scene's render origin
      * @param Flags Culling flags
-     * @param StartIndex Start primitive index
+     * @param StartIndex Start primitive index, a multiple of 32
      * @param EndIndex End primitive index (exclusive)
-     * @param OutNumCulled Output: number of primitives culled
+     * @return Visibility bits of the range, bit 0 being StartIndex
      */
-    void CullPrimitiveRange(const FScene* Scene, FViewInfo& View, 
-                           const FPrimitiveCullingFlags& Flags,
-                           int32 StartIndex, int32 EndIndex, int32& OutNumCulled);
+    uint32 CullPrimitiveRange(const FScene* Scene, const FRenderConvexVolume& RenderFrustum, 
+                              const FPrimitiveCullingFlags& Flags,
+                              int32 StartIndex, int32 EndIndex) const;
     
-    /** Number of primitives to process per parallel task */
+    /** Minimum number of primitives per parallel batch (whole visibility words) */
     static constexpr int32 PrimitivesPerTask = 128 * 32; // 128 words * 32 bits
 };
 
@@ -214,6 +171,7 @@ public:
     
     /**
      * Perform distance culling for a view
+     * Tests the primitives set in the view's visibility map and clears the culled ones.
      * @param Scene The scene containing primitives
      * @param View The view to cull against
      * @return Number of primitives culled
@@ -244,6 +202,9 @@ public:
     static void SetViewDistanceScale(float Scale);
     
 private:
+    /** Primitives culled by the last CullPrimitives call */
+    FSceneBitArray CulledPrimitiveMap;
+    
     /** Global view distance scale factor */
     static float ViewDistanceScale;
     
@@ -449,6 +410,7 @@ public:
     
     /**
      * Perform occlusion culling
+     * Tests the visible primitives that can be occluded and clears the occluded ones.
      * @param Scene The scene
      * @param View The view
      * @param RHICmdList The command list
@@ -532,6 +494,12 @@ private:
     /** Pending query indices */
     TArray<int32> PendingQueries;
     
+    /** Visible primitives that can be occluded, rebuilt by CullPrimitives */
+    FSceneBitArray OcclusionCandidateMap;
+    
+    /** Primitives occluded in the last CullPrimitives call */
+    FSceneBitArray OccludedPrimitiveMap;
+    
     /** HZB texture */
     IRHITexture* HZBTexture;
     
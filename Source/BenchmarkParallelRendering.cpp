@@ -211,7 +211,7 @@ FBenchmarkResults RunMultiThreadedBenchmark(const FBenchmarkConfig& config) {
             uint32 drawCalls = config.drawCallsPerList;
             
             FGraphEventRef event = FTaskGraph::QueueNamedTask(
-                "RecordCommands_" + std::to_string(i),
+                "RecordCommands",
                 [cmdList, drawCalls]() {
                     SimulateCommandRecording(cmdList, drawCalls);
                 },
@@ -0,0 +1,405 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+#include "Containers/Name.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+namespace MonsterEngine
+{
+
+namespace
+{
+    // Slot values: full hash in the high word, entry id plus SlotUsedBit in the low word
+    constexpr uint64 SlotUsedBit = 1ull << 31;
+
+    template<typename CharType>
+    FORCEINLINE uint32 GetCodeUnit(CharType C)
+    {
+        if constexpr (std::is_same_v<CharType, ANSICHAR>)
+        {
+            return static_cast<uint8>(C);
+        }
+        else
+        {
+            return static_cast<uint32>(C);
+        }
+    }
+
+    FORCEINLINE uint32 ToLowerCodeUnit(uint32 C)
+    {
+        return (C >= 'A' && C <= 'Z') ? C + ('a' - 'A') : C;
+    }
+
+    /**
+     * Case-insensitive hash over code units, so ANSI and wide spellings of a name hash alike
+     */
+    template<typename CharType>
+    uint32 HashNameNoCase(const CharType* Name, int32 Len)
+    {
+        uint32 Hash = 2166136261u;
+        for (int32 i = 0; i < Len; ++i)
+        {
+            Hash = (Hash ^ ToLowerCodeUnit(GetCodeUnit(Name[i]))) * 16777619u;
+        }
+
+        // FNV mixes the low bits poorly; the shard comes from the high bits
+        Hash ^= Hash >> 16;
+        Hash *= 0x85EBCA6Bu;
+        Hash ^= Hash >> 13;
+        Hash *= 0xC2B2AE35u;
+        Hash ^= Hash >> 16;
+        return Hash;
+    }
+
+    template<typename CharTypeA, typename CharTypeB>
+    bool EqualsNoCase(const CharTypeA* A, const CharTypeB* B, int32 Len)
+    {
+        for (int32 i = 0; i < Len; ++i)
+        {
+            if (ToLowerCodeUnit(GetCodeUnit(A[i])) != ToLowerCodeUnit(GetCodeUnit(B[i])))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename CharType>
+    bool EntryEquals(const FNameEntry& Entry, const CharType* Name, int32 Len)
+    {
+        if (Entry.GetNameLength() != Len)
+        {
+            return false;
+        }
+        return Entry.IsWide() ? EqualsNoCase(Entry.GetWideName(), Name, Len) : EqualsNoCase(Entry.GetAnsiName(), Name, Len);
+    }
+
+    template<typename CharType>
+    bool FitsInAnsi(const CharType* Name, int32 Len)
+    {
+        if constexpr (!std::is_same_v<CharType, ANSICHAR>)
+        {
+            for (int32 i = 0; i < Len; ++i)
+            {
+                if (GetCodeUnit(Name[i]) > 0xFF)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    template<typename CharType>
+    FORCEINLINE int32 GetNameLength(const CharType* Name)
+    {
+        if constexpr (std::is_same_v<CharType, ANSICHAR>)
+        {
+            return static_cast<int32>(std::strlen(Name));
+        }
+        else
+        {
+            return static_cast<int32>(std::wcslen(Name));
+        }
+    }
+}
+
+// ============================================================================
+// FNameEntry
+// ============================================================================
+
+void FNameEntry::AppendNameToString(FString& OutString) const
+{
+    if (IsWide())
+    {
+        OutString.Append(GetWideName(), Len);
+        return;
+    }
+
+    TCHAR Buffer[NAME_SIZE];
+    const ANSICHAR* Name = GetAnsiName();
+    for (int32 i = 0; i < Len; ++i)
+    {
+        Buffer[i] = static_cast<TCHAR>(static_cast<uint8>(Name[i]));
+    }
+    OutString.Append(Buffer, Len);
+}
+
+FString FNameEntry::GetPlainNameString() const
+{
+    FString Result;
+    AppendNameToString(Result);
+    return Result;
+}
+
+// ============================================================================
+// FNamePool
+// ============================================================================
+
+/**
+ * Open-addressing slot table of one shard, linear probing
+ */
+struct FNamePool::FSlotTable
+{
+    uint32 Mask;
+    std::atomic<uint64>* Slots;
+
+    static FSlotTable* Create(uint32 Capacity)
+    {
+        FSlotTable* Table = new FSlotTable;
+        Table->Mask = Capacity - 1;
+        Table->Slots = new std::atomic<uint64>[Capacity];
+        for (uint32 i = 0; i < Capacity; ++i)
+        {
+            Table->Slots[i].store(0, std::memory_order_relaxed);
+        }
+        return Table;
+    }
+
+    static void Destroy(FSlotTable* Table)
+    {
+        delete[] Table->Slots;
+        delete Table;
+    }
+};
+
+FNamePool& FNamePool::Get()
+{
+    static FNamePool Instance;
+    return Instance;
+}
+
+FNamePool::FNamePool()
+{
+    for (FShard& Shard : Shards)
+    {
+        Shard.Table.store(FSlotTable::Create(InitialShardCapacity), std::memory_order_relaxed);
+    }
+
+    // Entry 0 is NAME_None
+    FindOrAdd("None");
+}
+
+FNamePool::~FNamePool()
+{
+    for (FShard& Shard : Shards)
+    {
+        FSlotTable::Destroy(Shard.Table.load(std::memory_order_relaxed));
+        for (FSlotTable* Table : Shard.Retired)
+        {
+            FSlotTable::Destroy(Table);
+        }
+    }
+    for (uint32 BlockIndex = 0; BlockIndex <= CurrentBlock; ++BlockIndex)
+    {
+        std::free(Blocks[BlockIndex].load(std::memory_order_relaxed));
+    }
+}
+
+FNameEntryId FNamePool::FindOrAdd(const WIDECHAR* Name)
+{
+    return Name ? FindOrAddImpl(Name, GetNameLength(Name)) : FNameEntryId();
+}
+
+FNameEntryId FNamePool::FindOrAdd(const ANSICHAR* Name)
+{
+    return Name ? FindOrAddImpl(Name, GetNameLength(Name)) : FNameEntryId();
+}
+
+FNameEntryId FNamePool::FindOrAdd(const WIDECHAR* Name, int32 Len)
+{
+    return FindOrAddImpl(Name, Len);
+}
+
+FNameEntryId FNamePool::FindOrAdd(const ANSICHAR* Name, int32 Len)
+{
+    return FindOrAddImpl(Name, Len);
+}
+
+FNameEntryId FNamePool::Find(const WIDECHAR* Name) const
+{
+    return FindImpl(Name);
+}
+
+FNameEntryId FNamePool::Find(const ANSICHAR* Name) const
+{
+    return FindImpl(Name);
+}
+
+template<typename CharType>
+FNameEntryId FNamePool::FindImpl(const CharType* Name) const
+{
+    FNameEntryId Id;
+    if (!Name || !*Name)
+    {
+        return Id;
+    }
+
+    int32 Len = GetNameLength(Name);
+    if (Len >= NAME_SIZE)
+    {
+        Len = NAME_SIZE - 1;
+    }
+
+    const uint32 Hash = HashNameNoCase(Name, Len);
+    FindInTable(Shards[Hash >> (32 - NumShardBits)].Table.load(std::memory_order_acquire), Name, Len, Hash, Id);
+    return Id;
+}
+
+template<typename CharType>
+FNameEntryId FNamePool::FindOrAddImpl(const CharType* Name, int32 Len)
+{
+    if (!Name || Len <= 0)
+    {
+        return FNameEntryId(); // NAME_None
+    }
+    if (Len >= NAME_SIZE)
+    {
+        Len = NAME_SIZE - 1;
+    }
+
+    const uint32 Hash = HashNameNoCase(Name, Len);
+    FShard& Shard = Shards[Hash >> (32 - NumShardBits)];
+
+    // Lock-free fast path: the name usually exists already
+    FNameEntryId Id;
+    if (FindInTable(Shard.Table.load(std::memory_order_acquire), Name, Len, Hash, Id))
+    {
+        return Id;
+    }
+
+    std::lock_guard<std::mutex> Lock(Shard.WriteLock);
+
+    // Another thread may have added it, possibly into a grown table
+    FSlotTable* Table = Shard.Table.load(std::memory_order_relaxed);
+    if (FindInTable(Table, Name, Len, Hash, Id))
+    {
+        return Id;
+    }
+
+    // Keep the load at most 3/4 so probes stay short
+    if ((Shard.NumUsed + 1) * 4 > (Table->Mask + 1) * 3)
+    {
+        Table = GrowShard(Shard);
+    }
+
+    Id = CreateEntry(Name, Len, Hash);
+
+    uint32 SlotIndex = Hash & Table->Mask;
+    while (Table->Slots[SlotIndex].load(std::memory_order_relaxed) != 0)
+    {
+        SlotIndex = (SlotIndex + 1) & Table->Mask;
+    }
+
+    // Release: readers that see the slot also see the entry it points to
+    Table->Slots[SlotIndex].store((static_cast<uint64>(Hash) << 32) | SlotUsedBit | Id.ToUnstableInt(), std::memory_order_release);
+    ++Shard.NumUsed;
+    NumNames.fetch_add(1, std::memory_order_relaxed);
+    return Id;
+}
+
+template<typename CharType>
+bool FNamePool::FindInTable(const FSlotTable* Table, const CharType* Name, int32 Len, uint32 Hash, FNameEntryId& OutId) const
+{
+    uint32 SlotIndex = Hash & Table->Mask;
+    while (true)
+    {
+        const uint64 Slot = Table->Slots[SlotIndex].load(std::memory_order_acquire);
+        if (Slot == 0)
+        {
+            return false;
+        }
+        if (static_cast<uint32>(Slot >> 32) == Hash)
+        {
+            const FNameEntryId Id = FNameEntryId::FromUnstableInt(static_cast<uint32>(Slot & (SlotUsedBit - 1)));
+            if (EntryEquals(Resolve(Id), Name, Len))
+            {
+                OutId = Id;
+                return true;
+            }
+        }
+        SlotIndex = (SlotIndex + 1) & Table->Mask;
+    }
+}
+
+template<typename CharType>
+FNameEntryId FNamePool::CreateEntry(const CharType* Name, int32 Len, uint32 Hash)
+{
+    const bool bIsWide = !FitsInAnsi(Name, Len);
+    const uint32 CharSize = bIsWide ? sizeof(WIDECHAR) : sizeof(ANSICHAR);
+    const uint32 Bytes = (static_cast<uint32>(sizeof(FNameEntry)) + (Len + 1) * CharSize + EntryStride - 1) & ~(EntryStride - 1);
+
+    std::lock_guard<std::mutex> Lock(ArenaLock);
+
+    uint8* Block = Blocks[CurrentBlock].load(std::memory_order_relaxed);
+    if (!Block || CurrentByteCursor + Bytes > BlockSizeBytes)
+    {
+        if (Block)
+        {
+            ++CurrentBlock;
+            assert(CurrentBlock < MaxBlocks && "FName arena exhausted");
+        }
+        Block = static_cast<uint8*>(std::malloc(BlockSizeBytes));
+        Blocks[CurrentBlock].store(Block, std::memory_order_release);
+        CurrentByteCursor = 0;
+    }
+
+    FNameEntry* Entry = new (Block + CurrentByteCursor) FNameEntry;
+    Entry->Hash = Hash;
+    Entry->Len = static_cast<uint16>(Len);
+    Entry->bIsWide = bIsWide ? 1 : 0;
+    Entry->Padding = 0;
+
+    if (bIsWide)
+    {
+        WIDECHAR* Chars = reinterpret_cast<WIDECHAR*>(Entry + 1);
+        for (int32 i = 0; i < Len; ++i)
+        {
+            Chars[i] = static_cast<WIDECHAR>(GetCodeUnit(Name[i]));
+        }
+        Chars[Len] = 0;
+    }
+    else
+    {
+        ANSICHAR* Chars = reinterpret_cast<ANSICHAR*>(Entry + 1);
+        for (int32 i = 0; i < Len; ++i)
+        {
+            Chars[i] = static_cast<ANSICHAR>(GetCodeUnit(Name[i]));
+        }
+        Chars[Len] = 0;
+    }
+
+    const FNameEntryId Id = FNameEntryId::FromUnstableInt((CurrentBlock << BlockOffsetBits) | (CurrentByteCursor / EntryStride));
+    CurrentByteCursor += Bytes;
+    return Id;
+}
+
+FNamePool::FSlotTable* FNamePool::GrowShard(FShard& Shard)
+{
+    FSlotTable* OldTable = Shard.Table.load(std::memory_order_relaxed);
+    FSlotTable* NewTable = FSlotTable::Create((OldTable->Mask + 1) * 2);
+
+    for (uint32 i = 0; i <= OldTable->Mask; ++i)
+    {
+        const uint64 Slot = OldTable->Slots[i].load(std::memory_order_relaxed);
+        if (Slot != 0)
+        {
+            uint32 SlotIndex = static_cast<uint32>(Slot >> 32) & NewTable->Mask;
+            while (NewTable->Slots[SlotIndex].load(std::memory_order_relaxed) != 0)
+            {
+                SlotIndex = (SlotIndex + 1) & NewTable->Mask;
+            }
+            NewTable->Slots[SlotIndex].store(Slot, std::memory_order_relaxed);
+        }
+    }
+
+    // Readers may still probe the old table, so it is only freed with the pool
+    Shard.Table.store(NewTable, std::memory_order_release);
+    Shard.Retired.Add(OldTable);
+    return NewTable;
+}
+
+} // namespace MonsterEngine
@@ -1,6 +1,9 @@
 #include "Core/Application.h"
 #include "Core/Log.h"
 #include "Core/HAL/FMemoryManager.h"
+#include "Core/HAL/MemStack.h"
+#include "Core/FTaskGraph.h"
+#include "Core/FTaskTracer.h"
 #include "RHI/RHI.h"
 
 #include <chrono>
@@ -32,6 +35,17 @@ namespace MonsterRender {
         }
         MR_LOG_INFO("Memory system initialized successfully");
         
+        // Start the task graph workers and make this thread a named thread.
+        // Rendering runs on the main thread, so it owns the render thread queue
+        // as well; tick() drains both
+        if (!MonsterEngine::FTaskGraph::IsInitialized()) {
+            MonsterEngine::FTaskGraph::Initialize();
+            m_ownsTaskGraph = true;
+        }
+        MonsterEngine::FTaskGraph::AttachToThread(MonsterEngine::ENamedThread::RenderThread);
+        MonsterEngine::FTaskGraph::AttachToThread(MonsterEngine::ENamedThread::GameThread);
+        MonsterEngine::FTaskTracer::SetThreadName("GameThread (renders)", static_cast<int32>(MonsterEngine::ENamedThread::GameThread));
+        
         // Initialize window factory
         WindowFactory::initialize();
         
@@ -99,12 +113,27 @@ namespace MonsterRender {
         // Call derived class shutdown
         onShutdown();
         
+        // Run tasks still queued for this thread, then stop accepting them
+        MonsterEngine::FTaskGraph::ProcessThreadUntilIdle(MonsterEngine::ENamedThread::GameThread);
+        MonsterEngine::FTaskGraph::ProcessThreadUntilIdle(MonsterEngine::ENamedThread::RenderThread);
+        
         // Shutdown engine
         if (m_engine) {
             m_engine->shutdown();
             m_engine.reset();
         }
         
+        // Shutdown task graph after the engine, which may still queue work
+        MonsterEngine::FTaskGraph::DetachFromThread(MonsterEngine::ENamedThread::GameThread);
+        MonsterEngine::FTaskGraph::DetachFromThread(MonsterEngine::ENamedThread::RenderThread);
+        if (m_ownsTaskGraph) {
+            MonsterEngine::FTaskGraph::Shutdown();
+            m_ownsTaskGraph = false;
+        }
+        
+        // Free trace buffers of the exited workers and of this thread
+        MonsterEngine::FTaskTracer::Shutdown();
+        
         // Shutdown window
         if (m_window) {
             m_window->shutdown();
@@ -146,6 +175,9 @@ namespace MonsterRender {
         // Process window events
         m_window->pollEvents();
         
+        // Run tasks routed to the game thread
+        MonsterEngine::FTaskGraph::ProcessThreadUntilIdle(MonsterEngine::ENamedThread::GameThread);
+        
         // Skip rendering if minimized
         if (m_minimized) {
             // Sleep a bit to avoid busy waiting
@@ -159,10 +191,22 @@ namespace MonsterRender {
         }
         
         // Update application
-        onUpdate(m_deltaTime);
+        {
+            MR_TRACE_SCOPE("GameThread_Update");
+            onUpdate(m_deltaTime);
+        }
+        
+        // Run tasks routed to the render thread (and forwarded from an unattached RHI thread)
+        MonsterEngine::FTaskGraph::ProcessThreadUntilIdle(MonsterEngine::ENamedThread::RenderThread);
         
         // Render frame
-        onRender();
+        {
+            MR_TRACE_SCOPE("RenderThread_Render");
+            onRender();
+        }
+        
+        // Frame scratch memory of every thread is reclaimed from here on
+        FMemStack::EndFrame();
         
         // Update statistics
         m_frameCount++;
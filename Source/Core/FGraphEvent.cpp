@@ -48,11 +48,30 @@ bool FGraphEvent::IsComplete() const {
 
 void FGraphEvent::DispatchSubsequents() {
     TArray<TSharedPtr<FGraphEvent>> subsequentsToDispatch;
+    FBaseGraphTask* inlineTasksToDispatch[kNumInlineSubsequentTasks];
+    int32 numInlineTasksToDispatch = 0;
+    TArray<FBaseGraphTask*> tasksToDispatch;
     
     {
+        // Take the lists by move so dispatch never allocates
         std::lock_guard<std::mutex> lock(m_mutex);
-        subsequentsToDispatch = m_subsequents;
+        subsequentsToDispatch = std::move(m_subsequents);
         m_subsequents.clear();
+        numInlineTasksToDispatch = m_numInlineSubsequentTasks;
+        for (int32 i = 0; i < numInlineTasksToDispatch; ++i) {
+            inlineTasksToDispatch[i] = m_inlineSubsequentTasks[i];
+        }
+        m_numInlineSubsequentTasks = 0;
+        tasksToDispatch = std::move(m_subsequentTasks);
+        m_subsequentTasks.clear();
+    }
+    
+    // Notify waiting tasks first so they can be queued while events cascade
+    for (int32 i = 0; i < numInlineTasksToDispatch; ++i) {
+        inlineTasksToDispatch[i]->OnPrerequisiteCompleted();
+    }
+    for (FBaseGraphTask* Task : tasksToDispatch) {
+        Task->OnPrerequisiteCompleted();
     }
     
     // Dispatch all subsequent events
@@ -86,6 +105,26 @@ void FGraphEvent::AddSubsequent(TSharedPtr<FGraphEvent> Subsequent) {
     }
 }
 
+bool FGraphEvent::AddSubsequent(FBaseGraphTask* Task) {
+    if (!Task) {
+        return false;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    // Once complete, DispatchSubsequents may already have taken the list
+    if (m_isComplete.load(std::memory_order_acquire)) {
+        return false;
+    }
+    
+    if (m_numInlineSubsequentTasks < kNumInlineSubsequentTasks) {
+        m_inlineSubsequentTasks[m_numInlineSubsequentTasks++] = Task;
+    } else {
+        m_subsequentTasks.push_back(Task);
+    }
+    return true;
+}
+
 void FGraphEvent::Complete() {
     // Mark as complete
     bool wasAlreadyComplete = m_isComplete.exchange(true, std::memory_order_acq_rel);
@@ -107,7 +146,7 @@ void FGraphEvent::Complete() {
 
 uint32 FGraphEvent::GetNumSubsequents() const {
     std::lock_guard<std::mutex> lock(m_mutex);
-    return static_cast<uint32>(m_subsequents.size());
+    return static_cast<uint32>(m_subsequents.size() + m_numInlineSubsequentTasks + m_subsequentTasks.size());
 }
 
 } // namespace MonsterEngine
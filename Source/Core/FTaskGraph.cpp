@@ -1,13 +1,142 @@
 // Copyright Monster Engine. All Rights Reserved.
 
 #include "Core/FTaskGraph.h"
+#include "Core/FTaskTracer.h"
 #include "Core/Log.h"
+#include "Core/HAL/LowLevelMemTracker.h"
 #include <thread>
 
 namespace MonsterEngine {
 
 // Initialize static members
 TUniquePtr<FTaskGraph> FTaskGraph::s_instance = nullptr;
+std::atomic<bool> FTaskGraph::s_namedThreadAttached[FTaskGraph::kNumNamedThreads] = {};
+std::atomic<FTaskGraph::FNamedThreadWakeup> FTaskGraph::s_namedThreadWakeups[FTaskGraph::kNumNamedThreads] = {};
+
+namespace {
+    /** Index of the task graph worker running on this thread (-1 for non-worker threads) */
+    thread_local int32 t_workerIndex = -1;
+    
+    /** Maximum number of threads (caller + helpers) taking part in one ParallelFor */
+    constexpr int32 kMaxParallelForParticipants = 64;
+    
+    /**
+     * Shared state of one ParallelFor call
+     * 
+     * Each participant owns a slot holding its remaining sub-range packed as
+     * (Begin | End << 32). The owner takes batches from the front, thieves
+     * split off the back half; both only ever CAS the packed value.
+     * Reference counted because helper tasks may start after the caller returned.
+     */
+    struct FParallelForContext {
+        struct alignas(64) FRangeSlot {
+            std::atomic<uint64> Range{0};
+        };
+        
+        void (*Invoke)(void* Context, int32 Start, int32 End) = nullptr;
+        void* Body = nullptr;
+        int32 Num = 0;
+        int32 MinBatchSize = 1;
+        int32 NumParticipants = 0;
+        
+        /** Next free slot for a helper that starts */
+        std::atomic<int32> NextSlot{1};
+        
+        /** Indices whose Body call has returned */
+        alignas(64) std::atomic<int32> NumCompleted{0};
+        
+        FRangeSlot Slots[kMaxParallelForParticipants];
+        
+        static uint64 Pack(uint32 Begin, uint32 End) {
+            return static_cast<uint64>(Begin) | (static_cast<uint64>(End) << 32);
+        }
+        
+        static uint32 Begin(uint64 Range) { return static_cast<uint32>(Range); }
+        static uint32 End(uint64 Range) { return static_cast<uint32>(Range >> 32); }
+        
+        /** Take a batch from the front of a slot (owner only) */
+        bool TakeBatch(int32 SlotIndex, uint32& OutBegin, uint32& OutEnd) {
+            std::atomic<uint64>& slot = Slots[SlotIndex].Range;
+            uint64 range = slot.load(std::memory_order_acquire);
+            
+            while (Begin(range) < End(range)) {
+                // Guided batch size: a fraction of what is left, never below MinBatchSize,
+                // so early batches are large and the tail stays balanced
+                const uint32 remaining = End(range) - Begin(range);
+                const uint32 batch = std::max<uint32>(static_cast<uint32>(MinBatchSize),
+                                                      remaining / (2 * static_cast<uint32>(NumParticipants)));
+                const uint32 batchEnd = std::min<uint32>(Begin(range) + batch, End(range));
+                
+                if (slot.compare_exchange_weak(range, Pack(batchEnd, End(range)),
+                        std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    OutBegin = Begin(range);
+                    OutEnd = batchEnd;
+                    return true;
+                }
+            }
+            return false;
+        }
+        
+        /** Steal the back half of the largest other sub-range into our own (empty) slot */
+        bool StealRange(int32 SlotIndex) {
+            for (;;) {
+                int32 victim = -1;
+                uint64 victimRange = 0;
+                uint32 largest = 0;
+                
+                for (int32 i = 0; i < NumParticipants; ++i) {
+                    if (i == SlotIndex) {
+                        continue;
+                    }
+                    const uint64 range = Slots[i].Range.load(std::memory_order_acquire);
+                    if (Begin(range) < End(range) && End(range) - Begin(range) > largest) {
+                        largest = End(range) - Begin(range);
+                        victim = i;
+                        victimRange = range;
+                    }
+                }
+                
+                if (victim < 0) {
+                    return false;
+                }
+                
+                // Small remainders are taken whole, larger ones are halved
+                const uint32 begin = Begin(victimRange);
+                const uint32 end = End(victimRange);
+                const uint32 split = (largest <= static_cast<uint32>(MinBatchSize)) ? begin : begin + largest / 2;
+                
+                if (Slots[victim].Range.compare_exchange_strong(victimRange, Pack(begin, split),
+                        std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    Slots[SlotIndex].Range.store(Pack(split, end), std::memory_order_release);
+                    return true;
+                }
+            }
+        }
+        
+        /** Process own slot, then keep stealing until no work is left */
+        void Participate(int32 SlotIndex) {
+            uint32 begin = 0;
+            uint32 end = 0;
+            
+            do {
+                while (TakeBatch(SlotIndex, begin, end)) {
+                    Invoke(Body, static_cast<int32>(begin), static_cast<int32>(end));
+                    NumCompleted.fetch_add(static_cast<int32>(end - begin), std::memory_order_acq_rel);
+                }
+            } while (StealRange(SlotIndex));
+        }
+    };
+    
+    /** Xorshift32 step for victim selection */
+    inline uint32 NextRandom(uint32& State) {
+        uint32 x = State;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        State = x;
+        return x;
+    }
+}
 
 void FTaskGraph::Initialize(uint32 NumThreads) {
     if (s_instance) {
@@ -29,9 +158,22 @@ void FTaskGraph::Initialize(uint32 NumThreads) {
     
     s_instance = MakeUnique<FTaskGraph>();
     
+    // Keep one worker free of background work so high-priority tasks never
+    // wait behind a background burst. A single worker has none to spare, so
+    // it only runs background work while nothing else is pending.
+    s_instance->m_maxBackgroundWorkers = NumThreads - 1;
+    
     MR_LOG_INFO("FTaskGraph::Initialize - Creating task graph with " + 
                std::to_string(NumThreads) + " worker threads");
     
+    // Create per-worker deques before any worker can start stealing
+    s_instance->m_workerQueues.reserve(NumThreads);
+    for (uint32 i = 0; i < NumThreads; ++i) {
+        auto queue = MakeUnique<FWorkerQueue>();
+        queue->RandomState = 0x9E3779B9u ^ ((i + 1) * 0x85EBCA6Bu);
+        s_instance->m_workerQueues.push_back(std::move(queue));
+    }
+    
     // Create worker threads
     s_instance->m_workers.reserve(NumThreads);
     s_instance->m_workerThreads.reserve(NumThreads);
@@ -80,6 +222,32 @@ void FTaskGraph::Shutdown() {
     s_instance->m_workerThreads.clear();
     s_instance->m_workers.clear();
     
+    // Release tasks that were never picked up
+    for (auto& queue : s_instance->m_workerQueues) {
+        for (auto& localQueue : queue->LocalQueues) {
+            while (FTaskEntry* entry = localQueue.Steal()) {
+                delete entry;
+            }
+        }
+    }
+    s_instance->m_workerQueues.clear();
+    
+    for (FTaskList& injectionQueue : s_instance->m_injectionQueues) {
+        while (FTaskEntry* entry = injectionQueue.Pop()) {
+            delete entry;
+        }
+    }
+    
+    for (FNamedThreadQueue& namedQueue : s_instance->m_namedThreadQueues) {
+        std::lock_guard<std::mutex> lock(namedQueue.Mutex);
+        for (FTaskList& list : namedQueue.Lists) {
+            while (FTaskEntry* entry = list.Pop()) {
+                delete entry;
+            }
+        }
+        namedQueue.NumQueued.store(0, std::memory_order_relaxed);
+    }
+    
     MR_LOG_INFO("FTaskGraph::Shutdown - Task graph shutdown complete. " +
                std::to_string(s_instance->m_totalTasksCompleted.load()) + " tasks completed");
     
@@ -92,15 +260,19 @@ bool FTaskGraph::IsInitialized() {
 
 FGraphEventRef FTaskGraph::QueueTask(
     FTaskDelegate&& Task,
-    const FGraphEventArray& Prerequisites
+    const FGraphEventArray& Prerequisites,
+    ETaskPriority Priority,
+    ENamedThread Thread
 ) {
-    return QueueNamedTask("UnnamedTask", std::move(Task), Prerequisites);
+    return QueueNamedTask("UnnamedTask", std::move(Task), Prerequisites, Priority, Thread);
 }
 
 FGraphEventRef FTaskGraph::QueueNamedTask(
-    const String& TaskName,
+    const char* TaskName,
     FTaskDelegate&& Task,
-    const FGraphEventArray& Prerequisites
+    const FGraphEventArray& Prerequisites,
+    ETaskPriority Priority,
+    ENamedThread Thread
 ) {
     if (!s_instance) {
         MR_LOG_ERROR("FTaskGraph::QueueNamedTask - Task graph not initialized");
@@ -108,57 +280,176 @@ FGraphEventRef FTaskGraph::QueueNamedTask(
     }
     
     if (s_instance->m_isShuttingDown.load(std::memory_order_acquire)) {
-        MR_LOG_WARNING("FTaskGraph::QueueNamedTask - Cannot queue task during shutdown: " + TaskName);
+        MR_LOG_WARNING(String("FTaskGraph::QueueNamedTask - Cannot queue task during shutdown: ") + TaskName);
         return nullptr;
     }
     
     // Create completion event
     auto completionEvent = MakeGraphEvent();
     
+    FTaskEntry* entry = new FTaskEntry(std::move(Task), completionEvent, TaskName, Priority, Thread);
+    
+    if (FTaskTracer::IsEnabled()) {
+        const uint64 traceId = FTaskTracer::AllocateTaskId();
+        completionEvent->SetTraceId(traceId);
+        for (const auto& Prerequisite : Prerequisites) {
+            if (Prerequisite) {
+                FTaskTracer::RecordDependency(Prerequisite->GetTraceId(), traceId);
+            }
+        }
+    }
+    
     // If prerequisites are already complete, queue immediately
     if (Prerequisites.empty() || AreEventsComplete(Prerequisites)) {
-        std::lock_guard<std::mutex> lock(s_instance->m_queueMutex);
-        s_instance->m_taskQueue.emplace(std::move(Task), completionEvent, Prerequisites, TaskName);
-        s_instance->m_totalTasksQueued.fetch_add(1, std::memory_order_relaxed);
-        s_instance->m_queueCV.notify_one();
+        s_instance->EnqueueTask(entry);
         
-        MR_LOG_DEBUG("FTaskGraph::QueueNamedTask - Queued task: " + TaskName);
+        MR_LOG_DEBUG(String("FTaskGraph::QueueNamedTask - Queued task: ") + TaskName);
     } else {
-        // Prerequisites not complete, create a wrapper task that waits
-        auto wrappedTask = [Task = std::move(Task), Prerequisites, TaskName]() mutable {
-            // Wait for prerequisites
-            WaitForEvents(Prerequisites);
-            // Execute the actual task
-            Task();
-        };
+        // Subscribe to every prerequisite. The extra hold keeps a prerequisite that
+        // completes during setup from enqueuing the task before all are registered.
+        const int32 numPrerequisites = static_cast<int32>(Prerequisites.size());
+        entry->numPrerequisitesOutstanding.store(numPrerequisites + 1, std::memory_order_relaxed);
+        s_instance->m_numWaitingTasks.fetch_add(1, std::memory_order_acq_rel);
+        
+        int32 numAlreadyComplete = 0;
+        for (const auto& Prerequisite : Prerequisites) {
+            if (!Prerequisite || !Prerequisite->AddSubsequent(entry)) {
+                ++numAlreadyComplete;
+            }
+        }
         
-        std::lock_guard<std::mutex> lock(s_instance->m_queueMutex);
-        s_instance->m_taskQueue.emplace(std::move(wrappedTask), completionEvent, FGraphEventArray{}, TaskName);
-        s_instance->m_totalTasksQueued.fetch_add(1, std::memory_order_relaxed);
-        s_instance->m_queueCV.notify_one();
+        MR_LOG_DEBUG(String("FTaskGraph::QueueNamedTask - Queued task with prerequisites: ") + TaskName);
         
-        MR_LOG_DEBUG("FTaskGraph::QueueNamedTask - Queued task with prerequisites: " + TaskName);
+        s_instance->ReleasePrerequisites(entry, numAlreadyComplete + 1);
     }
     
     return completionEvent;
 }
 
-void FTaskGraph::WaitForAllTasks() {
-    if (!s_instance) {
+void FTaskGraph::AttachToThread(ENamedThread Thread, FNamedThreadWakeup OnTaskQueued) {
+    if (Thread == ENamedThread::AnyThread || Thread == ENamedThread::Num) {
+        MR_LOG_WARNING("FTaskGraph::AttachToThread - Only named threads can be attached");
         return;
     }
     
-    MR_LOG_DEBUG("FTaskGraph::WaitForAllTasks - Waiting for all tasks to complete");
+    static const char* const s_threadNames[kNumNamedThreads] = {"AnyThread", "GameThread", "RenderThread", "RHIThread"};
+    
+    const uint32 index = static_cast<uint32>(Thread);
+    FTaskTracer::SetThreadName(s_threadNames[index], static_cast<int32>(index));
+    s_namedThreadWakeups[index].store(OnTaskQueued, std::memory_order_release);
+    s_namedThreadAttached[index].store(true, std::memory_order_release);
+}
+
+void FTaskGraph::DetachFromThread(ENamedThread Thread) {
+    if (Thread == ENamedThread::AnyThread || Thread == ENamedThread::Num) {
+        return;
+    }
+    
+    const uint32 index = static_cast<uint32>(Thread);
+    s_namedThreadAttached[index].store(false, std::memory_order_release);
+    s_namedThreadWakeups[index].store(nullptr, std::memory_order_release);
+}
+
+uint32 FTaskGraph::ProcessThreadUntilIdle(ENamedThread Thread) {
+    if (!s_instance || Thread == ENamedThread::AnyThread || Thread == ENamedThread::Num) {
+        return 0;
+    }
+    
+    FNamedThreadQueue& namedQueue = s_instance->m_namedThreadQueues[static_cast<uint32>(Thread)];
+    uint32 numExecuted = 0;
     
-    // Wait until queue is empty and no active tasks
-    while (true) {
+    while (namedQueue.NumQueued.load(std::memory_order_acquire) != 0) {
+        FTaskEntry* entry = nullptr;
         {
-            std::lock_guard<std::mutex> lock(s_instance->m_queueMutex);
-            if (s_instance->m_taskQueue.empty() && 
-                s_instance->m_activeTasks.load(std::memory_order_acquire) == 0) {
-                break;
+            std::lock_guard<std::mutex> lock(namedQueue.Mutex);
+            for (FTaskList& list : namedQueue.Lists) {
+                if ((entry = list.Pop()) != nullptr) {
+                    break;
+                }
             }
         }
+        
+        if (!entry) {
+            break;
+        }
+        
+        namedQueue.NumQueued.fetch_sub(1, std::memory_order_acq_rel);
+        s_instance->ExecuteTask(entry);
+        ++numExecuted;
+    }
+    
+    return numExecuted;
+}
+
+bool FTaskGraph::HasPendingThreadTasks(ENamedThread Thread) {
+    if (!s_instance || Thread == ENamedThread::AnyThread || Thread == ENamedThread::Num) {
+        return false;
+    }
+    return s_instance->m_namedThreadQueues[static_cast<uint32>(Thread)].NumQueued.load(std::memory_order_acquire) != 0;
+}
+
+void FTaskGraph::ParallelForInternal(int32 Num, int32 MinBatchSize, FParallelForInvoke Invoke, void* Context) {
+    if (Num <= 0) {
+        return;
+    }
+    
+    MinBatchSize = std::max(MinBatchSize, 1);
+    
+    const int32 numWorkers = s_instance && !s_instance->m_isShuttingDown.load(std::memory_order_acquire)
+        ? static_cast<int32>(s_instance->m_workerThreads.size()) : 0;
+    const int32 maxUsefulParticipants = (Num + MinBatchSize - 1) / MinBatchSize;
+    const int32 numParticipants = std::min({numWorkers + 1, maxUsefulParticipants, kMaxParallelForParticipants});
+    
+    if (numParticipants <= 1) {
+        Invoke(Context, 0, Num);
+        return;
+    }
+    
+    // Static initial partition, rebalanced by stealing
+    auto context = MakeShared<FParallelForContext>();
+    context->Invoke = Invoke;
+    context->Body = Context;
+    context->Num = Num;
+    context->MinBatchSize = MinBatchSize;
+    context->NumParticipants = numParticipants;
+    
+    for (int32 i = 0; i < numParticipants; ++i) {
+        const uint32 begin = static_cast<uint32>(static_cast<int64>(Num) * i / numParticipants);
+        const uint32 end = static_cast<uint32>(static_cast<int64>(Num) * (i + 1) / numParticipants);
+        context->Slots[i].Range.store(FParallelForContext::Pack(begin, end), std::memory_order_relaxed);
+    }
+    
+    // Helpers claim slots 1..N-1 in the order they start; slot 0 is the caller's
+    for (int32 i = 1; i < numParticipants; ++i) {
+        s_instance->EnqueueTask(new FTaskEntry([context]() {
+            const int32 slot = context->NextSlot.fetch_add(1, std::memory_order_acq_rel);
+            if (slot < context->NumParticipants) {
+                context->Participate(slot);
+            }
+        }, nullptr, "ParallelForHelper", ETaskPriority::High));
+    }
+    
+    context->Participate(0);
+    
+    // All ranges are claimed; wait for batches still running on helpers
+    while (context->NumCompleted.load(std::memory_order_acquire) != Num) {
+        std::this_thread::yield();
+    }
+}
+
+void FTaskGraph::WaitForAllTasks() {
+    if (!s_instance) {
+        return;
+    }
+    
+    MR_LOG_DEBUG("FTaskGraph::WaitForAllTasks - Waiting for all tasks to complete");
+    
+    // Wait until no task is waiting, queued or active.
+    // Tasks move waiting -> pending -> active, and each counter is incremented
+    // before the previous one is decremented, so a task is never invisible.
+    while (s_instance->m_numWaitingTasks.load(std::memory_order_acquire) != 0 ||
+           s_instance->m_numPendingTasks.load(std::memory_order_acquire) != 0 ||
+           s_instance->m_activeTasks.load(std::memory_order_acquire) != 0) {
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
     
@@ -176,8 +467,41 @@ uint32 FTaskGraph::GetNumPendingTasks() {
     if (!s_instance) {
         return 0;
     }
-    std::lock_guard<std::mutex> lock(s_instance->m_queueMutex);
-    return static_cast<uint32>(s_instance->m_taskQueue.size());
+    return s_instance->m_numPendingTasks.load(std::memory_order_acquire);
+}
+
+int32 FTaskGraph::GetCurrentWorkerIndex() {
+    return s_instance ? t_workerIndex : -1;
+}
+
+FTaskGraphStats FTaskGraph::GetStats() {
+    FTaskGraphStats stats;
+    if (!s_instance) {
+        return stats;
+    }
+    
+    for (const auto& queue : s_instance->m_workerQueues) {
+        stats.NumTasksExecuted += queue->NumTasksExecuted.load(std::memory_order_relaxed);
+        stats.NumLocalPops += queue->NumLocalPops.load(std::memory_order_relaxed);
+        stats.NumGlobalPops += queue->NumGlobalPops.load(std::memory_order_relaxed);
+        stats.NumStealAttempts += queue->NumStealAttempts.load(std::memory_order_relaxed);
+        stats.NumSteals += queue->NumSteals.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+void FTaskGraph::ResetStats() {
+    if (!s_instance) {
+        return;
+    }
+    
+    for (auto& queue : s_instance->m_workerQueues) {
+        queue->NumTasksExecuted.store(0, std::memory_order_relaxed);
+        queue->NumLocalPops.store(0, std::memory_order_relaxed);
+        queue->NumGlobalPops.store(0, std::memory_order_relaxed);
+        queue->NumStealAttempts.store(0, std::memory_order_relaxed);
+        queue->NumSteals.store(0, std::memory_order_relaxed);
+    }
 }
 
 FTaskGraph::FTaskGraph() {
@@ -191,69 +515,280 @@ FTaskGraph& FTaskGraph::Get() {
 }
 
 void FTaskGraph::ProcessTasks(uint32 WorkerIndex) {
+    LLM_SCOPE(ELLMTag::TaskGraph);
     MR_LOG_DEBUG("FTaskGraph::ProcessTasks - Worker " + std::to_string(WorkerIndex) + " started");
     
+    t_workerIndex = static_cast<int32>(WorkerIndex);
+    
+    const String threadName = "TaskWorker " + std::to_string(WorkerIndex);
+    FTaskTracer::SetThreadName(threadName.c_str(), 100 + static_cast<int32>(WorkerIndex));
+    
     while (!m_isShuttingDown.load(std::memory_order_acquire)) {
-        FTaskEntry taskEntry;
-        
-        if (TryGetNextTask(taskEntry)) {
-            // Execute the task
-            m_activeTasks.fetch_add(1, std::memory_order_relaxed);
+        if (FTaskEntry* entry = FindWork(WorkerIndex)) {
+            const bool isBackground = entry->priority == ETaskPriority::Background;
             
-            try {
-                MR_LOG_DEBUG("FTaskGraph::ProcessTasks - Worker " + std::to_string(WorkerIndex) + 
-                           " executing task: " + taskEntry.taskName);
-                
-                taskEntry.task();
-                
-                // Mark completion event as complete
-                if (taskEntry.completionEvent) {
-                    taskEntry.completionEvent->Complete();
-                }
-                
-                m_totalTasksCompleted.fetch_add(1, std::memory_order_relaxed);
-            }
-            catch (const std::exception& e) {
-                MR_LOG_ERROR("FTaskGraph::ProcessTasks - Exception in task " + 
-                           taskEntry.taskName + ": " + e.what());
-                
-                // Still mark as complete to avoid deadlocks
-                if (taskEntry.completionEvent) {
-                    taskEntry.completionEvent->Complete();
+            ExecuteTask(entry);
+            m_workerQueues[WorkerIndex]->NumTasksExecuted.fetch_add(1, std::memory_order_relaxed);
+            
+            if (isBackground) {
+                m_numActiveBackgroundTasks.fetch_sub(1, std::memory_order_acq_rel);
+                // A background slot opened up; let a sleeper pick up queued background work
+                if (m_numPendingBackgroundTasks.load(std::memory_order_acquire) != 0) {
+                    WakeWorker();
                 }
             }
-            
-            m_activeTasks.fetch_sub(1, std::memory_order_relaxed);
-        } else {
-            // No tasks available, wait
-            std::unique_lock<std::mutex> lock(m_queueMutex);
-            m_queueCV.wait_for(lock, std::chrono::milliseconds(10), [this]() {
-                return !m_taskQueue.empty() || m_isShuttingDown.load(std::memory_order_acquire);
-            });
+            m_activeTasks.fetch_sub(1, std::memory_order_acq_rel);
+            continue;
         }
+        
+        // No tasks available, sleep. Publishing the sleeper count before re-checking
+        // the pending count pairs with EnqueueTask (pending++ then sleepers check),
+        // so a wakeup can not be lost between the two.
+        std::unique_lock<std::mutex> lock(m_queueMutex);
+        m_numSleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        m_queueCV.wait_for(lock, std::chrono::milliseconds(10), [this]() {
+            return HasRunnableWork() || m_isShuttingDown.load(std::memory_order_acquire);
+        });
+        m_numSleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
     }
     
+    t_workerIndex = -1;
+    
     MR_LOG_DEBUG("FTaskGraph::ProcessTasks - Worker " + std::to_string(WorkerIndex) + " stopped");
 }
 
-bool FTaskGraph::TryGetNextTask(FTaskEntry& OutTask) {
+void FTaskGraph::ReleasePrerequisites(FTaskEntry* Entry, int32 NumCompleted) {
+    const int32 previous = Entry->numPrerequisitesOutstanding.fetch_sub(NumCompleted, std::memory_order_acq_rel);
+    if (previous != NumCompleted) {
+        return;
+    }
+    
+    // Last prerequisite done: enqueue on the completing thread, which is usually
+    // a worker, so the dependent task lands in that worker's local deque
+    EnqueueTask(Entry);
+    m_numWaitingTasks.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void FTaskGraph::EnqueueTask(FTaskEntry* Entry) {
+    m_totalTasksQueued.fetch_add(1, std::memory_order_relaxed);
+    
+    if (Entry->thread != ENamedThread::AnyThread) {
+        EnqueueNamedThreadTask(Entry);
+        return;
+    }
+    
+    const uint32 priority = static_cast<uint32>(Entry->priority);
+    if (Entry->priority == ETaskPriority::Background) {
+        m_numPendingBackgroundTasks.fetch_add(1, std::memory_order_seq_cst);
+    }
+    m_numPendingTasks.fetch_add(1, std::memory_order_seq_cst);
+    
+    const int32 workerIndex = t_workerIndex;
+    if (workerIndex < 0 || !m_workerQueues[workerIndex]->LocalQueues[priority].Push(Entry)) {
+        // External thread, or local deque full: use the injection queue
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_injectionQueues[priority].Push(Entry);
+    }
+    
+    WakeWorker();
+}
+
+ENamedThread FTaskGraph::ResolveNamedThread(ENamedThread Thread) {
+    // Unattached named threads forward to the next thread up the pipeline
+    while (Thread != ENamedThread::GameThread &&
+           !s_namedThreadAttached[static_cast<uint32>(Thread)].load(std::memory_order_acquire)) {
+        Thread = static_cast<ENamedThread>(static_cast<uint32>(Thread) - 1);
+    }
+    return Thread;
+}
+
+void FTaskGraph::EnqueueNamedThreadTask(FTaskEntry* Entry) {
+    const uint32 index = static_cast<uint32>(ResolveNamedThread(Entry->thread));
+    FNamedThreadQueue& namedQueue = m_namedThreadQueues[index];
+    
+    // The game thread is the last fallback; if nobody attached it, the task
+    // only runs when someone calls ProcessThreadUntilIdle(GameThread)
+    if (!s_namedThreadAttached[index].load(std::memory_order_acquire)) {
+        static std::atomic<bool> s_warnedUnattached{false};
+        if (!s_warnedUnattached.exchange(true, std::memory_order_relaxed)) {
+            MR_LOG_WARNING(String("FTaskGraph::EnqueueNamedThreadTask - No thread is attached as GameThread; task '") +
+                           (Entry->taskName ? Entry->taskName : "Unnamed") + "' waits until the game thread queue is processed");
+        }
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(namedQueue.Mutex);
+        namedQueue.Lists[static_cast<uint32>(Entry->priority)].Push(Entry);
+        namedQueue.NumQueued.fetch_add(1, std::memory_order_release);
+    }
+    
+    if (FNamedThreadWakeup wakeup = s_namedThreadWakeups[index].load(std::memory_order_acquire)) {
+        wakeup();
+    }
+}
+
+bool FTaskGraph::HasRunnableWork() const {
+    const uint32 numPending = m_numPendingTasks.load(std::memory_order_seq_cst);
+    const uint32 numPendingBackground = m_numPendingBackgroundTasks.load(std::memory_order_seq_cst);
+    
+    if (numPending > numPendingBackground) {
+        return true;
+    }
+    return numPendingBackground != 0 &&
+           m_numActiveBackgroundTasks.load(std::memory_order_acquire) < GetMaxActiveBackgroundTasks();
+}
+
+uint32 FTaskGraph::GetMaxActiveBackgroundTasks() const {
+    if (m_maxBackgroundWorkers > 0) {
+        return m_maxBackgroundWorkers;
+    }
+    // No worker to spare: one background task at a time, and only while no
+    // higher-priority task is pending, so those wait for at most one slice
+    const bool bOnlyBackgroundPending = m_numPendingTasks.load(std::memory_order_seq_cst) ==
+                                        m_numPendingBackgroundTasks.load(std::memory_order_seq_cst);
+    return bOnlyBackgroundPending ? 1 : 0;
+}
+
+void FTaskGraph::WakeWorker() {
+    if (m_numSleepingWorkers.load(std::memory_order_seq_cst) == 0) {
+        return;
+    }
+    
+    // Take the lock so the notification can not slip in between a
+    // sleeper's predicate check and its wait
     std::lock_guard<std::mutex> lock(m_queueMutex);
+    m_queueCV.notify_one();
+}
+
+FTaskGraph::FTaskEntry* FTaskGraph::FindWork(uint32 WorkerIndex) {
+    // Re-checked before every task, so a high-priority task waits for at most
+    // the slice currently running on each worker
+    for (uint32 priority = 0; priority < kNumPriorities; ++priority) {
+        const bool isBackground = priority == static_cast<uint32>(ETaskPriority::Background);
+        
+        if (isBackground) {
+            // Reserve a background slot first so at most GetMaxActiveBackgroundTasks() run background work
+            if (m_numPendingBackgroundTasks.load(std::memory_order_acquire) == 0) {
+                break;
+            }
+            if (m_numActiveBackgroundTasks.fetch_add(1, std::memory_order_acq_rel) >= GetMaxActiveBackgroundTasks()) {
+                m_numActiveBackgroundTasks.fetch_sub(1, std::memory_order_acq_rel);
+                break;
+            }
+        }
+        
+        if (FTaskEntry* entry = FindWorkAtPriority(WorkerIndex, priority)) {
+            // Become active before leaving the pending count (see WaitForAllTasks)
+            m_activeTasks.fetch_add(1, std::memory_order_acq_rel);
+            if (isBackground) {
+                m_numPendingBackgroundTasks.fetch_sub(1, std::memory_order_acq_rel);
+            }
+            m_numPendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+            return entry;
+        }
+        
+        if (isBackground) {
+            m_numActiveBackgroundTasks.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+    return nullptr;
+}
+
+FTaskGraph::FTaskEntry* FTaskGraph::FindWorkAtPriority(uint32 WorkerIndex, uint32 Priority) {
+    FWorkerQueue& ownQueue = *m_workerQueues[WorkerIndex];
     
-    if (m_taskQueue.empty()) {
-        return false;
+    if (FTaskEntry* entry = ownQueue.LocalQueues[Priority].Pop()) {
+        ownQueue.NumLocalPops.fetch_add(1, std::memory_order_relaxed);
+        return entry;
     }
     
-    // Get task from queue
-    OutTask = std::move(m_taskQueue.front());
-    m_taskQueue.pop();
+    FTaskEntry* entry = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        entry = m_injectionQueues[Priority].Pop();
+    }
     
-    return true;
+    if (entry) {
+        ownQueue.NumGlobalPops.fetch_add(1, std::memory_order_relaxed);
+        return entry;
+    }
+    
+    return TrySteal(WorkerIndex, Priority);
+}
+
+FTaskGraph::FTaskEntry* FTaskGraph::TrySteal(uint32 WorkerIndex, uint32 Priority) {
+    const uint32 numWorkers = static_cast<uint32>(m_workerQueues.size());
+    if (numWorkers <= 1) {
+        return nullptr;
+    }
+    
+    FWorkerQueue& ownQueue = *m_workerQueues[WorkerIndex];
+    const uint32 start = NextRandom(ownQueue.RandomState) % numWorkers;
+    
+    for (uint32 i = 0; i < numWorkers; ++i) {
+        const uint32 victim = (start + i) % numWorkers;
+        if (victim == WorkerIndex) {
+            continue;
+        }
+        
+        ownQueue.NumStealAttempts.fetch_add(1, std::memory_order_relaxed);
+        if (FTaskEntry* entry = m_workerQueues[victim]->LocalQueues[Priority].Steal()) {
+            ownQueue.NumSteals.fetch_add(1, std::memory_order_relaxed);
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+void FTaskGraph::ExecuteTask(FTaskEntry* Entry) {
+    try {
+        MR_LOG_DEBUG("FTaskGraph::ExecuteTask - Worker " + std::to_string(t_workerIndex) + 
+                   " executing task: " + Entry->taskName);
+        
+        {
+            FScopedTaskTrace traceScope(Entry->taskName,
+                                        Entry->completionEvent ? Entry->completionEvent->GetTraceId() : 0,
+                                        t_workerIndex);
+            Entry->task();
+        }
+        
+        // Mark completion event as complete
+        if (Entry->completionEvent) {
+            Entry->completionEvent->Complete();
+        }
+        
+        m_totalTasksCompleted.fetch_add(1, std::memory_order_relaxed);
+    }
+    catch (const std::exception& e) {
+        MR_LOG_ERROR(String("FTaskGraph::ExecuteTask - Exception in task ") + 
+                   Entry->taskName + ": " + e.what());
+        
+        // Still mark as complete to avoid deadlocks
+        if (Entry->completionEvent) {
+            Entry->completionEvent->Complete();
+        }
+    }
+    
+    delete Entry;
 }
 
 bool FTaskGraph::ArePrerequisitesComplete(const FGraphEventArray& Prerequisites) {
     return AreEventsComplete(Prerequisites);
 }
 
+// FTaskEntry implementation
+void FTaskGraph::FTaskEntry::OnPrerequisiteCompleted() {
+    if (!s_instance) {
+        // Task graph was shut down while this task was still waiting
+        if (numPrerequisitesOutstanding.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+        return;
+    }
+    
+    s_instance->ReleasePrerequisites(this, 1);
+}
+
 // FTaskWorker implementation
 FTaskGraph::FTaskWorker::FTaskWorker(FTaskGraph* InTaskGraph, uint32 InWorkerIndex)
     : m_taskGraph(InTaskGraph)
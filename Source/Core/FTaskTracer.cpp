@@ -0,0 +1,408 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+#include "Core/FTaskTracer.h"
+#include "Core/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace MonsterEngine {
+
+#if MR_TASK_TRACE_ENABLED
+
+std::atomic<bool> FTaskTracer::s_enabled{false};
+
+namespace {
+    enum class ETraceRecordType : uint8 {
+        Scope,
+        Dependency
+    };
+
+    /** One ring buffer entry */
+    struct FTraceRecord {
+        /** Scope: start time. Dependency: source task id */
+        uint64 A;
+
+        /** Scope: end time. Dependency: target task id */
+        uint64 B;
+
+        /** Scope name (static storage) */
+        const char* Name;
+
+        /** Task id of the scope, 0 if none */
+        uint64 TaskId;
+
+        int32 WorkerIndex;
+        ETraceRecordType Type;
+    };
+
+    constexpr uint32 kMaxThreadNameLength = 64;
+
+    /** Per-thread ring buffer, written only by its owning thread */
+    struct FThreadBuffer {
+        char Name[kMaxThreadNameLength] = {};
+        int32 SortIndex = 0;
+        uint32 ThreadId = 0;
+
+        /** Owning thread has exited; the buffer is freed by the next Reset() or Shutdown() */
+        bool bThreadExited = false;
+
+        /** Total records ever written; slot = index % capacity */
+        std::atomic<uint64> NumWritten{0};
+
+        FTraceRecord Records[FTaskTracer::kRingBufferCapacity];
+
+        FORCEINLINE FTraceRecord& BeginWrite(uint64& OutIndex) {
+            OutIndex = NumWritten.load(std::memory_order_relaxed);
+            return Records[OutIndex % FTaskTracer::kRingBufferCapacity];
+        }
+
+        FORCEINLINE void EndWrite(uint64 Index) {
+            NumWritten.store(Index + 1, std::memory_order_release);
+        }
+    };
+
+    /** All live thread buffers; kept after thread exit so exports show them until Reset() or Shutdown() */
+    struct FTracerRegistry {
+        std::mutex Mutex;
+        std::vector<FThreadBuffer*> Buffers;
+
+        /** Set by Shutdown(): buffers are freed as soon as their thread exits */
+        bool bShutDown = false;
+        std::atomic<uint64> NextTaskId{1};
+
+        /** Trace row id of the next buffer; never reused, so freed buffers do not alias rows */
+        uint32 NextThreadId = 1;
+        const std::chrono::steady_clock::time_point Epoch = std::chrono::steady_clock::now();
+    };
+
+    FTracerRegistry& GetRegistry() {
+        // Intentionally leaked: worker threads may record during static destruction
+        static FTracerRegistry* s_registry = new FTracerRegistry();
+        return *s_registry;
+    }
+
+    thread_local FThreadBuffer* t_threadBuffer = nullptr;
+
+    /** Remove a buffer from the registry and free it; registry mutex must be held */
+    void FreeBufferLocked(FTracerRegistry& Registry, FThreadBuffer* Buffer) {
+        Registry.Buffers.erase(std::remove(Registry.Buffers.begin(), Registry.Buffers.end(), Buffer), Registry.Buffers.end());
+        delete Buffer;
+    }
+
+    /** Free every buffer whose thread has exited; registry mutex must be held */
+    void FreeExitedBuffersLocked(FTracerRegistry& Registry) {
+        for (size_t i = Registry.Buffers.size(); i-- > 0;) {
+            if (Registry.Buffers[i]->bThreadExited) {
+                delete Registry.Buffers[i];
+                Registry.Buffers.erase(Registry.Buffers.begin() + i);
+            }
+        }
+    }
+
+    /**
+     * Releases the calling thread's buffer when the thread exits
+     * Only constructed once the thread records, so threads that never trace
+     * pay nothing. The buffer stays readable for exports until the next
+     * Reset() or Shutdown(), or is freed at once after Shutdown().
+     */
+    struct FThreadBufferReleaser {
+        ~FThreadBufferReleaser() {
+            FThreadBuffer* buffer = t_threadBuffer;
+            if (!buffer) {
+                return;
+            }
+            t_threadBuffer = nullptr;
+
+            FTracerRegistry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.Mutex);
+            if (registry.bShutDown) {
+                FreeBufferLocked(registry, buffer);
+            } else {
+                buffer->bThreadExited = true;
+            }
+        }
+    };
+
+    thread_local FThreadBufferReleaser t_threadBufferReleaser;
+
+    /** Name set before the thread's first event; the buffer is only created when recording */
+    thread_local char t_threadName[kMaxThreadNameLength] = {};
+    thread_local int32 t_threadSortIndex = 0;
+
+    FThreadBuffer& GetThreadBuffer() {
+        if (!t_threadBuffer) {
+            FTracerRegistry& registry = GetRegistry();
+            FThreadBuffer* buffer = new FThreadBuffer();
+            memcpy(buffer->Name, t_threadName, kMaxThreadNameLength);
+            buffer->SortIndex = t_threadSortIndex;
+
+            std::lock_guard<std::mutex> lock(registry.Mutex);
+            buffer->ThreadId = registry.NextThreadId++;
+            registry.Buffers.push_back(buffer);
+            t_threadBuffer = buffer;
+
+            // Touch the releaser so its destructor runs at thread exit
+            (void)&t_threadBufferReleaser;
+        }
+        return *t_threadBuffer;
+    }
+
+    /** Write a JSON string literal; names are static identifiers but escape defensively */
+    void WriteJsonString(FILE* File, const char* Text) {
+        fputc('"', File);
+        for (const char* c = Text ? Text : "Unnamed"; *c; ++c) {
+            if (*c == '"' || *c == '\\') {
+                fputc('\\', File);
+                fputc(*c, File);
+            } else if (static_cast<unsigned char>(*c) < 0x20) {
+                fprintf(File, "\\u%04x", static_cast<unsigned char>(*c));
+            } else {
+                fputc(*c, File);
+            }
+        }
+        fputc('"', File);
+    }
+
+    /** Convert tracer nanoseconds to trace-event microseconds */
+    inline double ToMicroseconds(uint64 Nanoseconds) {
+        return static_cast<double>(Nanoseconds) / 1000.0;
+    }
+}
+
+void FTaskTracer::SetEnabled(bool bEnabled) {
+    // Create the registry (and epoch) before the first event
+    FTracerRegistry& registry = GetRegistry();
+    if (bEnabled) {
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        registry.bShutDown = false;
+    }
+    s_enabled.store(bEnabled, std::memory_order_relaxed);
+}
+
+void FTaskTracer::SetThreadName(const char* Name, int32 SortIndex) {
+    snprintf(t_threadName, kMaxThreadNameLength, "%s", Name ? Name : "");
+    t_threadSortIndex = SortIndex;
+
+    if (t_threadBuffer) {
+        memcpy(t_threadBuffer->Name, t_threadName, kMaxThreadNameLength);
+        t_threadBuffer->SortIndex = SortIndex;
+    }
+}
+
+uint64 FTaskTracer::AllocateTaskId() {
+    return GetRegistry().NextTaskId.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64 FTaskTracer::GetTimestamp() {
+    return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - GetRegistry().Epoch).count());
+}
+
+void FTaskTracer::RecordScope(const char* Name, uint64 StartTime, uint64 TaskId, int32 WorkerIndex) {
+    const uint64 endTime = GetTimestamp();
+    FThreadBuffer& buffer = GetThreadBuffer();
+
+    uint64 index = 0;
+    FTraceRecord& record = buffer.BeginWrite(index);
+    record.A = StartTime;
+    record.B = endTime;
+    record.Name = Name;
+    record.TaskId = TaskId;
+    record.WorkerIndex = WorkerIndex;
+    record.Type = ETraceRecordType::Scope;
+    buffer.EndWrite(index);
+}
+
+void FTaskTracer::RecordDependency(uint64 FromTaskId, uint64 ToTaskId) {
+    if (FromTaskId == 0 || ToTaskId == 0) {
+        return;
+    }
+
+    FThreadBuffer& buffer = GetThreadBuffer();
+
+    uint64 index = 0;
+    FTraceRecord& record = buffer.BeginWrite(index);
+    record.A = FromTaskId;
+    record.B = ToTaskId;
+    record.Name = nullptr;
+    record.TaskId = 0;
+    record.WorkerIndex = -1;
+    record.Type = ETraceRecordType::Dependency;
+    buffer.EndWrite(index);
+}
+
+bool FTaskTracer::ExportChromeTrace(const String& FilePath) {
+    FILE* file = nullptr;
+#if defined(_MSC_VER)
+    if (fopen_s(&file, FilePath.c_str(), "w") != 0) {
+        file = nullptr;
+    }
+#else
+    file = fopen(FilePath.c_str(), "w");
+#endif
+    if (!file) {
+        MR_LOG_ERROR("FTaskTracer::ExportChromeTrace - Failed to open " + FilePath);
+        return false;
+    }
+
+    struct FTaskSlice {
+        uint32 ThreadId;
+        uint64 Start;
+        uint64 End;
+    };
+
+    FTracerRegistry& registry = GetRegistry();
+    std::vector<FThreadBuffer*> buffers;
+    {
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        buffers = registry.Buffers;
+    }
+
+    std::unordered_map<uint64, FTaskSlice> taskSlices;
+    std::vector<std::pair<uint64, uint64>> dependencies;
+    uint64 numEvents = 0;
+
+    fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n", file);
+    bool first = true;
+    auto separator = [&first, file]() {
+        if (!first) {
+            fputs(",\n", file);
+        }
+        first = false;
+    };
+
+    for (FThreadBuffer* buffer : buffers) {
+        // Thread metadata
+        separator();
+        fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", buffer->ThreadId);
+        if (buffer->Name[0] != '\0') {
+            WriteJsonString(file, buffer->Name);
+        } else {
+            fprintf(file, "\"Thread %u\"", buffer->ThreadId);
+        }
+        fputs("}}", file);
+        separator();
+        fprintf(file, "{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"sort_index\":%d}}",
+                buffer->ThreadId, buffer->SortIndex);
+
+        const uint64 numWritten = buffer->NumWritten.load(std::memory_order_acquire);
+        const uint64 firstIndex = numWritten > kRingBufferCapacity ? numWritten - kRingBufferCapacity : 0;
+
+        for (uint64 i = firstIndex; i < numWritten; ++i) {
+            const FTraceRecord record = buffer->Records[i % kRingBufferCapacity];
+
+            if (record.Type == ETraceRecordType::Dependency) {
+                dependencies.emplace_back(record.A, record.B);
+                continue;
+            }
+
+            separator();
+            fputs("{\"name\":", file);
+            WriteJsonString(file, record.Name);
+            fprintf(file, ",\"cat\":\"task\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f",
+                    buffer->ThreadId, ToMicroseconds(record.A),
+                    ToMicroseconds(record.B > record.A ? record.B - record.A : 0));
+            if (record.TaskId != 0 || record.WorkerIndex >= 0) {
+                fprintf(file, ",\"args\":{\"task\":%llu,\"worker\":%d}",
+                        static_cast<unsigned long long>(record.TaskId), record.WorkerIndex);
+            }
+            fputc('}', file);
+            ++numEvents;
+
+            if (record.TaskId != 0) {
+                taskSlices[record.TaskId] = FTaskSlice{buffer->ThreadId, record.A, record.B};
+            }
+        }
+    }
+
+    // Dependency edges as flow arrows: prerequisite end -> dependent start
+    uint64 flowId = 1;
+    for (const auto& dependency : dependencies) {
+        auto from = taskSlices.find(dependency.first);
+        auto to = taskSlices.find(dependency.second);
+        if (from == taskSlices.end() || to == taskSlices.end()) {
+            continue;
+        }
+
+        separator();
+        fprintf(file, "{\"name\":\"dependency\",\"cat\":\"dependency\",\"ph\":\"s\",\"id\":%llu,\"pid\":1,\"tid\":%u,\"ts\":%.3f}",
+                static_cast<unsigned long long>(flowId), from->second.ThreadId, ToMicroseconds(from->second.End));
+        separator();
+        fprintf(file, "{\"name\":\"dependency\",\"cat\":\"dependency\",\"ph\":\"f\",\"bp\":\"e\",\"id\":%llu,\"pid\":1,\"tid\":%u,\"ts\":%.3f}",
+                static_cast<unsigned long long>(flowId), to->second.ThreadId, ToMicroseconds(to->second.Start));
+        ++flowId;
+    }
+
+    fputs("\n]}\n", file);
+    const bool success = ferror(file) == 0;
+    fclose(file);
+
+    MR_LOG_INFO("FTaskTracer::ExportChromeTrace - Wrote " + std::to_string(numEvents) + " events and " +
+               std::to_string(flowId - 1) + " dependencies to " + FilePath);
+    return success;
+}
+
+void FTaskTracer::Reset() {
+    FTracerRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+    FreeExitedBuffersLocked(registry);
+    for (FThreadBuffer* buffer : registry.Buffers) {
+        buffer->NumWritten.store(0, std::memory_order_release);
+    }
+}
+
+void FTaskTracer::Shutdown() {
+    s_enabled.store(false, std::memory_order_relaxed);
+
+    FTracerRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+    registry.bShutDown = true;
+    FreeExitedBuffersLocked(registry);
+
+    // The calling thread is the one shutting down; release its buffer now
+    if (t_threadBuffer) {
+        FreeBufferLocked(registry, t_threadBuffer);
+        t_threadBuffer = nullptr;
+    }
+}
+
+uint64 FTaskTracer::GetNumRecordedEvents() {
+    FTracerRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+
+    uint64 total = 0;
+    for (FThreadBuffer* buffer : registry.Buffers) {
+        const uint64 numWritten = buffer->NumWritten.load(std::memory_order_acquire);
+        total += numWritten > kRingBufferCapacity ? kRingBufferCapacity : numWritten;
+    }
+    return total;
+}
+
+uint32 FTaskTracer::GetNumThreadBuffers() {
+    FTracerRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.Mutex);
+    return static_cast<uint32>(registry.Buffers.size());
+}
+
+#else // MR_TASK_TRACE_ENABLED
+
+void FTaskTracer::SetEnabled(bool) {}
+void FTaskTracer::SetThreadName(const char*, int32) {}
+uint64 FTaskTracer::AllocateTaskId() { return 0; }
+uint64 FTaskTracer::GetTimestamp() { return 0; }
+void FTaskTracer::RecordScope(const char*, uint64, uint64, int32) {}
+void FTaskTracer::RecordDependency(uint64, uint64) {}
+bool FTaskTracer::ExportChromeTrace(const String&) { return false; }
+void FTaskTracer::Reset() {}
+void FTaskTracer::Shutdown() {}
+uint64 FTaskTracer::GetNumRecordedEvents() { return 0; }
+uint32 FTaskTracer::GetNumThreadBuffers() { return 0; }
+
+#endif // MR_TASK_TRACE_ENABLED
+
+} // namespace MonsterEngine
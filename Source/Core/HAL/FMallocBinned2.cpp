@@ -2,368 +2,1186 @@
 // MonsterEngine - Binned Memory Allocator Implementation
 
 #include "Core/HAL/FMallocBinned2.h"
+#include "Core/HAL/LowLevelMemTracker.h"
 #include "Core/Log.h"
 #include <new>
 #include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if PLATFORM_WINDOWS
+    #include <Windows.h>
+    #include <malloc.h>
+#elif PLATFORM_LINUX
+    #include <sys/mman.h>
+#endif
 
 namespace MonsterRender {
 
-// Static TLS cache
-thread_local FMallocBinned2::FThreadCache* FMallocBinned2::TLSCache = nullptr;
+namespace {
+    /**
+     * Global map from 64KB address granules to the binned page covering them
+     *
+     * Covers a 48-bit address space with a root table and lazily created
+     * leaves (512KB each, committed on touch) that are never freed. Lookups
+     * are two dependent loads and take no lock. Lets Free() find a block's
+     * page header, and tell binned blocks from large allocations, without
+     * any header in front of the block.
+     */
+    struct FBinnedPageMap {
+        static constexpr uint32 kGranuleShift = 16;
+        static constexpr uint32 kLeafBits = 16;
+        static constexpr uint32 kRootBits = 48 - kGranuleShift - kLeafBits;
+
+        std::atomic<std::atomic<void*>*> Roots[1u << kRootBits];
+
+        void* Find(uintptr_t Address) const {
+            if ((Address >> 48) != 0) {
+                return nullptr;
+            }
+            const std::atomic<void*>* leaf = Roots[Address >> (kGranuleShift + kLeafBits)].load(std::memory_order_acquire);
+            if (!leaf) {
+                return nullptr;
+            }
+            return leaf[(Address >> kGranuleShift) & ((1u << kLeafBits) - 1)].load(std::memory_order_acquire);
+        }
+
+        /** Map every granule of [Address, Address + Size) to Page (null to unmap) */
+        bool Set(uintptr_t Address, SIZE_T Size, void* Page) {
+            if (((Address + Size - 1) >> 48) != 0) {
+                return false;
+            }
+
+            for (uintptr_t granule = Address; granule < Address + Size; granule += uintptr_t(1) << kGranuleShift) {
+                std::atomic<std::atomic<void*>*>& root = Roots[granule >> (kGranuleShift + kLeafBits)];
+                std::atomic<void*>* leaf = root.load(std::memory_order_acquire);
+                if (!leaf) {
+                    // Zeroed memory is a valid array of atomics
+                    auto* newLeaf = static_cast<std::atomic<void*>*>(std::calloc(SIZE_T(1) << kLeafBits, sizeof(std::atomic<void*>)));
+                    if (!newLeaf) {
+                        return false;
+                    }
+                    if (root.compare_exchange_strong(leaf, newLeaf, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        leaf = newLeaf;
+                    } else {
+                        std::free(newLeaf);
+                    }
+                }
+                leaf[(granule >> kGranuleShift) & ((1u << kLeafBits) - 1)].store(Page, std::memory_order_release);
+            }
+            return true;
+        }
+    };
+
+    FBinnedPageMap& GetPageMap() {
+        // Intentionally leaked and zero-initialized: threads may free during static destruction
+        static FBinnedPageMap* s_pageMap = static_cast<FBinnedPageMap*>(std::calloc(1, sizeof(FBinnedPageMap)));
+        return *s_pageMap;
+    }
+
+    /** Allocate Size bytes aligned to Granularity (both multiples of 64KB) */
+    void* AllocatePageMemory(SIZE_T Size, SIZE_T Granularity) {
+#if PLATFORM_WINDOWS
+        // Allocation granularity is 64KB
+        (void)Granularity;
+        return VirtualAlloc(nullptr, Size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#elif PLATFORM_LINUX
+        // Over-map and trim to get the alignment
+        const SIZE_T mappedSize = Size + Granularity;
+        void* raw = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            return nullptr;
+        }
+        const uintptr_t rawAddress = reinterpret_cast<uintptr_t>(raw);
+        const uintptr_t alignedAddress = (rawAddress + Granularity - 1) & ~uintptr_t(Granularity - 1);
+        if (alignedAddress > rawAddress) {
+            munmap(raw, alignedAddress - rawAddress);
+        }
+        const uintptr_t tailSize = rawAddress + mappedSize - (alignedAddress + Size);
+        if (tailSize > 0) {
+            munmap(reinterpret_cast<void*>(alignedAddress + Size), tailSize);
+        }
+        return reinterpret_cast<void*>(alignedAddress);
+#else
+        return ::operator new(Size, std::align_val_t(Granularity), std::nothrow);
+#endif
+    }
+
+    void FreePageMemory(void* Ptr, SIZE_T Size, SIZE_T Granularity) {
+#if PLATFORM_WINDOWS
+        (void)Size;
+        (void)Granularity;
+        VirtualFree(Ptr, 0, MEM_RELEASE);
+#elif PLATFORM_LINUX
+        (void)Granularity;
+        munmap(Ptr, Size);
+#else
+        (void)Size;
+        ::operator delete(Ptr, std::align_val_t(Granularity), std::nothrow);
+#endif
+    }
+
+    /**
+     * System heap fallback for blocks outside the page map (large blocks off
+     * Linux, and allocations made while a thread is exiting). Honors
+     * alignments beyond what malloc guarantees; pair with SystemFree.
+     */
+    void* SystemMalloc(SIZE_T Size, uint32 Alignment) {
+        const SIZE_T alignment = std::max<SIZE_T>(Alignment, alignof(std::max_align_t));
+#if PLATFORM_WINDOWS
+        return _aligned_malloc(Size, alignment);
+#else
+        if (alignment == alignof(std::max_align_t)) {
+            return std::malloc(Size);
+        }
+        void* ptr = nullptr;
+        return posix_memalign(&ptr, alignment, Size) == 0 ? ptr : nullptr;
+#endif
+    }
+
+    void SystemFree(void* Ptr) {
+#if PLATFORM_WINDOWS
+        _aligned_free(Ptr);
+#else
+        std::free(Ptr);
+#endif
+    }
+
+    /** Page map entries of large blocks point at their header with this bit set */
+    constexpr uintptr_t kLargeBlockTag = 1;
+
+#if PLATFORM_LINUX
+    /** Whether mappings can opt in to transparent huge pages ("always" or "madvise" mode) */
+    bool IsTransparentHugePagesEnabled() {
+        static const bool s_enabled = []() {
+            FILE* file = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+            if (!file) {
+                return false;
+            }
+            char line[128] = {};
+            const bool bRead = fgets(line, sizeof(line), file) != nullptr;
+            fclose(file);
+            return bRead && (strstr(line, "[always]") || strstr(line, "[madvise]"));
+        }();
+        return s_enabled;
+    }
+#endif
+
+    /** Update a counter only ever written by one thread (no RMW needed) */
+    FORCEINLINE void BumpCounter(std::atomic<uint64>& Counter, uint64 Amount) {
+        Counter.store(Counter.load(std::memory_order_relaxed) + Amount, std::memory_order_relaxed);
+    }
+
+    /** Live allocator instances, so exiting threads only touch heaps of live allocators */
+    struct FBinnedInstanceRegistry {
+        std::mutex Mutex;
+        std::vector<std::pair<uint64, FMallocBinned2*>> Instances;
+    };
+
+    FBinnedInstanceRegistry& GetInstanceRegistry() {
+        // Intentionally leaked: thread exit may run after static destruction
+        static FBinnedInstanceRegistry* s_registry = new FBinnedInstanceRegistry();
+        return *s_registry;
+    }
+
+    /** Set once the calling thread's heap slots are destroyed; later calls fall back to the system heap */
+    thread_local bool t_heapSlotsDestroyed = false;
+}
+
+/**
+ * Thread heaps of the calling thread, keyed by allocator instance
+ * Most recently used first. Releases its heaps to their allocators on thread exit.
+ */
+struct FBinnedThreadHeapSlots {
+    uint64 InstanceIds[FMallocBinned2::MAX_THREAD_HEAP_SLOTS] = {};
+    FMallocBinned2::FThreadHeap* Heaps[FMallocBinned2::MAX_THREAD_HEAP_SLOTS] = {};
+
+    ~FBinnedThreadHeapSlots() {
+        t_heapSlotsDestroyed = true;
+        for (uint32 i = 0; i < FMallocBinned2::MAX_THREAD_HEAP_SLOTS; ++i) {
+            Release(i);
+        }
+    }
+
+    void Release(uint32 Slot) {
+        if (InstanceIds[Slot] == 0) {
+            return;
+        }
+
+        FBinnedInstanceRegistry& registry = GetInstanceRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        for (const auto& instance : registry.Instances) {
+            if (instance.first == InstanceIds[Slot]) {
+                instance.second->ReleaseThreadHeap(Heaps[Slot]);
+                break;
+            }
+        }
+        InstanceIds[Slot] = 0;
+        Heaps[Slot] = nullptr;
+    }
+};
+
+namespace {
+    thread_local FBinnedThreadHeapSlots t_heapSlots;
+}
+
+uint64 FMallocBinned2::AllocateInstanceId() {
+    static std::atomic<uint64> s_nextInstanceId{1};
+    return s_nextInstanceId.fetch_add(1, std::memory_order_relaxed);
+}
+
+FMallocBinned2::FMallocBinned2()
+    : InstanceId(AllocateInstanceId())
+{
+    // Size classes: 16..128 in 16-byte steps, then four per power of two up to 32KB
+    // (160, 192, 224, 256, 320, 384, 448, 512, ...)
+    uint32 binIdx = 0;
+    for (uint32 size = 16; size <= 128; size += 16) {
+        SmallBins[binIdx++].ElementSize = size;
+    }
+    for (uint32 base = 128; base < SMALL_BIN_MAX_SIZE; base <<= 1) {
+        for (uint32 step = 1; step <= 4; ++step) {
+            SmallBins[binIdx++].ElementSize = base + step * (base / 4);
+        }
+    }
 
-FMallocBinned2::FMallocBinned2() {
-    // Initialize bins with power-of-2 sizes
-    uint32 size = 16;
     for (uint32 i = 0; i < NUM_SMALL_BINS; ++i) {
-        SmallBins[i].ElementSize = size;
-        size <<= 1;  // 16, 32, 64, 128, 256, 512, 1024
+        auto& bin = SmallBins[i];
+
+        // Blocks are aligned to the largest power of two dividing their size
+        const uint32 lowestBit = bin.ElementSize & (~bin.ElementSize + 1);
+        bin.BlockAlignment = static_cast<uint32>(std::min<SIZE_T>(lowestBit, MAX_BLOCK_ALIGNMENT));
+
+        // Grow the page until it holds enough blocks
+        const uint32 headerSize = static_cast<uint32>(std::max<SIZE_T>(sizeof(FPageHeader), bin.BlockAlignment));
+        bin.PageSize = static_cast<uint32>(PAGE_SIZE);
+        while ((bin.PageSize - headerSize) / bin.ElementSize < MIN_BLOCKS_PER_PAGE) {
+            bin.PageSize <<= 1;
+        }
+
+        bin.RemoteBatchLimit = static_cast<uint32>(std::clamp<SIZE_T>(REMOTE_FREE_BATCH_BYTES / bin.ElementSize, 1, REMOTE_FREE_BATCH_SIZE));
+        bin.EmptyPagesToKeep = static_cast<uint32>(std::max<SIZE_T>(EMPTY_PAGE_BYTES_THRESHOLD / bin.PageSize, 1));
+    }
+
+    // Smallest bin for each 16-byte size step
+    binIdx = 0;
+    for (uint32 step = 0; step < SMALL_BIN_MAX_SIZE / 16; ++step) {
+        while (SmallBins[binIdx].ElementSize < (step + 1) * 16) {
+            ++binIdx;
+        }
+        SizeToBinIndex[step] = static_cast<uint8>(binIdx);
+    }
+
+    {
+        FBinnedInstanceRegistry& registry = GetInstanceRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        registry.Instances.emplace_back(InstanceId, this);
     }
 
     MR_LOG_INFO("FMallocBinned2 initialized with " + std::to_string(NUM_SMALL_BINS) + " bins");
 }
 
 FMallocBinned2::~FMallocBinned2() {
+    // Exiting threads must no longer hand their heaps back to us
+    {
+        FBinnedInstanceRegistry& registry = GetInstanceRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        registry.Instances.erase(
+            std::remove_if(registry.Instances.begin(), registry.Instances.end(),
+                           [this](const auto& Instance) { return Instance.first == InstanceId; }),
+            registry.Instances.end());
+    }
+
+    // Unmap cached and still-live large blocks
+    TrimLargeCache();
+    {
+        std::scoped_lock lock(LargeMutex);
+        while (FLargeBlockHeader* block = LiveLargeBlocks) {
+            LiveLargeBlocks = block->Next;
+            GetPageMap().Set(reinterpret_cast<uintptr_t>(block->UserPtr) & ~uintptr_t(PAGE_SIZE - 1), PAGE_SIZE, nullptr);
+            ReleaseLargeBlock(block);
+        }
+    }
+
     // Free all pages in all bins
-    for (uint32 i = 0; i < NUM_SMALL_BINS; ++i) {
-        auto& bin = SmallBins[i];
-        std::scoped_lock lock(bin.Mutex);
-        for (auto* page : bin.Pages) {
-            ::operator delete(page, std::nothrow);
+    {
+        std::scoped_lock lock(PagesMutex);
+        for (auto* page : AllPages) {
+            const SIZE_T pageSize = SmallBins[page->BinIndex].PageSize;
+            GetPageMap().Set(reinterpret_cast<uintptr_t>(page), pageSize, nullptr);
+            page->~FPageHeader();
+            FreePageMemory(page, pageSize, PAGE_SIZE);
+        }
+        AllPages.clear();
+    }
+
+    {
+        std::scoped_lock lock(HeapsMutex);
+        while (FThreadHeap* heap = Heaps) {
+            Heaps = heap->NextHeap;
+            heap->~FThreadHeap();
+            std::free(heap);
         }
-        bin.Pages.clear();
+        RetiredHeaps = nullptr;
     }
 
     MR_LOG_INFO("FMallocBinned2 shutdown");
 }
 
 void* FMallocBinned2::Malloc(SIZE_T Size, uint32 Alignment) {
+    void* ptr = MallocInternal(Size, Alignment);
+    if (FLowLevelMemTracker::IsEnabled()) {
+        FLowLevelMemTracker::OnAlloc(ELLMTracker::Default, ptr, Size);
+    }
+    return ptr;
+}
+
+void* FMallocBinned2::MallocStaging(SIZE_T Size, uint32 Alignment) {
+    void* ptr = MallocStagingInternal(Size, Alignment);
+    if (FLowLevelMemTracker::IsEnabled()) {
+        FLowLevelMemTracker::OnAlloc(ELLMTracker::Default, ptr, Size);
+    }
+    return ptr;
+}
+
+void* FMallocBinned2::Realloc(void* Original, SIZE_T Size, uint32 Alignment) {
+    if (!FLowLevelMemTracker::IsEnabled()) {
+        return ReallocInternal(Original, Size, Alignment);
+    }
+
+    // Untrack before the block can be freed and handed to another thread
+    const SIZE_T originalSize = Original ? GetAllocationSize(Original) : 0;
+    FLowLevelMemTracker::OnFree(ELLMTracker::Default, Original);
+    void* newPtr = ReallocInternal(Original, Size, Alignment);
+    if (newPtr) {
+        FLowLevelMemTracker::OnAlloc(ELLMTracker::Default, newPtr, Size);
+    } else if (Size != 0) {
+        // Failed; the original block is still live
+        FLowLevelMemTracker::OnAlloc(ELLMTracker::Default, Original, originalSize);
+    }
+    return newPtr;
+}
+
+void FMallocBinned2::Free(void* Original) {
+    if (FLowLevelMemTracker::IsEnabled()) {
+        FLowLevelMemTracker::OnFree(ELLMTracker::Default, Original);
+    }
+    FreeInternal(Original);
+}
+
+void* FMallocBinned2::MallocInternal(SIZE_T Size, uint32 Alignment) {
     if (Size == 0) Size = 1;
 
-    // Large allocations fall back to standard malloc for debug heap compatibility
-    if (Size > SMALL_BIN_MAX_SIZE) {
-        (void)Alignment; // Alignment ignored for large allocations with malloc
-        return std::malloc(Size);
+    if (Size > SMALL_BIN_MAX_SIZE || Alignment > MAX_BLOCK_ALIGNMENT) {
+#if PLATFORM_LINUX
+        return AllocateLarge(Size, Alignment, false);
+#else
+        // Large allocations fall back to the system heap for debug heap compatibility
+        return SystemMalloc(Size, Alignment);
+#endif
     }
 
     // Small allocation - use binned allocator
     uint32 binIdx = SelectBinIndex(Size);
-    FThreadCache* cache = GetTLSCache();
-    return AllocateFromBin(SmallBins[binIdx], Alignment, cache);
+    while (SmallBins[binIdx].BlockAlignment < Alignment) {
+        // Power-of-two classes always satisfy the alignment
+        ++binIdx;
+    }
+
+    FThreadHeap* heap = GetThreadHeap();
+    if (!heap) {
+        // Thread is exiting; Free() recognizes system blocks by their address
+        return SystemMalloc(Size, Alignment);
+    }
+    return AllocateFromBin(heap, binIdx, Size);
 }
 
-void* FMallocBinned2::Realloc(void* Original, SIZE_T Size, uint32 Alignment) {
+void* FMallocBinned2::MallocStagingInternal(SIZE_T Size, uint32 Alignment) {
+#if PLATFORM_LINUX
+    // Smaller buffers cannot fill a huge page
+    if (Size >= HUGE_PAGE_SIZE) {
+        return AllocateLarge(Size, Alignment, IsTransparentHugePagesEnabled());
+    }
+#endif
+    return MallocInternal(Size, Alignment);
+}
+
+void* FMallocBinned2::ReallocInternal(void* Original, SIZE_T Size, uint32 Alignment) {
     if (!Original) {
-        return Malloc(Size, Alignment);
+        return MallocInternal(Size, Alignment);
     }
 
     if (Size == 0) {
-        Free(Original);
+        FreeInternal(Original);
         return nullptr;
     }
 
-    // For now, simple implementation: allocate new + copy + free
-    // TODO: Optimize by checking if new size fits in same bin
+    // Still the same size class: keep the block
+    if (FPageHeader* page = FindPage(Original)) {
+        const bool bSameBin = Size <= SMALL_BIN_MAX_SIZE && SelectBinIndex(Size) == page->BinIndex;
+        const bool bAligned = Alignment == 0 || (reinterpret_cast<uintptr_t>(Original) & (Alignment - 1)) == 0;
+        if (bSameBin && bAligned) {
+            return Original;
+        }
+    }
+
+    // Large block whose mapping still fits the new size: resize in place
+    const uintptr_t entry = reinterpret_cast<uintptr_t>(GetPageMap().Find(reinterpret_cast<uintptr_t>(Original)));
+    if (entry & kLargeBlockTag) {
+        auto* block = reinterpret_cast<FLargeBlockHeader*>(entry & ~kLargeBlockTag);
+        const SIZE_T userOffset = static_cast<uint8*>(Original) - reinterpret_cast<uint8*>(block);
+        const bool bAligned = Alignment == 0 || (reinterpret_cast<uintptr_t>(Original) & (Alignment - 1)) == 0;
+        if (Size > SMALL_BIN_MAX_SIZE && bAligned && userOffset + Size <= block->MappedSize) {
+            std::scoped_lock lock(block->Allocator->LargeMutex);
+            block->Allocator->LargeLiveBytes += Size;
+            block->Allocator->LargeLiveBytes -= block->RequestedSize;
+            block->RequestedSize = Size;
+            return Original;
+        }
+    }
+
     SIZE_T oldSize = GetAllocationSize(Original);
-    void* newPtr = Malloc(Size, Alignment);
+    void* newPtr = MallocInternal(Size, Alignment);
     if (newPtr && oldSize > 0) {
         SIZE_T copySize = (oldSize < Size) ? oldSize : Size;
         ::memcpy(newPtr, Original, copySize);
     }
-    Free(Original);
+    FreeInternal(Original);
     return newPtr;
 }
 
-void FMallocBinned2::Free(void* Original) {
+void FMallocBinned2::FreeInternal(void* Original) {
     if (!Original) return;
 
-    // Check if it's a large allocation (heuristic: not in our pages)
-    // For simplicity, we'll track this via allocation metadata in future
-    // For now, attempt to free to bins, fallback to OS free
+    const uintptr_t entry = reinterpret_cast<uintptr_t>(GetPageMap().Find(reinterpret_cast<uintptr_t>(Original)));
+    if (!entry) {
+        // Not in any binned page - must be a system heap allocation
+        SystemFree(Original);
+        return;
+    }
 
-    // Try to find which bin owns this pointer
-    for (uint32 i = 0; i < NUM_SMALL_BINS; ++i) {
-        auto& bin = SmallBins[i];
-        std::scoped_lock lock(bin.Mutex);
-        for (auto* page : bin.Pages) {
-            uint8* pageStart = reinterpret_cast<uint8*>(page);
-            uint8* pageEnd = pageStart + PAGE_SIZE;
-            if (reinterpret_cast<uint8*>(Original) >= pageStart && 
-                reinterpret_cast<uint8*>(Original) < pageEnd) {
-                // Found it - free to this bin
-                FThreadCache* cache = GetTLSCache();
-                FreeToBin(bin, Original, cache);
-                return;
-            }
-        }
+    if (entry & kLargeBlockTag) {
+        auto* block = reinterpret_cast<FLargeBlockHeader*>(entry & ~kLargeBlockTag);
+        block->Allocator->FreeLarge(block);
+        return;
     }
 
-    // Not found in bins - must be large allocation
-    // Use standard free for debug heap compatibility
-    std::free(Original);
+    auto* page = reinterpret_cast<FPageHeader*>(entry);
+    FMallocBinned2* owner = page->Allocator;
+    owner->FreeToPage(owner->GetThreadHeap(), page, Original);
 }
 
 SIZE_T FMallocBinned2::GetAllocationSize(void* Original) {
     if (!Original) return 0;
 
-    // Check bins
-    for (uint32 i = 0; i < NUM_SMALL_BINS; ++i) {
-        auto& bin = SmallBins[i];
-        std::scoped_lock lock(bin.Mutex);
-        for (auto* page : bin.Pages) {
-            uint8* pageStart = reinterpret_cast<uint8*>(page);
-            uint8* pageEnd = pageStart + PAGE_SIZE;
-            if (reinterpret_cast<uint8*>(Original) >= pageStart && 
-                reinterpret_cast<uint8*>(Original) < pageEnd) {
-                return bin.ElementSize;
-            }
-        }
+    const uintptr_t entry = reinterpret_cast<uintptr_t>(GetPageMap().Find(reinterpret_cast<uintptr_t>(Original)));
+    if (entry & kLargeBlockTag) {
+        auto* block = reinterpret_cast<FLargeBlockHeader*>(entry & ~kLargeBlockTag);
+        return block->MappedSize - (static_cast<uint8*>(Original) - reinterpret_cast<uint8*>(block));
+    }
+    if (entry) {
+        return reinterpret_cast<FPageHeader*>(entry)->ElementSize;
     }
 
-    return 0;  // Unknown (large allocation)
+    return 0;  // Unknown (system allocation)
 }
 
 bool FMallocBinned2::ValidateHeap() {
-    // Simple validation: check all pages have valid headers
-    for (uint32 i = 0; i < NUM_SMALL_BINS; ++i) {
-        auto& bin = SmallBins[i];
-        std::scoped_lock lock(bin.Mutex);
-        for (auto* page : bin.Pages) {
-            if (page->ElementSize != bin.ElementSize) {
-                MR_LOG_ERROR("Heap validation failed: bin element size mismatch");
-                return false;
-            }
-            if (page->FreeCount > page->ElementCount) {
-                MR_LOG_ERROR("Heap validation failed: free count exceeds element count");
-                return false;
-            }
+    std::scoped_lock lock(PagesMutex);
+    for (auto* page : AllPages) {
+        if (page->BinIndex >= NUM_SMALL_BINS || FindPage(page) != page ||
+            FindPage(reinterpret_cast<uint8*>(page) + SmallBins[page->BinIndex].PageSize - 1) != page) {
+            MR_LOG_ERROR("Heap validation failed: page not registered");
+            return false;
+        }
+        if (page->Allocator != this || page->ElementSize != SmallBins[page->BinIndex].ElementSize) {
+            MR_LOG_ERROR("Heap validation failed: bin element size mismatch");
+            return false;
+        }
+        if (page->UsedCount > page->ElementCount) {
+            MR_LOG_ERROR("Heap validation failed: used count exceeds element count");
+            return false;
         }
     }
     return true;
 }
 
 uint64 FMallocBinned2::GetTotalAllocatedMemory() {
-    return TotalAllocated.load(std::memory_order_relaxed);
+    FBinTotals totals[NUM_SMALL_BINS];
+    GatherBinTotals(totals);
+
+    uint64 allocated = 0;
+    for (uint32 i = 0; i < NUM_SMALL_BINS; ++i) {
+        allocated += (totals[i].AllocCount - totals[i].FreeCount) * SmallBins[i].ElementSize;
+    }
+
+    std::scoped_lock lock(LargeMutex);
+    return allocated + LargeLiveBytes;
 }
 
 void FMallocBinned2::Trim() {
-    // Release empty pages
+    TrimLargeCache();
+
+    // Pages owned by the calling thread
+    if (FThreadHeap* heap = GetThreadHeap()) {
+        TrimHeap(heap);
+    }
+
+    // Release empty pages abandoned by exited threads
     for (uint32 i = 0; i < NUM_SMALL_BINS; ++i) {
         auto& bin = SmallBins[i];
-        std::scoped_lock lock(bin.Mutex);
-
-        // Count empty pages
-        uint32 emptyCount = 0;
-        for (auto* page : bin.Pages) {
-            if (page->FreeCount == page->ElementCount) {
-                ++emptyCount;
-            }
-        }
+        std::vector<FPageHeader*> emptyPages;
+        {
+            std::scoped_lock lock(bin.Mutex);
 
-        // Keep at least a few pages, release excess
-        if (emptyCount > EMPTY_PAGE_THRESHOLD) {
-            std::vector<FPageHeader*> keptPages;
-            uint32 releasedCount = 0;
-            for (auto* page : bin.Pages) {
-                if (page->FreeCount == page->ElementCount && 
-                    releasedCount < emptyCount - EMPTY_PAGE_THRESHOLD) {
-                    ::operator delete(page, std::nothrow);
-                    TotalReserved.fetch_sub(PAGE_SIZE, std::memory_order_relaxed);
-                    ++releasedCount;
+            uint32 keptEmptyCount = 0;
+            FPageHeader** link = &bin.AbandonedPages;
+            while (FPageHeader* page = *link) {
+                CollectRemoteFrees(page);
+                if (page->UsedCount == 0 && keptEmptyCount++ >= bin.EmptyPagesToKeep) {
+                    *link = page->NextPage;
+                    emptyPages.push_back(page);
                 } else {
-                    keptPages.push_back(page);
+                    link = &page->NextPage;
                 }
             }
-            bin.Pages = std::move(keptPages);
+        }
 
-            if (releasedCount > 0) {
-                MR_LOG_INFO("Trimmed " + std::to_string(releasedCount) + " pages from bin " + std::to_string(i));
-            }
+        for (FPageHeader* page : emptyPages) {
+            ReleasePage(page);
+        }
+
+        if (!emptyPages.empty()) {
+            MR_LOG_INFO("Trimmed " + std::to_string(emptyPages.size()) + " pages from bin " + std::to_string(i));
         }
     }
 }
 
 void FMallocBinned2::GetMemoryStats(FMemoryStats& OutStats) {
-    OutStats.TotalAllocated = TotalAllocated.load(std::memory_order_relaxed);
+    FBinTotals totals[NUM_SMALL_BINS];
+    GatherBinTotals(totals);
+
+    OutStats = FMemoryStats{};
     OutStats.TotalReserved = TotalReserved.load(std::memory_order_relaxed);
 
-    uint64 allocCount = 0;
-    uint64 freeCount = 0;
     for (uint32 i = 0; i < NUM_SMALL_BINS; ++i) {
-        allocCount += SmallBins[i].AllocCount.load(std::memory_order_relaxed);
-        freeCount += SmallBins[i].FreeCount.load(std::memory_order_relaxed);
+        const FBinTotals& binTotals = totals[i];
+        const uint64 liveBlocks = binTotals.AllocCount - binTotals.FreeCount;
+
+        OutStats.TotalAllocated += liveBlocks * SmallBins[i].ElementSize;
+        OutStats.AllocationCount += binTotals.AllocCount;
+        OutStats.FreeCount += binTotals.FreeCount;
+
+        // Live blocks are assumed to have the bin's average requested size
+        if (binTotals.AllocCount > 0) {
+            const double averageRequested = static_cast<double>(binTotals.RequestedBytes) / binTotals.AllocCount;
+            OutStats.InternalWaste += static_cast<uint64>(liveBlocks * (SmallBins[i].ElementSize - averageRequested));
+        }
+    }
+
+    {
+        std::scoped_lock lock(LargeMutex);
+        OutStats.TotalAllocated += LargeLiveBytes;
+        OutStats.TotalReserved += LargeMappedBytes;
+        OutStats.AllocationCount += LargeAllocCount;
+        OutStats.FreeCount += LargeFreeCount;
+        OutStats.LargeCacheHits = LargeCacheHits;
+        OutStats.LargeCacheMisses = LargeCacheMisses;
+        OutStats.LargeCachedBytes = LargeCachedBytes;
+        OutStats.LargeCacheRssSaved = LargeDecommittedBytes;
+        OutStats.HugePageBytes = HugePageBytes;
     }
-    OutStats.AllocationCount = allocCount;
-    OutStats.FreeCount = freeCount;
+
+    OutStats.ExternalWaste = OutStats.TotalReserved > OutStats.TotalAllocated ?
+        OutStats.TotalReserved - OutStats.TotalAllocated : 0;
+}
+
+void FMallocBinned2::LogWasteReport() {
+    FBinTotals totals[NUM_SMALL_BINS];
+    GatherBinTotals(totals);
+
+    MR_LOG_INFO("FMallocBinned2 waste report:");
+    MR_LOG_INFO("  Bin | Size  | Pages | Live blocks | Live KB | Reserved KB | Rounding % | Unused %");
+
+    for (uint32 i = 0; i < NUM_SMALL_BINS; ++i) {
+        const auto& bin = SmallBins[i];
+        const uint32 numPages = bin.NumPages.load(std::memory_order_relaxed);
+        const FBinTotals& binTotals = totals[i];
+        if (numPages == 0 && binTotals.AllocCount == 0) {
+            continue;
+        }
+
+        const uint64 liveBlocks = binTotals.AllocCount - binTotals.FreeCount;
+        const uint64 liveBytes = liveBlocks * bin.ElementSize;
+        const uint64 reservedBytes = uint64(numPages) * bin.PageSize;
+        const double roundingPercent = binTotals.AllocCount > 0 ?
+            100.0 * (1.0 - static_cast<double>(binTotals.RequestedBytes) / (static_cast<double>(binTotals.AllocCount) * bin.ElementSize)) : 0.0;
+        const double unusedPercent = reservedBytes > 0 ?
+            100.0 * static_cast<double>(reservedBytes - std::min(reservedBytes, liveBytes)) / reservedBytes : 0.0;
+
+        char line[160];
+        snprintf(line, sizeof(line), "  %3u | %5u | %5u | %11llu | %7llu | %11llu | %10.1f | %8.1f",
+                 i, bin.ElementSize, numPages, static_cast<unsigned long long>(liveBlocks),
+                 static_cast<unsigned long long>(liveBytes / 1024), static_cast<unsigned long long>(reservedBytes / 1024),
+                 roundingPercent, unusedPercent);
+        MR_LOG_INFO(line);
+    }
+
+    FMemoryStats stats;
+    GetMemoryStats(stats);
+    const uint64 largeRequests = stats.LargeCacheHits + stats.LargeCacheMisses;
+    if (largeRequests > 0) {
+        MR_LOG_INFO("  Large blocks: cache hit rate " + std::to_string(100 * stats.LargeCacheHits / largeRequests) +
+                    "% of " + std::to_string(largeRequests) + ", cached " + std::to_string(stats.LargeCachedBytes / 1024) +
+                    " KB (" + std::to_string(stats.LargeCacheRssSaved / 1024) + " KB released to the OS), huge pages " +
+                    std::to_string(stats.HugePageBytes / 1024) + " KB");
+    }
+    MR_LOG_INFO("  Allocated: " + std::to_string(stats.TotalAllocated / 1024) + " KB, reserved: " +
+                std::to_string(stats.TotalReserved / 1024) + " KB, internal waste: " +
+                std::to_string(stats.InternalWaste / 1024) + " KB, external waste: " +
+                std::to_string(stats.ExternalWaste / 1024) + " KB");
 }
 
 // Private methods
 
 uint32 FMallocBinned2::SelectBinIndex(SIZE_T Size) {
-    if (Size <= 16) return 0;
-    if (Size <= 32) return 1;
-    if (Size <= 64) return 2;
-    if (Size <= 128) return 3;
-    if (Size <= 256) return 4;
-    if (Size <= 512) return 5;
-    return 6;  // up to 1024
-}
-
-FMallocBinned2::FPageHeader* FMallocBinned2::AllocatePage(uint32 ElementSize) {
-    const SIZE_T rawSize = PAGE_SIZE;
-    auto* raw = reinterpret_cast<uint8*>(::operator new(rawSize, std::nothrow));
+    return SizeToBinIndex[(Size - 1) >> 4];
+}
+
+void FMallocBinned2::GatherBinTotals(FBinTotals* OutTotals) {
+    std::scoped_lock lock(HeapsMutex);
+    for (FThreadHeap* heap = Heaps; heap; heap = heap->NextHeap) {
+        for (uint32 i = 0; i < NUM_SMALL_BINS; ++i) {
+            const auto& heapBin = heap->Bins[i];
+            OutTotals[i].AllocCount += heapBin.AllocCount.load(std::memory_order_relaxed);
+            OutTotals[i].FreeCount += heapBin.FreeCount.load(std::memory_order_relaxed);
+            OutTotals[i].RequestedBytes += heapBin.RequestedBytes.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+FMallocBinned2::FPageHeader* FMallocBinned2::AllocatePage(uint32 BinIndex) {
+    auto& bin = SmallBins[BinIndex];
+
+    auto* raw = static_cast<uint8*>(AllocatePageMemory(bin.PageSize, PAGE_SIZE));
     if (!raw) return nullptr;
 
-    auto* page = reinterpret_cast<FPageHeader*>(raw);
+    auto* page = new (raw) FPageHeader();
+    if (!GetPageMap().Set(reinterpret_cast<uintptr_t>(raw), bin.PageSize, page)) {
+        page->~FPageHeader();
+        FreePageMemory(raw, bin.PageSize, PAGE_SIZE);
+        return nullptr;
+    }
+
     page->FreeList = nullptr;
-    page->ElementSize = ElementSize;
+    page->ElementSize = bin.ElementSize;
+    page->UsedCount = 0;
+    page->BinIndex = BinIndex;
     page->NextPage = nullptr;
+    page->Allocator = this;
+    page->Owner.store(nullptr, std::memory_order_relaxed);
+    page->RemoteFreeList.store(nullptr, std::memory_order_relaxed);
 
-    // Align region start
+    // Align region start so every block has the bin's alignment
     uint8* regionStart = raw + sizeof(FPageHeader);
-    SIZE_T alignment = ElementSize;
-    SIZE_T mask = alignment - 1;
-    regionStart = reinterpret_cast<uint8*>((reinterpret_cast<SIZE_T>(regionStart) + mask) & ~mask);
-
-    const SIZE_T usable = rawSize - (regionStart - raw);
-    const uint32 count = static_cast<uint32>(usable / ElementSize);
+    SIZE_T mask = bin.BlockAlignment - 1;
+    regionStart = reinterpret_cast<uint8*>((reinterpret_cast<uintptr_t>(regionStart) + mask) & ~mask);
 
+    const SIZE_T usable = bin.PageSize - (regionStart - raw);
+    const uint32 count = static_cast<uint32>(usable / bin.ElementSize);
     page->ElementCount = count;
-    page->FreeCount = count;
 
-    // Build free list
-    uint8* current = regionStart;
-    void* prev = nullptr;
-    for (uint32 i = 0; i < count; ++i) {
-        *reinterpret_cast<void**>(current) = prev;
-        prev = current;
-        current += ElementSize;
+    // Build free list in address order
+    void* next = nullptr;
+    for (uint32 i = count; i > 0; --i) {
+        uint8* block = regionStart + SIZE_T(i - 1) * bin.ElementSize;
+        *reinterpret_cast<void**>(block) = next;
+        next = block;
     }
-    page->FreeList = prev;
+    page->FreeList = next;
+
+    {
+        std::scoped_lock lock(PagesMutex);
+        AllPages.push_back(page);
+    }
+    bin.NumPages.fetch_add(1, std::memory_order_relaxed);
+    TotalReserved.fetch_add(bin.PageSize, std::memory_order_relaxed);
 
     return page;
 }
 
-void* FMallocBinned2::AllocateFromBin(FBin& Bin, uint32 Alignment, FThreadCache* Cache) {
-    const uint32 binIdx = SelectBinIndex(Bin.ElementSize);
+void FMallocBinned2::ReleasePage(FPageHeader* Page) {
+    {
+        std::scoped_lock lock(PagesMutex);
+        auto it = std::find(AllPages.begin(), AllPages.end(), Page);
+        if (it != AllPages.end()) {
+            *it = AllPages.back();
+            AllPages.pop_back();
+        }
+    }
+
+    auto& bin = SmallBins[Page->BinIndex];
+    GetPageMap().Set(reinterpret_cast<uintptr_t>(Page), bin.PageSize, nullptr);
+    Page->~FPageHeader();
+    FreePageMemory(Page, bin.PageSize, PAGE_SIZE);
+    bin.NumPages.fetch_sub(1, std::memory_order_relaxed);
+    TotalReserved.fetch_sub(bin.PageSize, std::memory_order_relaxed);
+}
+
+FMallocBinned2::FPageHeader* FMallocBinned2::FindPage(void* Ptr) const {
+    const uintptr_t entry = reinterpret_cast<uintptr_t>(GetPageMap().Find(reinterpret_cast<uintptr_t>(Ptr)));
+    return (entry & kLargeBlockTag) ? nullptr : reinterpret_cast<FPageHeader*>(entry);
+}
 
-    // Try TLS cache first (lock-free fast path)
-    if (Cache && Cache->Count[binIdx] > 0) {
-        --Cache->Count[binIdx];
-        void* p = Cache->Cache[binIdx][Cache->Count[binIdx]];
-        ++Cache->Hits;
-        CacheHits.fetch_add(1, std::memory_order_relaxed);
-        TotalAllocated.fetch_add(Bin.ElementSize, std::memory_order_relaxed);
-        Bin.AllocCount.fetch_add(1, std::memory_order_relaxed);
+void* FMallocBinned2::AllocateFromBin(FThreadHeap* Heap, uint32 BinIndex, SIZE_T Size) {
+    // Fast path: pop from the current page, no lock or atomic RMW
+    auto& heapBin = Heap->Bins[BinIndex];
+    FPageHeader* page = heapBin.Pages;
+    if (page && page->FreeList) {
+        void* p = page->FreeList;
+        page->FreeList = *reinterpret_cast<void**>(p);
+        ++page->UsedCount;
+        BumpCounter(heapBin.AllocCount, 1);
+        BumpCounter(heapBin.RequestedBytes, Size);
         return p;
     }
 
-    // Cache miss
-    if (Cache) {
-        ++Cache->Misses;
-        CacheMisses.fetch_add(1, std::memory_order_relaxed);
+    return AllocateSlow(Heap, BinIndex, Size);
+}
+
+void* FMallocBinned2::AllocateSlow(FThreadHeap* Heap, uint32 BinIndex, SIZE_T Size) {
+    auto& heapBin = Heap->Bins[BinIndex];
+
+    // 1. Reclaim remote frees of the current pages; retire pages that stay full
+    while (FPageHeader* page = heapBin.Pages) {
+        if (!page->FreeList) {
+            CollectRemoteFrees(page);
+        }
+        if (page->FreeList) {
+            break;
+        }
+        heapBin.Pages = page->NextPage;
+        page->NextPage = heapBin.FullPages;
+        heapBin.FullPages = page;
     }
 
-    // Acquire lock and allocate from bin
-    std::scoped_lock lock(Bin.Mutex);
+    // 2. Before growing, recheck full pages for blocks freed since
+    if (!heapBin.Pages) {
+        FPageHeader** link = &heapBin.FullPages;
+        while (FPageHeader* page = *link) {
+            if (!page->FreeList) {
+                CollectRemoteFrees(page);
+            }
+            if (page->FreeList) {
+                *link = page->NextPage;
+                page->NextPage = heapBin.Pages;
+                heapBin.Pages = page;
+            } else {
+                link = &page->NextPage;
+            }
+        }
+    }
 
-    // Find page with free slots
-    for (auto* page : Bin.Pages) {
-        if (page->FreeCount > 0) {
-            void* p = page->FreeList;
-            page->FreeList = *reinterpret_cast<void**>(p);
-            --page->FreeCount;
-            TotalAllocated.fetch_add(Bin.ElementSize, std::memory_order_relaxed);
-            Bin.AllocCount.fetch_add(1, std::memory_order_relaxed);
-            return p;
+    // 3. Adopt a page abandoned by an exited thread
+    if (!heapBin.Pages) {
+        auto& bin = SmallBins[BinIndex];
+        std::scoped_lock lock(bin.Mutex);
+
+        FPageHeader** link = &bin.AbandonedPages;
+        while (FPageHeader* page = *link) {
+            CollectRemoteFrees(page);
+            if (page->FreeList) {
+                *link = page->NextPage;
+                page->Owner.store(Heap, std::memory_order_relaxed);
+                page->NextPage = nullptr;
+                heapBin.Pages = page;
+                break;
+            }
+            link = &page->NextPage;
         }
     }
 
-    // No free slots - allocate new page
-    FPageHeader* newPage = AllocatePage(Bin.ElementSize);
-    if (!newPage) return nullptr;
+    // 4. Allocate a new page
+    if (!heapBin.Pages) {
+        FPageHeader* newPage = AllocatePage(BinIndex);
+        if (!newPage) return nullptr;
 
-    Bin.Pages.push_back(newPage);
-    TotalReserved.fetch_add(PAGE_SIZE, std::memory_order_relaxed);
+        newPage->Owner.store(Heap, std::memory_order_relaxed);
+        heapBin.Pages = newPage;
+    }
 
-    // Pop one element
-    void* p = newPage->FreeList;
-    newPage->FreeList = *reinterpret_cast<void**>(p);
-    --newPage->FreeCount;
-    TotalAllocated.fetch_add(Bin.ElementSize, std::memory_order_relaxed);
-    Bin.AllocCount.fetch_add(1, std::memory_order_relaxed);
+    FPageHeader* page = heapBin.Pages;
+    void* p = page->FreeList;
+    page->FreeList = *reinterpret_cast<void**>(p);
+    ++page->UsedCount;
+    BumpCounter(heapBin.AllocCount, 1);
+    BumpCounter(heapBin.RequestedBytes, Size);
     return p;
 }
 
-void FMallocBinned2::FreeToBin(FBin& Bin, void* Ptr, FThreadCache* Cache) {
-    const uint32 binIdx = SelectBinIndex(Bin.ElementSize);
+void FMallocBinned2::FreeToPage(FThreadHeap* Heap, FPageHeader* Page, void* Ptr) {
+    if (Heap) {
+        BumpCounter(Heap->Bins[Page->BinIndex].FreeCount, 1);
+    }
 
-    // Try to add to TLS cache (lock-free fast path)
-    if (Cache && Cache->Count[binIdx] < TLS_CACHE_SIZE) {
-        Cache->Cache[binIdx][Cache->Count[binIdx]] = Ptr;
-        ++Cache->Count[binIdx];
-        TotalAllocated.fetch_sub(Bin.ElementSize, std::memory_order_relaxed);
-        Bin.FreeCount.fetch_add(1, std::memory_order_relaxed);
+    // Owner: straight onto the page's local free list
+    if (Heap && Page->Owner.load(std::memory_order_relaxed) == Heap) {
+        *reinterpret_cast<void**>(Ptr) = Page->FreeList;
+        Page->FreeList = Ptr;
+        --Page->UsedCount;
         return;
     }
 
-    // Cache full - return to bin
-    std::scoped_lock lock(Bin.Mutex);
+    // Thread exiting: push the single block
+    if (!Heap) {
+        FRemoteFreeBatch batch;
+        batch.Page = Page;
+        batch.Head = Ptr;
+        batch.Tail = Ptr;
+        batch.Count = 1;
+        FlushRemoteBatch(batch);
+        return;
+    }
 
-    // Find the owning page
-    for (auto* page : Bin.Pages) {
-        uint8* pageStart = reinterpret_cast<uint8*>(page);
-        uint8* pageEnd = pageStart + PAGE_SIZE;
-        if (reinterpret_cast<uint8*>(Ptr) >= pageStart && reinterpret_cast<uint8*>(Ptr) < pageEnd) {
-            *reinterpret_cast<void**>(Ptr) = page->FreeList;
-            page->FreeList = Ptr;
-            ++page->FreeCount;
-            TotalAllocated.fetch_sub(Bin.ElementSize, std::memory_order_relaxed);
-            Bin.FreeCount.fetch_add(1, std::memory_order_relaxed);
-            return;
-        }
+    // Remote free: chain blocks of the same page and push them with one CAS
+    FRemoteFreeBatch& batch = Heap->Bins[Page->BinIndex].RemoteBatch;
+    if (batch.Page != Page) {
+        FlushRemoteBatch(batch);
+        *reinterpret_cast<void**>(Ptr) = nullptr;
+        batch.Page = Page;
+        batch.Head = Ptr;
+        batch.Tail = Ptr;
+        batch.Count = 1;
+    } else {
+        *reinterpret_cast<void**>(Ptr) = batch.Head;
+        batch.Head = Ptr;
+        ++batch.Count;
     }
 
-    MR_LOG_WARNING("FreeToBin: pointer not found in bin");
+    if (batch.Count >= SmallBins[Page->BinIndex].RemoteBatchLimit) {
+        FlushRemoteBatch(batch);
+    }
 }
 
-FMallocBinned2::FThreadCache* FMallocBinned2::GetTLSCache() {
-    if (!TLSCache) {
-        // Use system malloc for internal structures to avoid circular dependency
-        TLSCache = static_cast<FThreadCache*>(::malloc(sizeof(FThreadCache)));
-        new(TLSCache) FThreadCache();
-        for (uint32 i = 0; i < NUM_SMALL_BINS; ++i) {
-            TLSCache->Count[i] = 0;
-            for (uint32 j = 0; j < TLS_CACHE_SIZE; ++j) {
-                TLSCache->Cache[i][j] = nullptr;
+// Large blocks
+
+uint32 FMallocBinned2::SelectLargeBucket(SIZE_T& InOutMappedSize) {
+    // 64KB steps up to 1MB
+    constexpr SIZE_T kFineLimit = 1024 * 1024;
+    if (InOutMappedSize <= kFineLimit) {
+        InOutMappedSize = (InOutMappedSize + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+        return static_cast<uint32>(InOutMappedSize / PAGE_SIZE) - 1;
+    }
+
+    // Then four buckets per power of two
+    uint32 log2 = 20;
+    while ((SIZE_T(2) << log2) < InOutMappedSize) {
+        ++log2;
+    }
+    const SIZE_T step = (SIZE_T(1) << log2) / 4;
+    const SIZE_T rounded = (InOutMappedSize + step - 1) & ~(step - 1);
+    const uint32 bucket = 16 + (log2 - 20) * 4 + static_cast<uint32>((rounded - (SIZE_T(1) << log2)) / step) - 1;
+    if (bucket >= NUM_LARGE_BUCKETS) {
+        // Too large to cache, mapped exactly
+        InOutMappedSize = (InOutMappedSize + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+        return NUM_LARGE_BUCKETS;
+    }
+    InOutMappedSize = rounded;
+    return bucket;
+}
+
+void* FMallocBinned2::AllocateLarge(SIZE_T Size, uint32 Alignment, bool bHugePages) {
+#if PLATFORM_LINUX
+    const SIZE_T userOffset = std::max<SIZE_T>(sizeof(FLargeBlockHeader), Alignment);
+    const SIZE_T granularity = std::max<SIZE_T>(std::max<SIZE_T>(PAGE_SIZE, Alignment), bHugePages ? HUGE_PAGE_SIZE : 0);
+
+    SIZE_T mappedSize = userOffset + Size;
+    const uint32 bucket = SelectLargeBucket(mappedSize);
+
+    // Reuse a cached block of the same bucket with enough base alignment
+    FLargeBlockHeader* block = nullptr;
+    {
+        std::scoped_lock lock(LargeMutex);
+        if (bucket < NUM_LARGE_BUCKETS) {
+            FLargeBlockHeader** link = &LargeCache[bucket];
+            while (FLargeBlockHeader* cached = *link) {
+                if ((reinterpret_cast<uintptr_t>(cached) & (granularity - 1)) == 0) {
+                    *link = cached->Next;
+                    LargeCachedBytes -= cached->MappedSize;
+                    if (cached->bDecommitted) {
+                        LargeDecommittedBytes -= cached->MappedSize - PAGE_SIZE;
+                    } else {
+                        LargeCachedResidentBytes -= cached->MappedSize;
+                    }
+                    block = cached;
+                    break;
+                }
+                link = &cached->Next;
             }
         }
-        TLSCache->Hits = 0;
-        TLSCache->Misses = 0;
+        if (block) {
+            ++LargeCacheHits;
+        } else {
+            ++LargeCacheMisses;
+        }
     }
-    return TLSCache;
+
+    if (!block) {
+        block = static_cast<FLargeBlockHeader*>(AllocatePageMemory(mappedSize, granularity));
+        if (!block) {
+            return nullptr;
+        }
+        block->Allocator = this;
+        block->MappedSize = mappedSize;
+        block->BucketIndex = bucket;
+        block->bHugePages = false;
+
+        std::scoped_lock lock(LargeMutex);
+        LargeMappedBytes += mappedSize;
+    }
+
+    block->bDecommitted = false;
+    if (bHugePages && !block->bHugePages) {
+        block->bHugePages = madvise(block, block->MappedSize, MADV_HUGEPAGE) == 0;
+    }
+
+    uint8* userPtr = reinterpret_cast<uint8*>(block) + userOffset;
+    block->RequestedSize = Size;
+    block->UserPtr = userPtr;
+
+    const uintptr_t granule = reinterpret_cast<uintptr_t>(userPtr) & ~uintptr_t(PAGE_SIZE - 1);
+    if (!GetPageMap().Set(granule, PAGE_SIZE, reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(block) | kLargeBlockTag))) {
+        std::scoped_lock lock(LargeMutex);
+        ReleaseLargeBlock(block);
+        return nullptr;
+    }
+
+    std::scoped_lock lock(LargeMutex);
+    block->Prev = nullptr;
+    block->Next = LiveLargeBlocks;
+    if (LiveLargeBlocks) {
+        LiveLargeBlocks->Prev = block;
+    }
+    LiveLargeBlocks = block;
+
+    ++LargeAllocCount;
+    LargeLiveBytes += Size;
+    if (block->bHugePages) {
+        HugePageBytes += block->MappedSize;
+    }
+    return userPtr;
+#else
+    (void)bHugePages;
+    return SystemMalloc(Size, Alignment);
+#endif
 }
 
-void FMallocBinned2::ReleaseTLSCache(FThreadCache* Cache) {
-    if (!Cache) return;
+void FMallocBinned2::FreeLarge(FLargeBlockHeader* Block) {
+#if PLATFORM_LINUX
+    const uintptr_t granule = reinterpret_cast<uintptr_t>(Block->UserPtr) & ~uintptr_t(PAGE_SIZE - 1);
+    GetPageMap().Set(granule, PAGE_SIZE, nullptr);
+
+    std::scoped_lock lock(LargeMutex);
+    if (Block->Prev) {
+        Block->Prev->Next = Block->Next;
+    } else {
+        LiveLargeBlocks = Block->Next;
+    }
+    if (Block->Next) {
+        Block->Next->Prev = Block->Prev;
+    }
+
+    ++LargeFreeCount;
+    LargeLiveBytes -= Block->RequestedSize;
+    if (Block->bHugePages) {
+        HugePageBytes -= Block->MappedSize;
+    }
+
+    if (Block->BucketIndex >= NUM_LARGE_BUCKETS || LargeCachedBytes + Block->MappedSize > LARGE_CACHE_MAX_BYTES) {
+        ReleaseLargeBlock(Block);
+        return;
+    }
+
+    // Over the resident budget: drop the pages but keep the mapping (and the header page)
+    if (LargeCachedResidentBytes + Block->MappedSize > LARGE_CACHE_RESIDENT_BYTES &&
+        madvise(reinterpret_cast<uint8*>(Block) + PAGE_SIZE, Block->MappedSize - PAGE_SIZE, MADV_DONTNEED) == 0) {
+        Block->bDecommitted = true;
+        LargeDecommittedBytes += Block->MappedSize - PAGE_SIZE;
+    } else {
+        LargeCachedResidentBytes += Block->MappedSize;
+    }
+
+    Block->Next = LargeCache[Block->BucketIndex];
+    LargeCache[Block->BucketIndex] = Block;
+    LargeCachedBytes += Block->MappedSize;
+#else
+    (void)Block;
+#endif
+}
+
+void FMallocBinned2::ReleaseLargeBlock(FLargeBlockHeader* Block) {
+    // Caller holds LargeMutex
+    LargeMappedBytes -= Block->MappedSize;
+    FreePageMemory(Block, Block->MappedSize, PAGE_SIZE);
+}
+
+void FMallocBinned2::TrimLargeCache() {
+    std::scoped_lock lock(LargeMutex);
+    for (uint32 i = 0; i < NUM_LARGE_BUCKETS; ++i) {
+        while (FLargeBlockHeader* block = LargeCache[i]) {
+            LargeCache[i] = block->Next;
+            ReleaseLargeBlock(block);
+        }
+    }
+    LargeCachedBytes = 0;
+    LargeCachedResidentBytes = 0;
+    LargeDecommittedBytes = 0;
+}
+
+uint32 FMallocBinned2::CollectRemoteFrees(FPageHeader* Page) {
+    void* list = Page->RemoteFreeList.exchange(nullptr, std::memory_order_acquire);
+    if (!list) {
+        return 0;
+    }
+
+    uint32 count = 1;
+    void* tail = list;
+    while (void* next = *reinterpret_cast<void**>(tail)) {
+        tail = next;
+        ++count;
+    }
+
+    *reinterpret_cast<void**>(tail) = Page->FreeList;
+    Page->FreeList = list;
+    Page->UsedCount -= count;
+    return count;
+}
+
+void FMallocBinned2::FlushRemoteBatch(FRemoteFreeBatch& Batch) {
+    if (!Batch.Page) {
+        return;
+    }
+
+    std::atomic<void*>& remoteFreeList = Batch.Page->RemoteFreeList;
+    void* head = remoteFreeList.load(std::memory_order_relaxed);
+    do {
+        *reinterpret_cast<void**>(Batch.Tail) = head;
+    } while (!remoteFreeList.compare_exchange_weak(head, Batch.Head, std::memory_order_release, std::memory_order_relaxed));
 
-    // Flush all cached items back to bins
+    Batch = FRemoteFreeBatch();
+}
+
+FMallocBinned2::FThreadHeap* FMallocBinned2::GetThreadHeap() {
+    if (t_heapSlotsDestroyed) {
+        return nullptr;
+    }
+
+    FBinnedThreadHeapSlots& slots = t_heapSlots;
+    if (slots.InstanceIds[0] == InstanceId) {
+        return slots.Heaps[0];
+    }
+
+    // Another allocator instance was used last on this thread
+    uint32 slot = 1;
+    while (slot < MAX_THREAD_HEAP_SLOTS && slots.InstanceIds[slot] != InstanceId) {
+        ++slot;
+    }
+
+    FThreadHeap* heap = nullptr;
+    if (slot < MAX_THREAD_HEAP_SLOTS) {
+        heap = slots.Heaps[slot];
+    } else {
+        heap = CreateThreadHeap();
+        if (!heap) {
+            return nullptr;
+        }
+        slot = MAX_THREAD_HEAP_SLOTS - 1;
+        slots.Release(slot);
+    }
+
+    // Move to front
+    for (; slot > 0; --slot) {
+        slots.InstanceIds[slot] = slots.InstanceIds[slot - 1];
+        slots.Heaps[slot] = slots.Heaps[slot - 1];
+    }
+    slots.InstanceIds[0] = InstanceId;
+    slots.Heaps[0] = heap;
+    return heap;
+}
+
+FMallocBinned2::FThreadHeap* FMallocBinned2::CreateThreadHeap() {
+    std::scoped_lock lock(HeapsMutex);
+
+    // Reuse the heap of an exited thread (keeps its statistics)
+    if (FThreadHeap* heap = RetiredHeaps) {
+        RetiredHeaps = heap->NextRetired;
+        heap->NextRetired = nullptr;
+        return heap;
+    }
+
+    // Use system malloc for internal structures to avoid circular dependency
+    void* memory = std::malloc(sizeof(FThreadHeap));
+    if (!memory) {
+        return nullptr;
+    }
+    FThreadHeap* heap = new (memory) FThreadHeap();
+    heap->NextHeap = Heaps;
+    Heaps = heap;
+    return heap;
+}
+
+void FMallocBinned2::ReleaseThreadHeap(FThreadHeap* Heap) {
+    if (!Heap) return;
+
+    // Hand every owned page to its bin; other threads adopt them when they need pages
     for (uint32 binIdx = 0; binIdx < NUM_SMALL_BINS; ++binIdx) {
+        auto& heapBin = Heap->Bins[binIdx];
+        FlushRemoteBatch(heapBin.RemoteBatch);
+
+        FPageHeader* lists[] = {heapBin.Pages, heapBin.FullPages};
+        heapBin.Pages = nullptr;
+        heapBin.FullPages = nullptr;
+
         auto& bin = SmallBins[binIdx];
         std::scoped_lock lock(bin.Mutex);
-        for (uint32 i = 0; i < Cache->Count[binIdx]; ++i) {
-            void* ptr = Cache->Cache[binIdx][i];
-            // Return to first page's freelist (simplified)
-            if (!bin.Pages.empty()) {
-                auto* page = bin.Pages[0];
-                *reinterpret_cast<void**>(ptr) = page->FreeList;
-                page->FreeList = ptr;
-                ++page->FreeCount;
+        for (FPageHeader* page : lists) {
+            while (page) {
+                FPageHeader* next = page->NextPage;
+                page->Owner.store(nullptr, std::memory_order_release);
+                page->NextPage = bin.AbandonedPages;
+                bin.AbandonedPages = page;
+                page = next;
             }
         }
     }
-    Cache->~FThreadCache();
-    ::free(Cache);
+
+    std::scoped_lock lock(HeapsMutex);
+    Heap->NextRetired = RetiredHeaps;
+    RetiredHeaps = Heap;
 }
 
-} // namespace MonsterRender
+void FMallocBinned2::TrimHeap(FThreadHeap* Heap) {
+    for (uint32 binIdx = 0; binIdx < NUM_SMALL_BINS; ++binIdx) {
+        auto& heapBin = Heap->Bins[binIdx];
+        FlushRemoteBatch(heapBin.RemoteBatch);
 
+        // Keep the current page and a few empty ones, release the other empty pages
+        uint32 keptEmptyCount = 0;
+        for (FPageHeader** list : {&heapBin.Pages, &heapBin.FullPages}) {
+            FPageHeader** link = list;
+            while (FPageHeader* page = *link) {
+                CollectRemoteFrees(page);
+                if (page->UsedCount == 0 && page != heapBin.Pages && keptEmptyCount++ >= SmallBins[binIdx].EmptyPagesToKeep) {
+                    *link = page->NextPage;
+                    ReleasePage(page);
+                } else {
+                    link = &page->NextPage;
+                }
+            }
+        }
+    }
+}
+
+} // namespace MonsterRender
@@ -10,6 +10,10 @@ void* FMemory::Malloc(SIZE_T Count, uint32 Alignment) {
     return FMemoryManager::Get().GetAllocator()->Malloc(Count, Alignment);
 }
 
+void* FMemory::MallocStaging(SIZE_T Count, uint32 Alignment) {
+    return FMemoryManager::Get().GetAllocator()->MallocStaging(Count, Alignment);
+}
+
 void* FMemory::Realloc(void* Original, SIZE_T Count, uint32 Alignment) {
     return FMemoryManager::Get().GetAllocator()->Realloc(Original, Count, Alignment);
 }
@@ -44,6 +48,13 @@ void FMemory::GetMemoryStats(FMemoryStats& OutStats) {
     OutStats.TotalReserved = allocatorStats.TotalReserved;
     OutStats.AllocationCount = allocatorStats.AllocationCount;
     OutStats.FreeCount = allocatorStats.FreeCount;
+    OutStats.InternalWaste = allocatorStats.InternalWaste;
+    OutStats.ExternalWaste = allocatorStats.ExternalWaste;
+    OutStats.LargeCacheHits = allocatorStats.LargeCacheHits;
+    OutStats.LargeCacheMisses = allocatorStats.LargeCacheMisses;
+    OutStats.LargeCachedBytes = allocatorStats.LargeCachedBytes;
+    OutStats.LargeCacheRssSaved = allocatorStats.LargeCacheRssSaved;
+    OutStats.HugePageBytes = allocatorStats.HugePageBytes;
 }
 
 } // namespace MonsterRender
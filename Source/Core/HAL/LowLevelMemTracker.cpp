@@ -0,0 +1,347 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// MonsterEngine - Low Level Memory Tracker Implementation
+
+#include "Core/HAL/LowLevelMemTracker.h"
+#include "Core/Log.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace MonsterRender {
+
+#if MR_LLM_ENABLED
+
+std::atomic<bool> FLowLevelMemTracker::s_enabled{false};
+
+namespace {
+    constexpr uint32 kNumTags = static_cast<uint32>(ELLMTag::Count);
+    constexpr uint32 kNumTrackers = static_cast<uint32>(ELLMTracker::Count);
+    constexpr uint32 kMaxTagStackDepth = 32;
+    constexpr uint32 kNumMapShards = 64;
+
+    const char* const kTagNames[kNumTags] = {
+        "Untagged",
+        "EngineMisc",
+        "TaskGraph",
+        "Logging",
+        "Renderer",
+        "Scene",
+        "Meshes",
+        "MeshBuilder",
+        "Textures",
+        "Shaders",
+        "RHI",
+    };
+
+    /** Per-tag counters, one cache line each so tags do not contend */
+    struct alignas(64) FTagCounters {
+        std::atomic<int64> CurrentBytes{0};
+        std::atomic<int64> PeakBytes{0};
+        std::atomic<uint64> AllocationCount{0};
+    };
+
+    struct FTrackedAllocation {
+        uint64 Size;
+        ELLMTag Tag;
+    };
+
+    /** Pointer -> size and tag, sharded by address to spread lock contention */
+    struct alignas(64) FAllocationMapShard {
+        std::mutex Mutex;
+        std::unordered_map<uintptr_t, FTrackedAllocation> Allocations;
+    };
+
+    struct FCsvCapture {
+        std::mutex Mutex;
+        std::condition_variable Wakeup;
+        std::thread Thread;
+        FILE* File = nullptr;
+        bool bStopRequested = false;
+    };
+
+    struct FTrackerState {
+        FTagCounters Counters[kNumTrackers][kNumTags];
+        FAllocationMapShard Shards[kNumTrackers][kNumMapShards];
+        FCsvCapture Csv;
+        const std::chrono::steady_clock::time_point Epoch = std::chrono::steady_clock::now();
+    };
+
+    FTrackerState& GetState() {
+        // Intentionally leaked: allocations may be freed during static destruction
+        static FTrackerState* s_state = new FTrackerState();
+        return *s_state;
+    }
+
+    thread_local ELLMTag t_tagStack[kMaxTagStackDepth];
+    thread_local uint32 t_tagDepth = 0;
+
+    FORCEINLINE FAllocationMapShard& GetShard(ELLMTracker Tracker, uintptr_t Address) {
+        const uint64 hash = (static_cast<uint64>(Address) >> 4) * 0x9E3779B97F4A7C15ull;
+        return GetState().Shards[static_cast<uint32>(Tracker)][hash >> 58];
+    }
+
+    void Charge(ELLMTracker Tracker, ELLMTag Tag, int64 Delta) {
+        FTagCounters& counters = GetState().Counters[static_cast<uint32>(Tracker)][static_cast<uint32>(Tag)];
+        const int64 current = counters.CurrentBytes.fetch_add(Delta, std::memory_order_relaxed) + Delta;
+        if (Delta > 0) {
+            counters.AllocationCount.fetch_add(1, std::memory_order_relaxed);
+            int64 peak = counters.PeakBytes.load(std::memory_order_relaxed);
+            while (current > peak &&
+                   !counters.PeakBytes.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+            }
+        }
+    }
+
+    void WriteCsvRow(FILE* File) {
+        FTrackerState& state = GetState();
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - state.Epoch).count();
+        fprintf(File, "%.3f", seconds);
+        for (uint32 tracker = 0; tracker < kNumTrackers; ++tracker) {
+            for (uint32 tag = 0; tag < kNumTags; ++tag) {
+                fprintf(File, ",%lld", static_cast<long long>(
+                    state.Counters[tracker][tag].CurrentBytes.load(std::memory_order_relaxed)));
+            }
+        }
+        fputc('\n', File);
+        fflush(File);
+    }
+}
+
+void FLowLevelMemTracker::SetEnabled(bool bEnabled) {
+    FTrackerState& state = GetState();
+    s_enabled.store(bEnabled, std::memory_order_relaxed);
+
+    if (!bEnabled) {
+        // Frees are no longer reported, so forget everything tracked so far
+        for (uint32 tracker = 0; tracker < kNumTrackers; ++tracker) {
+            for (FAllocationMapShard& shard : state.Shards[tracker]) {
+                std::lock_guard<std::mutex> lock(shard.Mutex);
+                shard.Allocations.clear();
+            }
+            for (FTagCounters& counters : state.Counters[tracker]) {
+                counters.CurrentBytes.store(0, std::memory_order_relaxed);
+                counters.PeakBytes.store(0, std::memory_order_relaxed);
+                counters.AllocationCount.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    MR_LOG_INFO(String("Low level memory tracker ") + (bEnabled ? "enabled" : "disabled"));
+}
+
+ELLMTag FLowLevelMemTracker::GetActiveTag() {
+    if (t_tagDepth == 0) {
+        return ELLMTag::Untagged;
+    }
+    return t_tagStack[(t_tagDepth < kMaxTagStackDepth ? t_tagDepth : kMaxTagStackDepth) - 1];
+}
+
+void FLowLevelMemTracker::PushTag(ELLMTag Tag) {
+    // Past the maximum depth the innermost stored tag stays active
+    if (t_tagDepth < kMaxTagStackDepth) {
+        t_tagStack[t_tagDepth] = Tag;
+    }
+    ++t_tagDepth;
+}
+
+void FLowLevelMemTracker::PopTag() {
+    if (t_tagDepth > 0) {
+        --t_tagDepth;
+    }
+}
+
+void FLowLevelMemTracker::OnAlloc(ELLMTracker Tracker, const void* Ptr, uint64 Size) {
+    if (!Ptr || !IsEnabled()) {
+        return;
+    }
+
+    const ELLMTag tag = GetActiveTag();
+    const uintptr_t address = reinterpret_cast<uintptr_t>(Ptr);
+    FAllocationMapShard& shard = GetShard(Tracker, address);
+    {
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        auto [it, bInserted] = shard.Allocations.try_emplace(address, FTrackedAllocation{Size, tag});
+        if (!bInserted) {
+            // Address reused without a reported free; drop the stale entry
+            Charge(Tracker, it->second.Tag, -static_cast<int64>(it->second.Size));
+            it->second = FTrackedAllocation{Size, tag};
+        }
+    }
+    Charge(Tracker, tag, static_cast<int64>(Size));
+}
+
+void FLowLevelMemTracker::OnFree(ELLMTracker Tracker, const void* Ptr) {
+    if (!Ptr || !IsEnabled()) {
+        return;
+    }
+
+    const uintptr_t address = reinterpret_cast<uintptr_t>(Ptr);
+    FAllocationMapShard& shard = GetShard(Tracker, address);
+    FTrackedAllocation allocation;
+    {
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        auto it = shard.Allocations.find(address);
+        if (it == shard.Allocations.end()) {
+            return;
+        }
+        allocation = it->second;
+        shard.Allocations.erase(it);
+    }
+    Charge(Tracker, allocation.Tag, -static_cast<int64>(allocation.Size));
+}
+
+void FLowLevelMemTracker::OnFreeRange(ELLMTracker Tracker, const void* Start, uint64 Size) {
+    if (!IsEnabled()) {
+        return;
+    }
+
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(Start);
+    const uintptr_t end = begin + Size;
+    for (FAllocationMapShard& shard : GetState().Shards[static_cast<uint32>(Tracker)]) {
+        std::lock_guard<std::mutex> lock(shard.Mutex);
+        for (auto it = shard.Allocations.begin(); it != shard.Allocations.end();) {
+            if (it->first >= begin && it->first < end) {
+                Charge(Tracker, it->second.Tag, -static_cast<int64>(it->second.Size));
+                it = shard.Allocations.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+}
+
+void FLowLevelMemTracker::OnAllocTagged(ELLMTracker Tracker, ELLMTag Tag, uint64 Size) {
+    if (IsEnabled()) {
+        Charge(Tracker, Tag, static_cast<int64>(Size));
+    }
+}
+
+void FLowLevelMemTracker::OnFreeTagged(ELLMTracker Tracker, ELLMTag Tag, uint64 Size) {
+    if (IsEnabled()) {
+        Charge(Tracker, Tag, -static_cast<int64>(Size));
+    }
+}
+
+FLowLevelMemTracker::FTagStats FLowLevelMemTracker::GetTagStats(ELLMTracker Tracker, ELLMTag Tag) {
+    const FTagCounters& counters = GetState().Counters[static_cast<uint32>(Tracker)][static_cast<uint32>(Tag)];
+    FTagStats stats;
+    stats.CurrentBytes = counters.CurrentBytes.load(std::memory_order_relaxed);
+    stats.PeakBytes = counters.PeakBytes.load(std::memory_order_relaxed);
+    stats.AllocationCount = counters.AllocationCount.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void FLowLevelMemTracker::LogReport() {
+    MR_LOG_INFO("Low level memory tracker report:");
+    MR_LOG_INFO("  Tracker | Tag          | Current KB | Peak KB    | Allocations");
+
+    for (uint32 tracker = 0; tracker < kNumTrackers; ++tracker) {
+        for (uint32 tag = 0; tag < kNumTags; ++tag) {
+            const FTagStats stats = GetTagStats(static_cast<ELLMTracker>(tracker), static_cast<ELLMTag>(tag));
+            if (stats.AllocationCount == 0) {
+                continue;
+            }
+
+            char line[128];
+            snprintf(line, sizeof(line), "  %-7s | %-12s | %10lld | %10lld | %llu",
+                     GetTrackerName(static_cast<ELLMTracker>(tracker)), kTagNames[tag],
+                     static_cast<long long>(stats.CurrentBytes / 1024), static_cast<long long>(stats.PeakBytes / 1024),
+                     static_cast<unsigned long long>(stats.AllocationCount));
+            MR_LOG_INFO(line);
+        }
+    }
+}
+
+bool FLowLevelMemTracker::StartCsvCapture(const String& FilePath, float IntervalSeconds) {
+    FCsvCapture& csv = GetState().Csv;
+    std::lock_guard<std::mutex> lock(csv.Mutex);
+    if (csv.File) {
+        MR_LOG_WARNING("FLowLevelMemTracker::StartCsvCapture - Capture already running");
+        return false;
+    }
+
+#if defined(_MSC_VER)
+    if (fopen_s(&csv.File, FilePath.c_str(), "w") != 0) {
+        csv.File = nullptr;
+    }
+#else
+    csv.File = fopen(FilePath.c_str(), "w");
+#endif
+    if (!csv.File) {
+        MR_LOG_ERROR("FLowLevelMemTracker::StartCsvCapture - Failed to open " + FilePath);
+        return false;
+    }
+
+    // Header: one column per tracker and tag, values in bytes
+    fputs("Seconds", csv.File);
+    for (uint32 tracker = 0; tracker < kNumTrackers; ++tracker) {
+        for (uint32 tag = 0; tag < kNumTags; ++tag) {
+            fprintf(csv.File, ",%s/%s", GetTrackerName(static_cast<ELLMTracker>(tracker)), kTagNames[tag]);
+        }
+    }
+    fputc('\n', csv.File);
+    WriteCsvRow(csv.File);
+
+    csv.bStopRequested = false;
+    const auto interval = std::chrono::duration<float>(IntervalSeconds > 0.0f ? IntervalSeconds : 1.0f);
+    csv.Thread = std::thread([&csv, interval]() {
+        std::unique_lock<std::mutex> threadLock(csv.Mutex);
+        while (!csv.Wakeup.wait_for(threadLock, interval, [&csv]() { return csv.bStopRequested; })) {
+            WriteCsvRow(csv.File);
+        }
+    });
+
+    MR_LOG_INFO("FLowLevelMemTracker - CSV capture started: " + FilePath);
+    return true;
+}
+
+void FLowLevelMemTracker::StopCsvCapture() {
+    FCsvCapture& csv = GetState().Csv;
+    {
+        std::lock_guard<std::mutex> lock(csv.Mutex);
+        if (!csv.File) {
+            return;
+        }
+        csv.bStopRequested = true;
+    }
+    csv.Wakeup.notify_all();
+    csv.Thread.join();
+
+    std::lock_guard<std::mutex> lock(csv.Mutex);
+    WriteCsvRow(csv.File);
+    fclose(csv.File);
+    csv.File = nullptr;
+    MR_LOG_INFO("FLowLevelMemTracker - CSV capture stopped");
+}
+
+const char* FLowLevelMemTracker::GetTagName(ELLMTag Tag) {
+    return static_cast<uint32>(Tag) < kNumTags ? kTagNames[static_cast<uint32>(Tag)] : "Invalid";
+}
+
+#else // MR_LLM_ENABLED
+
+void FLowLevelMemTracker::SetEnabled(bool) {}
+ELLMTag FLowLevelMemTracker::GetActiveTag() { return ELLMTag::Untagged; }
+void FLowLevelMemTracker::PushTag(ELLMTag) {}
+void FLowLevelMemTracker::PopTag() {}
+void FLowLevelMemTracker::OnAlloc(ELLMTracker, const void*, uint64) {}
+void FLowLevelMemTracker::OnFree(ELLMTracker, const void*) {}
+void FLowLevelMemTracker::OnFreeRange(ELLMTracker, const void*, uint64) {}
+void FLowLevelMemTracker::OnAllocTagged(ELLMTracker, ELLMTag, uint64) {}
+void FLowLevelMemTracker::OnFreeTagged(ELLMTracker, ELLMTag, uint64) {}
+FLowLevelMemTracker::FTagStats FLowLevelMemTracker::GetTagStats(ELLMTracker, ELLMTag) { return FTagStats{}; }
+void FLowLevelMemTracker::LogReport() {}
+bool FLowLevelMemTracker::StartCsvCapture(const String&, float) { return false; }
+void FLowLevelMemTracker::StopCsvCapture() {}
+const char* FLowLevelMemTracker::GetTagName(ELLMTag) { return "Untagged"; }
+
+#endif // MR_LLM_ENABLED
+
+const char* FLowLevelMemTracker::GetTrackerName(ELLMTracker Tracker) {
+    return Tracker == ELLMTracker::GPU ? "GPU" : "CPU";
+}
+
+} // namespace MonsterRender
@@ -0,0 +1,170 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// MonsterEngine - Per-thread Frame Memory Stack Implementation
+
+#include "Core/HAL/MemStack.h"
+
+namespace MonsterRender {
+
+namespace {
+    constexpr SIZE_T kChunkHeaderSize = 16;
+
+    std::atomic<uint64> GChunkAllocations{0};
+    std::atomic<uint64> GReservedBytes{0};
+}
+
+std::atomic<uint64> FMemStack::FrameNumber{0};
+
+FMemStack& FMemStack::Get() {
+    static thread_local FMemStack ThreadStack;
+    return ThreadStack;
+}
+
+void FMemStack::EndFrame() {
+    FrameNumber.fetch_add(1, std::memory_order_relaxed);
+}
+
+FMemStack::FStats FMemStack::GetStats() {
+    FStats Stats;
+    Stats.ChunkAllocations = GChunkAllocations.load(std::memory_order_relaxed);
+    Stats.ReservedBytes = GReservedBytes.load(std::memory_order_relaxed);
+    return Stats;
+}
+
+FMemStack::~FMemStack() {
+    FreeChunks(nullptr);
+    Trim();
+}
+
+void* FMemStack::AllocateNewChunk(SIZE_T Size, SIZE_T Alignment) {
+    static_assert(sizeof(FChunk) == kChunkHeaderSize, "Chunk data must start 16-byte aligned");
+
+    // Worst-case padding, so the aligned request always fits the new chunk
+    const SIZE_T Needed = Size + (Alignment > kChunkHeaderSize ? Alignment : 0);
+
+    FChunk* Chunk = nullptr;
+    if (Needed <= CHUNK_SIZE - sizeof(FChunk)) {
+        if (UnusedChunks) {
+            Chunk = UnusedChunks;
+            UnusedChunks = Chunk->Next;
+        } else {
+            Chunk = static_cast<FChunk*>(FMemory::Malloc(CHUNK_SIZE, kChunkHeaderSize));
+            Chunk->DataSize = CHUNK_SIZE - sizeof(FChunk);
+            GChunkAllocations.fetch_add(1, std::memory_order_relaxed);
+            GReservedBytes.fetch_add(CHUNK_SIZE, std::memory_order_relaxed);
+        }
+    } else {
+        // Oversized request: a chunk of its own, the smallest cached one that fits
+        FChunk** BestLink = nullptr;
+        for (FChunk** Link = &UnusedLargeChunks; *Link; Link = &(*Link)->Next) {
+            if ((*Link)->DataSize >= Needed && (!BestLink || (*Link)->DataSize < (*BestLink)->DataSize)) {
+                BestLink = Link;
+            }
+        }
+
+        if (BestLink) {
+            Chunk = *BestLink;
+            *BestLink = Chunk->Next;
+        } else {
+            // Whole chunks, so arrays growing at the top have room to grow in place
+            const SIZE_T AllocSize = (sizeof(FChunk) + Needed + CHUNK_SIZE - 1) & ~(CHUNK_SIZE - 1);
+            Chunk = static_cast<FChunk*>(FMemory::Malloc(AllocSize, kChunkHeaderSize));
+            Chunk->DataSize = AllocSize - sizeof(FChunk);
+            GChunkAllocations.fetch_add(1, std::memory_order_relaxed);
+            GReservedBytes.fetch_add(AllocSize, std::memory_order_relaxed);
+        }
+    }
+
+    Chunk->Next = TopChunk;
+    TopChunk = Chunk;
+    End = ChunkData(Chunk) + Chunk->DataSize;
+
+    uint8* Result = AlignPtr(ChunkData(Chunk), Alignment);
+    Top = Result + Size;
+    return Result;
+}
+
+void FMemStack::FreeChunks(FChunk* NewTopChunk) {
+    while (TopChunk != NewTopChunk) {
+        FChunk* Chunk = TopChunk;
+        TopChunk = Chunk->Next;
+
+        FChunk*& UnusedList = Chunk->DataSize == CHUNK_SIZE - sizeof(FChunk) ? UnusedChunks : UnusedLargeChunks;
+        Chunk->Next = UnusedList;
+        UnusedList = Chunk;
+    }
+
+    Top = TopChunk ? ChunkData(TopChunk) : nullptr;
+    End = TopChunk ? ChunkData(TopChunk) + TopChunk->DataSize : nullptr;
+}
+
+void FMemStack::BeginFrame() {
+    FreeChunks(nullptr);
+    LocalFrame = FrameNumber.load(std::memory_order_relaxed);
+}
+
+bool FMemStack::TryGrowInPlace(void* Ptr, SIZE_T OldSize, SIZE_T NewSize) {
+    uint8* Block = static_cast<uint8*>(Ptr);
+    if (NeedsNewFrame()) {
+        return false;
+    }
+    if (Block + OldSize != Top || Block + NewSize > End) {
+        return false;
+    }
+    Top = Block + NewSize;
+    return true;
+}
+
+void FMemStack::Trim() {
+    auto FreeList = [](FChunk*& List) {
+        while (List) {
+            FChunk* Chunk = List;
+            List = Chunk->Next;
+            GReservedBytes.fetch_sub(sizeof(FChunk) + Chunk->DataSize, std::memory_order_relaxed);
+            FMemory::Free(Chunk);
+        }
+    };
+    FreeList(UnusedChunks);
+    FreeList(UnusedLargeChunks);
+}
+
+SIZE_T FMemStack::GetByteCount() const {
+    if (!TopChunk) {
+        return 0;
+    }
+    SIZE_T Count = static_cast<SIZE_T>(Top - ChunkData(TopChunk));
+    for (const FChunk* Chunk = TopChunk->Next; Chunk; Chunk = Chunk->Next) {
+        Count += Chunk->DataSize;
+    }
+    return Count;
+}
+
+// ============================================================================
+// FMemMark
+// ============================================================================
+
+FMemMark::FMemMark(FMemStack& InMem)
+    : Mem(InMem)
+{
+    // Rewind a stale stack first so the mark does not keep last frame's memory
+    if (Mem.NumMarks == 0 && Mem.LocalFrame != FMemStack::FrameNumber.load(std::memory_order_relaxed)) {
+        Mem.BeginFrame();
+    }
+    SavedTop = Mem.Top;
+    SavedChunk = Mem.TopChunk;
+    ++Mem.NumMarks;
+}
+
+void FMemMark::Pop() {
+    if (bPopped) {
+        return;
+    }
+    bPopped = true;
+
+    if (Mem.TopChunk != SavedChunk) {
+        Mem.FreeChunks(SavedChunk);
+    }
+    Mem.Top = SavedTop;
+    --Mem.NumMarks;
+}
+
+} // namespace MonsterRender
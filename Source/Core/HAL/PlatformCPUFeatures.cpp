@@ -0,0 +1,137 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// MonsterEngine - Runtime CPU Feature Detection Implementation
+
+#include "Core/HAL/PlatformCPUFeatures.h"
+
+#include <string>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define MR_CPUID_X86 1
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#else
+    #define MR_CPUID_X86 0
+#endif
+
+namespace MonsterRender {
+
+namespace {
+
+#if MR_CPUID_X86
+    void QueryCPUID(uint32 Leaf, uint32 SubLeaf, uint32 OutRegisters[4]) {
+#if defined(_MSC_VER)
+        int Registers[4];
+        __cpuidex(Registers, static_cast<int>(Leaf), static_cast<int>(SubLeaf));
+        for (int32 i = 0; i < 4; ++i) {
+            OutRegisters[i] = static_cast<uint32>(Registers[i]);
+        }
+#else
+        __cpuid_count(Leaf, SubLeaf, OutRegisters[0], OutRegisters[1], OutRegisters[2], OutRegisters[3]);
+#endif
+    }
+
+    uint64 ReadXCR0() {
+#if defined(_MSC_VER)
+        return _xgetbv(0);
+#else
+        // Encoded directly so the file needs no -mxsave
+        uint32 Low = 0;
+        uint32 High = 0;
+        __asm__ volatile(".byte 0x0f, 0x01, 0xd0" : "=a"(Low), "=d"(High) : "c"(0));
+        return (static_cast<uint64>(High) << 32) | Low;
+#endif
+    }
+
+    uint32 DetectFeatureBits() {
+        using F = FPlatformCPUFeatures;
+
+        uint32 Regs[4];  // EAX, EBX, ECX, EDX
+        QueryCPUID(0, 0, Regs);
+        const uint32 MaxLeaf = Regs[0];
+        if (MaxLeaf < 1) {
+            return 0;
+        }
+
+        uint32 Bits = 0;
+        QueryCPUID(1, 0, Regs);
+        const uint32 Leaf1ECX = Regs[2];
+        const uint32 Leaf1EDX = Regs[3];
+        if (Leaf1EDX & (1u << 26)) Bits |= F::SSE2;
+        if (Leaf1ECX & (1u << 19)) Bits |= F::SSE41;
+        if (Leaf1ECX & (1u << 20)) Bits |= F::SSE42;
+        if (Leaf1ECX & (1u << 23)) Bits |= F::POPCNT;
+
+        // AVX state is only usable if the OS enabled XSAVE and saves XMM|YMM
+        const bool bOSXSave = (Leaf1ECX & (1u << 27)) != 0;
+        const uint64 XCR0 = bOSXSave ? ReadXCR0() : 0;
+        const bool bOSSavesYMM = (XCR0 & 0x6) == 0x6;
+        const bool bOSSavesZMM = (XCR0 & 0xE6) == 0xE6;
+
+        if (bOSSavesYMM && (Leaf1ECX & (1u << 28))) Bits |= F::AVX;
+        if (bOSSavesYMM && (Leaf1ECX & (1u << 12))) Bits |= F::FMA3;
+
+        if (MaxLeaf >= 7) {
+            QueryCPUID(7, 0, Regs);
+            const uint32 Leaf7EBX = Regs[1];
+            if (Leaf7EBX & (1u << 8)) Bits |= F::BMI2;
+            if ((Bits & F::AVX) && (Leaf7EBX & (1u << 5))) Bits |= F::AVX2;
+            if (bOSSavesZMM) {
+                if (Leaf7EBX & (1u << 16)) Bits |= F::AVX512F;
+                if (Leaf7EBX & (1u << 17)) Bits |= F::AVX512DQ;
+                if (Leaf7EBX & (1u << 30)) Bits |= F::AVX512BW;
+                if (Leaf7EBX & (1u << 31)) Bits |= F::AVX512VL;
+            }
+        }
+
+        return Bits;
+    }
+#else
+    uint32 DetectFeatureBits() {
+        return 0;
+    }
+#endif
+
+    std::string BuildFeatureString(uint32 Bits) {
+        static const struct { uint32 Bit; const char* Name; } Names[] = {
+            { FPlatformCPUFeatures::SSE2, "SSE2" },
+            { FPlatformCPUFeatures::SSE41, "SSE4.1" },
+            { FPlatformCPUFeatures::SSE42, "SSE4.2" },
+            { FPlatformCPUFeatures::POPCNT, "POPCNT" },
+            { FPlatformCPUFeatures::AVX, "AVX" },
+            { FPlatformCPUFeatures::AVX2, "AVX2" },
+            { FPlatformCPUFeatures::FMA3, "FMA3" },
+            { FPlatformCPUFeatures::BMI2, "BMI2" },
+            { FPlatformCPUFeatures::AVX512F, "AVX512F" },
+            { FPlatformCPUFeatures::AVX512BW, "AVX512BW" },
+            { FPlatformCPUFeatures::AVX512DQ, "AVX512DQ" },
+            { FPlatformCPUFeatures::AVX512VL, "AVX512VL" },
+        };
+
+        std::string Result;
+        for (const auto& Entry : Names) {
+            if (Bits & Entry.Bit) {
+                if (!Result.empty()) {
+                    Result += ' ';
+                }
+                Result += Entry.Name;
+            }
+        }
+        return Result.empty() ? std::string("None") : Result;
+    }
+
+} // namespace
+
+uint32 FPlatformCPUFeatures::GetFeatureBits() {
+    static const uint32 FeatureBits = DetectFeatureBits();
+    return FeatureBits;
+}
+
+const char* FPlatformCPUFeatures::GetFeatureString() {
+    static const std::string FeatureString = BuildFeatureString(GetFeatureBits());
+    return FeatureString.c_str();
+}
+
+} // namespace MonsterRender
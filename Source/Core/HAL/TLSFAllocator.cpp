@@ -0,0 +1,335 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// MonsterEngine - Two-Level Segregated Fit Range Allocator Implementation
+
+#include "Core/HAL/TLSFAllocator.h"
+#include <bit>
+
+namespace MonsterRender {
+
+namespace {
+    FORCEINLINE uint64 AlignUp(uint64 Value, uint64 Alignment) {
+        return (Value + Alignment - 1) & ~(Alignment - 1);
+    }
+
+    FORCEINLINE uint32 FloorLog2(uint64 Value) {
+        return static_cast<uint32>(std::bit_width(Value) - 1);
+    }
+}
+
+FTLSFAllocator::FTLSFAllocator(uint64 Size, uint64 InGranularity) {
+    Initialize(Size, InGranularity);
+}
+
+void FTLSFAllocator::Initialize(uint64 Size, uint64 InGranularity) {
+    Granularity = InGranularity < 1 ? 1 : std::bit_ceil(InGranularity);
+    TotalSize = Size & ~(Granularity - 1);
+    Reset();
+}
+
+void FTLSFAllocator::Reset() {
+    Blocks.clear();
+    UnusedBlocks.clear();
+    FLBitmap = 0;
+    for (uint32 FL = 0; FL < FL_COUNT; ++FL) {
+        SLBitmap[FL] = 0;
+        for (uint32 SL = 0; SL < SL_COUNT; ++SL) {
+            FreeHeads[FL][SL] = NONE;
+        }
+    }
+    UsedSize = 0;
+    NumAllocations = 0;
+    NumFreeBlocks = 0;
+
+    if (TotalSize > 0) {
+        InsertFreeBlock(CreateBlock(0, TotalSize));
+    }
+}
+
+void FTLSFAllocator::MappingInsert(uint64 Size, uint32& OutFL, uint32& OutSL) {
+    if (Size < SL_COUNT) {
+        // Small sizes: one list per size in the first level
+        OutFL = 0;
+        OutSL = static_cast<uint32>(Size);
+    } else {
+        const uint32 Log2 = FloorLog2(Size);
+        OutSL = static_cast<uint32>(Size >> (Log2 - SL_BITS)) ^ SL_COUNT;
+        OutFL = Log2 - SL_BITS + 1;
+    }
+}
+
+FTLSFAllocation FTLSFAllocator::Allocate(uint64 Size, uint64 Alignment) {
+    FTLSFAllocation Result;
+    if (Size == 0 || Size > GetFreeSize()) {
+        return Result;
+    }
+
+    Size = AlignUp(Size, Granularity);
+    Alignment = Alignment > Granularity ? Alignment : Granularity;
+
+    // A block of the size class may already be aligned well enough; otherwise
+    // any block large enough for the worst-case padding holds the range
+    uint32 Index = FindFreeBlock(Size);
+    if (Index != NONE && AlignUp(Blocks[Index].Offset, Alignment) + Size > Blocks[Index].Offset + Blocks[Index].Size) {
+        Index = FindFreeBlock(Size + (Alignment - Granularity));
+    }
+    if (Index == NONE) {
+        return Result;
+    }
+    RemoveFreeBlock(Index);
+
+    // Give the padding in front back as a free block of its own
+    const uint64 Padding = AlignUp(Blocks[Index].Offset, Alignment) - Blocks[Index].Offset;
+    if (Padding > 0) {
+        const uint32 Front = CreateBlock(Blocks[Index].Offset, Padding);
+        Blocks[Front].PrevPhysical = Blocks[Index].PrevPhysical;
+        Blocks[Front].NextPhysical = Index;
+        if (Blocks[Index].PrevPhysical != NONE) {
+            Blocks[Blocks[Index].PrevPhysical].NextPhysical = Front;
+        }
+        Blocks[Index].PrevPhysical = Front;
+        Blocks[Index].Offset += Padding;
+        Blocks[Index].Size -= Padding;
+        InsertFreeBlock(Front);
+    }
+
+    // And the tail
+    if (Blocks[Index].Size > Size) {
+        const uint32 Back = CreateBlock(Blocks[Index].Offset + Size, Blocks[Index].Size - Size);
+        Blocks[Back].PrevPhysical = Index;
+        Blocks[Back].NextPhysical = Blocks[Index].NextPhysical;
+        if (Blocks[Index].NextPhysical != NONE) {
+            Blocks[Blocks[Index].NextPhysical].PrevPhysical = Back;
+        }
+        Blocks[Index].NextPhysical = Back;
+        Blocks[Index].Size = Size;
+        InsertFreeBlock(Back);
+    }
+
+    UsedSize += Size;
+    ++NumAllocations;
+
+    Result.Offset = Blocks[Index].Offset;
+    Result.Size = Size;
+    Result.Handle = Index;
+    return Result;
+}
+
+void FTLSFAllocator::Free(uint32 Handle) {
+    if (Handle >= Blocks.size() || Blocks[Handle].bFree) {
+        return;
+    }
+
+    uint32 Index = Handle;
+    UsedSize -= Blocks[Index].Size;
+    --NumAllocations;
+
+    // Merge with the free neighbours; free blocks never touch each other
+    const uint32 Prev = Blocks[Index].PrevPhysical;
+    if (Prev != NONE && Blocks[Prev].bFree) {
+        RemoveFreeBlock(Prev);
+        Blocks[Prev].Size += Blocks[Index].Size;
+        Blocks[Prev].NextPhysical = Blocks[Index].NextPhysical;
+        if (Blocks[Index].NextPhysical != NONE) {
+            Blocks[Blocks[Index].NextPhysical].PrevPhysical = Prev;
+        }
+        ReleaseBlock(Index);
+        Index = Prev;
+    }
+
+    const uint32 Next = Blocks[Index].NextPhysical;
+    if (Next != NONE && Blocks[Next].bFree) {
+        RemoveFreeBlock(Next);
+        Blocks[Index].Size += Blocks[Next].Size;
+        Blocks[Index].NextPhysical = Blocks[Next].NextPhysical;
+        if (Blocks[Next].NextPhysical != NONE) {
+            Blocks[Blocks[Next].NextPhysical].PrevPhysical = Index;
+        }
+        ReleaseBlock(Next);
+    }
+
+    InsertFreeBlock(Index);
+}
+
+uint64 FTLSFAllocator::GetLargestFreeBlock() const {
+    if (FLBitmap == 0) {
+        return 0;
+    }
+    const uint32 FL = FloorLog2(FLBitmap);
+    const uint32 SL = FloorLog2(SLBitmap[FL]);
+
+    uint64 Largest = 0;
+    for (uint32 Index = FreeHeads[FL][SL]; Index != NONE; Index = Blocks[Index].NextFree) {
+        Largest = Blocks[Index].Size > Largest ? Blocks[Index].Size : Largest;
+    }
+    return Largest;
+}
+
+float FTLSFAllocator::GetFragmentation() const {
+    const uint64 FreeSize = GetFreeSize();
+    if (FreeSize == 0) {
+        return 0.0f;
+    }
+    return 1.0f - static_cast<float>(static_cast<double>(GetLargestFreeBlock()) / static_cast<double>(FreeSize));
+}
+
+bool FTLSFAllocator::Validate() const {
+    // Walk the region from the block at offset 0
+    uint32 First = NONE;
+    for (uint32 Index = 0; Index < Blocks.size(); ++Index) {
+        if (Blocks[Index].Size > 0 && Blocks[Index].PrevPhysical == NONE) {
+            if (First != NONE) {
+                return false;
+            }
+            First = Index;
+        }
+    }
+
+    uint64 ExpectedOffset = 0;
+    uint64 FreeBytes = 0;
+    uint32 FreeBlocks = 0;
+    uint32 UsedBlocks = 0;
+    for (uint32 Index = First, Prev = NONE; Index != NONE; Prev = Index, Index = Blocks[Index].NextPhysical) {
+        const FBlock& Block = Blocks[Index];
+        if (Block.Offset != ExpectedOffset || Block.PrevPhysical != Prev || Block.Size == 0) {
+            return false;
+        }
+        if (Block.bFree) {
+            if (Prev != NONE && Blocks[Prev].bFree) {
+                return false;
+            }
+            FreeBytes += Block.Size;
+            ++FreeBlocks;
+        } else {
+            ++UsedBlocks;
+        }
+        ExpectedOffset += Block.Size;
+    }
+    if (ExpectedOffset != TotalSize || FreeBytes != GetFreeSize() ||
+        FreeBlocks != NumFreeBlocks || UsedBlocks != NumAllocations) {
+        return false;
+    }
+
+    // Every free block sits in the list its size maps to, and bitmaps match the lists
+    uint32 ListedBlocks = 0;
+    for (uint32 FL = 0; FL < FL_COUNT; ++FL) {
+        if (((FLBitmap >> FL) & 1) != (SLBitmap[FL] != 0 ? 1u : 0u)) {
+            return false;
+        }
+        for (uint32 SL = 0; SL < SL_COUNT; ++SL) {
+            if (((SLBitmap[FL] >> SL) & 1) != (FreeHeads[FL][SL] != NONE ? 1u : 0u)) {
+                return false;
+            }
+            for (uint32 Index = FreeHeads[FL][SL]; Index != NONE; Index = Blocks[Index].NextFree) {
+                uint32 BlockFL, BlockSL;
+                MappingInsert(Blocks[Index].Size, BlockFL, BlockSL);
+                if (!Blocks[Index].bFree || BlockFL != FL || BlockSL != SL) {
+                    return false;
+                }
+                ++ListedBlocks;
+            }
+        }
+    }
+    return ListedBlocks == NumFreeBlocks;
+}
+
+uint32 FTLSFAllocator::CreateBlock(uint64 Offset, uint64 Size) {
+    uint32 Index;
+    if (!UnusedBlocks.empty()) {
+        Index = UnusedBlocks.back();
+        UnusedBlocks.pop_back();
+    } else {
+        Index = static_cast<uint32>(Blocks.size());
+        Blocks.emplace_back();
+    }
+
+    FBlock& Block = Blocks[Index];
+    Block.Offset = Offset;
+    Block.Size = Size;
+    Block.PrevPhysical = NONE;
+    Block.NextPhysical = NONE;
+    Block.PrevFree = NONE;
+    Block.NextFree = NONE;
+    Block.bFree = false;
+    return Index;
+}
+
+void FTLSFAllocator::ReleaseBlock(uint32 Index) {
+    Blocks[Index].Size = 0;
+    Blocks[Index].bFree = true;     // Stale handles are ignored by Free
+    Blocks[Index].PrevPhysical = NONE;
+    UnusedBlocks.push_back(Index);
+}
+
+uint32 FTLSFAllocator::FindFreeBlock(uint64 Size) const {
+    // Round up to the next list boundary so every block found is large enough
+    if (Size >= SL_COUNT) {
+        const uint64 Round = (uint64(1) << (FloorLog2(Size) - SL_BITS)) - 1;
+        if (Size > ~uint64(0) - Round) {
+            return NONE;
+        }
+        Size += Round;
+    }
+
+    uint32 FL, SL;
+    MappingInsert(Size, FL, SL);
+    if (FL >= FL_COUNT) {
+        return NONE;
+    }
+
+    uint32 SLMap = SLBitmap[FL] & (~0u << SL);
+    if (SLMap == 0) {
+        const uint64 FLMap = FL + 1 < 64 ? FLBitmap & (~uint64(0) << (FL + 1)) : 0;
+        if (FLMap == 0) {
+            return NONE;
+        }
+        FL = static_cast<uint32>(std::countr_zero(FLMap));
+        SLMap = SLBitmap[FL];
+    }
+    SL = static_cast<uint32>(std::countr_zero(SLMap));
+    return FreeHeads[FL][SL];
+}
+
+void FTLSFAllocator::InsertFreeBlock(uint32 Index) {
+    uint32 FL, SL;
+    MappingInsert(Blocks[Index].Size, FL, SL);
+
+    FBlock& Block = Blocks[Index];
+    Block.bFree = true;
+    Block.PrevFree = NONE;
+    Block.NextFree = FreeHeads[FL][SL];
+    if (Block.NextFree != NONE) {
+        Blocks[Block.NextFree].PrevFree = Index;
+    }
+    FreeHeads[FL][SL] = Index;
+
+    FLBitmap |= uint64(1) << FL;
+    SLBitmap[FL] |= 1u << SL;
+    ++NumFreeBlocks;
+}
+
+void FTLSFAllocator::RemoveFreeBlock(uint32 Index) {
+    uint32 FL, SL;
+    MappingInsert(Blocks[Index].Size, FL, SL);
+
+    FBlock& Block = Blocks[Index];
+    if (Block.PrevFree != NONE) {
+        Blocks[Block.PrevFree].NextFree = Block.NextFree;
+    } else {
+        FreeHeads[FL][SL] = Block.NextFree;
+        if (Block.NextFree == NONE) {
+            SLBitmap[FL] &= ~(1u << SL);
+            if (SLBitmap[FL] == 0) {
+                FLBitmap &= ~(uint64(1) << FL);
+            }
+        }
+    }
+    if (Block.NextFree != NONE) {
+        Blocks[Block.NextFree].PrevFree = Block.PrevFree;
+    }
+    Block.bFree = false;
+    Block.PrevFree = NONE;
+    Block.NextFree = NONE;
+    --NumFreeBlocks;
+}
+
+} // namespace MonsterRender
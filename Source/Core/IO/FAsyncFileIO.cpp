@@ -96,6 +96,9 @@ uint64 FAsyncFileIO::ReadAsync(const FReadRequest& Request) {
     internalReq->Request = Request;
     internalReq->bCompleted = false;
 
+    // The worker may complete and free the request as soon as it is queued
+    const uint64 requestID = internalReq->RequestID;
+
     // Add to active requests
     {
         std::scoped_lock lock(ActiveRequestsMutex);
@@ -113,7 +116,7 @@ uint64 FAsyncFileIO::ReadAsync(const FReadRequest& Request) {
 
     TotalRequests.fetch_add(1, std::memory_order_relaxed);
 
-    return internalReq->RequestID;
+    return requestID;
 }
 
 bool FAsyncFileIO::WaitForRequest(uint64 RequestID) {
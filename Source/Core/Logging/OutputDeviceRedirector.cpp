@@ -1,4 +1,5 @@
 #include "Core/Logging/OutputDeviceRedirector.h"
+#include "Core/HAL/LowLevelMemTracker.h"
 #include <algorithm>
 #include <chrono>
 
@@ -99,6 +100,7 @@ void FOutputDeviceRedirector::Serialize(const char* Message, ELogVerbosity::Type
 
 void FOutputDeviceRedirector::Serialize(const char* Message, ELogVerbosity::Type Verbosity, const char* Category,
                                         double Time, const char* File, int32 Line) {
+    LLM_SCOPE(ELLMTag::Logging);
     // In panic mode, only use panic-safe devices
     if (m_bInPanicMode.load(std::memory_order_acquire)) {
         // Only the panic thread can log
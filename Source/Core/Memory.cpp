@@ -1,5 +1,6 @@
 #include "Core/CoreMinimal.h"
 #include "Core/Memory.h"
+#include "Core/HAL/LowLevelMemTracker.h"
 #include <malloc.h>
 #include <new>
 #include <algorithm>
@@ -17,6 +18,8 @@ namespace MonsterRender {
 
 	static constexpr size_t kSmallPageSize = 64ull * 1024ull; // 64KB pages for small bins
 	static constexpr uint32 kEmptyPageThreshold = 4;  // Trim if this many empty pages exist
+	static constexpr uint64 kTextureGranularity = 256;  // Texture offsets are multiples of this (GPU alignment)
+	static constexpr size_t kTextureBaseAlignment = 64 * 1024;  // Block base alignment, so aligned offsets are aligned addresses
 
 	static uint8* alignPtr(uint8* ptr, size_t alignment) {
 		const size_t mask = alignment - 1;
@@ -57,6 +60,7 @@ namespace MonsterRender {
 		// Texture pool
 		m_textureBlockSize = texturePoolBlockSizeBytes;
 		m_textureBlocks.clear();
+		m_textureLiveAllocations.Empty();
 		m_textureReservedBytes.store(0, std::memory_order_relaxed);
 		m_textureUsedBytes.store(0, std::memory_order_relaxed);
 
@@ -93,13 +97,6 @@ namespace MonsterRender {
 		{
 			std::scoped_lock lock(m_textureBlocksMutex);
 			for (auto& block : m_textureBlocks) {
-				// Free all free-list regions
-				TextureFreeRegion* region = block->freeList;
-				while (region) {
-					TextureFreeRegion* next = region->next;
-					::free(region);
-					region = next;
-				}
 				// Free huge pages if used
 				if (block->usesHugePages && block->rawHugePagePtr) {
 					freeHugePages(block->rawHugePagePtr, static_cast<size_t>(block->capacity));
@@ -107,6 +104,7 @@ namespace MonsterRender {
 				}
 			}
 			m_textureBlocks.clear();
+			m_textureLiveAllocations.Empty();
 		}
 		m_textureReservedBytes.store(0, std::memory_order_relaxed);
 		m_textureUsedBytes.store(0, std::memory_order_relaxed);
@@ -278,11 +276,18 @@ namespace MonsterRender {
 		const uint32 binIndex = selectSmallBin(size);
 		ThreadLocalCache* tlsCache = getTLSCache();
 		auto& bin = m_smallBins[binIndex];
-		return allocateFromBin(bin, alignment, tlsCache);
+		void* ptr = allocateFromBin(bin, alignment, tlsCache);
+		if (FLowLevelMemTracker::IsEnabled()) {
+			FLowLevelMemTracker::OnAlloc(ELLMTracker::Default, ptr, size);
+		}
+		return ptr;
 	}
 
 	void MemorySystem::freeSmall(void* ptr, size_t size) {
 		if (!ptr) return;
+		if (FLowLevelMemTracker::IsEnabled()) {
+			FLowLevelMemTracker::OnFree(ELLMTracker::Default, ptr);
+		}
 		const uint32 binIndex = selectSmallBin(size);
 		ThreadLocalCache* tlsCache = getTLSCache();
 		freeToBin(m_smallBins[binIndex], ptr, tlsCache);
@@ -294,7 +299,11 @@ namespace MonsterRender {
 		}
 		// Use standard malloc for debug heap compatibility
 		(void)alignment; // Alignment ignored for large allocations with malloc
-		return std::malloc(size);
+		void* ptr = std::malloc(size);
+		if (FLowLevelMemTracker::IsEnabled()) {
+			FLowLevelMemTracker::OnAlloc(ELLMTracker::Default, ptr, size);
+		}
+		return ptr;
 	}
 
 	void MemorySystem::free(void* ptr, size_t size) {
@@ -303,6 +312,9 @@ namespace MonsterRender {
 			freeSmall(ptr, size);
 			return;
 		}
+		if (FLowLevelMemTracker::IsEnabled()) {
+			FLowLevelMemTracker::OnFree(ELLMTracker::Default, ptr);
+		}
 		// Use standard free for debug heap compatibility
 		std::free(ptr);
 	}
@@ -345,112 +357,45 @@ namespace MonsterRender {
 		m_frameScratch.offset.store(0, std::memory_order_relaxed);
 	}
 
-	// Texture free-list helpers
-	void* MemorySystem::allocateFromFreeList(TextureBlock& block, size_t size, size_t alignment) {
-		std::scoped_lock lock(block.mutex);
-		TextureFreeRegion* prev = nullptr;
-		TextureFreeRegion* region = block.freeList;
-		uint8* basePtr = block.usesHugePages ? block.rawHugePagePtr : block.buffer.get();
-		
-		while (region) {
-			uint64 alignedOffset = static_cast<uint64>(alignUp(static_cast<size_t>(region->offset), alignment));
-			if (alignedOffset + size <= region->offset + region->size) {
-				// Found a suitable region
-				void* ptr = basePtr + alignedOffset;
-				// Split region if there's leftover space
-				uint64 usedSize = (alignedOffset - region->offset) + size;
-				if (region->size > usedSize + 64) {  // Keep region if >64B left
-					region->offset += usedSize;
-					region->size -= usedSize;
-				} else {
-					// Remove region from list
-					if (prev) {
-						prev->next = region->next;
-					} else {
-						block.freeList = region->next;
-					}
-					::free(region);
-				}
-				block.usedBytes.fetch_add(size, std::memory_order_relaxed);
-				m_textureUsedBytes.fetch_add(size, std::memory_order_relaxed);
-				return ptr;
-			}
-			prev = region;
-			region = region->next;
+	// Texture block helpers
+	void* MemorySystem::allocateFromTextureBlock(uint32 blockIndex, size_t size, size_t alignment) {
+		TextureBlock& block = *m_textureBlocks[blockIndex];
+		const FTLSFAllocation range = block.allocator.Allocate(size, alignment);
+		if (!range.IsValid()) {
+			return nullptr;
 		}
-		return nullptr;
-	}
 
-	void MemorySystem::addToFreeList(TextureBlock& block, void* ptr, size_t size) {
-		std::scoped_lock lock(block.mutex);
-		uint8* basePtr = block.usesHugePages ? block.rawHugePagePtr : block.buffer.get();
-		uint64 offset = static_cast<uint8*>(ptr) - basePtr;
-		// Use system malloc for internal structures to avoid circular dependency
-		auto* newRegion = static_cast<TextureFreeRegion*>(::malloc(sizeof(TextureFreeRegion)));
-		newRegion->offset = offset;
-		newRegion->size = size;
-		newRegion->next = nullptr;
-		// Insert sorted by offset
-		if (!block.freeList || block.freeList->offset > offset) {
-			newRegion->next = block.freeList;
-			block.freeList = newRegion;
-		} else {
-			TextureFreeRegion* current = block.freeList;
-			while (current->next && current->next->offset < offset) {
-				current = current->next;
-			}
-			newRegion->next = current->next;
-			current->next = newRegion;
-		}
-		block.usedBytes.fetch_sub(size, std::memory_order_relaxed);
-		m_textureUsedBytes.fetch_sub(size, std::memory_order_relaxed);
-	}
-
-	void MemorySystem::mergeFreeRegions(TextureBlock& block) {
-		std::scoped_lock lock(block.mutex);
-		TextureFreeRegion* current = block.freeList;
-		while (current && current->next) {
-			// Check if current and next are adjacent
-			if (current->offset + current->size == current->next->offset) {
-				// Merge
-				TextureFreeRegion* next = current->next;
-				current->size += next->size;
-				current->next = next->next;
-				::free(next);
-			} else {
-				current = current->next;
-			}
+		void* ptr = block.base + range.Offset;
+
+		TextureAllocation allocation;
+		allocation.blockIndex = blockIndex;
+		allocation.handle = range.Handle;
+		allocation.size = size;
+		m_textureLiveAllocations.Add(ptr, allocation);
+
+		block.usedBytes.fetch_add(size, std::memory_order_relaxed);
+		m_textureUsedBytes.fetch_add(size, std::memory_order_relaxed);
+		if (FLowLevelMemTracker::IsEnabled()) {
+			FLowLevelMemTracker::OnAlloc(ELLMTracker::Default, ptr, size);
 		}
+		return ptr;
 	}
 
 	void* MemorySystem::textureAllocate(size_t size, size_t alignment) {
 		const size_t alignedSize = alignUp(size, alignment);
 		m_textureAllocations.fetch_add(1, std::memory_order_relaxed);
 
-		// Try to allocate from free-lists first
-		for (auto& block : m_textureBlocks) {
-			void* ptr = allocateFromFreeList(*block, alignedSize, alignment);
-			if (ptr) return ptr;
-		}
+		std::scoped_lock lock(m_textureBlocksMutex);
 
-		// Try bump allocation
-		for (auto& block : m_textureBlocks) {
-			uint64 off = block->offset.load(std::memory_order_relaxed);
-			uint64 alignedOff = static_cast<uint64>(alignUp(static_cast<size_t>(off), alignment));
-			uint64 next = alignedOff + alignedSize;
-			if (next <= block->capacity) {
-				if (block->offset.compare_exchange_weak(off, next, std::memory_order_acq_rel)) {
-					block->usedBytes.fetch_add(alignedSize, std::memory_order_relaxed);
-					m_textureUsedBytes.fetch_add(alignedSize, std::memory_order_relaxed);
-					uint8* basePtr = block->usesHugePages ? block->rawHugePagePtr : block->buffer.get();
-					return basePtr + alignedOff;
-				}
+		// Constant-time fit in each existing block
+		for (uint32 i = 0; i < static_cast<uint32>(m_textureBlocks.size()); ++i) {
+			if (void* ptr = allocateFromTextureBlock(i, alignedSize, alignment)) {
+				return ptr;
 			}
 		}
 
 		// Allocate new block
-		std::scoped_lock lock(m_textureBlocksMutex);
-		uint64 blockSize = std::max<uint64>(m_textureBlockSize, alignedSize);
+		uint64 blockSize = std::max<uint64>(m_textureBlockSize, alignUp(alignedSize, static_cast<size_t>(kTextureGranularity)));
 		
 		// Try huge pages first if enabled and size >= 2MB
 		void* hugePagePtr = nullptr;
@@ -470,65 +415,59 @@ namespace MonsterRender {
 		if (usedHugePages) {
 			// Store huge page pointer
 			block->rawHugePagePtr = reinterpret_cast<uint8*>(hugePagePtr);
+			block->base = block->rawHugePagePtr;
 		} else {
-			// Standard allocation
-			block->buffer = MakeUnique<uint8[]>(static_cast<size_t>(blockSize));
+			// Standard allocation, padded so the base can be aligned
+			block->buffer = MakeUnique<uint8[]>(static_cast<size_t>(blockSize) + kTextureBaseAlignment);
+			block->base = reinterpret_cast<uint8*>(alignUp(reinterpret_cast<size_t>(block->buffer.get()), kTextureBaseAlignment));
 		}
 		
-		block->offset.store(0, std::memory_order_relaxed);
+		block->allocator.Initialize(blockSize, kTextureGranularity);
 		block->usedBytes.store(0, std::memory_order_relaxed);
-		block->freeList = nullptr;
-		
-		void* ptr = block->usesHugePages ? block->rawHugePagePtr : block->buffer.get();
-		block->offset.store(alignedSize, std::memory_order_relaxed);
-		block->usedBytes.store(alignedSize, std::memory_order_relaxed);
 		m_textureReservedBytes.fetch_add(blockSize, std::memory_order_relaxed);
-		m_textureUsedBytes.fetch_add(alignedSize, std::memory_order_relaxed);
 		m_textureBlocks.push_back(std::move(block));
-		return ptr;
+
+		return allocateFromTextureBlock(static_cast<uint32>(m_textureBlocks.size() - 1), alignedSize, alignment);
 	}
 
 	void MemorySystem::textureFree(void* ptr) {
 		if (!ptr) return;
+
+		std::scoped_lock lock(m_textureBlocksMutex);
+		TextureAllocation* found = m_textureLiveAllocations.Find(ptr);
+		if (!found) {
+			MR_LOG_WARNING("textureFree: pointer not found in texture blocks");
+			return;
+		}
+
 		m_textureFrees.fetch_add(1, std::memory_order_relaxed);
-		
-		// Find which block owns this pointer
-		for (auto& block : m_textureBlocks) {
-			uint8* basePtr = block->usesHugePages ? block->rawHugePagePtr : block->buffer.get();
-			uint8* blockStart = basePtr;
-			uint8* blockEnd = blockStart + block->capacity;
-			if (reinterpret_cast<uint8*>(ptr) >= blockStart && reinterpret_cast<uint8*>(ptr) < blockEnd) {
-				// TODO: Track allocation size for proper free
-				// For now, just add to free-list with placeholder size
-				MR_LOG_WARNING("textureFree: allocation size tracking not yet implemented");
-				return;
-			}
+		if (FLowLevelMemTracker::IsEnabled()) {
+			FLowLevelMemTracker::OnFree(ELLMTracker::Default, ptr);
 		}
-		MR_LOG_WARNING("textureFree: pointer not found in texture blocks");
+
+		// Back to the block's allocator, merged with free neighbours
+		TextureBlock& block = *m_textureBlocks[found->blockIndex];
+		block.allocator.Free(found->handle);
+		block.usedBytes.fetch_sub(found->size, std::memory_order_relaxed);
+		m_textureUsedBytes.fetch_sub(found->size, std::memory_order_relaxed);
+		m_textureLiveAllocations.Remove(ptr);
 	}
 
 	void MemorySystem::textureReleaseAll() {
 		std::scoped_lock lock(m_textureBlocksMutex);
 		for (auto& block : m_textureBlocks) {
-			block->offset.store(0, std::memory_order_relaxed);
-			block->usedBytes.store(0, std::memory_order_relaxed);
-			// Free all free-list regions
-			TextureFreeRegion* region = block->freeList;
-			while (region) {
-				TextureFreeRegion* next = region->next;
-				::free(region);
-				region = next;
+			if (FLowLevelMemTracker::IsEnabled()) {
+				FLowLevelMemTracker::OnFreeRange(ELLMTracker::Default, block->base, block->capacity);
 			}
-			block->freeList = nullptr;
+			block->allocator.Reset();
+			block->usedBytes.store(0, std::memory_order_relaxed);
 		}
+		m_textureLiveAllocations.Empty();
 		m_textureUsedBytes.store(0, std::memory_order_relaxed);
 	}
 
 	void MemorySystem::compactTextureBlocks() {
-		std::scoped_lock lock(m_textureBlocksMutex);
-		for (auto& block : m_textureBlocks) {
-			mergeFreeRegions(*block);
-		}
+		// Nothing to merge: the TLSF allocators coalesce free regions as they are freed
 	}
 
 	void MemorySystem::trimEmptyPages() {
@@ -605,20 +544,19 @@ namespace MonsterRender {
 		// Texture pool
 		stats.textureReservedBytes = m_textureReservedBytes.load(std::memory_order_relaxed);
 		stats.textureUsedBytes = m_textureUsedBytes.load(std::memory_order_relaxed);
-		stats.textureBlockCount = m_textureBlocks.size();
 		stats.textureAllocations = m_textureAllocations.load(std::memory_order_relaxed);
 		stats.textureFrees = m_textureFrees.load(std::memory_order_relaxed);
 		
 		// Count free regions
-		uint64 freeRegions = 0;
-		for (const auto& block : m_textureBlocks) {
-			TextureFreeRegion* region = block->freeList;
-			while (region) {
-				++freeRegions;
-				region = region->next;
+		{
+			std::scoped_lock lock(m_textureBlocksMutex);
+			stats.textureBlockCount = m_textureBlocks.size();
+			uint64 freeRegions = 0;
+			for (const auto& block : m_textureBlocks) {
+				freeRegions += block->allocator.GetNumFreeBlocks();
 			}
+			stats.textureFreeRegions = freeRegions;
 		}
-		stats.textureFreeRegions = freeRegions;
 
 		// Overall
 		stats.totalAllocatedBytes = stats.smallAllocatedBytes + stats.frameAllocatedBytes + stats.textureUsedBytes;
@@ -704,6 +642,17 @@ namespace MonsterRender {
 			}
 		}
 		fclose(fp);
+
+		// Transparent huge pages work without a reserved pool when mappings may opt in
+		if (!found) {
+			fp = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+			if (fp) {
+				if (fgets(line, sizeof(line), fp)) {
+					found = strstr(line, "[always]") || strstr(line, "[madvise]");
+				}
+				fclose(fp);
+			}
+		}
 		return found;
 
 #else
@@ -751,11 +700,33 @@ namespace MonsterRender {
 		if (ptr != MAP_FAILED) {
 			MR_LOG_DEBUG("Allocated " + std::to_string(size / 1024 / 1024) + "MB with huge pages (Linux)");
 			return ptr;
-		} else {
+		}
+
+		// No reserved hugetlb pages: map a huge-page-aligned range and ask for transparent huge pages
+		const size_t mappedSize = size + MR_HUGE_PAGE_SIZE;
+		void* raw = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (raw == MAP_FAILED) {
 			MR_LOG_WARNING("Failed to allocate huge pages, falling back to normal allocation");
 			return nullptr;
 		}
 
+		uint8* rawBytes = static_cast<uint8*>(raw);
+		uint8* aligned = reinterpret_cast<uint8*>(alignUp(reinterpret_cast<size_t>(rawBytes), MR_HUGE_PAGE_SIZE));
+		if (aligned > rawBytes) {
+			munmap(rawBytes, aligned - rawBytes);
+		}
+		const size_t tailSize = (rawBytes + mappedSize) - (aligned + size);
+		if (tailSize > 0) {
+			munmap(aligned + size, tailSize);
+		}
+
+		if (madvise(aligned, size, MADV_HUGEPAGE) != 0) {
+			MR_LOG_WARNING("MADV_HUGEPAGE rejected, texture block uses normal pages");
+		} else {
+			MR_LOG_DEBUG("Allocated " + std::to_string(size / 1024 / 1024) + "MB with transparent huge pages (Linux)");
+		}
+		return aligned;
+
 #else
 		return nullptr;
 #endif
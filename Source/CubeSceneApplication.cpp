@@ -355,6 +355,8 @@ void CubeSceneApplication::onRender()
     TArray<FLightSceneInfo*> lights;
     if (m_scene)
     {
+        // Keep the scene's float render data anchored near the camera
+        m_scene->UpdateRenderOrigin(cameraPosition);
         const TSparseArray<FLightSceneInfoCompact>& sceneLights = m_scene->GetLights();
         for (auto It = sceneLights.CreateConstIterator(); It; ++It)
         {
@@ -1689,6 +1691,8 @@ void CubeSceneApplication::renderSceneToViewport(
     TArray<FLightSceneInfo*> lights;
     if (m_scene)
     {
+        // Keep the scene's float render data anchored near the camera
+        m_scene->UpdateRenderOrigin(cameraPosition);
         const TSparseArray<FLightSceneInfoCompact>& sceneLights = m_scene->GetLights();
         for (auto It = sceneLights.CreateConstIterator(); It; ++It)
         {
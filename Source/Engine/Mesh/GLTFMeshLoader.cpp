@@ -19,6 +19,7 @@
 #include "Engine/Mesh/MeshLoader.h"
 #include "Engine/Mesh/MeshBuilder.h"
 #include "Core/Logging/LogMacros.h"
+#include "Core/HAL/LowLevelMemTracker.h"
 #include <sstream>
 #include <algorithm>
 #include <cstring>
@@ -415,6 +416,7 @@ EMeshLoadResult FGLTFMeshLoader::Load(
     FMeshBuilder& OutBuilder,
     const FMeshLoadOptions& Options)
 {
+    LLM_SCOPE(ELLMTag::Meshes);
     MR_LOG(LogGLTFLoader, Log, "Loading glTF file: %s", FilePath.c_str());
     
     // Get extension
@@ -465,6 +467,7 @@ EMeshLoadResult FGLTFMeshLoader::LoadFromMemory(
     FMeshBuilder& OutBuilder,
     const FMeshLoadOptions& Options)
 {
+    LLM_SCOPE(ELLMTag::Meshes);
     if (!Data || DataSize < 4)
     {
         return EMeshLoadResult::InvalidData;
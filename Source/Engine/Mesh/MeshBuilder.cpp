@@ -11,6 +11,7 @@
 #include "RHI/RHIResources.h"
 #include "RHI/RHIDefinitions.h"
 #include "Core/Logging/LogMacros.h"
+#include "Core/HAL/LowLevelMemTracker.h"
 #include <cmath>
 #include <algorithm>
 #include <cstring>
@@ -191,6 +192,7 @@ void FMeshBuilder::SetVertexColor(int32 VertexIndex, const FColor& Color)
  */
 void FMeshBuilder::ReserveVertices(int32 NumVertices)
 {
+    LLM_SCOPE(ELLMTag::MeshBuilder);
     Vertices.Reserve(Vertices.Num() + NumVertices);
 }
 
@@ -267,6 +269,7 @@ void FMeshBuilder::AddQuad(int32 V0, int32 V1, int32 V2, int32 V3, int32 Materia
  */
 void FMeshBuilder::ReserveTriangles(int32 NumTriangles)
 {
+    LLM_SCOPE(ELLMTag::MeshBuilder);
     Indices.Reserve(Indices.Num() + NumTriangles * 3);
     TriangleMaterials.Reserve(TriangleMaterials.Num() + NumTriangles);
 }
@@ -310,6 +313,7 @@ void FMeshBuilder::SetMaterialName(int32 MaterialIndex, const String& Name)
  */
 void FMeshBuilder::ComputeNormals()
 {
+    LLM_SCOPE(ELLMTag::MeshBuilder);
     if (Vertices.Num() == 0 || Indices.Num() == 0)
     {
         return;
@@ -430,6 +434,7 @@ void FMeshBuilder::ComputeFlatNormals()
  */
 void FMeshBuilder::ComputeTangents()
 {
+    LLM_SCOPE(ELLMTag::MeshBuilder);
     if (Vertices.Num() == 0 || Indices.Num() == 0)
     {
         return;
@@ -628,6 +633,7 @@ Math::FBox3f FMeshBuilder::ComputeBounds() const
  */
 FStaticMesh* FMeshBuilder::Build(IRHIDevice* Device, const String& MeshName)
 {
+    LLM_SCOPE(ELLMTag::MeshBuilder);
     if (!IsValid())
     {
         MR_LOG(LogMeshBuilder, Error, "Cannot build mesh '%s': invalid data", MeshName.c_str());
@@ -655,6 +661,7 @@ FStaticMesh* FMeshBuilder::Build(IRHIDevice* Device, const String& MeshName)
  */
 bool FMeshBuilder::BuildInto(IRHIDevice* Device, FStaticMesh& OutMesh)
 {
+    LLM_SCOPE(ELLMTag::MeshBuilder);
     if (!IsValid())
     {
         MR_LOG(LogMeshBuilder, Error, "Cannot build mesh: invalid data");
@@ -18,6 +18,7 @@
 #include "Engine/Mesh/MeshLoader.h"
 #include "Engine/Mesh/MeshBuilder.h"
 #include "Core/Logging/LogMacros.h"
+#include "Core/HAL/LowLevelMemTracker.h"
 #include <sstream>
 #include <algorithm>
 #include <cctype>
@@ -154,6 +155,7 @@ EMeshLoadResult FOBJMeshLoader::Load(
     FMeshBuilder& OutBuilder,
     const FMeshLoadOptions& Options)
 {
+    LLM_SCOPE(ELLMTag::Meshes);
     MR_LOG(LogOBJLoader, Log, "Loading OBJ file: %s", FilePath.c_str());
     
     // Read file content
@@ -176,6 +178,7 @@ EMeshLoadResult FOBJMeshLoader::LoadFromMemory(
     FMeshBuilder& OutBuilder,
     const FMeshLoadOptions& Options)
 {
+    LLM_SCOPE(ELLMTag::Meshes);
     if (!Data || DataSize == 0)
     {
         return EMeshLoadResult::InvalidData;
@@ -176,8 +176,7 @@ void FPrimitiveSceneInfo::UpdateTransform(const FMatrix& NewLocalToWorld, const
 {
     if (Proxy)
     {
-        Proxy->SetLocalToWorld(NewLocalToWorld);
-        Proxy->SetBounds(NewBounds);
+        Proxy->SetLocalToWorldAndBounds(NewLocalToWorld, NewBounds);
     }
 
     // Mark for visibility check
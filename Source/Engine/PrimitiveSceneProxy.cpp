@@ -26,6 +26,7 @@ FPrimitiveSceneProxy::FPrimitiveSceneProxy(const UPrimitiveComponent* InComponen
     , PrimitiveSceneInfo(nullptr)
     , Scene(nullptr)
     , LocalToWorld(FMatrix::Identity)
+    , WorldToLocal(FMatrix::Identity)
     , Bounds()
     , LocalBounds(ForceInit)
     , PrimitiveComponentId()
@@ -51,7 +52,9 @@ FPrimitiveSceneProxy::FPrimitiveSceneProxy(const UPrimitiveComponent* InComponen
     {
         // Copy properties from component
         LocalToWorld = InComponent->GetComponentToWorld();
+        WorldToLocal = LocalToWorld.Inverse();
         Bounds = InComponent->GetBounds();
+        LocalBounds = InComponent->CalcLocalBounds();
         Mobility = InComponent->GetMobility();
         MinDrawDistance = InComponent->GetMinDrawDistance();
         MaxDrawDistance = InComponent->GetLDMaxDrawDistance();
@@ -81,9 +84,15 @@ FPrimitiveSceneProxy::~FPrimitiveSceneProxy()
 // Transform
 // ============================================================================
 
+FVector FPrimitiveSceneProxy::GetRenderOrigin() const
+{
+    return Scene ? Scene->GetRenderOrigin() : FVector::ZeroVector;
+}
+
 void FPrimitiveSceneProxy::SetLocalToWorld(const FMatrix& InLocalToWorld)
 {
     LocalToWorld = InLocalToWorld;
+    WorldToLocal = LocalToWorld.Inverse();
     
     // Update bounds based on new transform
     if (LocalBounds.IsValidBox())
@@ -105,6 +114,22 @@ void FPrimitiveSceneProxy::SetLocalToWorld(const FMatrix& InLocalToWorld)
     }
 }
 
+void FPrimitiveSceneProxy::SetLocalToWorldAndBounds(const FMatrix& InLocalToWorld, const FBoxSphereBounds& InBounds)
+{
+    // The bounds are not rebuilt from LocalBounds: the scene has transformed them already
+    LocalToWorld = InLocalToWorld;
+    WorldToLocal = LocalToWorld.Inverse();
+    Bounds = InBounds;
+}
+
+void FPrimitiveSceneProxy::ApplyWorldOffset(const FVector& InOffset)
+{
+    // Translate only: the bounds keep their extent instead of being rebuilt from LocalBounds
+    LocalToWorld.SetOrigin(LocalToWorld.GetOrigin() + InOffset);
+    WorldToLocal = LocalToWorld.Inverse();
+    Bounds.Origin = Bounds.Origin + InOffset;
+}
+
 // ============================================================================
 // View Relevance
 // ============================================================================
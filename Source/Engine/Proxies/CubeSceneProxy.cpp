@@ -704,8 +704,12 @@ void FCubeSceneProxy::UpdateTransformBuffer(
 {
     FCubeLitUniformBuffer UBO;
     
-    // Model matrix from local to world transform
-    FMatrix ModelMatrix = GetLocalToWorld();
+    // Positions are uploaded relative to the scene's render origin: the model matrix
+    // comes from the compact float transform and the view is moved to the same origin,
+    // so Model * View is unchanged but stays precise far from the world origin
+    const FVector RenderOrigin = GetRenderOrigin();
+    const FMatrix44f ModelMatrix = GetRenderTransform().ToMatrix44f();
+    const FMatrix RelativeViewMatrix = FMatrix::MakeTranslation(RenderOrigin) * ViewMatrix;
     
     // DEBUG: Log matrix values - all 4 rows of View matrix
     MR_LOG(LogCubeSceneProxy, Log, "UpdateTransformBuffer:");
@@ -731,17 +735,17 @@ void FCubeSceneProxy::UpdateTransformBuffer(
     MatrixToFloatArray(ModelMatrix, UBO.Model);
     
     // View and projection matrices
-    MatrixToFloatArray(ViewMatrix, UBO.View);
+    MatrixToFloatArray(RelativeViewMatrix, UBO.View);
     MatrixToFloatArray(ProjectionMatrix, UBO.Projection);
     
     // Normal matrix (inverse transpose of model matrix upper-left 3x3)
-    FMatrix NormalMatrix = GetLocalToWorld().Inverse().GetTransposed();
+    FMatrix NormalMatrix = GetWorldToLocal().GetTransposed();
     MatrixToFloatArray(NormalMatrix, UBO.NormalMatrix);
     
     // Camera position
-    UBO.CameraPosition[0] = static_cast<float>(CameraPosition.X);
-    UBO.CameraPosition[1] = static_cast<float>(CameraPosition.Y);
-    UBO.CameraPosition[2] = static_cast<float>(CameraPosition.Z);
+    UBO.CameraPosition[0] = static_cast<float>(CameraPosition.X - RenderOrigin.X);
+    UBO.CameraPosition[1] = static_cast<float>(CameraPosition.Y - RenderOrigin.Y);
+    UBO.CameraPosition[2] = static_cast<float>(CameraPosition.Z - RenderOrigin.Z);
     UBO.CameraPosition[3] = 1.0f;
     
     // Texture blend factor
@@ -771,6 +775,7 @@ void FCubeSceneProxy::UpdateLightBuffer(const TArray<FLightSceneInfo*>& Lights)
     LightUBO.AmbientColor[3] = 1.0f;
     
     // Process lights (up to 8)
+    const FVector RenderOrigin = GetRenderOrigin();
     int32 NumLights = FMath::Min(Lights.Num(), 8);
     LightUBO.NumLights = NumLights;
     
@@ -798,7 +803,7 @@ void FCubeSceneProxy::UpdateLightBuffer(const TArray<FLightSceneInfo*>& Lights)
         }
         else
         {
-            FVector Position = Proxy->GetPosition();
+            FVector Position = Proxy->GetPosition() - RenderOrigin;
             LightUBO.Lights[i].Position[0] = static_cast<float>(Position.X);
             LightUBO.Lights[i].Position[1] = static_cast<float>(Position.Y);
             LightUBO.Lights[i].Position[2] = static_cast<float>(Position.Z);
@@ -865,6 +870,17 @@ void FCubeSceneProxy::MatrixToFloatArray(const FMatrix& Matrix, float* OutArray)
     }
 }
 
+void FCubeSceneProxy::MatrixToFloatArray(const FMatrix44f& Matrix, float* OutArray)
+{
+    for (int32 Row = 0; Row < 4; ++Row)
+    {
+        for (int32 Col = 0; Col < 4; ++Col)
+        {
+            OutArray[Col * 4 + Row] = Matrix.M[Row][Col];
+        }
+    }
+}
+
 // ============================================================================
 // Shadow Rendering Support
 // ============================================================================
@@ -1008,8 +1024,8 @@ void FCubeSceneProxy::UpdateShadowBuffer(
     
     FCubeShadowUniformBuffer* ShadowUBO = static_cast<FCubeShadowUniformBuffer*>(MappedData);
     
-    // Set light view-projection matrix
-    MatrixToFloatArray(LightViewProjection, ShadowUBO->LightViewProjection);
+    // Set light view-projection matrix, taking render-origin-relative positions
+    MatrixToFloatArray(FMatrix::MakeTranslation(GetRenderOrigin()) * LightViewProjection, ShadowUBO->LightViewProjection);
     
     // Set shadow parameters
     ShadowUBO->ShadowParams[0] = static_cast<float>(ShadowParams.X);  // Depth bias
@@ -689,19 +689,22 @@ void FFloorSceneProxy::UpdateTransformBuffer(
     }
 
     FFloorUniformBuffer UBOData;
-    // Get model matrix from local to world transform
-    FMatrix ModelMatrix = GetLocalToWorld();
+    // Positions are uploaded relative to the scene's render origin: the model matrix
+    // comes from the compact float transform and the view is moved to the same origin
+    const FVector RenderOrigin = GetRenderOrigin();
+    const FMatrix44f ModelMatrix = GetRenderTransform().ToMatrix44f();
+    const FMatrix RelativeViewMatrix = FMatrix::MakeTranslation(RenderOrigin) * ViewMatrix;
     // Calculate normal matrix (inverse transpose of model matrix)
-    FMatrix NormalMatrix = ModelMatrix.GetTransposed().Inverse();
+    FMatrix NormalMatrix = GetWorldToLocal().GetTransposed();
     // Convert matrices to float arrays (column-major for GPU)
     MatrixToFloatArray(ModelMatrix, UBOData.Model);
-    MatrixToFloatArray(ViewMatrix, UBOData.View);
+    MatrixToFloatArray(RelativeViewMatrix, UBOData.View);
     MatrixToFloatArray(ProjectionMatrix, UBOData.Projection);
     MatrixToFloatArray(NormalMatrix, UBOData.NormalMatrix);
     // Camera position
-    UBOData.CameraPosition[0] = static_cast<float>(CameraPosition.X);
-    UBOData.CameraPosition[1] = static_cast<float>(CameraPosition.Y);
-    UBOData.CameraPosition[2] = static_cast<float>(CameraPosition.Z);
+    UBOData.CameraPosition[0] = static_cast<float>(CameraPosition.X - RenderOrigin.X);
+    UBOData.CameraPosition[1] = static_cast<float>(CameraPosition.Y - RenderOrigin.Y);
+    UBOData.CameraPosition[2] = static_cast<float>(CameraPosition.Z - RenderOrigin.Z);
     UBOData.CameraPosition[3] = 1.0f;
     // Upload to GPU
     void* MappedData = TransformUniformBuffer->map();
@@ -728,6 +731,7 @@ void FFloorSceneProxy::UpdateLightBuffer(const TArray<FLightSceneInfo*>& Lights)
     LightUBO.AmbientColor[2] = 0.15f;
     LightUBO.AmbientColor[3] = 1.0f;
     // Process lights (max 8)
+    const FVector RenderOrigin = GetRenderOrigin();
     int32 LightCount = FMath::Min(Lights.Num(), 8);
     for (int32 i = 0; i < LightCount; ++i)
     {
@@ -752,7 +756,7 @@ void FFloorSceneProxy::UpdateLightBuffer(const TArray<FLightSceneInfo*>& Lights)
 
         else
         {
-            FVector Position = Proxy->GetPosition();
+            FVector Position = Proxy->GetPosition() - RenderOrigin;
             LightUBO.Lights[i].Position[0] = static_cast<float>(Position.X);
             LightUBO.Lights[i].Position[1] = static_cast<float>(Position.Y);
             LightUBO.Lights[i].Position[2] = static_cast<float>(Position.Z);
@@ -796,8 +800,8 @@ void FFloorSceneProxy::UpdateShadowBuffer(
     }
 
     FFloorShadowUniformBuffer ShadowUBO;
-    // Light view projection matrix
-    MatrixToFloatArray(LightViewProjection, ShadowUBO.LightViewProjection);
+    // Light view projection matrix, taking render-origin-relative positions
+    MatrixToFloatArray(FMatrix::MakeTranslation(GetRenderOrigin()) * LightViewProjection, ShadowUBO.LightViewProjection);
     // Shadow parameters
     ShadowUBO.ShadowParams[0] = static_cast<float>(ShadowParams.X);  // bias
     ShadowUBO.ShadowParams[1] = static_cast<float>(ShadowParams.Y);  // slope bias
@@ -833,4 +837,17 @@ void FFloorSceneProxy::MatrixToFloatArray(const FMatrix& Matrix, float* OutArray
 
 }
 
+void FFloorSceneProxy::MatrixToFloatArray(const FMatrix44f& Matrix, float* OutArray)
+{
+    for (int32 Row = 0; Row < 4; ++Row)
+    {
+        for (int32 Col = 0; Col < 4; ++Col)
+        {
+            OutArray[Col * 4 + Row] = Matrix.M[Row][Col];
+        }
+
+    }
+
+}
+
 } // namespace MonsterEngine
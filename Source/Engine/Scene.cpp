@@ -14,6 +14,10 @@
 #include "Engine/Components/PrimitiveComponent.h"
 #include "Engine/Components/LightComponent.h"
 #include "Core/Logging/LogMacros.h"
+#include "Core/HAL/LowLevelMemTracker.h"
+#include "Math/VectorKernels.h"
+
+#include <algorithm>
 
 namespace MonsterEngine
 {
@@ -21,6 +25,15 @@ namespace MonsterEngine
 // Use global log category (defined in LogCategories.cpp)
 using MonsterRender::LogScene;
 
+namespace
+{
+    /** Scene bounds keep the sphere enclosing the box so both transform update paths cull alike */
+    FBoxSphereBounds MakePrimitiveBounds(const FVector& Origin, const FVector& BoxExtent)
+    {
+        return FBoxSphereBounds(Origin, BoxExtent, BoxExtent.Size());
+    }
+}
+
 // ============================================================================
 // FSceneInterface Implementation
 // ============================================================================
@@ -57,6 +70,7 @@ void FLightSceneInfoCompact::Init(FLightSceneInfo* InLightSceneInfo)
 
 FScene::FScene(UWorld* InWorld, bool bInRequiresHitProxies, bool bInIsEditorScene)
     : World(InWorld)
+    , RenderOrigin(FVector::ZeroVector)
     , SimpleDirectionalLight(nullptr)
     , SkyLight(nullptr)
     , bRequiresHitProxies(bInRequiresHitProxies)
@@ -108,6 +122,7 @@ FScene::~FScene()
 
 void FScene::AddPrimitive(UPrimitiveComponent* Primitive)
 {
+    LLM_SCOPE(ELLMTag::Scene);
     if (!Primitive)
     {
         MR_LOG(LogScene, Warning, "AddPrimitive called with null primitive");
@@ -169,7 +184,8 @@ void FScene::UpdatePrimitiveTransform(UPrimitiveComponent* Primitive)
     {
         // Update transform
         FMatrix NewLocalToWorld = Primitive->GetComponentToWorld();
-        FBoxSphereBounds NewBounds = Primitive->GetBounds();
+        const FBoxSphereBounds& ComponentBounds = Primitive->GetBounds();
+        FBoxSphereBounds NewBounds = MakePrimitiveBounds(ComponentBounds.Origin, ComponentBounds.BoxExtent);
         
         SceneInfo->UpdateTransform(NewLocalToWorld, NewBounds);
         
@@ -177,12 +193,127 @@ void FScene::UpdatePrimitiveTransform(UPrimitiveComponent* Primitive)
         int32 PackedIndex = SceneInfo->GetPackedIndex();
         if (PackedIndex >= 0 && PackedIndex < Primitives.Num())
         {
-            PrimitiveTransforms[PackedIndex] = NewLocalToWorld;
             PrimitiveBounds[PackedIndex].BoxSphereBounds = NewBounds;
+            SetPrimitiveRenderData(PackedIndex, NewLocalToWorld, NewBounds);
         }
     }
 }
 
+void FScene::UpdatePrimitiveTransforms(const TArray<FPrimitiveTransformUpdate>& Updates)
+{
+    // Updates are processed in blocks small enough that the staged streams stay in L1
+    constexpr int32 BlockSize = 64;
+    struct FBlockStreams
+    {
+        float LocalCenter[3][BlockSize];
+        float LocalExtent[3][BlockSize];
+        float Linear[9][BlockSize];
+        float WorldCenter[3][BlockSize];
+        float WorldExtent[3][BlockSize];
+    };
+    FBlockStreams Block;
+
+    const Math::FConstBoxStreams LocalBoxes = {
+        { Block.LocalCenter[0], Block.LocalCenter[1], Block.LocalCenter[2] },
+        { Block.LocalExtent[0], Block.LocalExtent[1], Block.LocalExtent[2] } };
+    const Math::FBoxStreams WorldBoxes = {
+        { Block.WorldCenter[0], Block.WorldCenter[1], Block.WorldCenter[2] },
+        { Block.WorldExtent[0], Block.WorldExtent[1], Block.WorldExtent[2] } };
+    const float* const Linear[9] = {
+        Block.Linear[0], Block.Linear[1], Block.Linear[2],
+        Block.Linear[3], Block.Linear[4], Block.Linear[5],
+        Block.Linear[6], Block.Linear[7], Block.Linear[8] };
+    const Math::FVectorKernels& Kernels = Math::FVectorKernels::Get();
+
+    const int32 NumUpdates = Updates.Num();
+    const int32 NumPrimitives = Primitives.Num();
+    for (int32 BlockStart = 0; BlockStart < NumUpdates; BlockStart += BlockSize)
+    {
+        const int32 NumInBlock = (std::min)(BlockSize, NumUpdates - BlockStart);
+
+        // Gather local bounds and the linear part of each matrix; invalid entries transform an empty box
+        for (int32 i = 0; i < NumInBlock; ++i)
+        {
+            const FPrimitiveTransformUpdate& Update = Updates[BlockStart + i];
+            const FPrimitiveSceneProxy* Proxy = (Update.PackedIndex >= 0 && Update.PackedIndex < NumPrimitives)
+                ? PrimitiveSceneProxies[Update.PackedIndex] : nullptr;
+
+            FVector LocalCenter(0.0, 0.0, 0.0);
+            FVector LocalExtent(0.0, 0.0, 0.0);
+            if (Proxy && Proxy->GetLocalBounds().IsValid)
+            {
+                Proxy->GetLocalBounds().GetCenterAndExtents(LocalCenter, LocalExtent);
+            }
+            Block.LocalCenter[0][i] = static_cast<float>(LocalCenter.X);
+            Block.LocalCenter[1][i] = static_cast<float>(LocalCenter.Y);
+            Block.LocalCenter[2][i] = static_cast<float>(LocalCenter.Z);
+            Block.LocalExtent[0][i] = static_cast<float>(LocalExtent.X);
+            Block.LocalExtent[1][i] = static_cast<float>(LocalExtent.Y);
+            Block.LocalExtent[2][i] = static_cast<float>(LocalExtent.Z);
+
+            const FMatrix& M = Update.LocalToWorld;
+            Block.Linear[0][i] = static_cast<float>(M.M[0][0]);
+            Block.Linear[1][i] = static_cast<float>(M.M[0][1]);
+            Block.Linear[2][i] = static_cast<float>(M.M[0][2]);
+            Block.Linear[3][i] = static_cast<float>(M.M[1][0]);
+            Block.Linear[4][i] = static_cast<float>(M.M[1][1]);
+            Block.Linear[5][i] = static_cast<float>(M.M[1][2]);
+            Block.Linear[6][i] = static_cast<float>(M.M[2][0]);
+            Block.Linear[7][i] = static_cast<float>(M.M[2][1]);
+            Block.Linear[8][i] = static_cast<float>(M.M[2][2]);
+        }
+
+        Kernels.TransformBoundsPerBox(Linear, LocalBoxes, WorldBoxes, NumInBlock);
+
+        // Scatter into the packed arrays; translation is added in double so distant primitives keep their precision
+        for (int32 i = 0; i < NumInBlock; ++i)
+        {
+            const FPrimitiveTransformUpdate& Update = Updates[BlockStart + i];
+            const int32 PackedIndex = Update.PackedIndex;
+            if (PackedIndex < 0 || PackedIndex >= NumPrimitives)
+            {
+                continue;
+            }
+
+            const FBoxSphereBounds NewBounds = MakePrimitiveBounds(
+                Update.LocalToWorld.GetOrigin() + FVector(Block.WorldCenter[0][i], Block.WorldCenter[1][i], Block.WorldCenter[2][i]),
+                FVector(Block.WorldExtent[0][i], Block.WorldExtent[1][i], Block.WorldExtent[2][i]));
+
+            // The kernel's bounds go straight to the scene info, which does not transform them again
+            if (Primitives[PackedIndex])
+            {
+                Primitives[PackedIndex]->UpdateTransform(Update.LocalToWorld, NewBounds);
+            }
+            PrimitiveBounds[PackedIndex].BoxSphereBounds = NewBounds;
+            SetPrimitiveRenderData(PackedIndex, Update.LocalToWorld, NewBounds);
+        }
+    }
+}
+
+void FScene::SetPrimitiveRenderData(int32 PackedIndex, const FMatrix& LocalToWorld, const FBoxSphereBounds& Bounds)
+{
+    PrimitiveTransforms[PackedIndex] = Math::FRenderTransform(LocalToWorld, RenderOrigin);
+    PrimitiveRenderBounds[PackedIndex] = Math::FRenderBounds(Bounds.Origin, Bounds.BoxExtent, Bounds.SphereRadius, RenderOrigin);
+}
+
+void FScene::UpdateRenderOrigin(const FVector& ViewOrigin)
+{
+    const FVector NewRenderOrigin = Math::GetRenderTileOrigin(ViewOrigin);
+    if (NewRenderOrigin == RenderOrigin)
+    {
+        return;
+    }
+
+    RenderOrigin = NewRenderOrigin;
+    for (int32 i = 0; i < Primitives.Num(); ++i)
+    {
+        SetPrimitiveRenderData(i, PrimitiveSceneProxies[i]->GetLocalToWorld(), PrimitiveBounds[i].BoxSphereBounds);
+    }
+
+    MR_LOG(LogScene, Verbose, "Render origin moved to (%.0f, %.0f, %.0f), rebased %d primitives",
+           RenderOrigin.X, RenderOrigin.Y, RenderOrigin.Z, Primitives.Num());
+}
+
 void FScene::UpdatePrimitiveAttachment(UPrimitiveComponent* Primitive)
 {
     if (!Primitive)
@@ -228,8 +359,8 @@ void FScene::AddPrimitiveSceneInfo_RenderThread(FPrimitiveSceneInfo* PrimitiveSc
     FPrimitiveSceneProxy* Proxy = PrimitiveSceneInfo->GetProxy();
     if (Proxy)
     {
-        // Add transform to the packed transform array
-        PrimitiveTransforms.Add(Proxy->GetLocalToWorld());
+        // Add transform to the packed transform array (filled in with the render bounds below)
+        PrimitiveTransforms.AddDefaulted();
         
         // Add proxy to the packed proxy array
         PrimitiveSceneProxies.Add(Proxy);
@@ -240,6 +371,8 @@ void FScene::AddPrimitiveSceneInfo_RenderThread(FPrimitiveSceneInfo* PrimitiveSc
         Bounds.MinDrawDistance = Proxy->GetMinDrawDistance();
         Bounds.MaxDrawDistance = Proxy->GetMaxDrawDistance();
         PrimitiveBounds.Add(Bounds);
+        PrimitiveRenderBounds.AddDefaulted();
+        SetPrimitiveRenderData(PackedIndex, Proxy->GetLocalToWorld(), Bounds.BoxSphereBounds);
         
         // Add flags and visibility info
         PrimitiveFlagsCompact.Add(FPrimitiveFlagsCompact(EPrimitiveFlags::Default));
@@ -299,6 +432,7 @@ void FScene::RemovePrimitiveSceneInfo_RenderThread(FPrimitiveSceneInfo* Primitiv
         PrimitiveTransforms[PackedIndex] = PrimitiveTransforms[LastIndex];
         PrimitiveSceneProxies[PackedIndex] = PrimitiveSceneProxies[LastIndex];
         PrimitiveBounds[PackedIndex] = PrimitiveBounds[LastIndex];
+        PrimitiveRenderBounds[PackedIndex] = PrimitiveRenderBounds[LastIndex];
         PrimitiveFlagsCompact[PackedIndex] = PrimitiveFlagsCompact[LastIndex];
         PrimitiveVisibilityIds[PackedIndex] = PrimitiveVisibilityIds[LastIndex];
         PrimitiveOcclusionFlags[PackedIndex] = PrimitiveOcclusionFlags[LastIndex];
@@ -311,6 +445,7 @@ void FScene::RemovePrimitiveSceneInfo_RenderThread(FPrimitiveSceneInfo* Primitiv
     PrimitiveTransforms.RemoveAt(LastIndex);
     PrimitiveSceneProxies.RemoveAt(LastIndex);
     PrimitiveBounds.RemoveAt(LastIndex);
+    PrimitiveRenderBounds.RemoveAt(LastIndex);
     PrimitiveFlagsCompact.RemoveAt(LastIndex);
     PrimitiveVisibilityIds.RemoveAt(LastIndex);
     PrimitiveOcclusionFlags.RemoveAt(LastIndex);
@@ -653,19 +788,21 @@ void FScene::ApplyWorldOffset(const FVector& InOffset)
     MR_LOG(LogScene, Log, "Applying world offset: (%f, %f, %f)",
            InOffset.X, InOffset.Y, InOffset.Z);
 
-    // Update all primitive transforms
+    // Move proxies and bounds in double, then repack them against the offset
+    // origin snapped back to the tile grid. A whole-tile offset leaves the
+    // packed values unchanged; any other offset re-rounds them.
+    RenderOrigin = Math::GetRenderTileOrigin(RenderOrigin + InOffset);
+
     for (int32 i = 0; i < Primitives.Num(); ++i)
     {
-        FMatrix& Transform = PrimitiveTransforms[i];
-        FVector Origin = Transform.GetOrigin();
-        Origin = Origin + InOffset;
-        Transform.SetOrigin(Origin);
+        FPrimitiveSceneProxy* Proxy = PrimitiveSceneProxies[i];
+        Proxy->ApplyWorldOffset(InOffset);
 
-        // Update bounds
         PrimitiveBounds[i].BoxSphereBounds.Origin = 
             PrimitiveBounds[i].BoxSphereBounds.Origin + InOffset;
         PrimitiveOcclusionBounds[i].Origin = 
             PrimitiveOcclusionBounds[i].Origin + InOffset;
+        SetPrimitiveRenderData(i, Proxy->GetLocalToWorld(), PrimitiveBounds[i].BoxSphereBounds);
     }
 
     // Update light positions
@@ -16,6 +16,9 @@
 #include "RHI/IRHICommandList.h"
 #include "Containers/SparseArray.h"
 #include "Core/Logging/LogMacros.h"
+#include "Core/HAL/LowLevelMemTracker.h"
+#include "Core/HAL/MemStack.h"
+#include "Core/Templates/RadixSort.h"
 
 // Use RHI namespace
 using namespace MonsterRender::RHI;
@@ -25,6 +28,8 @@ namespace MonsterEngine
 
 // Use global log category (defined in LogCategories.cpp)
 using MonsterRender::LogSceneRenderer;
+using MonsterRender::FMemMark;
+using MonsterRender::FMemStack;
 
 // ============================================================================
 // FMeshDrawCommand Implementation
@@ -69,6 +74,7 @@ FSceneRenderer::~FSceneRenderer()
 
 void FSceneRenderer::Render(IRHICommandList& RHICmdList)
 {
+    LLM_SCOPE(ELLMTag::Renderer);
     if (!Scene)
     {
         MR_LOG(LogSceneRenderer, Warning, "Cannot render: no scene");
@@ -257,25 +263,32 @@ void FSceneRenderer::SortPrimitives()
         // In a real implementation, this would use a more sophisticated sort key
         
         // Sort translucent primitives back-to-front
-        if (ViewInfo.VisibleTranslucentPrimitives.Num() > 1)
+        TArray<FPrimitiveSceneInfo*, SceneRenderingAllocator>& Translucent = ViewInfo.VisibleTranslucentPrimitives;
+        if (Translucent.Num() > 1)
         {
             const FVector ViewOrigin = ViewInfo.ViewLocation;
             
-            ViewInfo.VisibleTranslucentPrimitives.Sort(
-                [&ViewOrigin](const FPrimitiveSceneInfo* A, const FPrimitiveSceneInfo* B)
-                {
-                    if (!A || !B) return false;
-                    
-                    FPrimitiveSceneProxy* ProxyA = A->GetProxy();
-                    FPrimitiveSceneProxy* ProxyB = B->GetProxy();
-                    
-                    if (!ProxyA || !ProxyB) return false;
-                    
-                    float DistA = (ProxyA->GetBounds().Origin - ViewOrigin).SizeSquared();
-                    float DistB = (ProxyB->GetBounds().Origin - ViewOrigin).SizeSquared();
-                    
-                    return DistA > DistB; // Back-to-front
-                });
+            // Compute each distance once into a scratch sort buffer rather than per comparison
+            FMemMark Mark(FMemStack::Get());
+            TArray<TPair<float, FPrimitiveSceneInfo*>, SceneRenderingAllocator> SortBuffer;
+            SortBuffer.Reserve(Translucent.Num());
+            
+            for (FPrimitiveSceneInfo* PrimitiveInfo : Translucent)
+            {
+                FPrimitiveSceneProxy* Proxy = PrimitiveInfo ? PrimitiveInfo->GetProxy() : nullptr;
+                const float Distance = Proxy ? static_cast<float>((Proxy->GetBounds().Origin - ViewOrigin).SizeSquared()) : 0.0f;
+                SortBuffer.Add(TPair<float, FPrimitiveSceneInfo*>(Distance, PrimitiveInfo));
+            }
+            
+            RadixSort(SortBuffer, [](const TPair<float, FPrimitiveSceneInfo*>& Pair)
+            {
+                return -Pair.Key; // Back-to-front
+            });
+            
+            for (int32 Index = 0; Index < SortBuffer.Num(); ++Index)
+            {
+                Translucent[Index] = SortBuffer[Index].Value;
+            }
         }
     }
 }
@@ -286,7 +299,8 @@ void FSceneRenderer::RenderDepthPrepass(IRHICommandList& RHICmdList)
     
     for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
     {
-        TArray<FMeshDrawCommand> DrawCommands;
+        FMemMark Mark(FMemStack::Get());
+        FMeshCommandOneFrameArray DrawCommands;
         GenerateDrawCommands(ViewIndex, ERenderPass::DepthPrepass, DrawCommands);
         SubmitDrawCommands(RHICmdList, DrawCommands);
     }
@@ -298,7 +312,8 @@ void FSceneRenderer::RenderBasePass(IRHICommandList& RHICmdList)
     
     for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
     {
-        TArray<FMeshDrawCommand> DrawCommands;
+        FMemMark Mark(FMemStack::Get());
+        FMeshCommandOneFrameArray DrawCommands;
         GenerateDrawCommands(ViewIndex, ERenderPass::BasePass, DrawCommands);
         SubmitDrawCommands(RHICmdList, DrawCommands);
     }
@@ -327,7 +342,8 @@ void FSceneRenderer::RenderShadowDepths(IRHICommandList& RHICmdList)
             }
             
             // Generate shadow draw commands
-            TArray<FMeshDrawCommand> ShadowCommands;
+            FMemMark Mark(FMemStack::Get());
+            FMeshCommandOneFrameArray ShadowCommands;
             GenerateDrawCommands(ViewIndex, ERenderPass::ShadowDepth, ShadowCommands);
             SubmitDrawCommands(RHICmdList, ShadowCommands);
         }
@@ -347,7 +363,8 @@ void FSceneRenderer::RenderTranslucency(IRHICommandList& RHICmdList)
     
     for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
     {
-        TArray<FMeshDrawCommand> DrawCommands;
+        FMemMark Mark(FMemStack::Get());
+        FMeshCommandOneFrameArray DrawCommands;
         GenerateDrawCommands(ViewIndex, ERenderPass::Translucency, DrawCommands);
         SubmitDrawCommands(RHICmdList, DrawCommands);
     }
@@ -360,7 +377,7 @@ void FSceneRenderer::RenderPostProcess(IRHICommandList& RHICmdList)
     // Base implementation does nothing - derived classes implement post-processing
 }
 
-void FSceneRenderer::GenerateDrawCommands(int32 ViewIndex, ERenderPass Pass, TArray<FMeshDrawCommand>& OutCommands)
+void FSceneRenderer::GenerateDrawCommands(int32 ViewIndex, ERenderPass Pass, FMeshCommandOneFrameArray& OutCommands)
 {
     if (ViewIndex < 0 || ViewIndex >= Views.Num())
     {
@@ -370,7 +387,7 @@ void FSceneRenderer::GenerateDrawCommands(int32 ViewIndex, ERenderPass Pass, TAr
     FViewInfo& ViewInfo = Views[ViewIndex];
     
     // Select primitive list based on pass
-    TArray<FPrimitiveSceneInfo*>* PrimitiveList = nullptr;
+    TArray<FPrimitiveSceneInfo*, SceneRenderingAllocator>* PrimitiveList = nullptr;
     
     switch (Pass)
     {
@@ -454,7 +471,7 @@ void FSceneRenderer::GenerateDrawCommands(int32 ViewIndex, ERenderPass Pass, TAr
     OutCommands.Sort();
 }
 
-void FSceneRenderer::SubmitDrawCommands(IRHICommandList& RHICmdList, const TArray<FMeshDrawCommand>& Commands)
+void FSceneRenderer::SubmitDrawCommands(IRHICommandList& RHICmdList, const FMeshCommandOneFrameArray& Commands)
 {
     // In a real implementation, this would:
     // 1. Set render state for each command
@@ -483,6 +500,7 @@ FDeferredShadingRenderer::~FDeferredShadingRenderer()
 
 void FDeferredShadingRenderer::Render(IRHICommandList& RHICmdList)
 {
+    LLM_SCOPE(ELLMTag::Renderer);
     if (!Scene)
     {
         MR_LOG(LogSceneRenderer, Warning, "Cannot render: no scene");
@@ -527,7 +545,8 @@ void FDeferredShadingRenderer::RenderGBuffer(IRHICommandList& RHICmdList)
     
     for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
     {
-        TArray<FMeshDrawCommand> DrawCommands;
+        FMemMark Mark(FMemStack::Get());
+        FMeshCommandOneFrameArray DrawCommands;
         GenerateDrawCommands(ViewIndex, ERenderPass::BasePass, DrawCommands);
         SubmitDrawCommands(RHICmdList, DrawCommands);
     }
@@ -619,6 +638,7 @@ FForwardShadingRenderer::~FForwardShadingRenderer()
 
 void FForwardShadingRenderer::Render(IRHICommandList& RHICmdList)
 {
+    LLM_SCOPE(ELLMTag::Renderer);
     if (!Scene)
     {
         MR_LOG(LogSceneRenderer, Warning, "Cannot render: no scene");
@@ -694,7 +714,8 @@ void FForwardShadingRenderer::RenderForwardOpaque(IRHICommandList& RHICmdList)
         FViewInfo& ViewInfo = Views[ViewIndex];
         
         // Generate and submit draw commands
-        TArray<FMeshDrawCommand> DrawCommands;
+        FMemMark Mark(FMemStack::Get());
+        FMeshCommandOneFrameArray DrawCommands;
         GenerateDrawCommands(ViewIndex, ERenderPass::BasePass, DrawCommands);
         SubmitDrawCommands(RHICmdList, DrawCommands);
     }
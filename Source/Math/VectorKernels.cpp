@@ -0,0 +1,217 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+/**
+ * @file VectorKernels.cpp
+ * @brief Scalar reference kernels and runtime instruction set selection
+ */
+
+#include "Math/VectorKernels.h"
+#include "Core/HAL/PlatformCPUFeatures.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace MonsterEngine
+{
+namespace Math
+{
+
+namespace VectorKernelsPrivate
+{
+
+void TransformPositionsScalar(const float* Matrix, const float* const In[3], float* const Out[3], int32_t Num)
+{
+    for (int32_t Index = 0; Index < Num; ++Index)
+    {
+        const float X = In[0][Index];
+        const float Y = In[1][Index];
+        const float Z = In[2][Index];
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            Out[Axis][Index] = X * Matrix[Axis] + Y * Matrix[4 + Axis] + Z * Matrix[8 + Axis] + Matrix[12 + Axis];
+        }
+    }
+}
+
+void TransformBoundsScalar(const float* Matrix, const FConstBoxStreams& In, const FBoxStreams& Out, int32_t Num)
+{
+    for (int32_t Index = 0; Index < Num; ++Index)
+    {
+        const float CX = In.Center[0][Index];
+        const float CY = In.Center[1][Index];
+        const float CZ = In.Center[2][Index];
+        const float EX = In.Extent[0][Index];
+        const float EY = In.Extent[1][Index];
+        const float EZ = In.Extent[2][Index];
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            Out.Center[Axis][Index] = CX * Matrix[Axis] + CY * Matrix[4 + Axis] + CZ * Matrix[8 + Axis] + Matrix[12 + Axis];
+            Out.Extent[Axis][Index] = EX * std::abs(Matrix[Axis]) + EY * std::abs(Matrix[4 + Axis]) + EZ * std::abs(Matrix[8 + Axis]);
+        }
+    }
+}
+
+void TransformBoundsPerBoxScalar(const float* const Linear[9], const FConstBoxStreams& In, const FBoxStreams& Out, int32_t Num)
+{
+    for (int32_t Index = 0; Index < Num; ++Index)
+    {
+        const float CX = In.Center[0][Index];
+        const float CY = In.Center[1][Index];
+        const float CZ = In.Center[2][Index];
+        const float EX = In.Extent[0][Index];
+        const float EY = In.Extent[1][Index];
+        const float EZ = In.Extent[2][Index];
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            const float M0 = Linear[Axis][Index];
+            const float M1 = Linear[3 + Axis][Index];
+            const float M2 = Linear[6 + Axis][Index];
+            Out.Center[Axis][Index] = CX * M0 + CY * M1 + CZ * M2;
+            Out.Extent[Axis][Index] = EX * std::abs(M0) + EY * std::abs(M1) + EZ * std::abs(M2);
+        }
+    }
+}
+
+void CullBoxesScalar(const float* Planes, int32_t NumPlanes, const FConstBoxStreams& Boxes, int32_t Num, uint32_t* OutVisibleWords)
+{
+    const int32_t NumWords = (Num + 31) / 32;
+    std::memset(OutVisibleWords, 0, static_cast<size_t>(NumWords) * sizeof(uint32_t));
+
+    for (int32_t Index = 0; Index < Num; ++Index)
+    {
+        bool bVisible = true;
+        for (int32_t PlaneIndex = 0; PlaneIndex < NumPlanes && bVisible; ++PlaneIndex)
+        {
+            const float* Plane = Planes + PlaneIndex * 4;
+            const float Distance = Plane[0] * Boxes.Center[0][Index] + Plane[1] * Boxes.Center[1][Index] + Plane[2] * Boxes.Center[2][Index] - Plane[3];
+            const float PushOut = std::abs(Plane[0]) * Boxes.Extent[0][Index] + std::abs(Plane[1]) * Boxes.Extent[1][Index] + std::abs(Plane[2]) * Boxes.Extent[2][Index];
+            bVisible = !(Distance > PushOut);
+        }
+        if (bVisible)
+        {
+            OutVisibleWords[Index >> 5] |= 1u << (Index & 31);
+        }
+    }
+}
+
+void CullBoxBlocksScalar(const float* Planes, int32_t NumPlanes, const FBoxBlock8* Blocks, int32_t Num, uint32_t* OutVisibleWords)
+{
+    const int32_t NumWords = (Num + 31) / 32;
+    std::memset(OutVisibleWords, 0, static_cast<size_t>(NumWords) * sizeof(uint32_t));
+
+    for (int32_t Index = 0; Index < Num; ++Index)
+    {
+        const FBoxBlock8& Block = Blocks[Index >> 3];
+        const int32_t Lane = Index & 7;
+        bool bVisible = true;
+        for (int32_t PlaneIndex = 0; PlaneIndex < NumPlanes && bVisible; ++PlaneIndex)
+        {
+            const float* Plane = Planes + PlaneIndex * 4;
+            const float Distance = Plane[0] * Block.Center[0][Lane] + Plane[1] * Block.Center[1][Lane] + Plane[2] * Block.Center[2][Lane] - Plane[3];
+            const float PushOut = std::abs(Plane[0]) * Block.Extent[0][Lane] + std::abs(Plane[1]) * Block.Extent[1][Lane] + std::abs(Plane[2]) * Block.Extent[2][Lane];
+            bVisible = !(Distance > PushOut);
+        }
+        if (bVisible)
+        {
+            OutVisibleWords[Index >> 5] |= 1u << (Index & 31);
+        }
+    }
+}
+
+void DownsampleRGBA8Scalar(const uint8_t* Src, uint32_t SrcWidth, uint32_t SrcHeight, uint8_t* Dst)
+{
+    const uint32_t DstWidth = std::max(1u, SrcWidth / 2);
+    const uint32_t DstHeight = std::max(1u, SrcHeight / 2);
+
+    for (uint32_t Y = 0; Y < DstHeight; ++Y)
+    {
+        const uint32_t SY0 = Y * 2;
+        const uint32_t SY1 = std::min(SY0 + 1, SrcHeight - 1);
+        for (uint32_t X = 0; X < DstWidth; ++X)
+        {
+            const uint32_t SX0 = X * 2;
+            const uint32_t SX1 = std::min(SX0 + 1, SrcWidth - 1);
+            const uint8_t* P00 = Src + (SY0 * SrcWidth + SX0) * 4;
+            const uint8_t* P10 = Src + (SY0 * SrcWidth + SX1) * 4;
+            const uint8_t* P01 = Src + (SY1 * SrcWidth + SX0) * 4;
+            const uint8_t* P11 = Src + (SY1 * SrcWidth + SX1) * 4;
+            uint8_t* Out = Dst + (Y * DstWidth + X) * 4;
+            for (uint32_t Channel = 0; Channel < 4; ++Channel)
+            {
+                Out[Channel] = static_cast<uint8_t>((P00[Channel] + P10[Channel] + P01[Channel] + P11[Channel]) >> 2);
+            }
+        }
+    }
+}
+
+const FVectorKernels* GetScalarKernels()
+{
+    static const FVectorKernels Kernels = {
+        &TransformPositionsScalar,
+        &TransformBoundsScalar,
+        &TransformBoundsPerBoxScalar,
+        &CullBoxesScalar,
+        &CullBoxBlocksScalar,
+        &DownsampleRGBA8Scalar,
+        EVectorISA::Scalar
+    };
+    return &Kernels;
+}
+
+} // namespace VectorKernelsPrivate
+
+const char* GetVectorISAName(EVectorISA ISA)
+{
+    switch (ISA)
+    {
+        case EVectorISA::Scalar: return "Scalar";
+        case EVectorISA::SSE42:  return "SSE4.2";
+        case EVectorISA::AVX2:   return "AVX2";
+        case EVectorISA::AVX512: return "AVX-512";
+        default:                 return "Unknown";
+    }
+}
+
+const FVectorKernels* FVectorKernels::GetForISA(EVectorISA ISA)
+{
+    using MonsterRender::FPlatformCPUFeatures;
+    using namespace VectorKernelsPrivate;
+
+    switch (ISA)
+    {
+        case EVectorISA::Scalar:
+            return GetScalarKernels();
+        case EVectorISA::SSE42:
+            return FPlatformCPUFeatures::HasFeatures(FPlatformCPUFeatures::SSE41 | FPlatformCPUFeatures::SSE42)
+                ? GetSSE42Kernels() : nullptr;
+        case EVectorISA::AVX2:
+            return FPlatformCPUFeatures::HasFeatures(FPlatformCPUFeatures::AVX2)
+                ? GetAVX2Kernels() : nullptr;
+        case EVectorISA::AVX512:
+            return FPlatformCPUFeatures::HasFeatures(FPlatformCPUFeatures::AVX512F | FPlatformCPUFeatures::AVX512BW |
+                                                     FPlatformCPUFeatures::AVX512DQ | FPlatformCPUFeatures::AVX512VL)
+                ? GetAVX512Kernels() : nullptr;
+        default:
+            return nullptr;
+    }
+}
+
+const FVectorKernels& FVectorKernels::Get()
+{
+    static const FVectorKernels* const Selected = []()
+    {
+        for (int32_t ISA = static_cast<int32_t>(EVectorISA::Num) - 1; ISA > 0; --ISA)
+        {
+            if (const FVectorKernels* Kernels = GetForISA(static_cast<EVectorISA>(ISA)))
+            {
+                return Kernels;
+            }
+        }
+        return VectorKernelsPrivate::GetScalarKernels();
+    }();
+    return *Selected;
+}
+
+} // namespace Math
+} // namespace MonsterEngine
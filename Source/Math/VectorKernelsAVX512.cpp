@@ -0,0 +1,349 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+/**
+ * @file VectorKernelsAVX512.cpp
+ * @brief AVX-512 variants of the bulk vector kernels (16 floats per instruction)
+ *
+ * Everything is included before the target pragma so only the kernels below
+ * are compiled for AVX-512 F/BW/DQ/VL. Floating-point contraction is disabled so results
+ * match the scalar kernels bit for bit.
+ */
+
+#include "Math/VectorKernels.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("avx512f,avx512bw,avx512dq,avx512vl"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC target("avx512f,avx512bw,avx512dq,avx512vl")
+    #pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace MonsterEngine
+{
+namespace Math
+{
+namespace
+{
+
+constexpr int32_t Width = 16;
+
+inline __m512 AbsAVX512(__m512 Value)
+{
+    return _mm512_andnot_ps(_mm512_set1_ps(-0.0f), Value);
+}
+
+void TransformPositionsAVX512(const float* Matrix, const float* const In[3], float* const Out[3], int32_t Num)
+{
+    __m512 Rows[4][3];
+    for (int32_t Row = 0; Row < 4; ++Row)
+    {
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            Rows[Row][Axis] = _mm512_set1_ps(Matrix[Row * 4 + Axis]);
+        }
+    }
+
+    const int32_t NumVector = Num & ~(Width - 1);
+    for (int32_t Index = 0; Index < NumVector; Index += Width)
+    {
+        const __m512 X = _mm512_loadu_ps(In[0] + Index);
+        const __m512 Y = _mm512_loadu_ps(In[1] + Index);
+        const __m512 Z = _mm512_loadu_ps(In[2] + Index);
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            __m512 Result = _mm512_mul_ps(X, Rows[0][Axis]);
+            Result = _mm512_add_ps(Result, _mm512_mul_ps(Y, Rows[1][Axis]));
+            Result = _mm512_add_ps(Result, _mm512_mul_ps(Z, Rows[2][Axis]));
+            _mm512_storeu_ps(Out[Axis] + Index, _mm512_add_ps(Result, Rows[3][Axis]));
+        }
+    }
+
+    if (NumVector < Num)
+    {
+        const float* const TailIn[3] = { In[0] + NumVector, In[1] + NumVector, In[2] + NumVector };
+        float* const TailOut[3] = { Out[0] + NumVector, Out[1] + NumVector, Out[2] + NumVector };
+        VectorKernelsPrivate::TransformPositionsScalar(Matrix, TailIn, TailOut, Num - NumVector);
+    }
+}
+
+void TransformBoundsAVX512(const float* Matrix, const FConstBoxStreams& In, const FBoxStreams& Out, int32_t Num)
+{
+    __m512 Rows[4][3];
+    __m512 AbsRows[3][3];
+    for (int32_t Row = 0; Row < 4; ++Row)
+    {
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            Rows[Row][Axis] = _mm512_set1_ps(Matrix[Row * 4 + Axis]);
+            if (Row < 3)
+            {
+                AbsRows[Row][Axis] = AbsAVX512(Rows[Row][Axis]);
+            }
+        }
+    }
+
+    const int32_t NumVector = Num & ~(Width - 1);
+    for (int32_t Index = 0; Index < NumVector; Index += Width)
+    {
+        const __m512 CX = _mm512_loadu_ps(In.Center[0] + Index);
+        const __m512 CY = _mm512_loadu_ps(In.Center[1] + Index);
+        const __m512 CZ = _mm512_loadu_ps(In.Center[2] + Index);
+        const __m512 EX = _mm512_loadu_ps(In.Extent[0] + Index);
+        const __m512 EY = _mm512_loadu_ps(In.Extent[1] + Index);
+        const __m512 EZ = _mm512_loadu_ps(In.Extent[2] + Index);
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            __m512 Center = _mm512_mul_ps(CX, Rows[0][Axis]);
+            Center = _mm512_add_ps(Center, _mm512_mul_ps(CY, Rows[1][Axis]));
+            Center = _mm512_add_ps(Center, _mm512_mul_ps(CZ, Rows[2][Axis]));
+            _mm512_storeu_ps(Out.Center[Axis] + Index, _mm512_add_ps(Center, Rows[3][Axis]));
+
+            __m512 Extent = _mm512_mul_ps(EX, AbsRows[0][Axis]);
+            Extent = _mm512_add_ps(Extent, _mm512_mul_ps(EY, AbsRows[1][Axis]));
+            Extent = _mm512_add_ps(Extent, _mm512_mul_ps(EZ, AbsRows[2][Axis]));
+            _mm512_storeu_ps(Out.Extent[Axis] + Index, Extent);
+        }
+    }
+
+    if (NumVector < Num)
+    {
+        VectorKernelsPrivate::TransformBoundsScalar(Matrix,
+            VectorKernelsPrivate::OffsetStreams(In, NumVector),
+            VectorKernelsPrivate::OffsetStreams(Out, NumVector),
+            Num - NumVector);
+    }
+}
+
+void TransformBoundsPerBoxAVX512(const float* const Linear[9], const FConstBoxStreams& In, const FBoxStreams& Out, int32_t Num)
+{
+    const int32_t NumVector = Num & ~(Width - 1);
+    for (int32_t Index = 0; Index < NumVector; Index += Width)
+    {
+        const __m512 CX = _mm512_loadu_ps(In.Center[0] + Index);
+        const __m512 CY = _mm512_loadu_ps(In.Center[1] + Index);
+        const __m512 CZ = _mm512_loadu_ps(In.Center[2] + Index);
+        const __m512 EX = _mm512_loadu_ps(In.Extent[0] + Index);
+        const __m512 EY = _mm512_loadu_ps(In.Extent[1] + Index);
+        const __m512 EZ = _mm512_loadu_ps(In.Extent[2] + Index);
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            const __m512 M0 = _mm512_loadu_ps(Linear[Axis] + Index);
+            const __m512 M1 = _mm512_loadu_ps(Linear[3 + Axis] + Index);
+            const __m512 M2 = _mm512_loadu_ps(Linear[6 + Axis] + Index);
+
+            __m512 Center = _mm512_mul_ps(CX, M0);
+            Center = _mm512_add_ps(Center, _mm512_mul_ps(CY, M1));
+            Center = _mm512_add_ps(Center, _mm512_mul_ps(CZ, M2));
+            _mm512_storeu_ps(Out.Center[Axis] + Index, Center);
+
+            __m512 Extent = _mm512_mul_ps(EX, AbsAVX512(M0));
+            Extent = _mm512_add_ps(Extent, _mm512_mul_ps(EY, AbsAVX512(M1)));
+            Extent = _mm512_add_ps(Extent, _mm512_mul_ps(EZ, AbsAVX512(M2)));
+            _mm512_storeu_ps(Out.Extent[Axis] + Index, Extent);
+        }
+    }
+
+    if (NumVector < Num)
+    {
+        const float* const TailLinear[9] = {
+            Linear[0] + NumVector, Linear[1] + NumVector, Linear[2] + NumVector,
+            Linear[3] + NumVector, Linear[4] + NumVector, Linear[5] + NumVector,
+            Linear[6] + NumVector, Linear[7] + NumVector, Linear[8] + NumVector };
+        VectorKernelsPrivate::TransformBoundsPerBoxScalar(TailLinear,
+            VectorKernelsPrivate::OffsetStreams(In, NumVector),
+            VectorKernelsPrivate::OffsetStreams(Out, NumVector),
+            Num - NumVector);
+    }
+}
+
+/** Bit i set if box i of 16 lies outside any plane */
+inline __mmask16 OutsideMask16AVX512(const float* Planes, int32_t NumPlanes, __m512 CX, __m512 CY, __m512 CZ, __m512 EX, __m512 EY, __m512 EZ)
+{
+    __mmask16 Outside = 0;
+    for (int32_t PlaneIndex = 0; PlaneIndex < NumPlanes; ++PlaneIndex)
+    {
+        const float* Plane = Planes + PlaneIndex * 4;
+        const __m512 NX = _mm512_set1_ps(Plane[0]);
+        const __m512 NY = _mm512_set1_ps(Plane[1]);
+        const __m512 NZ = _mm512_set1_ps(Plane[2]);
+
+        __m512 Distance = _mm512_mul_ps(NX, CX);
+        Distance = _mm512_add_ps(Distance, _mm512_mul_ps(NY, CY));
+        Distance = _mm512_add_ps(Distance, _mm512_mul_ps(NZ, CZ));
+        Distance = _mm512_sub_ps(Distance, _mm512_set1_ps(Plane[3]));
+
+        __m512 PushOut = _mm512_mul_ps(AbsAVX512(NX), EX);
+        PushOut = _mm512_add_ps(PushOut, _mm512_mul_ps(AbsAVX512(NY), EY));
+        PushOut = _mm512_add_ps(PushOut, _mm512_mul_ps(AbsAVX512(NZ), EZ));
+
+        Outside |= _mm512_cmp_ps_mask(Distance, PushOut, _CMP_GT_OQ);
+    }
+    return Outside;
+}
+
+void CullBoxesAVX512(const float* Planes, int32_t NumPlanes, const FConstBoxStreams& Boxes, int32_t Num, uint32_t* OutVisibleWords)
+{
+    const int32_t NumFullWords = Num / 32;
+    for (int32_t Word = 0; Word < NumFullWords; ++Word)
+    {
+        uint32_t VisibleBits = 0;
+        for (int32_t Lane = 0; Lane < 32; Lane += Width)
+        {
+            const int32_t Index = Word * 32 + Lane;
+            const __mmask16 Outside = OutsideMask16AVX512(Planes, NumPlanes,
+                _mm512_loadu_ps(Boxes.Center[0] + Index), _mm512_loadu_ps(Boxes.Center[1] + Index), _mm512_loadu_ps(Boxes.Center[2] + Index),
+                _mm512_loadu_ps(Boxes.Extent[0] + Index), _mm512_loadu_ps(Boxes.Extent[1] + Index), _mm512_loadu_ps(Boxes.Extent[2] + Index));
+            VisibleBits |= static_cast<uint32_t>(~Outside & 0xFFFF) << Lane;
+        }
+        OutVisibleWords[Word] = VisibleBits;
+    }
+
+    const int32_t NumVector = NumFullWords * 32;
+    if (NumVector < Num)
+    {
+        VectorKernelsPrivate::CullBoxesScalar(Planes, NumPlanes,
+            VectorKernelsPrivate::OffsetStreams(Boxes, NumVector), Num - NumVector,
+            OutVisibleWords + NumFullWords);
+    }
+}
+
+/** One row of two blocks in a 16-wide register, Low in lanes 0-7 */
+inline __m512 LoadBlockPairAVX512(const float* Low, const float* High)
+{
+    return _mm512_insertf32x8(_mm512_castps256_ps512(_mm256_loadu_ps(Low)), _mm256_loadu_ps(High), 1);
+}
+
+void CullBoxBlocksAVX512(const float* Planes, int32_t NumPlanes, const FBoxBlock8* Blocks, int32_t Num, uint32_t* OutVisibleWords)
+{
+    for (int32_t Word = 0; Word * 32 < Num; ++Word)
+    {
+        // Partial last words test whole blocks and mask off the unused lanes; a
+        // missing second block of a pair is replaced by the first, never read
+        const int32_t NumInWord = Num - Word * 32;
+        const int32_t NumBlocks = NumInWord >= 32 ? 4 : (NumInWord + 7) / 8;
+        uint32_t VisibleBits = 0;
+        for (int32_t BlockIndex = 0; BlockIndex < NumBlocks; BlockIndex += 2)
+        {
+            const FBoxBlock8& Low = Blocks[Word * 4 + BlockIndex];
+            const FBoxBlock8& High = Blocks[Word * 4 + (BlockIndex + 1 < NumBlocks ? BlockIndex + 1 : BlockIndex)];
+            const __mmask16 Outside = OutsideMask16AVX512(Planes, NumPlanes,
+                LoadBlockPairAVX512(Low.Center[0], High.Center[0]), LoadBlockPairAVX512(Low.Center[1], High.Center[1]),
+                LoadBlockPairAVX512(Low.Center[2], High.Center[2]), LoadBlockPairAVX512(Low.Extent[0], High.Extent[0]),
+                LoadBlockPairAVX512(Low.Extent[1], High.Extent[1]), LoadBlockPairAVX512(Low.Extent[2], High.Extent[2]));
+            VisibleBits |= static_cast<uint32_t>(~Outside & 0xFFFF) << (BlockIndex * 8);
+        }
+        OutVisibleWords[Word] = VisibleBits & VectorKernelsPrivate::LowBitsMask(NumInWord);
+    }
+}
+
+/** Averages 2x2 blocks of two source rows into 16 destination pixels */
+inline __m512i Downsample16AVX512(const uint8_t* Row0, const uint8_t* Row1)
+{
+    const __m512i Zero = _mm512_setzero_si512();
+    __m512i Sum[2] = { Zero, Zero };
+
+    const uint8_t* const Rows[2] = { Row0, Row1 };
+    for (const uint8_t* Row : Rows)
+    {
+        // Shuffles stay within 128-bit lanes: lane k of Even holds pixels 4k, 4k+2, 4k+16, 4k+18
+        const __m512 A = _mm512_castsi512_ps(_mm512_loadu_si512(Row));
+        const __m512 B = _mm512_castsi512_ps(_mm512_loadu_si512(Row + 64));
+        const __m512i Even = _mm512_castps_si512(_mm512_shuffle_ps(A, B, _MM_SHUFFLE(2, 0, 2, 0)));
+        const __m512i Odd = _mm512_castps_si512(_mm512_shuffle_ps(A, B, _MM_SHUFFLE(3, 1, 3, 1)));
+        Sum[0] = _mm512_add_epi16(Sum[0], _mm512_add_epi16(_mm512_unpacklo_epi8(Even, Zero), _mm512_unpacklo_epi8(Odd, Zero)));
+        Sum[1] = _mm512_add_epi16(Sum[1], _mm512_add_epi16(_mm512_unpackhi_epi8(Even, Zero), _mm512_unpackhi_epi8(Odd, Zero)));
+    }
+
+    // Packing leaves destination pixel pairs in the order 0 4 1 5 2 6 3 7
+    const __m512i Packed = _mm512_packus_epi16(_mm512_srli_epi16(Sum[0], 2), _mm512_srli_epi16(Sum[1], 2));
+    return _mm512_permutexvar_epi64(_mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7), Packed);
+}
+
+void DownsampleRGBA8AVX512(const uint8_t* Src, uint32_t SrcWidth, uint32_t SrcHeight, uint8_t* Dst)
+{
+    // 1-wide or 1-tall sources clamp at the edge; leave them to the scalar kernel
+    if (SrcWidth < 2 || SrcHeight < 2)
+    {
+        VectorKernelsPrivate::DownsampleRGBA8Scalar(Src, SrcWidth, SrcHeight, Dst);
+        return;
+    }
+
+    const uint32_t DstWidth = SrcWidth / 2;
+    const uint32_t DstHeight = SrcHeight / 2;
+    const uint32_t NumVector = DstWidth & ~static_cast<uint32_t>(Width - 1);
+
+    for (uint32_t Y = 0; Y < DstHeight; ++Y)
+    {
+        const uint8_t* Row0 = Src + static_cast<size_t>(Y * 2) * SrcWidth * 4;
+        const uint8_t* Row1 = Row0 + static_cast<size_t>(SrcWidth) * 4;
+        uint8_t* Out = Dst + static_cast<size_t>(Y) * DstWidth * 4;
+
+        uint32_t X = 0;
+        for (; X < NumVector; X += Width)
+        {
+            _mm512_storeu_si512(Out + X * 4, Downsample16AVX512(Row0 + X * 8, Row1 + X * 8));
+        }
+        for (; X < DstWidth; ++X)
+        {
+            for (uint32_t Channel = 0; Channel < 4; ++Channel)
+            {
+                const uint32_t Offset = X * 8 + Channel;
+                Out[X * 4 + Channel] = static_cast<uint8_t>((Row0[Offset] + Row0[Offset + 4] + Row1[Offset] + Row1[Offset + 4]) >> 2);
+            }
+        }
+    }
+}
+
+} // namespace
+
+namespace VectorKernelsPrivate
+{
+
+const FVectorKernels* GetAVX512Kernels()
+{
+    static const FVectorKernels Kernels = {
+        &TransformPositionsAVX512,
+        &TransformBoundsAVX512,
+        &TransformBoundsPerBoxAVX512,
+        &CullBoxesAVX512,
+        &CullBoxBlocksAVX512,
+        &DownsampleRGBA8AVX512,
+        EVectorISA::AVX512
+    };
+    return &Kernels;
+}
+
+} // namespace VectorKernelsPrivate
+} // namespace Math
+} // namespace MonsterEngine
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#elif defined(__GNUC__)
+    #pragma GCC pop_options
+#endif
+
+#else // !x64
+
+namespace MonsterEngine
+{
+namespace Math
+{
+namespace VectorKernelsPrivate
+{
+
+const FVectorKernels* GetAVX512Kernels()
+{
+    return nullptr;
+}
+
+} // namespace VectorKernelsPrivate
+} // namespace Math
+} // namespace MonsterEngine
+
+#endif
@@ -0,0 +1,340 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+/**
+ * @file VectorKernelsSSE.cpp
+ * @brief SSE4.2 variants of the bulk vector kernels (4 floats per instruction)
+ *
+ * Everything is included before the target pragma so only the kernels below
+ * are compiled for SSE4.2. Floating-point contraction is disabled so results
+ * match the scalar kernels bit for bit.
+ */
+
+#include "Math/VectorKernels.h"
+
+#if defined(_M_X64) || defined(__x86_64__)
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+    #pragma clang attribute push(__attribute__((target("sse4.2"))), apply_to = function)
+#elif defined(__GNUC__)
+    #pragma GCC push_options
+    #pragma GCC target("sse4.2")
+    #pragma GCC optimize("fp-contract=off")
+#endif
+
+namespace MonsterEngine
+{
+namespace Math
+{
+namespace
+{
+
+constexpr int32_t Width = 4;
+
+inline __m128 AbsSSE(__m128 Value)
+{
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), Value);
+}
+
+void TransformPositionsSSE(const float* Matrix, const float* const In[3], float* const Out[3], int32_t Num)
+{
+    __m128 Rows[4][3];
+    for (int32_t Row = 0; Row < 4; ++Row)
+    {
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            Rows[Row][Axis] = _mm_set1_ps(Matrix[Row * 4 + Axis]);
+        }
+    }
+
+    const int32_t NumVector = Num & ~(Width - 1);
+    for (int32_t Index = 0; Index < NumVector; Index += Width)
+    {
+        const __m128 X = _mm_loadu_ps(In[0] + Index);
+        const __m128 Y = _mm_loadu_ps(In[1] + Index);
+        const __m128 Z = _mm_loadu_ps(In[2] + Index);
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            __m128 Result = _mm_mul_ps(X, Rows[0][Axis]);
+            Result = _mm_add_ps(Result, _mm_mul_ps(Y, Rows[1][Axis]));
+            Result = _mm_add_ps(Result, _mm_mul_ps(Z, Rows[2][Axis]));
+            _mm_storeu_ps(Out[Axis] + Index, _mm_add_ps(Result, Rows[3][Axis]));
+        }
+    }
+
+    if (NumVector < Num)
+    {
+        const float* const TailIn[3] = { In[0] + NumVector, In[1] + NumVector, In[2] + NumVector };
+        float* const TailOut[3] = { Out[0] + NumVector, Out[1] + NumVector, Out[2] + NumVector };
+        VectorKernelsPrivate::TransformPositionsScalar(Matrix, TailIn, TailOut, Num - NumVector);
+    }
+}
+
+void TransformBoundsSSE(const float* Matrix, const FConstBoxStreams& In, const FBoxStreams& Out, int32_t Num)
+{
+    __m128 Rows[4][3];
+    __m128 AbsRows[3][3];
+    for (int32_t Row = 0; Row < 4; ++Row)
+    {
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            Rows[Row][Axis] = _mm_set1_ps(Matrix[Row * 4 + Axis]);
+            if (Row < 3)
+            {
+                AbsRows[Row][Axis] = AbsSSE(Rows[Row][Axis]);
+            }
+        }
+    }
+
+    const int32_t NumVector = Num & ~(Width - 1);
+    for (int32_t Index = 0; Index < NumVector; Index += Width)
+    {
+        const __m128 CX = _mm_loadu_ps(In.Center[0] + Index);
+        const __m128 CY = _mm_loadu_ps(In.Center[1] + Index);
+        const __m128 CZ = _mm_loadu_ps(In.Center[2] + Index);
+        const __m128 EX = _mm_loadu_ps(In.Extent[0] + Index);
+        const __m128 EY = _mm_loadu_ps(In.Extent[1] + Index);
+        const __m128 EZ = _mm_loadu_ps(In.Extent[2] + Index);
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            __m128 Center = _mm_mul_ps(CX, Rows[0][Axis]);
+            Center = _mm_add_ps(Center, _mm_mul_ps(CY, Rows[1][Axis]));
+            Center = _mm_add_ps(Center, _mm_mul_ps(CZ, Rows[2][Axis]));
+            _mm_storeu_ps(Out.Center[Axis] + Index, _mm_add_ps(Center, Rows[3][Axis]));
+
+            __m128 Extent = _mm_mul_ps(EX, AbsRows[0][Axis]);
+            Extent = _mm_add_ps(Extent, _mm_mul_ps(EY, AbsRows[1][Axis]));
+            Extent = _mm_add_ps(Extent, _mm_mul_ps(EZ, AbsRows[2][Axis]));
+            _mm_storeu_ps(Out.Extent[Axis] + Index, Extent);
+        }
+    }
+
+    if (NumVector < Num)
+    {
+        VectorKernelsPrivate::TransformBoundsScalar(Matrix,
+            VectorKernelsPrivate::OffsetStreams(In, NumVector),
+            VectorKernelsPrivate::OffsetStreams(Out, NumVector),
+            Num - NumVector);
+    }
+}
+
+void TransformBoundsPerBoxSSE(const float* const Linear[9], const FConstBoxStreams& In, const FBoxStreams& Out, int32_t Num)
+{
+    const int32_t NumVector = Num & ~(Width - 1);
+    for (int32_t Index = 0; Index < NumVector; Index += Width)
+    {
+        const __m128 CX = _mm_loadu_ps(In.Center[0] + Index);
+        const __m128 CY = _mm_loadu_ps(In.Center[1] + Index);
+        const __m128 CZ = _mm_loadu_ps(In.Center[2] + Index);
+        const __m128 EX = _mm_loadu_ps(In.Extent[0] + Index);
+        const __m128 EY = _mm_loadu_ps(In.Extent[1] + Index);
+        const __m128 EZ = _mm_loadu_ps(In.Extent[2] + Index);
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            const __m128 M0 = _mm_loadu_ps(Linear[Axis] + Index);
+            const __m128 M1 = _mm_loadu_ps(Linear[3 + Axis] + Index);
+            const __m128 M2 = _mm_loadu_ps(Linear[6 + Axis] + Index);
+
+            __m128 Center = _mm_mul_ps(CX, M0);
+            Center = _mm_add_ps(Center, _mm_mul_ps(CY, M1));
+            Center = _mm_add_ps(Center, _mm_mul_ps(CZ, M2));
+            _mm_storeu_ps(Out.Center[Axis] + Index, Center);
+
+            __m128 Extent = _mm_mul_ps(EX, AbsSSE(M0));
+            Extent = _mm_add_ps(Extent, _mm_mul_ps(EY, AbsSSE(M1)));
+            Extent = _mm_add_ps(Extent, _mm_mul_ps(EZ, AbsSSE(M2)));
+            _mm_storeu_ps(Out.Extent[Axis] + Index, Extent);
+        }
+    }
+
+    if (NumVector < Num)
+    {
+        const float* const TailLinear[9] = {
+            Linear[0] + NumVector, Linear[1] + NumVector, Linear[2] + NumVector,
+            Linear[3] + NumVector, Linear[4] + NumVector, Linear[5] + NumVector,
+            Linear[6] + NumVector, Linear[7] + NumVector, Linear[8] + NumVector };
+        VectorKernelsPrivate::TransformBoundsPerBoxScalar(TailLinear,
+            VectorKernelsPrivate::OffsetStreams(In, NumVector),
+            VectorKernelsPrivate::OffsetStreams(Out, NumVector),
+            Num - NumVector);
+    }
+}
+
+/** Bit i set if box i of 4 lies outside any plane */
+inline uint32_t OutsideMask4SSE(const float* Planes, int32_t NumPlanes, const float* const Center[3], const float* const Extent[3], int32_t Offset)
+{
+    const __m128 CX = _mm_loadu_ps(Center[0] + Offset);
+    const __m128 CY = _mm_loadu_ps(Center[1] + Offset);
+    const __m128 CZ = _mm_loadu_ps(Center[2] + Offset);
+    const __m128 EX = _mm_loadu_ps(Extent[0] + Offset);
+    const __m128 EY = _mm_loadu_ps(Extent[1] + Offset);
+    const __m128 EZ = _mm_loadu_ps(Extent[2] + Offset);
+
+    __m128 Outside = _mm_setzero_ps();
+    for (int32_t PlaneIndex = 0; PlaneIndex < NumPlanes; ++PlaneIndex)
+    {
+        const float* Plane = Planes + PlaneIndex * 4;
+        const __m128 NX = _mm_set1_ps(Plane[0]);
+        const __m128 NY = _mm_set1_ps(Plane[1]);
+        const __m128 NZ = _mm_set1_ps(Plane[2]);
+
+        __m128 Distance = _mm_mul_ps(NX, CX);
+        Distance = _mm_add_ps(Distance, _mm_mul_ps(NY, CY));
+        Distance = _mm_add_ps(Distance, _mm_mul_ps(NZ, CZ));
+        Distance = _mm_sub_ps(Distance, _mm_set1_ps(Plane[3]));
+
+        __m128 PushOut = _mm_mul_ps(AbsSSE(NX), EX);
+        PushOut = _mm_add_ps(PushOut, _mm_mul_ps(AbsSSE(NY), EY));
+        PushOut = _mm_add_ps(PushOut, _mm_mul_ps(AbsSSE(NZ), EZ));
+
+        Outside = _mm_or_ps(Outside, _mm_cmpgt_ps(Distance, PushOut));
+    }
+    return static_cast<uint32_t>(_mm_movemask_ps(Outside));
+}
+
+void CullBoxesSSE(const float* Planes, int32_t NumPlanes, const FConstBoxStreams& Boxes, int32_t Num, uint32_t* OutVisibleWords)
+{
+    const int32_t NumFullWords = Num / 32;
+    for (int32_t Word = 0; Word < NumFullWords; ++Word)
+    {
+        uint32_t VisibleBits = 0;
+        for (int32_t Lane = 0; Lane < 32; Lane += Width)
+        {
+            VisibleBits |= (~OutsideMask4SSE(Planes, NumPlanes, Boxes.Center, Boxes.Extent, Word * 32 + Lane) & 0xF) << Lane;
+        }
+        OutVisibleWords[Word] = VisibleBits;
+    }
+
+    const int32_t NumVector = NumFullWords * 32;
+    if (NumVector < Num)
+    {
+        VectorKernelsPrivate::CullBoxesScalar(Planes, NumPlanes,
+            VectorKernelsPrivate::OffsetStreams(Boxes, NumVector), Num - NumVector,
+            OutVisibleWords + NumFullWords);
+    }
+}
+
+void CullBoxBlocksSSE(const float* Planes, int32_t NumPlanes, const FBoxBlock8* Blocks, int32_t Num, uint32_t* OutVisibleWords)
+{
+    for (int32_t Word = 0; Word * 32 < Num; ++Word)
+    {
+        // Partial last words test whole blocks and mask off the unused lanes
+        const int32_t NumInWord = Num - Word * 32;
+        const int32_t NumBlocks = NumInWord >= 32 ? 4 : (NumInWord + 7) / 8;
+        uint32_t VisibleBits = 0;
+        for (int32_t BlockIndex = 0; BlockIndex < NumBlocks; ++BlockIndex)
+        {
+            const FBoxBlock8& Block = Blocks[Word * 4 + BlockIndex];
+            const float* const Center[3] = { Block.Center[0], Block.Center[1], Block.Center[2] };
+            const float* const Extent[3] = { Block.Extent[0], Block.Extent[1], Block.Extent[2] };
+            const uint32_t Outside = OutsideMask4SSE(Planes, NumPlanes, Center, Extent, 0) | (OutsideMask4SSE(Planes, NumPlanes, Center, Extent, Width) << Width);
+            VisibleBits |= (~Outside & 0xFF) << (BlockIndex * 8);
+        }
+        OutVisibleWords[Word] = VisibleBits & VectorKernelsPrivate::LowBitsMask(NumInWord);
+    }
+}
+
+/** Averages 2x2 blocks of two source rows into 4 destination pixels */
+inline __m128i Downsample4SSE(const uint8_t* Row0, const uint8_t* Row1)
+{
+    const __m128i Zero = _mm_setzero_si128();
+    __m128i Sum[2] = { Zero, Zero };
+
+    const uint8_t* const Rows[2] = { Row0, Row1 };
+    for (const uint8_t* Row : Rows)
+    {
+        const __m128 A = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Row)));
+        const __m128 B = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Row + 16)));
+        const __m128i Even = _mm_castps_si128(_mm_shuffle_ps(A, B, _MM_SHUFFLE(2, 0, 2, 0)));
+        const __m128i Odd = _mm_castps_si128(_mm_shuffle_ps(A, B, _MM_SHUFFLE(3, 1, 3, 1)));
+        Sum[0] = _mm_add_epi16(Sum[0], _mm_add_epi16(_mm_unpacklo_epi8(Even, Zero), _mm_unpacklo_epi8(Odd, Zero)));
+        Sum[1] = _mm_add_epi16(Sum[1], _mm_add_epi16(_mm_unpackhi_epi8(Even, Zero), _mm_unpackhi_epi8(Odd, Zero)));
+    }
+
+    return _mm_packus_epi16(_mm_srli_epi16(Sum[0], 2), _mm_srli_epi16(Sum[1], 2));
+}
+
+void DownsampleRGBA8SSE(const uint8_t* Src, uint32_t SrcWidth, uint32_t SrcHeight, uint8_t* Dst)
+{
+    // 1-wide or 1-tall sources clamp at the edge; leave them to the scalar kernel
+    if (SrcWidth < 2 || SrcHeight < 2)
+    {
+        VectorKernelsPrivate::DownsampleRGBA8Scalar(Src, SrcWidth, SrcHeight, Dst);
+        return;
+    }
+
+    const uint32_t DstWidth = SrcWidth / 2;
+    const uint32_t DstHeight = SrcHeight / 2;
+    const uint32_t NumVector = DstWidth & ~static_cast<uint32_t>(Width - 1);
+
+    for (uint32_t Y = 0; Y < DstHeight; ++Y)
+    {
+        const uint8_t* Row0 = Src + static_cast<size_t>(Y * 2) * SrcWidth * 4;
+        const uint8_t* Row1 = Row0 + static_cast<size_t>(SrcWidth) * 4;
+        uint8_t* Out = Dst + static_cast<size_t>(Y) * DstWidth * 4;
+
+        uint32_t X = 0;
+        for (; X < NumVector; X += Width)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(Out + X * 4), Downsample4SSE(Row0 + X * 8, Row1 + X * 8));
+        }
+        for (; X < DstWidth; ++X)
+        {
+            for (uint32_t Channel = 0; Channel < 4; ++Channel)
+            {
+                const uint32_t Offset = X * 8 + Channel;
+                Out[X * 4 + Channel] = static_cast<uint8_t>((Row0[Offset] + Row0[Offset + 4] + Row1[Offset] + Row1[Offset + 4]) >> 2);
+            }
+        }
+    }
+}
+
+} // namespace
+
+namespace VectorKernelsPrivate
+{
+
+const FVectorKernels* GetSSE42Kernels()
+{
+    static const FVectorKernels Kernels = {
+        &TransformPositionsSSE,
+        &TransformBoundsSSE,
+        &TransformBoundsPerBoxSSE,
+        &CullBoxesSSE,
+        &CullBoxBlocksSSE,
+        &DownsampleRGBA8SSE,
+        EVectorISA::SSE42
+    };
+    return &Kernels;
+}
+
+} // namespace VectorKernelsPrivate
+} // namespace Math
+} // namespace MonsterEngine
+
+#if defined(__clang__)
+    #pragma clang attribute pop
+#elif defined(__GNUC__)
+    #pragma GCC pop_options
+#endif
+
+#else // !x64
+
+namespace MonsterEngine
+{
+namespace Math
+{
+namespace VectorKernelsPrivate
+{
+
+const FVectorKernels* GetSSE42Kernels()
+{
+    return nullptr;
+}
+
+} // namespace VectorKernelsPrivate
+} // namespace Math
+} // namespace MonsterEngine
+
+#endif
@@ -19,7 +19,8 @@ using namespace Vulkan;
 // ============================================================================
 
 FVulkanMemoryPool::FVulkanMemoryPool(VkDevice InDevice, VkDeviceSize InPoolSize, 
-                                     uint32 InMemoryTypeIndex, bool bInHostVisible)
+                                     uint32 InMemoryTypeIndex, bool bInHostVisible,
+                                     ESubAllocatorMode InMode)
     : Device(InDevice)
     , DeviceMemory(VK_NULL_HANDLE)
     , PersistentMappedPtr(nullptr)
@@ -27,7 +28,7 @@ FVulkanMemoryPool::FVulkanMemoryPool(VkDevice InDevice, VkDeviceSize InPoolSize,
     , MemoryTypeIndex(InMemoryTypeIndex)
     , bHostVisible(bInHostVisible)
     , UsedSize(0)
-    , FreeList(nullptr)
+    , SubAllocator(InPoolSize, InMode)
 {
     const auto& functions = VulkanAPI::getFunctions();
     
@@ -53,29 +54,16 @@ FVulkanMemoryPool::FVulkanMemoryPool(VkDevice InDevice, VkDeviceSize InPoolSize,
         }
     }
     
-    // Initialize Free-List: entire pool as one large free block using FMemory
-    FreeList = FMemory::New<FMemoryBlock>(0, PoolSize, true);
-    
     MR_LOG_INFO("FVulkanMemoryPool: Created " + std::to_string(PoolSize / (1024 * 1024)) + 
                 "MB pool (Type Index: " + std::to_string(MemoryTypeIndex) + 
-                (bHostVisible ? ", Host" : ", Device") + ")");
+                (bHostVisible ? ", Host" : ", Device") +
+                (InMode == ESubAllocatorMode::Ring ? ", Ring" : "") + ")");
 }
 
 FVulkanMemoryPool::~FVulkanMemoryPool()
 {
-    // CRITICAL: Do NOT call FMemory::Delete() in destructor!
-    // The global memory allocator (FMallocBinned2) may already be destroyed.
-    // Memory blocks will be leaked, but this is acceptable during shutdown.
-    // Proper cleanup should be done via explicit Shutdown() before destruction.
-    
     const auto& functions = VulkanAPI::getFunctions();
     
-    // WARNING: Intentionally NOT freeing FMemoryBlock nodes here
-    // They were allocated with FMemory::New() but we cannot safely call FMemory::Delete()
-    // during static destruction. This is a known limitation.
-    // The OS will reclaim all process memory anyway.
-    FreeList = nullptr;
-    
     // Unmap memory (safe - just a Vulkan call)
     if (PersistentMappedPtr) {
         functions.vkUnmapMemory(Device, DeviceMemory);
@@ -95,117 +83,59 @@ bool FVulkanMemoryPool::Allocate(VkDeviceSize Size, VkDeviceSize Alignment, FVul
 {
     std::lock_guard<std::mutex> lock(PoolMutex);
     
-    // Use First-Fit algorithm to find suitable free block
-    FMemoryBlock* current = FreeList;
-    FMemoryBlock* prev = nullptr;
+    FRHISubAllocation range;
+    if (!SubAllocator.Allocate(Size, Alignment, range)) {
+        MR_LOG_DEBUG("FVulkanMemoryPool: Cannot allocate " + std::to_string(Size / 1024) + "KB (pool full)");
+        return false;
+    }
+    UsedSize.store(SubAllocator.GetUsedSize());
     
-    while (current) {
-        if (current->bFree) {
-            // Calculate aligned offset
-VkDeviceSize alignedOffset = (current->Offset + Alignment - 1) & ~(Alignment - 1);
-            VkDeviceSize padding = alignedOffset - current->Offset;
-            VkDeviceSize requiredSize = padding + Size;
-            
-            if (requiredSize <= current->Size) {
-                // Found suitable block, split it if necessary
-                
-                // Step 1: Create padding block if needed
-                if (padding > 0) {
-                    FMemoryBlock* paddingBlock = FMemory::New<FMemoryBlock>(current->Offset, padding, true);
-                    paddingBlock->Next = current;
-                    paddingBlock->Prev = prev;
-                    
-                    if (prev) {
-                        prev->Next = paddingBlock;
-                    } else {
-                        FreeList = paddingBlock;
-                    }
-                    
-                    current->Offset += padding;
-                    current->Size -= padding;
-                    prev = paddingBlock;
-                }
-                
-                // Step 2: Split remainder block if allocated size is smaller than free block
-                if (current->Size > Size) {
-                    FMemoryBlock* remainder = FMemory::New<FMemoryBlock>(
-                        current->Offset + Size,
-                        current->Size - Size,
-                        true
-                    );
-                    remainder->Next = current->Next;
-                    remainder->Prev = current;
-                    
-                    if (current->Next) {
-                        current->Next->Prev = remainder;
-                    }
-                    current->Next = remainder;
-                    
-                    current->Size = Size;
-                }
-                
-                // Step 3: Mark block as used
-                current->bFree = false;
-                UsedSize.fetch_add(current->Size);
-                
-                // Step 4: Fill allocation structure
-                OutAllocation.DeviceMemory = DeviceMemory;
-                OutAllocation.Offset = current->Offset;
-                OutAllocation.Size = current->Size;
-                OutAllocation.MemoryTypeIndex = MemoryTypeIndex;
-                OutAllocation.MappedPointer = nullptr;
-                OutAllocation.bDedicated = false;
-                OutAllocation.bMapped = false;
-                OutAllocation.Pool = this;
-                OutAllocation.AllocationHandle = current;
-                
-                // Set mapped pointer for host visible memory
-                if (PersistentMappedPtr) {
-                    OutAllocation.MappedPointer = static_cast<uint8*>(PersistentMappedPtr) + current->Offset;
-                    OutAllocation.bMapped = true;
-                }
-                
-                MR_LOG_DEBUG("FVulkanMemoryPool: Sub-allocated " + std::to_string(Size / 1024) + 
-                             "KB (offset: " + std::to_string(current->Offset) + 
-                             ", utilization: " + std::to_string(UsedSize.load() * 100 / PoolSize) + "%)");
-                
-                return true;
-            }
-        }
-        
-        prev = current;
-        current = current->Next;
+    OutAllocation.DeviceMemory = DeviceMemory;
+    OutAllocation.Offset = range.Offset;
+    OutAllocation.Size = Size;
+    OutAllocation.MemoryTypeIndex = MemoryTypeIndex;
+    OutAllocation.MappedPointer = nullptr;
+    OutAllocation.bDedicated = false;
+    OutAllocation.bMapped = false;
+    OutAllocation.Pool = this;
+    OutAllocation.AllocationHandle = range.Handle;
+    
+    // Set mapped pointer for host visible memory
+    if (PersistentMappedPtr) {
+        OutAllocation.MappedPointer = static_cast<uint8*>(PersistentMappedPtr) + range.Offset;
+        OutAllocation.bMapped = true;
     }
     
-    // No suitable block found
-    MR_LOG_DEBUG("FVulkanMemoryPool: Cannot allocate " + std::to_string(Size / 1024) + "KB (pool full)");
-    return false;
+    MR_LOG_DEBUG("FVulkanMemoryPool: Sub-allocated " + std::to_string(Size / 1024) + 
+                 "KB (offset: " + std::to_string(range.Offset) + 
+                 ", utilization: " + std::to_string(UsedSize.load() * 100 / PoolSize) + "%)");
+    
+    return true;
 }
 
 void FVulkanMemoryPool::Free(const FVulkanAllocation& Allocation)
 {
     std::lock_guard<std::mutex> lock(PoolMutex);
     
-    FMemoryBlock* block = static_cast<FMemoryBlock*>(Allocation.AllocationHandle);
-    if (!block) {
-        MR_LOG_ERROR("FVulkanMemoryPool::Free: Invalid block pointer");
+    // Ring pools release whole frames instead
+    if (SubAllocator.GetMode() == ESubAllocatorMode::Ring) {
         return;
     }
     
-    if (block->bFree) {
-        MR_LOG_WARNING("FVulkanMemoryPool::Free: Trying to free already free block");
+    if (Allocation.AllocationHandle == FRHISubAllocation::INVALID_HANDLE) {
+        MR_LOG_ERROR("FVulkanMemoryPool::Free: Invalid allocation handle");
         return;
     }
     
-    // Mark block as free
-    block->bFree = true;
-    UsedSize.fetch_sub(block->Size);
+    FRHISubAllocation range;
+    range.Offset = Allocation.Offset;
+    range.Size = Allocation.Size;
+    range.Handle = Allocation.AllocationHandle;
+    SubAllocator.Free(range);
+    UsedSize.store(SubAllocator.GetUsedSize());
     
-    MR_LOG_DEBUG("FVulkanMemoryPool: Freed " + std::to_string(block->Size / 1024) + 
+    MR_LOG_DEBUG("FVulkanMemoryPool: Freed " + std::to_string(Allocation.Size / 1024) + 
                  "KB (utilization: " + std::to_string(UsedSize.load() * 100 / PoolSize) + "%)");
-    
-    // Merge adjacent free blocks to reduce fragmentation
-    MergeFreeBlocks();
 }
 
 bool FVulkanMemoryPool::Map(FVulkanAllocation& Allocation, void** OutMappedPtr)
@@ -259,54 +189,28 @@ void FVulkanMemoryPool::Unmap(FVulkanAllocation& Allocation)
     Allocation.bMapped = false;
 }
 
-void FVulkanMemoryPool::Defragment()
+VkDeviceSize FVulkanMemoryPool::GetLargestFreeBlock()
 {
     std::lock_guard<std::mutex> lock(PoolMutex);
-    MergeFreeBlocks();
+    return SubAllocator.GetLargestFreeBlock();
 }
 
-void FVulkanMemoryPool::MergeFreeBlocks()
+void FVulkanMemoryPool::EndFrame(uint64 FenceValue)
 {
-    // Iterate through free list and merge adjacent free blocks
-    FMemoryBlock* current = FreeList;
-    
-    while (current && current->Next) {
-        if (current->bFree && current->Next->bFree) {
-            // Merge current and Next blocks
-            FMemoryBlock* next = current->Next;
-            current->Size += next->Size;
-            current->Next = next->Next;
-            
-            if (next->Next) {
-                next->Next->Prev = current;
-            }
-            
-            FMemory::Delete(next);
-            // Continue from current block (don't advance)
-        } else {
-            current = current->Next;
-        }
-    }
+    std::lock_guard<std::mutex> lock(PoolMutex);
+    SubAllocator.EndFrame(FenceValue);
 }
 
-FVulkanMemoryPool::FMemoryBlock* FVulkanMemoryPool::FindFirstFit(VkDeviceSize Size, VkDeviceSize Alignment)
+void FVulkanMemoryPool::ReleaseCompletedFrames(uint64 CompletedFenceValue)
 {
-    FMemoryBlock* current = FreeList;
-    
-    while (current) {
-        if (current->bFree) {
-            VkDeviceSize alignedOffset = (current->Offset + Alignment - 1) & ~(Alignment - 1);
-            VkDeviceSize padding = alignedOffset - current->Offset;
-            VkDeviceSize requiredSize = padding + Size;
-            
-            if (requiredSize <= current->Size) {
-                return current;
-            }
-        }
-        current = current->Next;
-    }
-    
-    return nullptr;
+    std::lock_guard<std::mutex> lock(PoolMutex);
+    SubAllocator.ReleaseCompletedFrames(CompletedFenceValue);
+    UsedSize.store(SubAllocator.GetUsedSize());
+}
+
+void FVulkanMemoryPool::Defragment()
+{
+    // Nothing to merge: the sub-allocator coalesces free blocks as they are freed
 }
 
 // ============================================================================
@@ -393,6 +297,7 @@ bool FVulkanMemoryManager::Allocate(const FAllocationRequest& Request, FVulkanAl
         if (result) {
             TotalAllocationCount.fetch_add(1);
             TotalAllocatedMemory.fetch_add(Request.Size);
+            TrackAllocation(OutAllocation);
         }
         return result;
     }
@@ -405,6 +310,7 @@ bool FVulkanMemoryManager::Allocate(const FAllocationRequest& Request, FVulkanAl
             if (pool->Allocate(Request.Size, Request.Alignment, OutAllocation)) {
                 TotalAllocationCount.fetch_add(1);
                 TotalAllocatedMemory.fetch_add(Request.Size);
+                TrackAllocation(OutAllocation);
                 
                 MR_LOG_DEBUG("FVulkanMemoryManager: Allocated from existing pool " + 
                              std::to_string(Request.Size / 1024) + "KB");
@@ -426,6 +332,7 @@ bool FVulkanMemoryManager::Allocate(const FAllocationRequest& Request, FVulkanAl
     if (newPool->Allocate(Request.Size, Request.Alignment, OutAllocation)) {
         TotalAllocationCount.fetch_add(1);
         TotalAllocatedMemory.fetch_add(Request.Size);
+        TrackAllocation(OutAllocation);
         
         MR_LOG_DEBUG("FVulkanMemoryManager: Allocated from new pool " + 
                      std::to_string(Request.Size / 1024) + "KB");
@@ -444,6 +351,9 @@ void FVulkanMemoryManager::Free(FVulkanAllocation& Allocation)
     }
     
     TotalAllocatedMemory.fetch_sub(Allocation.Size);
+    if (Allocation.bLLMTracked) {
+        FLowLevelMemTracker::OnFreeTagged(ELLMTracker::GPU, Allocation.LLMTag, Allocation.Size);
+    }
     
     if (Allocation.bDedicated) {
         FreeDedicated(Allocation);
@@ -459,6 +369,15 @@ void FVulkanMemoryManager::Free(FVulkanAllocation& Allocation)
     Allocation = FVulkanAllocation{};
 }
 
+void FVulkanMemoryManager::TrackAllocation(FVulkanAllocation& Allocation)
+{
+    Allocation.bLLMTracked = FLowLevelMemTracker::IsEnabled();
+    if (Allocation.bLLMTracked) {
+        Allocation.LLMTag = FLowLevelMemTracker::GetActiveTag();
+        FLowLevelMemTracker::OnAllocTagged(ELLMTracker::GPU, Allocation.LLMTag, Allocation.Size);
+    }
+}
+
 bool FVulkanMemoryManager::MapMemory(FVulkanAllocation& Allocation, void** OutMappedPtr)
 {
     if (!Allocation.IsValid()) {
@@ -542,9 +461,9 @@ void FVulkanMemoryManager::GetMemoryStats(FMemoryStats& OutStats)
             OutStats.TotalReserved += pool->GetPoolSize();
             OutStats.PoolCount++;
             
-            VkDeviceSize freeSize = pool->GetFreeSize();
-            if (freeSize > OutStats.LargestFreeBlock) {
-                OutStats.LargestFreeBlock = freeSize;
+            VkDeviceSize largestFree = pool->GetLargestFreeBlock();
+            if (largestFree > OutStats.LargestFreeBlock) {
+                OutStats.LargestFreeBlock = largestFree;
             }
             
             // Categorize by memory type
@@ -662,7 +581,7 @@ bool FVulkanMemoryManager::AllocateDedicated(const FAllocationRequest& Request,
     OutAllocation.bDedicated = true;
     OutAllocation.bMapped = false;
     OutAllocation.Pool = nullptr;
-    OutAllocation.AllocationHandle = nullptr;
+    OutAllocation.AllocationHandle = FRHISubAllocation::INVALID_HANDLE;
     
     DedicatedAllocationCount.fetch_add(1);
     
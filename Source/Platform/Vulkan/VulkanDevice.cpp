@@ -16,6 +16,7 @@
 #include "Platform/Vulkan/VulkanCommandListContext.h"
 #include "Core/Log.h"
 #include "Core/Logging/LogMacros.h"
+#include "Core/HAL/LowLevelMemTracker.h"
 
 #include <set>
 #include <algorithm>
@@ -64,6 +65,7 @@ namespace MonsterRender::RHI::Vulkan {
     }
     
     bool VulkanDevice::initialize(const RHICreateInfo& createInfo) {
+        LLM_SCOPE(ELLMTag::RHI);
         MR_LOG_INFO("Initializing Vulkan device...");
         
         // Initialize Vulkan API first
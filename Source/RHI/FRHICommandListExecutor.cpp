@@ -2,6 +2,7 @@
 
 #include "RHI/FRHICommandListExecutor.h"
 #include "RHI/FRHIThread.h"
+#include "Core/FTaskTracer.h"
 #include "Core/Log.h"
 
 namespace MonsterEngine {
@@ -124,6 +125,18 @@ FGraphEventRef FRHICommandListExecutor::QueueAsyncCommandListSubmit(
     // Create completion event
     auto completionEvent = MakeGraphEvent();
 
+    // Connect the submit to the tasks that recorded the command list
+    uint64 traceId = 0;
+    if (FTaskTracer::IsEnabled()) {
+        traceId = FTaskTracer::AllocateTaskId();
+        completionEvent->SetTraceId(traceId);
+        for (const auto& Prerequisite : Prerequisites) {
+            if (Prerequisite) {
+                FTaskTracer::RecordDependency(Prerequisite->GetTraceId(), traceId);
+            }
+        }
+    }
+
     // Queue the command list
     {
         std::lock_guard<std::mutex> lock(m_queueMutex);
@@ -136,9 +149,12 @@ FGraphEventRef FRHICommandListExecutor::QueueAsyncCommandListSubmit(
     // Submit to RHI thread
     if (m_bUseRHIThread) {
         // Queue task to RHI thread that waits for prerequisites then executes
-        FRHIThread::QueueTask([this, CommandList, Prerequisites, completionEvent]() {
+        FRHIThread::QueueTask([this, CommandList, Prerequisites, completionEvent, traceId]() {
+            FScopedTaskTrace traceScope("AsyncCommandListSubmit", traceId);
+
             // Wait for prerequisites
             if (!Prerequisites.empty()) {
+                MR_TRACE_SCOPE("WaitForCommandListPrerequisites");
                 WaitForEvents(Prerequisites);
             }
 
@@ -213,6 +229,8 @@ void FRHICommandListExecutor::ExecuteCommandList(MonsterRender::RHI::IRHICommand
         return;
     }
 
+    MR_TRACE_SCOPE("ExecuteCommandList");
+
     MR_LOG_DEBUG("FRHICommandListExecutor::ExecuteCommandList - Executing command list");
 
     // TODO: Implement actual command list execution
@@ -174,15 +174,13 @@ FGraphEventRef FRHICommandListParallelTranslator::QueueParallelTranslateInternal
         
         // Dispatch translation tasks to worker threads
         for (auto& task : tasks) {
-            // Determine task priority based on translation priority
-            String taskName = "ParallelTranslate_" + std::to_string(task.taskIndex);
-            
             FGraphEventRef taskEvent = FTaskGraph::QueueNamedTask(
-                taskName,
+                "ParallelTranslate",
                 [this, task]() {
                     TranslateCommandList(task);
                 },
-                {} // No prerequisites for now
+                {}, // No prerequisites for now
+                ETaskPriority::High // On the frame's critical path
             );
             
             // Store the task event
@@ -200,7 +198,8 @@ FGraphEventRef FRHICommandListParallelTranslator::QueueParallelTranslateInternal
             [completionEvent = context->completionEvent]() {
                 completionEvent->Complete();
             },
-            translationEvents // Wait for all translation tasks
+            translationEvents, // Wait for all translation tasks
+            ETaskPriority::High
         );
         
         m_parallelTranslations.fetch_add(1, std::memory_order_relaxed);
@@ -1,6 +1,7 @@
 // Copyright Monster Engine. All Rights Reserved.
 
 #include "RHI/FRHIThread.h"
+#include "Core/FTaskTracer.h"
 #include "Core/Log.h"
 #include <thread>
 
@@ -179,6 +180,9 @@ bool FRHIThread::Init() {
     m_rhiThreadID.store(static_cast<uint32>(std::hash<std::thread::id>{}(std::this_thread::get_id())), 
                        std::memory_order_release);
 
+    // Run task graph tasks targeted at the RHI thread here
+    FTaskGraph::AttachToThread(ENamedThread::RHIThread, &FRHIThread::OnTaskGraphTaskQueued);
+
     MR_LOG_INFO("FRHIThread::Init - RHI thread initialized (ThreadID: " + 
                std::to_string(m_rhiThreadID.load()) + ")");
     return true;
@@ -198,9 +202,20 @@ void FRHIThread::Stop() {
 }
 
 void FRHIThread::Exit() {
+    FTaskGraph::DetachFromThread(ENamedThread::RHIThread);
     MR_LOG_INFO("FRHIThread::Exit - RHI thread exited");
 }
 
+void FRHIThread::OnTaskGraphTaskQueued() {
+    if (!s_instance) {
+        return;
+    }
+
+    // Lock so the wakeup can not slip in between the predicate check and the wait
+    std::lock_guard<std::mutex> lock(s_instance->m_queueMutex);
+    s_instance->m_queueCV.notify_one();
+}
+
 void FRHIThread::ProcessTasks() {
     while (!m_bIsShuttingDown.load(std::memory_order_acquire)) {
         FRHIThreadTask task;
@@ -213,7 +228,10 @@ void FRHIThread::ProcessTasks() {
             try {
                 MR_LOG_DEBUG("FRHIThread::ProcessTasks - Executing RHI task");
 
-                task();
+                {
+                    FScopedTaskTrace traceScope("RHIThreadTask", event ? event->GetTraceId() : 0);
+                    task();
+                }
 
                 // Mark completion event as complete
                 if (event) {
@@ -232,11 +250,13 @@ void FRHIThread::ProcessTasks() {
             }
 
             m_activeTasks.fetch_sub(1, std::memory_order_relaxed);
-        } else {
+        } else if (FTaskGraph::ProcessThreadUntilIdle(ENamedThread::RHIThread) == 0) {
             // No tasks available, wait
             std::unique_lock<std::mutex> lock(m_queueMutex);
             m_queueCV.wait_for(lock, std::chrono::milliseconds(10), [this]() {
-                return !m_taskQueue.empty() || m_bIsShuttingDown.load(std::memory_order_acquire);
+                return !m_taskQueue.empty() ||
+                       FTaskGraph::HasPendingThreadTasks(ENamedThread::RHIThread) ||
+                       m_bIsShuttingDown.load(std::memory_order_acquire);
             });
         }
     }
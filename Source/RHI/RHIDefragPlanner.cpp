@@ -0,0 +1,216 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// MonsterEngine - Incremental GPU memory defragmentation planner implementation
+
+#include "RHI/RHIDefragPlanner.h"
+
+namespace MonsterRender {
+namespace RHI {
+
+using MonsterEngine::INDEX_NONE;
+
+uint32 FRHIDefragPlanner::AddBlock(FRHISubAllocator* Block)
+{
+    Blocks.Add(Block);
+    return static_cast<uint32>(Blocks.Num() - 1);
+}
+
+void FRHIDefragPlanner::AddAllocation(uint64 UserId, uint32 BlockIndex, const FRHISubAllocation& Allocation, uint64 Alignment)
+{
+    CandidateIndices.Add(UserId, Candidates.Num());
+    Candidates.Add(FCandidate{UserId, BlockIndex, Allocation, Alignment, INDEX_NONE});
+}
+
+void FRHIDefragPlanner::RemoveAllocation(uint64 UserId)
+{
+    const int32* Found = CandidateIndices.Find(UserId);
+    if (!Found) {
+        return;
+    }
+    const int32 CandidateIndex = *Found;
+
+    // The GPU may still be copying: keep the destination reserved until the step ends
+    if (Candidates[CandidateIndex].MoveIndex != INDEX_NONE) {
+        MoveCandidates[Candidates[CandidateIndex].MoveIndex] = INDEX_NONE;
+    }
+    RemoveCandidate(CandidateIndex);
+}
+
+void FRHIDefragPlanner::RemoveCandidate(int32 CandidateIndex)
+{
+    CandidateIndices.Remove(Candidates[CandidateIndex].UserId);
+
+    const int32 LastIndex = Candidates.Num() - 1;
+    if (CandidateIndex != LastIndex) {
+        const FCandidate& Last = Candidates[LastIndex];
+        CandidateIndices.Add(Last.UserId, CandidateIndex);
+        if (Last.MoveIndex != INDEX_NONE) {
+            MoveCandidates[Last.MoveIndex] = CandidateIndex;
+        }
+    }
+    Candidates.RemoveAtSwap(CandidateIndex);
+}
+
+bool FRHIDefragPlanner::TryMove(int32 CandidateIndex, uint32 DstBlock, bool bRequireLowerOffset, uint64& InOutBudget)
+{
+    FCandidate& Candidate = Candidates[CandidateIndex];
+    const uint64 Size = Candidate.Allocation.Size;
+    if (Size > InOutBudget) {
+        return false;
+    }
+
+    FRHISubAllocation Destination;
+    if (!Blocks[DstBlock]->Allocate(Size, Candidate.Alignment, Destination)) {
+        return false;
+    }
+    if (bRequireLowerOffset && Destination.Offset >= Candidate.Allocation.Offset) {
+        Blocks[DstBlock]->Free(Destination);
+        return false;
+    }
+
+    FRHIDefragMove Move;
+    Move.UserId = Candidate.UserId;
+    Move.SrcBlock = Candidate.Block;
+    Move.SrcOffset = Candidate.Allocation.Offset;
+    Move.DstBlock = DstBlock;
+    Move.DstAllocation = Destination;
+    Move.Size = Size;
+
+    Candidate.MoveIndex = Moves.Num();
+    Moves.Add(Move);
+    MoveCandidates.Add(CandidateIndex);
+    InOutBudget -= Size;
+    return true;
+}
+
+const TArray<FRHIDefragMove>& FRHIDefragPlanner::PlanStep(uint64 MaxBytes)
+{
+    if (bStepPending) {
+        return Moves;
+    }
+    Moves.Reset();
+    MoveCandidates.Reset();
+
+    uint64 Budget = MaxBytes;
+    const int32 NumBlocks = Blocks.Num();
+
+    // Evacuate the least occupied block into fuller ones. Each move goes from
+    // the emptiest block to a fuller one, so blocks never trade allocations back.
+    if (NumBlocks >= 2) {
+        int32 Source = INDEX_NONE;
+        uint64 OtherFree = 0;
+        for (int32 BlockIndex = 0; BlockIndex < NumBlocks; ++BlockIndex) {
+            const uint64 Used = Blocks[BlockIndex]->GetUsedSize();
+            if (Used > 0 && (Source == INDEX_NONE || Used < Blocks[Source]->GetUsedSize())) {
+                Source = BlockIndex;
+            }
+        }
+        if (Source != INDEX_NONE) {
+            TArray<int32> Destinations;
+            for (int32 BlockIndex = 0; BlockIndex < NumBlocks; ++BlockIndex) {
+                // Empty blocks are left empty so they can be released
+                if (BlockIndex != Source && Blocks[BlockIndex]->GetUsedSize() > 0) {
+                    Destinations.Add(BlockIndex);
+                    OtherFree += Blocks[BlockIndex]->GetFreeSize();
+                }
+            }
+
+            if (!Destinations.IsEmpty() && Blocks[Source]->GetUsedSize() <= OtherFree) {
+                // Fullest destinations first to pack them, largest allocations first while holes are big
+                Destinations.Sort([this](int32 A, int32 B) {
+                    return Blocks[A]->GetUsedSize() > Blocks[B]->GetUsedSize();
+                });
+
+                TArray<int32> SourceCandidates;
+                for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num(); ++CandidateIndex) {
+                    if (Candidates[CandidateIndex].Block == static_cast<uint32>(Source)) {
+                        SourceCandidates.Add(CandidateIndex);
+                    }
+                }
+                SourceCandidates.Sort([this](int32 A, int32 B) {
+                    return Candidates[A].Allocation.Size > Candidates[B].Allocation.Size;
+                });
+
+                for (int32 CandidateIndex : SourceCandidates) {
+                    for (int32 Destination : Destinations) {
+                        if (TryMove(CandidateIndex, static_cast<uint32>(Destination), false, Budget)) {
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // Slide the highest allocations of each block into lower holes
+    TArray<int32> Order;
+    for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num(); ++CandidateIndex) {
+        if (Candidates[CandidateIndex].MoveIndex == INDEX_NONE) {
+            Order.Add(CandidateIndex);
+        }
+    }
+    Order.Sort([this](int32 A, int32 B) {
+        return Candidates[A].Allocation.Offset > Candidates[B].Allocation.Offset;
+    });
+    for (int32 CandidateIndex : Order) {
+        if (Budget == 0) {
+            break;
+        }
+        TryMove(CandidateIndex, Candidates[CandidateIndex].Block, true, Budget);
+    }
+
+    bStepPending = !Moves.IsEmpty();
+    return Moves;
+}
+
+const TArray<FRHIDefragMove>& FRHIDefragPlanner::CompleteStep()
+{
+    TArray<FRHIDefragMove> Completed;
+    for (int32 MoveIndex = 0; MoveIndex < Moves.Num(); ++MoveIndex) {
+        const FRHIDefragMove& Move = Moves[MoveIndex];
+        const int32 CandidateIndex = MoveCandidates[MoveIndex];
+        if (CandidateIndex == INDEX_NONE) {
+            // The allocation was freed during the step
+            Blocks[Move.DstBlock]->Free(Move.DstAllocation);
+            continue;
+        }
+
+        FCandidate& Candidate = Candidates[CandidateIndex];
+        Blocks[Candidate.Block]->Free(Candidate.Allocation);
+        Candidate.Block = Move.DstBlock;
+        Candidate.Allocation = Move.DstAllocation;
+        Candidate.MoveIndex = INDEX_NONE;
+        Completed.Add(Move);
+    }
+
+    Moves = std::move(Completed);
+    MoveCandidates.Reset();
+    bStepPending = false;
+    return Moves;
+}
+
+void FRHIDefragPlanner::CancelStep()
+{
+    for (int32 MoveIndex = 0; MoveIndex < Moves.Num(); ++MoveIndex) {
+        Blocks[Moves[MoveIndex].DstBlock]->Free(Moves[MoveIndex].DstAllocation);
+        if (MoveCandidates[MoveIndex] != INDEX_NONE) {
+            Candidates[MoveCandidates[MoveIndex]].MoveIndex = INDEX_NONE;
+        }
+    }
+    Moves.Reset();
+    MoveCandidates.Reset();
+    bStepPending = false;
+}
+
+const FRHISubAllocation* FRHIDefragPlanner::FindAllocation(uint64 UserId, uint32* OutBlockIndex) const
+{
+    const int32* Found = CandidateIndices.Find(UserId);
+    if (!Found) {
+        return nullptr;
+    }
+    if (OutBlockIndex) {
+        *OutBlockIndex = Candidates[*Found].Block;
+    }
+    return &Candidates[*Found].Allocation;
+}
+
+}} // namespace MonsterRender::RHI
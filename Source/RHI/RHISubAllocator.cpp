@@ -0,0 +1,176 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+// MonsterEngine - Device-independent GPU memory sub-allocator implementation
+
+#include "RHI/RHISubAllocator.h"
+
+namespace MonsterRender {
+namespace RHI {
+
+namespace {
+    FORCEINLINE uint64 AlignUp(uint64 Value, uint64 Alignment)
+    {
+        return (Value + Alignment - 1) & ~(Alignment - 1);
+    }
+}
+
+FRHISubAllocator::FRHISubAllocator(uint64 InSize, ESubAllocatorMode InMode, uint64 InGranularity)
+    : Mode(InMode)
+    , TotalSize(InSize)
+    , Granularity(InGranularity)
+{
+    if (Mode == ESubAllocatorMode::TLSF) {
+        Ranges.Initialize(TotalSize, Granularity);
+    }
+}
+
+bool FRHISubAllocator::Allocate(uint64 Size, uint64 Alignment, FRHISubAllocation& OutAllocation)
+{
+    if (Size == 0) {
+        return false;
+    }
+    if (Mode == ESubAllocatorMode::Ring) {
+        return AllocateRing(Size, Alignment, OutAllocation);
+    }
+
+    const FTLSFAllocation Range = Ranges.Allocate(Size, Alignment);
+    if (!Range.IsValid()) {
+        return false;
+    }
+    OutAllocation.Offset = Range.Offset;
+    OutAllocation.Size = Range.Size;
+    OutAllocation.Handle = Range.Handle;
+    return true;
+}
+
+bool FRHISubAllocator::AllocateRing(uint64 Size, uint64 Alignment, FRHISubAllocation& OutAllocation)
+{
+    Size = AlignUp(Size, Granularity);
+    Alignment = Alignment > Granularity ? Alignment : Granularity;
+
+    // Head meeting Tail with live data means the ring is full
+    if (RingUsedSize > 0 && Head == Tail) {
+        return false;
+    }
+
+    uint64 Offset = AlignUp(Head, Alignment);
+    uint64 Consumed = 0;
+    if (Head >= Tail) {
+        if (Offset + Size <= TotalSize) {
+            Consumed = Offset + Size - Head;
+        } else if (Size <= Tail) {
+            // Skip the end of the block and wrap to the start
+            Offset = 0;
+            Consumed = TotalSize - Head + Size;
+        } else {
+            return false;
+        }
+    } else if (Offset + Size <= Tail) {
+        Consumed = Offset + Size - Head;
+    } else {
+        return false;
+    }
+
+    Head = Offset + Size;
+    if (Head == TotalSize) {
+        Head = 0;
+    }
+    RingUsedSize += Consumed;
+    CurrentFrameBytes += Consumed;
+    ++CurrentFrameAllocations;
+    ++RingAllocations;
+
+    OutAllocation.Offset = Offset;
+    OutAllocation.Size = Size;
+    OutAllocation.Handle = FRHISubAllocation::INVALID_HANDLE;
+    return true;
+}
+
+void FRHISubAllocator::Free(const FRHISubAllocation& Allocation)
+{
+    if (Mode == ESubAllocatorMode::TLSF) {
+        Ranges.Free(Allocation.Handle);
+    }
+}
+
+void FRHISubAllocator::EndFrame(uint64 FenceValue)
+{
+    if (Mode != ESubAllocatorMode::Ring) {
+        return;
+    }
+    Frames.Add(FFrame{Head, CurrentFrameBytes, FenceValue, CurrentFrameAllocations});
+    CurrentFrameBytes = 0;
+    CurrentFrameAllocations = 0;
+}
+
+void FRHISubAllocator::ReleaseCompletedFrames(uint64 CompletedFenceValue)
+{
+    int32 NumReleased = 0;
+    while (NumReleased < Frames.Num() && Frames[NumReleased].FenceValue <= CompletedFenceValue) {
+        const FFrame& Frame = Frames[NumReleased];
+        Tail = Frame.EndOffset;
+        RingUsedSize -= Frame.Bytes;
+        RingAllocations -= Frame.NumAllocations;
+        ++NumReleased;
+    }
+    if (NumReleased > 0) {
+        Frames.RemoveAt(0, NumReleased);
+    }
+
+    // Restart an empty ring at the beginning so the next frame gets the largest run
+    if (RingUsedSize == 0) {
+        Head = 0;
+        Tail = 0;
+    }
+}
+
+void FRHISubAllocator::Reset()
+{
+    if (Mode == ESubAllocatorMode::TLSF) {
+        Ranges.Reset();
+    }
+    Head = 0;
+    Tail = 0;
+    RingUsedSize = 0;
+    CurrentFrameBytes = 0;
+    CurrentFrameAllocations = 0;
+    RingAllocations = 0;
+    Frames.Empty();
+}
+
+uint64 FRHISubAllocator::GetUsedSize() const
+{
+    return Mode == ESubAllocatorMode::TLSF ? Ranges.GetUsedSize() : RingUsedSize;
+}
+
+uint64 FRHISubAllocator::GetLargestFreeBlock() const
+{
+    if (Mode == ESubAllocatorMode::TLSF) {
+        return Ranges.GetLargestFreeBlock();
+    }
+    if (RingUsedSize == 0) {
+        return TotalSize;
+    }
+    if (Head == Tail) {
+        return 0;
+    }
+    if (Head > Tail) {
+        return TotalSize - Head > Tail ? TotalSize - Head : Tail;
+    }
+    return Tail - Head;
+}
+
+float FRHISubAllocator::GetFragmentation() const
+{
+    const uint64 FreeSize = GetFreeSize();
+    if (FreeSize == 0) {
+        return 0.0f;
+    }
+    return 1.0f - static_cast<float>(static_cast<double>(GetLargestFreeBlock()) / static_cast<double>(FreeSize));
+}
+
+uint32 FRHISubAllocator::GetNumAllocations() const
+{
+    return Mode == ESubAllocatorMode::TLSF ? Ranges.GetNumAllocations() : RingAllocations;
+}
+
+}} // namespace MonsterRender::RHI
@@ -4,6 +4,7 @@
 #include "Renderer/FTextureLoader.h"
 #include "Core/Log.h"
 #include "Core/HAL/FMemory.h"
+#include "Core/HAL/LowLevelMemTracker.h"
 #include "Platform/Vulkan/VulkanDevice.h"
 #include "Platform/Vulkan/VulkanTexture.h"
 #include "Platform/Vulkan/VulkanBuffer.h"
@@ -17,6 +18,7 @@
 #include "Platform/OpenGL/OpenGLDefinitions.h"  // For GL_TEXTURE_2D, GL_RGBA, etc.
 #include "RHI/RHI.h"  // For ERHIBackend
 #include "Renderer/FTextureStreamingManager.h"
+#include "Math/VectorKernels.h"
 #include <algorithm>
 #include <cstring>
 
@@ -75,6 +77,7 @@ SIZE_T FTextureData::GetTotalSize() const {
 TSharedPtr<RHI::IRHITexture> FTextureLoader::LoadFromFile(
     RHI::IRHIDevice* Device,
     const FTextureLoadInfo& LoadInfo) {
+    LLM_SCOPE(ELLMTag::Textures);
     
     if (!Device) {
         MR_LOG_ERROR("FTextureLoader::LoadFromFile - Device is null");
@@ -123,6 +126,7 @@ TSharedPtr<RHI::IRHITexture> FTextureLoader::LoadFromFileWithUpload(
     RHI::IRHIDevice* Device,
     RHI::IRHICommandList* CommandList,
     const FTextureLoadInfo& LoadInfo) {
+    LLM_SCOPE(ELLMTag::Textures);
     
     if (!Device || !CommandList) {
         MR_LOG_ERROR("FTextureLoader::LoadFromFileWithUpload - Invalid parameters");
@@ -153,6 +157,7 @@ TSharedPtr<RHI::IRHITexture> FTextureLoader::LoadFromFileWithUpload(
 bool FTextureLoader::LoadTextureData(
     const FTextureLoadInfo& LoadInfo,
     FTextureData& OutData) {
+    LLM_SCOPE(ELLMTag::Textures);
     
     MR_LOG_INFO("Loading texture data from: " + LoadInfo.FilePath);
     
@@ -254,7 +259,7 @@ bool FTextureLoader::GenerateMipmaps(
     }
     
     // Allocate memory for all mip levels
-    uint8* AllMipsData = static_cast<uint8*>(FMemory::Malloc(TotalSize, 16));
+    uint8* AllMipsData = static_cast<uint8*>(FMemory::MallocStaging(TotalSize, 16));
     if (!AllMipsData) {
         MR_LOG_ERROR("Failed to allocate memory for mipmaps");
         return false;
@@ -634,31 +639,8 @@ void FTextureLoader::GenerateMipLevel(
     uint32 SourceHeight,
     uint8* OutData) {
     
-    // Box filter: average 2x2 pixels into 1 pixel
-    uint32 DestWidth = (std::max)(1u, SourceWidth / 2);
-    uint32 DestHeight = (std::max)(1u, SourceHeight / 2);
-    
-    constexpr uint32 Channels = 4;  // RGBA
-    
-    for (uint32 y = 0; y < DestHeight; ++y) {
-        for (uint32 x = 0; x < DestWidth; ++x) {
-            uint32 sx = x * 2;
-            uint32 sy = y * 2;
-            
-            // Sample 4 source pixels
-            const uint8* P00 = &SourceData[(sy * SourceWidth + sx) * Channels];
-            const uint8* P10 = &SourceData[(sy * SourceWidth + (std::min)(sx + 1, SourceWidth - 1)) * Channels];
-            const uint8* P01 = &SourceData[((std::min)(sy + 1, SourceHeight - 1) * SourceWidth + sx) * Channels];
-            const uint8* P11 = &SourceData[((std::min)(sy + 1, SourceHeight - 1) * SourceWidth + (std::min)(sx + 1, SourceWidth - 1)) * Channels];
-            
-            // Average all channels
-            uint8* Dest = &OutData[(y * DestWidth + x) * Channels];
-            for (uint32 c = 0; c < Channels; ++c) {
-                uint32 Sum = P00[c] + P10[c] + P01[c] + P11[c];
-                Dest[c] = static_cast<uint8>(Sum / 4);
-            }
-        }
-    }
+    // Box filter: average 2x2 pixels into 1 pixel, using the widest SIMD variant the CPU supports
+    MonsterEngine::Math::FVectorKernels::Get().DownsampleRGBA8(SourceData, SourceWidth, SourceHeight, OutData);
 }
 
 uint32 FTextureLoader::CalculateMipLevels(uint32 Width, uint32 Height) {
@@ -4,43 +4,38 @@
 #include "Renderer/FTextureStreamingManager.h"
 #include "Core/HAL/FMemory.h"
 #include "Core/Log.h"
-#include <algorithm>
 
 namespace MonsterRender {
 
 // ===== FTexturePool Implementation =====
 
+namespace {
+    // Offsets handed out by the pool are multiples of this (GPU texture alignment)
+    constexpr SIZE_T kPoolGranularity = 256;
+
+    // Pool base alignment, so aligned offsets are aligned addresses (largest GPU texture alignment)
+    constexpr uint32 kPoolBaseAlignment = 64 * 1024;
+}
+
 FTexturePool::FTexturePool(SIZE_T PoolSizeBytes)
     : PoolMemory(nullptr)
     , TotalSize(PoolSizeBytes)
     , UsedSize(0)
-    , FreeList(nullptr)
 {
     // Allocate pool memory
-    PoolMemory = FMemory::Malloc(PoolSizeBytes, 256);  // 256-byte alignment for GPU
+    PoolMemory = FMemory::MallocStaging(PoolSizeBytes, kPoolBaseAlignment);  // Huge pages when available
     if (!PoolMemory) {
         MR_LOG_ERROR("Failed to allocate texture pool: " + std::to_string(PoolSizeBytes / 1024 / 1024) + "MB");
         return;
     }
 
-    // Initialize with one large free region using FMemory
-    FreeList = FMemory::New<FFreeRegion>();
-    FreeList->Offset = 0;
-    FreeList->Size = PoolSizeBytes;
-    FreeList->Next = nullptr;
+    // The whole pool starts as one free block
+    RangeAllocator.Initialize(PoolSizeBytes, kPoolGranularity);
 
     MR_LOG_INFO("FTexturePool created: " + std::to_string(PoolSizeBytes / 1024 / 1024) + "MB");
 }
 
 FTexturePool::~FTexturePool() {
-    // Free all regions in free list
-    FFreeRegion* region = FreeList;
-    while (region) {
-        FFreeRegion* next = region->Next;
-        FMemory::Delete(region);
-        region = next;
-    }
-
     // Free pool memory
     if (PoolMemory) {
         FMemory::Free(PoolMemory);
@@ -51,23 +46,27 @@ FTexturePool::~FTexturePool() {
 }
 
 void* FTexturePool::Allocate(SIZE_T Size, SIZE_T Alignment) {
-    if (Size == 0) return nullptr;
+    if (Size == 0 || !PoolMemory) return nullptr;
 
     std::scoped_lock lock(PoolMutex);
 
     // Align size up
     Size = (Size + Alignment - 1) & ~(Alignment - 1);
 
-    // Try to allocate from free list (First-Fit algorithm)
-    void* ptr = AllocateFromFreeList(Size, Alignment);
-    if (ptr) {
-        UsedSize += Size;
+    FTLSFAllocation range = RangeAllocator.Allocate(Size, Alignment);
+    if (range.IsValid()) {
+        void* ptr = static_cast<uint8*>(PoolMemory) + range.Offset;
+        // Account for the whole block, which the allocator rounds up to its granularity
+        const SIZE_T blockSize = static_cast<SIZE_T>(range.Size);
+        Allocations.Add(ptr, FAllocation{blockSize, range.Handle});
+        UsedSize += blockSize;
         return ptr;
     }
 
     MR_LOG_WARNING("FTexturePool::Allocate failed: out of memory (requested " + 
                    std::to_string(Size / 1024) + "KB, available " + 
-                   std::to_string((TotalSize - UsedSize) / 1024) + "KB)");
+                   std::to_string((TotalSize - UsedSize) / 1024) + "KB, largest free block " +
+                   std::to_string(RangeAllocator.GetLargestFreeBlock() / 1024) + "KB)");
     return nullptr;
 }
 
@@ -86,8 +85,8 @@ void FTexturePool::Free(void* Ptr) {
     FAllocation alloc = *FoundAlloc;
     Allocations.Remove(Ptr);
 
-    // Add back to free list
-    AddToFreeList(alloc.Offset, alloc.Size);
+    // Back to the allocator, merged with free neighbours
+    RangeAllocator.Free(alloc.Handle);
     UsedSize -= alloc.Size;
 
     MR_LOG_DEBUG("FTexturePool::Free: " + std::to_string(alloc.Size / 1024) + "KB freed");
@@ -106,105 +105,21 @@ SIZE_T FTexturePool::GetAllocationSize(void* Ptr) {
     return FoundAlloc->Size;
 }
 
-void FTexturePool::Compact() {
+float FTexturePool::GetFragmentation() {
     std::scoped_lock lock(PoolMutex);
-    
-    MergeFreeRegions();
-    
-    MR_LOG_INFO("FTexturePool::Compact completed");
-}
-
-// Private methods
-
-void* FTexturePool::AllocateFromFreeList(SIZE_T Size, SIZE_T Alignment) {
-    FFreeRegion* prev = nullptr;
-    FFreeRegion* region = FreeList;
-
-    while (region) {
-        // Calculate aligned offset
-        SIZE_T alignedOffset = (region->Offset + Alignment - 1) & ~(Alignment - 1);
-        SIZE_T padding = alignedOffset - region->Offset;
-
-        // Check if region is large enough
-        if (region->Size >= Size + padding) {
-            // Calculate allocation pointer
-            void* ptr = static_cast<uint8*>(PoolMemory) + alignedOffset;
-
-            // Store allocation info
-            FAllocation alloc;
-            alloc.Offset = alignedOffset;
-            alloc.Size = Size;
-            Allocations[ptr] = alloc;
-
-            // Update or remove free region
-            SIZE_T remainingSize = region->Size - (Size + padding);
-            
-            if (remainingSize > 64) {  // Keep region if >64 bytes remain
-                region->Offset = alignedOffset + Size;
-                region->Size = remainingSize;
-            } else {
-                // Remove region from list
-                if (prev) {
-                    prev->Next = region->Next;
-                } else {
-                    FreeList = region->Next;
-                }
-                FMemory::Delete(region);
-            }
-
-            return ptr;
-        }
-
-        prev = region;
-        region = region->Next;
-    }
-
-    return nullptr;  // No suitable region found
+    return RangeAllocator.GetFragmentation();
 }
 
-void FTexturePool::AddToFreeList(SIZE_T Offset, SIZE_T Size) {
-    // Create new free region using FMemory
-    FFreeRegion* newRegion = FMemory::New<FFreeRegion>();
-    newRegion->Offset = Offset;
-    newRegion->Size = Size;
-    newRegion->Next = nullptr;
-
-    // Insert sorted by offset
-    if (!FreeList || FreeList->Offset > Offset) {
-        // Insert at head
-        newRegion->Next = FreeList;
-        FreeList = newRegion;
-    } else {
-        // Find insertion point
-        FFreeRegion* current = FreeList;
-        while (current->Next && current->Next->Offset < Offset) {
-            current = current->Next;
-        }
-        newRegion->Next = current->Next;
-        current->Next = newRegion;
-    }
-
-    // Try to merge with adjacent regions
-    MergeFreeRegions();
+SIZE_T FTexturePool::GetLargestFreeBlock() {
+    std::scoped_lock lock(PoolMutex);
+    return RangeAllocator.GetLargestFreeBlock();
 }
 
-void FTexturePool::MergeFreeRegions() {
-    FFreeRegion* current = FreeList;
-
-    while (current && current->Next) {
-        // Check if current and next are adjacent
-        if (current->Offset + current->Size == current->Next->Offset) {
-            // Merge with next region
-            FFreeRegion* next = current->Next;
-            current->Size += next->Size;
-            current->Next = next->Next;
-            FMemory::Delete(next);
-            // Don't advance - check if we can merge again
-        } else {
-            current = current->Next;
-        }
-    }
+void FTexturePool::Compact() {
+    std::scoped_lock lock(PoolMutex);
+    
+    MR_LOG_INFO("FTexturePool::Compact: " + std::to_string(RangeAllocator.GetNumFreeBlocks()) + " free blocks, largest " +
+                std::to_string(RangeAllocator.GetLargestFreeBlock() / 1024) + "KB");
 }
 
 } // namespace MonsterRender
-
@@ -4,6 +4,7 @@
 #include "Renderer/FTextureStreamingManager.h"
 #include "Core/HAL/FMemory.h"
 #include "Core/Log.h"
+#include "Core/HAL/LowLevelMemTracker.h"
 #include <algorithm>
 #include <thread>
 #include <future>
@@ -128,6 +129,7 @@ void FTextureStreamingManager::UnregisterTexture(FTexture* Texture) {
 }
 
 void FTextureStreamingManager::UpdateResourceStreaming(float DeltaTime) {
+    LLM_SCOPE(ELLMTag::Textures);
     if (!bInitialized) return;
 
     std::scoped_lock lock(StreamingMutex);
@@ -21,6 +21,7 @@
 #include "Engine/SceneView.h"
 #include "Engine/SceneRenderer.h"
 #include "Containers/Map.h"
+#include "Core/Templates/RadixSort.h"
 #include "Core/Logging/LogMacros.h"
 #include "Math/MathFunctions.h"
 
@@ -541,7 +542,7 @@ void FTransparentPass::Execute(FRenderPassContext& Context)
 
 void FTransparentPass::SortPrimitives(
     FRenderPassContext& Context,
-    TArray<FPrimitiveSceneInfo*>& Primitives)
+    TArray<FPrimitiveSceneInfo*, SceneRenderingAllocator>& Primitives)
 {
     SortedPrimitives.Reset();
     
@@ -559,19 +560,17 @@ void FTransparentPass::SortPrimitives(
     if (SortMode == ESortMode::BackToFront)
     {
         // Sort by descending distance (far to near)
-        SortedPrimitives.Sort([](const TPair<float, FPrimitiveSceneInfo*>& A, 
-                                  const TPair<float, FPrimitiveSceneInfo*>& B)
+        RadixSort(SortedPrimitives, [](const TPair<float, FPrimitiveSceneInfo*>& Pair)
         {
-            return A.Key > B.Key;
+            return -Pair.Key;
         });
     }
     else if (SortMode == ESortMode::FrontToBack)
     {
         // Sort by ascending distance (near to far)
-        SortedPrimitives.Sort([](const TPair<float, FPrimitiveSceneInfo*>& A, 
-                                  const TPair<float, FPrimitiveSceneInfo*>& B)
+        RadixSort(SortedPrimitives, [](const TPair<float, FPrimitiveSceneInfo*>& Pair)
         {
-            return A.Key < B.Key;
+            return Pair.Key;
         });
     }
 }
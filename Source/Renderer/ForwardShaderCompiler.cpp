@@ -12,6 +12,7 @@
 #include "Core/Logging/LogMacros.h"
 #include "RHI/IRHIDevice.h"
 #include "RHI/IRHIResource.h"
+#include "Core/HAL/LowLevelMemTracker.h"
 
 namespace MonsterEngine
 {
@@ -153,6 +154,7 @@ TSharedPtr<MonsterRender::RHI::IRHIPipelineState> FForwardShaderCompiler::Compil
     EForwardShaderType Type,
     const FForwardShaderPermutation& Permutation)
 {
+    LLM_SCOPE(ELLMTag::Shaders);
     if (!m_initialized || !m_device)
     {
         MR_LOG_ERROR("FForwardShaderCompiler: Not initialized");
@@ -343,6 +345,7 @@ bool FForwardShaderCompiler::CompileShaderPair(
     TSharedPtr<MonsterRender::RHI::IRHIShader>& OutVertexShader,
     TSharedPtr<MonsterRender::RHI::IRHIShader>& OutFragmentShader)
 {
+    LLM_SCOPE(ELLMTag::Shaders);
     // Use the MonsterRender shader compiler to compile GLSL to SPIR-V
     MonsterRender::ShaderCompileOptions VertexOptions;
     VertexOptions.language = MonsterRender::EShaderLanguage::GLSL;
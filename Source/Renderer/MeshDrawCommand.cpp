@@ -12,6 +12,7 @@
 #include "Renderer/Scene.h"
 #include "Renderer/SceneView.h"
 #include "Core/Logging/Logging.h"
+#include "Core/Templates/RadixSort.h"
 #include "RHI/IRHICommandList.h"
 #include "RHI/IRHIDevice.h"
 
@@ -162,7 +163,7 @@ void FParallelMeshDrawCommandPass::GenerateDynamicMeshDrawCommands()
         return;
     }
     
-    TArray<FMeshDrawCommand> GeneratedCommands;
+    TArray<FMeshDrawCommand>& GeneratedCommands = TaskContext.MeshDrawCommandStorage;
     
     for (const FMeshBatchAndRelevance& MeshBatchAndRelevance : *TaskContext.DynamicMeshElements)
     {
@@ -198,24 +199,21 @@ void FParallelMeshDrawCommandPass::GenerateDynamicMeshDrawCommands()
         }
         
         // Generate mesh draw command through the processor
-        GeneratedCommands.Empty();
         TaskContext.MeshPassProcessor->AddMeshBatch(
             MeshBatch,
             ~0ull, // All elements
             MeshBatchAndRelevance.PrimitiveSceneInfo,
             GeneratedCommands);
-        
-        // Add generated commands to visible list
-        for (const FMeshDrawCommand& Command : GeneratedCommands)
+    }
+    
+    // Reference the commands only once the storage has stopped growing
+    TaskContext.VisibleMeshDrawCommands.Reserve(GeneratedCommands.Num());
+    for (const FMeshDrawCommand& Command : GeneratedCommands)
+    {
+        if (Command.IsValid())
         {
-            if (Command.IsValid())
-            {
-                int32 CmdIndex = TaskContext.VisibleMeshDrawCommands.Add(FVisibleMeshDrawCommand());
-                FVisibleMeshDrawCommand& VisibleCommand = TaskContext.VisibleMeshDrawCommands[CmdIndex];
-                VisibleCommand.MeshDrawCommand = &Command;
-                VisibleCommand.SortKey = Command.SortKey;
-                TaskContext.NumDynamicMeshCommandsGenerated++;
-            }
+            TaskContext.VisibleMeshDrawCommands.Add(FVisibleMeshDrawCommand(&Command));
+            TaskContext.NumDynamicMeshCommandsGenerated++;
         }
     }
 }
@@ -234,11 +232,11 @@ void FParallelMeshDrawCommandPass::SortVisibleMeshDrawCommands()
         return;
     }
     
-    // Sort by sort key
-    TaskContext.VisibleMeshDrawCommands.Sort([](const FVisibleMeshDrawCommand& A, const FVisibleMeshDrawCommand& B)
+    // Radix sort by sort key; large passes split the histogram and scatter over the task graph
+    RadixSort(TaskContext.VisibleMeshDrawCommands, [](const FVisibleMeshDrawCommand& Command)
     {
-        return A.SortKey < B.SortKey;
-    });
+        return Command.SortKey;
+    }, true);
     
     MR_LOG(LogRenderer, Verbose, "Sorted %d mesh draw commands",
            TaskContext.VisibleMeshDrawCommands.Num());
@@ -10,6 +10,7 @@
 
 #include "Renderer/Scene.h"
 #include "Core/Logging/Logging.h"
+#include "Core/HAL/LowLevelMemTracker.h"
 
 using namespace MonsterRender;
 
@@ -42,7 +43,8 @@ FPrimitiveViewRelevance FPrimitiveSceneProxy::GetViewRelevance(const FViewInfo*
 // ============================================================================
 
 FScene::FScene()
-    : FrameNumber(0)
+    : RenderOrigin(Math::FVector::ZeroVector)
+    , FrameNumber(0)
     , NextComponentId(1)
 {
     MR_LOG(LogRenderer, Log, "FScene (Renderer) created");
@@ -79,6 +81,7 @@ FScene::~FScene()
 
 FPrimitiveSceneInfo* FScene::AddPrimitive(FPrimitiveSceneProxy* Proxy)
 {
+    LLM_SCOPE(ELLMTag::Scene);
     if (!Proxy)
     {
         MR_LOG(LogRenderer, Warning, "Attempted to add null primitive proxy to scene");
@@ -144,6 +147,50 @@ void FScene::UpdatePrimitiveTransform(FPrimitiveSceneInfo* PrimitiveSceneInfo,
     
     // Update bounds in the scene arrays
     PrimitiveBounds[Index].BoxSphereBounds = Proxy->GetBounds();
+    UpdatePrimitiveRenderData(Index);
+}
+
+void FScene::UpdatePrimitiveRenderData(int32 Index)
+{
+    const FPrimitiveSceneProxy* Proxy = Primitives[Index]->Proxy;
+    const FBoxSphereBounds& Bounds = PrimitiveBounds[Index].BoxSphereBounds;
+    
+    PrimitiveRenderTransforms[Index] = Proxy
+        ? Math::FRenderTransform(Proxy->GetLocalToWorld(), RenderOrigin)
+        : Math::FRenderTransform();
+    PrimitiveRenderBounds[Index] = Math::FRenderBounds(Bounds.Origin, Bounds.BoxExtent, Bounds.SphereRadius, RenderOrigin);
+    WritePrimitiveBoundsBlock(Index);
+}
+
+void FScene::WritePrimitiveBoundsBlock(int32 Index)
+{
+    const Math::FRenderBounds& Bounds = PrimitiveRenderBounds[Index];
+    Math::FBoxBlock8& Block = PrimitiveBoundsBlocks[Index / 8];
+    const int32 Lane = Index % 8;
+    
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        Block.Center[Axis][Lane] = Bounds.Origin[Axis];
+        Block.Extent[Axis][Lane] = Bounds.BoxExtent[Axis];
+    }
+}
+
+void FScene::UpdateRenderOrigin(const Math::FVector& ViewOrigin)
+{
+    const Math::FVector NewRenderOrigin = Math::GetRenderTileOrigin(ViewOrigin);
+    if (NewRenderOrigin == RenderOrigin)
+    {
+        return;
+    }
+    
+    RenderOrigin = NewRenderOrigin;
+    for (int32 Index = 0; Index < Primitives.Num(); ++Index)
+    {
+        UpdatePrimitiveRenderData(Index);
+    }
+    
+    MR_LOG(LogRenderer, Verbose, "Render origin moved to (%.0f, %.0f, %.0f), rebased %d primitives",
+                 RenderOrigin.X, RenderOrigin.Y, RenderOrigin.Z, Primitives.Num());
 }
 
 void FScene::AddPrimitiveToArrays(FPrimitiveSceneInfo* PrimitiveSceneInfo)
@@ -168,9 +215,19 @@ void FScene::AddPrimitiveToArrays(FPrimitiveSceneInfo* PrimitiveSceneInfo)
     // Add occlusion flags
     uint8 OcclusionFlags = EOcclusionFlags::CanBeOccluded;
     PrimitiveOcclusionFlags.Add(OcclusionFlags);
+    PrimitivesCanBeOccludedMap.Add((OcclusionFlags & EOcclusionFlags::CanBeOccluded) != 0);
     
     // Add component ID
     PrimitiveComponentIds.Add(PrimitiveSceneInfo->GetComponentId());
+    
+    // Add render-origin-relative transform and bounds
+    PrimitiveRenderTransforms.AddDefaulted();
+    PrimitiveRenderBounds.AddDefaulted();
+    if (NewIndex % 8 == 0)
+    {
+        PrimitiveBoundsBlocks.AddZeroed();
+    }
+    UpdatePrimitiveRenderData(NewIndex);
 }
 
 void FScene::RemovePrimitiveFromArrays(FPrimitiveSceneInfo* PrimitiveSceneInfo)
@@ -189,7 +246,11 @@ void FScene::RemovePrimitiveFromArrays(FPrimitiveSceneInfo* PrimitiveSceneInfo)
         Primitives[Index] = Primitives[LastIndex];
         PrimitiveBounds[Index] = PrimitiveBounds[LastIndex];
         PrimitiveOcclusionFlags[Index] = PrimitiveOcclusionFlags[LastIndex];
+        PrimitivesCanBeOccludedMap.SetBit(Index, PrimitivesCanBeOccludedMap[LastIndex]);
         PrimitiveComponentIds[Index] = PrimitiveComponentIds[LastIndex];
+        PrimitiveRenderTransforms[Index] = PrimitiveRenderTransforms[LastIndex];
+        PrimitiveRenderBounds[Index] = PrimitiveRenderBounds[LastIndex];
+        WritePrimitiveBoundsBlock(Index);
         
         // Update the swapped primitive's index
         if (Primitives[Index])
@@ -202,7 +263,14 @@ void FScene::RemovePrimitiveFromArrays(FPrimitiveSceneInfo* PrimitiveSceneInfo)
     Primitives.RemoveAt(LastIndex);
     PrimitiveBounds.RemoveAt(LastIndex);
     PrimitiveOcclusionFlags.RemoveAt(LastIndex);
+    PrimitivesCanBeOccludedMap.RemoveAt(LastIndex);
     PrimitiveComponentIds.RemoveAt(LastIndex);
+    PrimitiveRenderTransforms.RemoveAt(LastIndex);
+    PrimitiveRenderBounds.RemoveAt(LastIndex);
+    if (LastIndex % 8 == 0)
+    {
+        PrimitiveBoundsBlocks.RemoveAt(PrimitiveBoundsBlocks.Num() - 1);
+    }
     
     // Invalidate the removed primitive's index
     PrimitiveSceneInfo->SetIndex(INDEX_NONE);
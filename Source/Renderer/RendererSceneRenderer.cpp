@@ -19,6 +19,7 @@
 #include "RHI/IRHICommandList.h"
 #include "RHI/IRHIDevice.h"
 #include "RHI/RHIDefinitions.h"
+#include "Core/HAL/LowLevelMemTracker.h"
 #include <cstdlib>
 
 using namespace MonsterRender;
@@ -163,6 +164,12 @@ void FSceneRenderer::PreVisibilityFrameSetup()
         }
     }
     
+    // Anchor the scene's float render data near the primary view
+    if (Scene && Views.Num() > 0)
+    {
+        Scene->UpdateRenderOrigin(Views[0].GetViewOrigin());
+    }
+    
     MR_LOG(LogRenderer, Verbose, "PreVisibilityFrameSetup complete");
 }
 
@@ -280,14 +287,7 @@ void FSceneRenderer::PostVisibilityFrameSetup()
     {
         View.NumVisibleDynamicPrimitives = 0;
         View.NumVisibleStaticMeshElements = 0;
-        
-        for (int32 i = 0; i < View.PrimitiveVisibilityMap.Num(); ++i)
-        {
-            if (View.PrimitiveVisibilityMap[i])
-            {
-                View.NumVisibleDynamicPrimitives++;
-            }
-        }
+        View.NumVisibleDynamicPrimitives = View.PrimitiveVisibilityMap.CountSetBits();
     }
     
     MR_LOG(LogRenderer, Verbose, "PostVisibilityFrameSetup complete");
@@ -304,28 +304,13 @@ int32 FSceneRenderer::FrustumCull(FViewInfo& View)
         return 0;
     }
     
-    int32 NumCulled = 0;
-    const TArray<FPrimitiveBounds>& PrimitiveBounds = Scene->GetPrimitiveBounds();
-    
-    for (int32 PrimitiveIndex = 0; PrimitiveIndex < PrimitiveBounds.Num(); ++PrimitiveIndex)
-    {
-        const FPrimitiveBounds& Bounds = PrimitiveBounds[PrimitiveIndex];
-        
-        // Test against view frustum
-        bool bVisible = View.ViewFrustum.IntersectBounds(Bounds.BoxSphereBounds);
-        
-        if (bVisible)
-        {
-            View.SetPrimitiveVisibility(PrimitiveIndex, true);
-        }
-        else
-        {
-            View.SetPrimitiveVisibility(PrimitiveIndex, false);
-            NumCulled++;
-        }
-    }
+    // Same tests as FSceneVisibility: box blocks against the frustum moved to the
+    // render origin, then the sphere test on the primitives that pass
+    FPrimitiveCullingFlags Flags;
+    Flags.bAlsoUseSphereTest = true;
     
-    return NumCulled;
+    FFrustumCuller FrustumCuller;
+    return FrustumCuller.CullPrimitives(Scene, View, Flags);
 }
 
 void FSceneRenderer::OcclusionCull(FViewInfo& View, RHI::IRHICommandList& RHICmdList)
@@ -341,16 +326,18 @@ int32 FSceneRenderer::DistanceCull(FViewInfo& View)
         return 0;
     }
     
-    int32 NumCulled = 0;
     const TArray<FPrimitiveBounds>& PrimitiveBounds = Scene->GetPrimitiveBounds();
     const Math::FVector& ViewOrigin = View.GetViewOrigin();
     
-    for (int32 PrimitiveIndex = 0; PrimitiveIndex < PrimitiveBounds.Num(); ++PrimitiveIndex)
+    // Test only primitives the frustum left visible, then clear the culled ones in one pass
+    FSceneBitArray CulledPrimitiveMap(false, View.PrimitiveVisibilityMap.Num());
+    
+    for (TConstSetBitIterator<> It(View.PrimitiveVisibilityMap); It; ++It)
     {
-        // Skip already culled primitives
-        if (!View.IsPrimitiveVisible(PrimitiveIndex))
+        const int32 PrimitiveIndex = It.GetIndex();
+        if (PrimitiveIndex >= PrimitiveBounds.Num())
         {
-            continue;
+            break;
         }
         
         const FPrimitiveBounds& Bounds = PrimitiveBounds[PrimitiveIndex];
@@ -361,12 +348,12 @@ int32 FSceneRenderer::DistanceCull(FViewInfo& View)
         // Check distance culling
         if (View.IsDistanceCulled(DistanceSquared, Bounds.MinDrawDistance, Bounds.MaxCullDistance))
         {
-            View.SetPrimitiveVisibility(PrimitiveIndex, false);
-            NumCulled++;
+            CulledPrimitiveMap.SetBit(PrimitiveIndex, true);
         }
     }
     
-    return NumCulled;
+    View.PrimitiveVisibilityMap.CombineWithBitwiseANDNOT(CulledPrimitiveMap);
+    return CulledPrimitiveMap.CountSetBits();
 }
 
 void FSceneRenderer::ComputeViewRelevance(FViewInfo& View)
@@ -376,11 +363,12 @@ void FSceneRenderer::ComputeViewRelevance(FViewInfo& View)
         return;
     }
     
-    for (int32 PrimitiveIndex = 0; PrimitiveIndex < Scene->GetNumPrimitives(); ++PrimitiveIndex)
+    for (TConstSetBitIterator<> It(View.PrimitiveVisibilityMap); It; ++It)
     {
-        if (!View.IsPrimitiveVisible(PrimitiveIndex))
+        const int32 PrimitiveIndex = It.GetIndex();
+        if (PrimitiveIndex >= Scene->GetNumPrimitives())
         {
-            continue;
+            break;
         }
         
         FPrimitiveSceneInfo* PrimitiveSceneInfo = Scene->GetPrimitive(PrimitiveIndex);
@@ -427,16 +415,23 @@ void FSceneRenderer::GatherDynamicMeshElements()
     
     MeshCollector.ClearMeshes();
     
+    // Views passed to the proxies, built once per view rather than per primitive
+    TArray<const FViewInfo*> ViewArray;
+    
     for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ++ViewIndex)
     {
         FViewInfo& View = Views[ViewIndex];
         
+        ViewArray.Reset();
+        ViewArray.Add(&View);
+        
         // Gather mesh elements from visible primitives
-        for (int32 PrimitiveIndex = 0; PrimitiveIndex < Scene->GetNumPrimitives(); ++PrimitiveIndex)
+        for (TConstSetBitIterator<> It(View.PrimitiveVisibilityMap); It; ++It)
         {
-            if (!View.IsPrimitiveVisible(PrimitiveIndex))
+            const int32 PrimitiveIndex = It.GetIndex();
+            if (PrimitiveIndex >= Scene->GetNumPrimitives())
             {
-                continue;
+                break;
             }
             
             FPrimitiveSceneInfo* PrimitiveSceneInfo = Scene->GetPrimitive(PrimitiveIndex);
@@ -453,9 +448,6 @@ void FSceneRenderer::GatherDynamicMeshElements()
             }
             
             // Request dynamic mesh elements from the proxy
-            TArray<const FViewInfo*> ViewArray;
-            ViewArray.Add(&View);
-            
             uint32 VisibilityMap = 1 << ViewIndex;
             PrimitiveSceneInfo->Proxy->GetDynamicMeshElements(ViewArray, ViewFamily, VisibilityMap, MeshCollector);
         }
@@ -780,6 +772,7 @@ FDeferredShadingSceneRenderer::~FDeferredShadingSceneRenderer()
 
 void FDeferredShadingSceneRenderer::Render(RHI::IRHICommandList& RHICmdList)
 {
+    LLM_SCOPE(ELLMTag::Renderer);
     MR_LOG(LogRenderer, Verbose, "FDeferredShadingSceneRenderer::Render begin");
     
     // Pre-visibility setup
@@ -1140,6 +1133,7 @@ FForwardShadingSceneRenderer::~FForwardShadingSceneRenderer()
 
 void FForwardShadingSceneRenderer::Render(RHI::IRHICommandList& RHICmdList)
 {
+    LLM_SCOPE(ELLMTag::Renderer);
     MR_LOG(LogRenderer, Verbose, "FForwardShadingSceneRenderer::Render begin");
     
     // Pre-visibility setup
@@ -12,10 +12,12 @@
 #include "Renderer/Scene.h"
 #include "Renderer/SceneView.h"
 #include "Core/Logging/Logging.h"
+#include "Core/FTaskGraph.h"
 #include "Math/MathUtility.h"
 #include "Math/MathFunctions.h"
 #include "RHI/IRHICommandList.h"
 #include "RHI/IRHIDevice.h"
+#include <bit>
 
 using namespace MonsterRender;
 
@@ -58,148 +60,57 @@ int32 FFrustumCuller::CullPrimitives(const FScene* Scene, FViewInfo& View,
         return 0;
     }
     
-    int32 TotalCulled = 0;
-    
-    // Process primitives in parallel-friendly chunks
-    const int32 NumTasks = (NumPrimitives + PrimitivesPerTask - 1) / PrimitivesPerTask;
-    
-    for (int32 TaskIndex = 0; TaskIndex < NumTasks; ++TaskIndex)
+    if (View.PrimitiveVisibilityMap.Num() != NumPrimitives)
     {
-        int32 StartIndex = TaskIndex * PrimitivesPerTask;
-        int32 EndIndex = Math::FMath::Min(StartIndex + PrimitivesPerTask, NumPrimitives);
-        
-        int32 NumCulled = 0;
-        CullPrimitiveRange(Scene, View, Flags, StartIndex, EndIndex, NumCulled);
-        TotalCulled += NumCulled;
+        View.InitVisibilityArrays(NumPrimitives);
     }
     
-    return TotalCulled;
-}
-
-void FFrustumCuller::CullPrimitiveRange(const FScene* Scene, FViewInfo& View,
-                                        const FPrimitiveCullingFlags& Flags,
-                                        int32 StartIndex, int32 EndIndex, int32& OutNumCulled)
-{
-    OutNumCulled = 0;
-    
-    const TArray<FPrimitiveBounds>& PrimitiveBounds = Scene->GetPrimitiveBounds();
-    const Math::FPlane* PermutedPlanes = View.ViewFrustum.PermutedPlanes.GetData();
-    const int32 NumPermutedPlanes = View.ViewFrustum.PermutedPlanes.Num();
-    
-    for (int32 PrimitiveIndex = StartIndex; PrimitiveIndex < EndIndex; ++PrimitiveIndex)
-    {
-        const FPrimitiveBounds& Bounds = PrimitiveBounds[PrimitiveIndex];
-        
-        bool bVisible = IsPrimitiveVisible(View, Bounds, Flags);
-        
-        if (bVisible)
-        {
-            View.SetPrimitiveVisibility(PrimitiveIndex, true);
-        }
-        else
-        {
-            View.SetPrimitiveVisibility(PrimitiveIndex, false);
-            OutNumCulled++;
-        }
-    }
-}
-
-bool FFrustumCuller::IsPrimitiveVisible(const FViewInfo& View, const FPrimitiveBounds& Bounds,
-                                        const FPrimitiveCullingFlags& Flags) const
-{
-    const FBoxSphereBounds& BoxSphereBounds = Bounds.BoxSphereBounds;
-    
-    // Optional sphere test first (faster rejection)
-    if (Flags.bAlsoUseSphereTest)
-    {
-        if (!View.ViewFrustum.IntersectSphere(BoxSphereBounds.Origin, BoxSphereBounds.SphereRadius))
-        {
-            return false;
-        }
-    }
-    
-    // Box-frustum intersection test
-    if (Flags.bUseFastIntersect && View.ViewFrustum.PermutedPlanes.Num() == 8)
-    {
-        return IntersectBox8Plane(BoxSphereBounds.Origin, BoxSphereBounds.BoxExtent,
-                                  View.ViewFrustum.PermutedPlanes.GetData());
-    }
-    else
-    {
-        return View.ViewFrustum.IntersectBox(BoxSphereBounds.Origin, BoxSphereBounds.BoxExtent);
-    }
-}
-
-bool FFrustumCuller::IntersectBox8Plane(const Math::FVector& Origin, const Math::FVector& Extent,
-                                        const Math::FPlane* PermutedPlanes)
-{
-    // SIMD-optimized 8-plane intersection test
-    // Tests box against 8 planes (6 frustum planes + 2 padding)
+    // Move the frustum to the scene's render origin once, so the per-primitive
+    // tests read the compact float bounds
+    const FRenderConvexVolume RenderFrustum(View.ViewFrustum, Scene->GetRenderOrigin());
     
-    // For each plane, compute: distance = dot(normal, origin) - w
-    // Box is outside if: distance > dot(abs(normal), extent)
+    // Parallelize over visibility words; each word is computed locally and
+    // stored once, so no two threads ever write the same word
+    const int32 NumWords = View.PrimitiveVisibilityMap.GetNumWords();
+    uint32* VisibilityWords = View.PrimitiveVisibilityMap.GetData();
     
-    for (int32 PlaneIndex = 0; PlaneIndex < 8; ++PlaneIndex)
+    FTaskGraph::ParallelFor(NumWords, [&](int32 WordIndex)
     {
-        const Math::FPlane& Plane = PermutedPlanes[PlaneIndex];
-        
-        // Calculate signed distance from box center to plane
-        float Distance = Plane.X * Origin.X + Plane.Y * Origin.Y + Plane.Z * Origin.Z - Plane.W;
+        int32 StartIndex = WordIndex * NumBitsPerDWORD;
+        int32 EndIndex = Math::FMath::Min(StartIndex + NumBitsPerDWORD, NumPrimitives);
         
-        // Calculate the effective radius (push-out distance)
-        float EffectiveRadius = 
-            Math::FMath::Abs(Plane.X) * Extent.X +
-            Math::FMath::Abs(Plane.Y) * Extent.Y +
-            Math::FMath::Abs(Plane.Z) * Extent.Z;
-        
-        // If the box is completely outside this plane, it's not visible
-        if (Distance > EffectiveRadius)
-        {
-            return false;
-        }
-    }
+        VisibilityWords[WordIndex] = CullPrimitiveRange(Scene, RenderFrustum, Flags, StartIndex, EndIndex);
+    }, PrimitivesPerTask / NumBitsPerDWORD);
     
-    return true;
+    return NumPrimitives - View.PrimitiveVisibilityMap.CountSetBits();
 }
 
-bool FFrustumCuller::IntersectBoxPlanes(const Math::FVector& Origin, const Math::FVector& Extent,
-                                        const Math::FPlane* Planes, int32 NumPlanes)
+uint32 FFrustumCuller::CullPrimitiveRange(const FScene* Scene, const FRenderConvexVolume& RenderFrustum,
+                                          const FPrimitiveCullingFlags& Flags,
+                                          int32 StartIndex, int32 EndIndex) const
 {
-    for (int32 PlaneIndex = 0; PlaneIndex < NumPlanes; ++PlaneIndex)
-    {
-        const Math::FPlane& Plane = Planes[PlaneIndex];
-        
-        float Distance = Plane.X * Origin.X + Plane.Y * Origin.Y + Plane.Z * Origin.Z - Plane.W;
-        float EffectiveRadius = 
-            Math::FMath::Abs(Plane.X) * Extent.X +
-            Math::FMath::Abs(Plane.Y) * Extent.Y +
-            Math::FMath::Abs(Plane.Z) * Extent.Z;
-        
-        if (Distance > EffectiveRadius)
-        {
-            return false;
-        }
-    }
+    // Box test 8 primitives at a time; StartIndex is word aligned, so the range
+    // starts on a block boundary
+    uint32 VisibleBits = 0;
+    RenderFrustum.IntersectBoxBlocks(Scene->GetPrimitiveBoundsBlocks().GetData() + StartIndex / 8,
+                                     EndIndex - StartIndex, &VisibleBits);
     
-    return true;
-}
-
-bool FFrustumCuller::IntersectSpherePlanes(const Math::FVector& Center, float Radius,
-                                           const Math::FPlane* Planes, int32 NumPlanes)
-{
-    for (int32 PlaneIndex = 0; PlaneIndex < NumPlanes; ++PlaneIndex)
+    // Optional sphere test, only on the primitives that passed the box test
+    if (Flags.bAlsoUseSphereTest)
     {
-        const Math::FPlane& Plane = Planes[PlaneIndex];
-        
-        float Distance = Plane.X * Center.X + Plane.Y * Center.Y + Plane.Z * Center.Z - Plane.W;
-        
-        if (Distance > Radius)
+        const TArray<Math::FRenderBounds>& RenderBounds = Scene->GetPrimitiveRenderBounds();
+        for (uint32 RemainingBits = VisibleBits; RemainingBits != 0; RemainingBits &= RemainingBits - 1)
         {
-            return false;
+            const int32 Offset = std::countr_zero(RemainingBits);
+            const Math::FRenderBounds& Bounds = RenderBounds[StartIndex + Offset];
+            if (!RenderFrustum.IntersectSphere(Bounds.Origin, Bounds.SphereRadius))
+            {
+                VisibleBits &= ~(1u << Offset);
+            }
         }
     }
     
-    return true;
+    return VisibleBits;
 }
 
 // ============================================================================
@@ -221,16 +132,18 @@ int32 FDistanceCuller::CullPrimitives(const FScene* Scene, FViewInfo& View)
         return 0;
     }
     
-    int32 NumCulled = 0;
     const TArray<FPrimitiveBounds>& PrimitiveBounds = Scene->GetPrimitiveBounds();
     const Math::FVector& ViewOrigin = View.GetViewOrigin();
     
-    for (int32 PrimitiveIndex = 0; PrimitiveIndex < PrimitiveBounds.Num(); ++PrimitiveIndex)
+    // Test only primitives earlier stages left visible, collecting the culled ones in a mask
+    CulledPrimitiveMap.Init(false, View.PrimitiveVisibilityMap.Num());
+    
+    for (TConstSetBitIterator<> It(View.PrimitiveVisibilityMap); It; ++It)
     {
-        // Skip already culled primitives
-        if (!View.IsPrimitiveVisible(PrimitiveIndex))
+        const int32 PrimitiveIndex = It.GetIndex();
+        if (PrimitiveIndex >= PrimitiveBounds.Num())
         {
-            continue;
+            break;
         }
         
         const FPrimitiveBounds& Bounds = PrimitiveBounds[PrimitiveIndex];
@@ -244,8 +157,7 @@ int32 FDistanceCuller::CullPrimitives(const FScene* Scene, FViewInfo& View)
         if (IsDistanceCulled(DistanceSquared, Bounds.MinDrawDistance, Bounds.MaxCullDistance,
                             ViewDistanceScale, bMayBeFading, bFadingIn))
         {
-            View.SetPrimitiveVisibility(PrimitiveIndex, false);
-            NumCulled++;
+            CulledPrimitiveMap.SetBit(PrimitiveIndex, true);
         }
         else if (bMayBeFading)
         {
@@ -254,7 +166,8 @@ int32 FDistanceCuller::CullPrimitives(const FScene* Scene, FViewInfo& View)
         }
     }
     
-    return NumCulled;
+    View.PrimitiveVisibilityMap.CombineWithBitwiseANDNOT(CulledPrimitiveMap);
+    return CulledPrimitiveMap.CountSetBits();
 }
 
 bool FDistanceCuller::IsDistanceCulled(float DistanceSquared, float MinDrawDistance, 
@@ -458,9 +371,7 @@ int32 FOcclusionCuller::CullPrimitives(const FScene* Scene, FViewInfo& View,
         return 0;
     }
     
-    int32 NumCulled = 0;
     const TArray<FPrimitiveBounds>& PrimitiveBounds = Scene->GetPrimitiveBounds();
-    const TArray<uint8>& OcclusionFlags = Scene->GetPrimitiveOcclusionFlags();
     
     // Ensure history array is properly sized
     if (OcclusionHistory.Num() != PrimitiveBounds.Num())
@@ -468,25 +379,23 @@ int32 FOcclusionCuller::CullPrimitives(const FScene* Scene, FViewInfo& View,
         OcclusionHistory.SetNum(PrimitiveBounds.Num());
     }
     
-    for (int32 PrimitiveIndex = 0; PrimitiveIndex < PrimitiveBounds.Num(); ++PrimitiveIndex)
+    // Candidates are the visible primitives that can be occluded
+    OcclusionCandidateMap = View.PrimitiveVisibilityMap;
+    OcclusionCandidateMap.CombineWithBitwiseAND(Scene->GetPrimitivesCanBeOccludedMap());
+    OccludedPrimitiveMap.Init(false, OcclusionCandidateMap.Num());
+    
+    for (TConstSetBitIterator<> It(OcclusionCandidateMap); It; ++It)
     {
-        // Skip already culled primitives
-        if (!View.IsPrimitiveVisible(PrimitiveIndex))
-        {
-            continue;
-        }
-        
-        // Check if primitive can be occluded
-        if (!(OcclusionFlags[PrimitiveIndex] & EOcclusionFlags::CanBeOccluded))
+        const int32 PrimitiveIndex = It.GetIndex();
+        if (PrimitiveIndex >= PrimitiveBounds.Num())
         {
-            continue;
+            break;
         }
         
         // Check occlusion based on history
         if (IsPrimitiveOccluded(PrimitiveIndex, CurrentFrame))
         {
-            View.SetPrimitiveVisibility(PrimitiveIndex, false);
-            NumCulled++;
+            OccludedPrimitiveMap.SetBit(PrimitiveIndex, true);
         }
         else
         {
@@ -501,7 +410,8 @@ int32 FOcclusionCuller::CullPrimitives(const FScene* Scene, FViewInfo& View,
         }
     }
     
-    return NumCulled;
+    View.PrimitiveVisibilityMap.CombineWithBitwiseANDNOT(OccludedPrimitiveMap);
+    return OccludedPrimitiveMap.CountSetBits();
 }
 
 void FOcclusionCuller::EndOcclusionCulling(IRHICommandList& RHICmdList)
@@ -646,12 +556,9 @@ void FSceneVisibility::ComputeViewVisibility(const FScene* Scene, FViewInfo& Vie
         return;
     }
     
-    // Initialize visibility to all visible
+    // Initialize visibility to all visible; each stage then clears the bits it culls
     View.InitVisibilityArrays(NumPrimitives);
-    for (int32 i = 0; i < NumPrimitives; ++i)
-    {
-        View.SetPrimitiveVisibility(i, true);
-    }
+    View.PrimitiveVisibilityMap.Init(true, NumPrimitives);
     
     int32 TotalCulled = 0;
     
@@ -660,7 +567,6 @@ void FSceneVisibility::ComputeViewVisibility(const FScene* Scene, FViewInfo& Vie
     {
         FPrimitiveCullingFlags Flags;
         Flags.bShouldVisibilityCull = true;
-        Flags.bUseFastIntersect = true;
         Flags.bAlsoUseSphereTest = true;
         
         int32 NumFrustumCulled = FrustumCuller.CullPrimitives(Scene, View, Flags);
@@ -1,13 +1,510 @@
 // Copyright Monster Engine. All Rights Reserved.
 
+/**
+ * Standalone task graph test and benchmark program
+ * 
+ * Not part of MonsterEngine.vcxproj: it has its own main() and replaces the
+ * global operator new to count allocations, which would affect the whole
+ * engine executable. Build it as a separate console program together with
+ * the Core sources, on Windows or Linux.
+ */
+
 #include "Core/CoreMinimal.h"
 #include "Core/FTaskGraph.h"
 #include "Core/FGraphEvent.h"
+#include "Core/TTask.h"
+#include "Core/FTaskTracer.h"
+#include "Core/IO/FAsyncFileIOTask.h"
+#include "Core/HAL/FMemoryManager.h"
 #include "Core/Log.h"
+#include "Core/Templates/RadixSort.h"
+#include <algorithm>
 #include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
 
 using namespace MonsterEngine;
 
+/**
+ * Coroutine that suspends on a graph event and returns Value once it completes
+ */
+static TTask<int32> WaitForGateCoroutine(FGraphEventRef Gate, int32 Value) {
+    co_await Gate;
+    co_return Value;
+}
+
+/**
+ * Decode stage of the coroutine load pipeline: sums the bytes that were read
+ */
+static TTask<uint64> DecodeCoroutine(const std::vector<uint8>* Buffer, SIZE_T NumBytes) {
+    uint64 sum = 0;
+    for (SIZE_T i = 0; i < NumBytes; ++i) {
+        sum += (*Buffer)[i];
+    }
+    co_return sum;
+}
+
+/**
+ * Read -> decode -> build pipeline written as straight-line coroutine code
+ * Returns the byte sum, or 0 if the read failed
+ */
+static TTask<uint64> LoadPipelineCoroutine(String FilePath, SIZE_T FileSize) {
+    std::vector<uint8> buffer(FileSize);
+    
+    MonsterRender::FAsyncFileIO::FReadRequest request;
+    request.FilePath = FilePath;
+    request.Offset = 0;
+    request.Size = FileSize;
+    request.DestBuffer = buffer.data();
+    
+    MonsterRender::FAsyncFileIO::FReadResult read = co_await MonsterRender::FAsyncFileIO::Get().AwaitRead(request);
+    if (!read.bSuccess) {
+        co_return 0;
+    }
+    
+    uint64 decoded = co_await DecodeCoroutine(&buffer, read.BytesRead);
+    
+    // Build stage: plain task graph work awaited through its event
+    uint64 built = 0;
+    co_await FTaskGraph::QueueNamedTask("BuildStage", [&built, decoded]() {
+        built = decoded;
+    });
+    
+    co_return built;
+}
+
+/** Global heap allocation counter for the task allocation benchmark */
+static std::atomic<uint64> g_numHeapAllocations{0};
+
+void* operator new(std::size_t Size) {
+    g_numHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(Size ? Size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t Size, std::align_val_t Alignment) {
+    g_numHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+    const std::size_t alignment = static_cast<std::size_t>(Alignment);
+#if defined(_WIN32)
+    if (void* ptr = _aligned_malloc(Size ? Size : 1, alignment)) {
+        return ptr;
+    }
+#else
+    if (void* ptr = std::aligned_alloc(alignment, (Size + alignment - 1) & ~(alignment - 1))) {
+        return ptr;
+    }
+#endif
+    throw std::bad_alloc();
+}
+
+/** Frees memory from the aligned operator new above */
+static void FreeAligned(void* Ptr) noexcept {
+#if defined(_WIN32)
+    _aligned_free(Ptr);
+#else
+    std::free(Ptr);
+#endif
+}
+
+void operator delete(void* Ptr) noexcept { std::free(Ptr); }
+void operator delete(void* Ptr, std::size_t) noexcept { std::free(Ptr); }
+void operator delete(void* Ptr, std::align_val_t) noexcept { FreeAligned(Ptr); }
+void operator delete(void* Ptr, std::size_t, std::align_val_t) noexcept { FreeAligned(Ptr); }
+
+/**
+ * Benchmark heap allocations made per task submission
+ * 
+ * Counts global operator new calls while queuing and running tasks after a
+ * warm-up pass has filled the task entry and graph event pools. With
+ * pooled entries, pooled events and inline delegates the steady state
+ * should be zero for captures up to 64 bytes; larger captures fall back
+ * to one heap allocation. TArray storage (std::realloc) is not counted.
+ */
+static void RunTaskAllocationBenchmark() {
+    const int numTasks = 100000;
+    
+    printf("\n=== Task Allocation Benchmark (%d tasks) ===\n", numTasks);
+    printf("%-28s %16s %14s\n", "Case", "Allocs/task", "Tasks/sec");
+    
+    FTaskGraph::Initialize(4);
+    
+    std::atomic<uint64> sink{0};
+    struct FLargeCapture {
+        uint64 Values[16] = {};
+    };
+    
+    auto runIndependent = [&sink](int Count) {
+        for (int i = 0; i < Count; ++i) {
+            FTaskGraph::QueueNamedTask("AllocBenchTask", [&sink, i]() {
+                sink.fetch_add(static_cast<uint64>(i), std::memory_order_relaxed);
+            });
+        }
+        FTaskGraph::WaitForAllTasks();
+    };
+    
+    auto runChained = [&sink](int Count) {
+        FGraphEventArray prerequisites;
+        prerequisites.push_back(FTaskGraph::QueueNamedTask("AllocBenchChainRoot", []() {}));
+        for (int i = 0; i < Count; ++i) {
+            prerequisites[0] = FTaskGraph::QueueNamedTask("AllocBenchChain", [&sink, i]() {
+                sink.fetch_add(static_cast<uint64>(i), std::memory_order_relaxed);
+            }, prerequisites);
+        }
+        prerequisites[0]->Wait();
+        FTaskGraph::WaitForAllTasks();
+    };
+    
+    auto runLargeCapture = [&sink](int Count) {
+        FLargeCapture capture;
+        for (int i = 0; i < Count; ++i) {
+            capture.Values[0] = static_cast<uint64>(i);
+            FTaskGraph::QueueNamedTask("AllocBenchLarge", [&sink, capture]() {
+                sink.fetch_add(capture.Values[0], std::memory_order_relaxed);
+            });
+        }
+        FTaskGraph::WaitForAllTasks();
+    };
+    
+    auto measure = [numTasks](const char* Name, auto&& Run) {
+        // Warm up so the pools reach steady state
+        Run(numTasks);
+        
+        const uint64 allocationsBefore = g_numHeapAllocations.load(std::memory_order_relaxed);
+        auto start = std::chrono::high_resolution_clock::now();
+        Run(numTasks);
+        double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+        const uint64 allocations = g_numHeapAllocations.load(std::memory_order_relaxed) - allocationsBefore;
+        
+        printf("%-28s %16.4f %14.0f\n", Name,
+               static_cast<double>(allocations) / numTasks,
+               seconds > 0.0 ? numTasks / seconds : 0.0);
+    };
+    
+    measure("No prerequisites", runIndependent);
+    measure("One prerequisite (chain)", runChained);
+    measure("128-byte capture (fallback)", runLargeCapture);
+    
+    FTaskGraph::Shutdown();
+}
+
+/**
+ * Benchmark work-stealing scheduler throughput
+ * 
+ * For each thread count, a batch of root tasks is queued from the main thread
+ * (injection queue). Every root fans out tiny child tasks from its worker
+ * (local deque), so idle workers have to steal to stay busy.
+ * Reports tasks/sec and steal rate (steals / executed tasks).
+ */
+static void RunWorkStealingBenchmark() {
+    const uint32 threadCounts[] = {1, 2, 4, 8, 16, 32, 64};
+    const int numRootTasks = 64;
+    const int numChildrenPerRoot = 1024;
+    const int numIterations = 3;
+    
+    printf("\n=== Work-Stealing Benchmark (%d roots x %d children) ===\n", numRootTasks, numChildrenPerRoot);
+    printf("%8s %16s %12s %14s\n", "Threads", "Tasks/sec", "Steal rate", "Steal success");
+    
+    for (uint32 numThreads : threadCounts) {
+        FTaskGraph::Initialize(numThreads);
+        
+        std::atomic<uint64> checksum{0};
+        uint64 totalTasks = 0;
+        double totalSeconds = 0.0;
+        
+        // Warm up workers and deques
+        FTaskGraph::QueueNamedTask("Warmup", []() {})->Wait();
+        FTaskGraph::WaitForAllTasks();
+        FTaskGraph::ResetStats();
+        
+        for (int iteration = 0; iteration < numIterations; ++iteration) {
+            auto start = std::chrono::high_resolution_clock::now();
+            
+            for (int root = 0; root < numRootTasks; ++root) {
+                FTaskGraph::QueueNamedTask("BenchRoot", [&checksum, numChildrenPerRoot]() {
+                    for (int child = 0; child < numChildrenPerRoot; ++child) {
+                        FTaskGraph::QueueNamedTask("BenchChild", [&checksum, child]() {
+                            // Small amount of work per task
+                            uint64 value = static_cast<uint64>(child);
+                            for (int i = 0; i < 64; ++i) {
+                                value = value * 6364136223846793005ull + 1442695040888963407ull;
+                            }
+                            checksum.fetch_add(value & 1, std::memory_order_relaxed);
+                        });
+                    }
+                });
+            }
+            
+            FTaskGraph::WaitForAllTasks();
+            
+            auto end = std::chrono::high_resolution_clock::now();
+            totalSeconds += std::chrono::duration<double>(end - start).count();
+            totalTasks += static_cast<uint64>(numRootTasks) * (numChildrenPerRoot + 1);
+        }
+        
+        FTaskGraphStats stats = FTaskGraph::GetStats();
+        double stealSuccess = stats.NumStealAttempts > 0
+            ? static_cast<double>(stats.NumSteals) / static_cast<double>(stats.NumStealAttempts) : 0.0;
+        
+        printf("%8u %16.0f %11.2f%% %13.2f%%\n",
+               numThreads,
+               totalSeconds > 0.0 ? static_cast<double>(totalTasks) / totalSeconds : 0.0,
+               stats.GetStealRate() * 100.0,
+               stealSuccess * 100.0);
+        
+        FTaskGraph::Shutdown();
+    }
+}
+
+/**
+ * Benchmark ParallelFor scaling on a frustum-culling style kernel
+ * 
+ * Tests N boxes against 6 planes and writes a visibility bitmask, split on
+ * 32-bit word boundaries exactly like FFrustumCuller::CullPrimitives.
+ */
+static void RunParallelForBenchmark() {
+    struct FBox {
+        float OriginX, OriginY, OriginZ;
+        float ExtentX, ExtentY, ExtentZ;
+    };
+    
+    struct FPlane {
+        float X, Y, Z, W;
+    };
+    
+    const FPlane planes[6] = {
+        { 1.0f,  0.0f,  0.0f, 500.0f}, {-1.0f,  0.0f,  0.0f, 500.0f},
+        { 0.0f,  1.0f,  0.0f, 500.0f}, { 0.0f, -1.0f,  0.0f, 500.0f},
+        { 0.0f,  0.0f,  1.0f, 500.0f}, { 0.0f,  0.0f, -1.0f, 500.0f},
+    };
+    
+    const uint32 threadCounts[] = {1, 2, 4, 8, 16};
+    const int32 primitiveCounts[] = {10000, 100000, 1000000};
+    const int32 minWordsPerBatch = 128;
+    const int numIterations = 10;
+    
+    printf("\n=== ParallelFor Culling Benchmark ===\n");
+    printf("%8s %12s %14s %14s %10s\n", "Threads", "Primitives", "Serial (ms)", "Parallel (ms)", "Speedup");
+    
+    for (uint32 numThreads : threadCounts) {
+        FTaskGraph::Initialize(numThreads);
+        
+        for (int32 numPrimitives : primitiveCounts) {
+            std::vector<FBox> boxes(numPrimitives);
+            uint32 seed = 12345;
+            for (FBox& box : boxes) {
+                auto next = [&seed]() {
+                    seed = seed * 1664525u + 1013904223u;
+                    return static_cast<float>(seed >> 8) / 16777216.0f;
+                };
+                box = {next() * 2000.0f - 1000.0f, next() * 2000.0f - 1000.0f, next() * 2000.0f - 1000.0f,
+                       next() * 20.0f, next() * 20.0f, next() * 20.0f};
+            }
+            
+            const int32 numWords = (numPrimitives + 31) / 32;
+            std::vector<uint32> serialMask(numWords, 0);
+            std::vector<uint32> parallelMask(numWords, 0);
+            
+            auto cullWord = [&boxes, &planes, numPrimitives](int32 WordIndex, uint32* Mask) {
+                const int32 start = WordIndex * 32;
+                const int32 end = std::min(start + 32, numPrimitives);
+                uint32 bits = 0;
+                for (int32 i = start; i < end; ++i) {
+                    const FBox& box = boxes[i];
+                    bool visible = true;
+                    for (const FPlane& plane : planes) {
+                        float distance = plane.X * box.OriginX + plane.Y * box.OriginY + plane.Z * box.OriginZ - plane.W;
+                        float radius = std::abs(plane.X) * box.ExtentX + std::abs(plane.Y) * box.ExtentY +
+                                       std::abs(plane.Z) * box.ExtentZ;
+                        visible = visible && distance <= radius;
+                    }
+                    bits |= (visible ? 1u : 0u) << (i - start);
+                }
+                Mask[WordIndex] = bits;
+            };
+            
+            auto serialStart = std::chrono::high_resolution_clock::now();
+            for (int iteration = 0; iteration < numIterations; ++iteration) {
+                for (int32 word = 0; word < numWords; ++word) {
+                    cullWord(word, serialMask.data());
+                }
+            }
+            double serialMs = std::chrono::duration<double, std::milli>(
+                std::chrono::high_resolution_clock::now() - serialStart).count() / numIterations;
+            
+            auto parallelStart = std::chrono::high_resolution_clock::now();
+            for (int iteration = 0; iteration < numIterations; ++iteration) {
+                FTaskGraph::ParallelFor(numWords, [&](int32 WordIndex) {
+                    cullWord(WordIndex, parallelMask.data());
+                }, minWordsPerBatch);
+            }
+            double parallelMs = std::chrono::duration<double, std::milli>(
+                std::chrono::high_resolution_clock::now() - parallelStart).count() / numIterations;
+            
+            printf("%8u %12d %14.3f %14.3f %9.2fx%s\n",
+                   numThreads, numPrimitives, serialMs, parallelMs,
+                   parallelMs > 0.0 ? serialMs / parallelMs : 0.0,
+                   serialMask == parallelMask ? "" : "  MISMATCH");
+        }
+        
+        FTaskGraph::Shutdown();
+    }
+}
+
+/**
+ * Benchmark RadixSort against TArray::Sort on mesh draw command sort keys
+ * 
+ * Sorts 32-byte elements by 64-bit keys packed like FMeshDrawCommand::CalculateSortKey
+ * (pipeline, material, mesh, LOD), and 16-byte distance pairs by float key
+ * back-to-front like FTransparentPass::SortPrimitives. Results are checked
+ * against std::stable_sort.
+ */
+static void RunRadixSortBenchmark() {
+    struct FDrawCommand {
+        const void* MeshDrawCommand;
+        uint32 DrawPrimitiveId;
+        uint32 InstanceFactor;
+        uint64 SortKey;
+        int32 StateBucketId;
+    };
+    
+    struct FDistancePair {
+        float Key;
+        void* Value;
+    };
+    
+    const int32 commandCounts[] = {10000, 50000, 100000, 500000};
+    const int numIterations = 10;
+    
+    FTaskGraph::Initialize();
+    printf("\n=== Radix Sort Benchmark (%u workers) ===\n", FTaskGraph::GetNumWorkerThreads());
+    printf("%-10s %10s %14s %14s %14s %10s\n", "Keys", "Elements", "Sort (ms)", "Radix (ms)", "Parallel (ms)", "Speedup");
+    
+    auto printRow = [](const char* keys, int32 num, double sortMs, double radixMs, double parallelMs, bool bMatches) {
+        const double bestMs = std::min(radixMs, parallelMs);
+        printf("%-10s %10d %14.3f %14.3f %14.3f %9.2fx%s\n", keys, num, sortMs, radixMs, parallelMs,
+               bestMs > 0.0 ? sortMs / bestMs : 0.0, bMatches ? "" : "  MISMATCH");
+    };
+    
+    for (int32 numCommands : commandCounts) {
+        uint32 seed = 12345;
+        auto next = [&seed]() {
+            seed = seed * 1664525u + 1013904223u;
+            return seed >> 8;
+        };
+        
+        TArray<FDrawCommand> source;
+        TArray<FDistancePair> distances;
+        for (int32 i = 0; i < numCommands; ++i) {
+            const uint64 pipeline = next() % 64;
+            const uint64 material = next() % 1024;
+            const uint64 mesh = next() & 0xFFFF;
+            const uint64 lod = next() % 4;
+            FDrawCommand command = {};
+            command.DrawPrimitiveId = static_cast<uint32>(i);
+            command.SortKey = (pipeline << 48) | (material << 32) | (mesh << 16) | lod;
+            source.Add(command);
+            distances.Add(FDistancePair{static_cast<float>(next()) * 0.01f - 50000.0f, nullptr});
+        }
+        
+        TArray<FDrawCommand> expected = source;
+        std::stable_sort(expected.begin(), expected.end(), [](const FDrawCommand& A, const FDrawCommand& B) {
+            return A.SortKey < B.SortKey;
+        });
+        
+        double timesMs[3] = {};
+        bool bMatches = true;
+        for (int mode = 0; mode < 3; ++mode) {
+            TArray<FDrawCommand> commands;
+            double totalMs = 0.0;
+            for (int iteration = 0; iteration < numIterations; ++iteration) {
+                commands = source;
+                auto start = std::chrono::high_resolution_clock::now();
+                if (mode == 0) {
+                    commands.Sort([](const FDrawCommand& A, const FDrawCommand& B) {
+                        return A.SortKey < B.SortKey;
+                    });
+                } else {
+                    RadixSort(commands, [](const FDrawCommand& Command) {
+                        return Command.SortKey;
+                    }, mode == 2);
+                }
+                totalMs += std::chrono::duration<double, std::milli>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+            }
+            timesMs[mode] = totalMs / numIterations;
+            
+            // Radix sort is stable, so it must match element for element
+            for (int32 i = 0; i < numCommands; ++i) {
+                bMatches = bMatches && commands[i].SortKey == expected[i].SortKey &&
+                    (mode == 0 || commands[i].DrawPrimitiveId == expected[i].DrawPrimitiveId);
+            }
+        }
+        printRow("uint64", numCommands, timesMs[0], timesMs[1], timesMs[2], bMatches);
+        
+        for (int mode = 0; mode < 3; ++mode) {
+            TArray<FDistancePair> sorted;
+            double totalMs = 0.0;
+            for (int iteration = 0; iteration < numIterations; ++iteration) {
+                sorted = distances;
+                auto start = std::chrono::high_resolution_clock::now();
+                if (mode == 0) {
+                    sorted.Sort([](const FDistancePair& A, const FDistancePair& B) {
+                        return A.Key > B.Key;
+                    });
+                } else {
+                    RadixSort(sorted, [](const FDistancePair& Pair) {
+                        return -Pair.Key;
+                    }, mode == 2);
+                }
+                totalMs += std::chrono::duration<double, std::milli>(
+                    std::chrono::high_resolution_clock::now() - start).count();
+            }
+            timesMs[mode] = totalMs / numIterations;
+            
+            bMatches = true;
+            for (int32 i = 1; i < numCommands; ++i) {
+                bMatches = bMatches && sorted[i - 1].Key >= sorted[i].Key;
+            }
+        }
+        printRow("float", numCommands, timesMs[0], timesMs[1], timesMs[2], bMatches);
+    }
+    
+    // Frame arrays sort without the heap: scratch and histograms come from the warm stack and are released
+    {
+        MonsterRender::FMemStack& mem = MonsterRender::FMemStack::Get();
+        MonsterRender::FMemMark mark(mem);
+        TArray<FDistancePair, TMemStackAllocator<>> frameArray;
+        for (int32 i = 0; i < 100000; ++i) {
+            frameArray.Add(FDistancePair{static_cast<float>((i * 7919) % 100000), nullptr});
+        }
+        RadixSort(frameArray, [](const FDistancePair& Pair) { return Pair.Key; }, true);
+        
+        const uint64 chunksBefore = MonsterRender::FMemStack::GetStats().ChunkAllocations;
+        const SIZE_T bytesBefore = mem.GetByteCount();
+        RadixSort(frameArray, [](const FDistancePair& Pair) { return -Pair.Key; }, true);
+        const bool bNoHeap = MonsterRender::FMemStack::GetStats().ChunkAllocations == chunksBefore;
+        const bool bReleased = mem.GetByteCount() == bytesBefore;
+        printf("FMemStack-backed sort: %s chunk allocations, %s\n", bNoHeap ? "no" : "new",
+               bReleased ? "scratch released" : "scratch LEAKED on the stack");
+        if (!bNoHeap || !bReleased || frameArray[0].Key != 99999.0f) {
+            MR_LOG_ERROR("Radix sort of a frame array FAILED");
+        }
+    }
+    
+    FTaskGraph::Shutdown();
+}
+
 /**
  * Test program for task graph system
  * Validates FTaskGraph, FGraphEvent, FRunnable, and FRunnableThread
@@ -54,7 +551,7 @@ int main() {
         
         for (int i = 0; i < numTasks; ++i) {
             auto event = FTaskGraph::QueueNamedTask(
-                "ParallelTask_" + std::to_string(i),
+                "ParallelTask",
                 [&counter, i]() {
                     counter.fetch_add(1, std::memory_order_relaxed);
                     MR_LOG_DEBUG("ParallelTask_" + std::to_string(i) + " executed");
@@ -121,7 +618,7 @@ int main() {
         FGraphEventArray childEvents;
         for (int i = 0; i < 3; ++i) {
             auto childEvent = FTaskGraph::QueueNamedTask(
-                "ChildTask_" + std::to_string(i),
+                "ChildTask",
                 [&counter, i]() {
                     counter.fetch_add(1, std::memory_order_relaxed);
                     MR_LOG_INFO("ChildTask_" + std::to_string(i) + " executed");
@@ -174,7 +671,7 @@ int main() {
         const int numTasks = 20;
         for (int i = 0; i < numTasks; ++i) {
             FTaskGraph::QueueNamedTask(
-                "BulkTask_" + std::to_string(i),
+                "BulkTask",
                 [i]() {
                     MR_LOG_DEBUG("BulkTask_" + std::to_string(i) + " executed");
                     std::this_thread::sleep_for(std::chrono::milliseconds(5));
@@ -193,10 +690,388 @@ int main() {
         }
     }
     
+    // Test 8: Dependents do not occupy workers while waiting
+    MR_LOG_INFO("\nTest 8: Waiting dependents do not block workers");
+    {
+        // More dependents than workers wait on an event that is only completed
+        // by a task queued afterwards. Blocking waits would starve that task.
+        const int numDependents = 16;
+        std::atomic<int> counter{0};
+        FGraphEventRef gate = MakeGraphEvent();
+        FGraphEventArray dependentEvents;
+        
+        for (int i = 0; i < numDependents; ++i) {
+            dependentEvents.push_back(FTaskGraph::QueueNamedTask("GatedTask", [&counter]() {
+                counter.fetch_add(1, std::memory_order_relaxed);
+            }, {gate}));
+        }
+        
+        FTaskGraph::QueueNamedTask("OpenGate", [gate]() {
+            gate->Complete();
+        });
+        
+        bool allCompleted = true;
+        for (const auto& event : dependentEvents) {
+            allCompleted = event->WaitFor(5000) && allCompleted;
+        }
+        
+        if (allCompleted && counter.load() == numDependents) {
+            MR_LOG_INFO("Test 8 PASSED: All gated tasks ran after the gate opened");
+        } else {
+            MR_LOG_ERROR("Test 8 FAILED: " + std::to_string(counter.load()) + " of " + 
+                        std::to_string(numDependents) + " gated tasks executed");
+        }
+    }
+    
+    // Test 9: Deep dependency chain
+    MR_LOG_INFO("\nTest 9: Deep dependency chain");
+    {
+        const int chainLength = 10000;
+        std::atomic<int> lastIndex{-1};
+        std::atomic<bool> inOrder{true};
+        FGraphEventRef previous;
+        
+        for (int i = 0; i < chainLength; ++i) {
+            FGraphEventArray prerequisites;
+            if (previous) {
+                prerequisites.push_back(previous);
+            }
+            previous = FTaskGraph::QueueNamedTask("ChainTask", [&lastIndex, &inOrder, i]() {
+                if (lastIndex.exchange(i, std::memory_order_acq_rel) != i - 1) {
+                    inOrder.store(false, std::memory_order_relaxed);
+                }
+            }, prerequisites);
+        }
+        
+        bool completed = previous->WaitFor(10000);
+        
+        if (completed && inOrder.load() && lastIndex.load() == chainLength - 1) {
+            MR_LOG_INFO("Test 9 PASSED: Chain of " + std::to_string(chainLength) + " tasks executed in order");
+        } else {
+            MR_LOG_ERROR("Test 9 FAILED: Chain stopped at " + std::to_string(lastIndex.load()));
+        }
+    }
+    
+    // Test 10: ParallelFor visits every index exactly once
+    MR_LOG_INFO("\nTest 10: ParallelFor");
+    {
+        const int32 num = 100000;
+        std::vector<std::atomic<int32>> visits(num);
+        
+        FTaskGraph::ParallelFor(num, [&visits](int32 Index) {
+            visits[Index].fetch_add(1, std::memory_order_relaxed);
+        }, 64);
+        
+        int32 numWrong = 0;
+        for (const auto& count : visits) {
+            numWrong += count.load() != 1 ? 1 : 0;
+        }
+        
+        // Nested ParallelFor from inside a task must not deadlock
+        std::atomic<int32> nestedSum{0};
+        FTaskGraph::QueueNamedTask("NestedParallelFor", [&nestedSum]() {
+            FTaskGraph::ParallelFor(1000, [&nestedSum](int32 Index) {
+                nestedSum.fetch_add(Index, std::memory_order_relaxed);
+            });
+        })->Wait();
+        
+        if (numWrong == 0 && nestedSum.load() == 999 * 1000 / 2) {
+            MR_LOG_INFO("Test 10 PASSED: ParallelFor covered all indices once");
+        } else {
+            MR_LOG_ERROR("Test 10 FAILED: " + std::to_string(numWrong) + " indices visited != 1 times");
+        }
+    }
+    
+    // Test 11: Coroutines suspended on an event do not occupy workers
+    MR_LOG_INFO("\nTest 11: Coroutine tasks awaiting graph events");
+    {
+        // More suspended coroutines than workers: blocking waits would deadlock
+        const int32 numCoroutines = 32;
+        FGraphEventRef gate = MakeGraphEvent();
+        std::vector<TTask<int32>> coroutines;
+        for (int32 i = 0; i < numCoroutines; ++i) {
+            coroutines.push_back(WaitForGateCoroutine(gate, i));
+        }
+        
+        std::atomic<bool> otherTaskRan{false};
+        bool otherTaskCompleted = FTaskGraph::QueueNamedTask("WhileSuspended", [&otherTaskRan]() {
+            otherTaskRan.store(true);
+        })->WaitFor(5000);
+        
+        bool anyFinishedEarly = false;
+        for (const auto& coroutine : coroutines) {
+            anyFinishedEarly |= coroutine.IsCompleted();
+        }
+        
+        gate->Complete();
+        
+        int32 sum = 0;
+        for (const auto& coroutine : coroutines) {
+            sum += coroutine.GetResult();
+        }
+        
+        if (otherTaskCompleted && otherTaskRan.load() && !anyFinishedEarly &&
+            sum == numCoroutines * (numCoroutines - 1) / 2) {
+            MR_LOG_INFO("Test 11 PASSED: " + std::to_string(numCoroutines) + " coroutines resumed after the gate");
+        } else {
+            MR_LOG_ERROR("Test 11 FAILED: sum " + std::to_string(sum));
+        }
+    }
+    
+    // Test 12: Coroutine load pipeline (read -> decode -> build)
+    MR_LOG_INFO("\nTest 12: Coroutine load pipeline");
+    {
+        MonsterRender::FMemoryManager::Get().Initialize();
+        MonsterRender::FAsyncFileIO::Get().Initialize(2);
+        
+        const String filePath = "TestTaskGraph_Pipeline.bin";
+        const SIZE_T fileSize = 64 * 1024;
+        uint64 expectedSum = 0;
+        {
+            std::ofstream file(filePath, std::ios::binary);
+            for (SIZE_T i = 0; i < fileSize; ++i) {
+                const uint8 value = static_cast<uint8>(i * 31);
+                file.put(static_cast<char>(value));
+                expectedSum += value;
+            }
+        }
+        
+        const int32 numPipelines = 8;
+        std::vector<TTask<uint64>> pipelines;
+        for (int32 i = 0; i < numPipelines; ++i) {
+            pipelines.push_back(LoadPipelineCoroutine(filePath, fileSize));
+        }
+        
+        int32 numCorrect = 0;
+        for (const auto& pipeline : pipelines) {
+            numCorrect += pipeline.GetResult() == expectedSum ? 1 : 0;
+        }
+        
+        MonsterRender::FAsyncFileIO::Get().Shutdown();
+        std::remove(filePath.c_str());
+        
+        if (numCorrect == numPipelines) {
+            MR_LOG_INFO("Test 12 PASSED: " + std::to_string(numPipelines) + " pipelines completed");
+        } else {
+            MR_LOG_ERROR("Test 12 FAILED: " + std::to_string(numCorrect) + "/" + std::to_string(numPipelines) + " pipelines correct");
+        }
+    }
+    
+    // Test 13: High-priority tasks overtake a background burst
+    MR_LOG_INFO("\nTest 13: Task priorities");
+    {
+        const int32 numBackgroundTasks = 200;
+        const auto sliceDuration = std::chrono::milliseconds(2);
+        std::atomic<int32> backgroundDone{0};
+        
+        for (int32 i = 0; i < numBackgroundTasks; ++i) {
+            FTaskGraph::QueueNamedTask("BackgroundSlice", [&backgroundDone, sliceDuration]() {
+                std::this_thread::sleep_for(sliceDuration);
+                backgroundDone.fetch_add(1, std::memory_order_relaxed);
+            }, {}, ETaskPriority::Background);
+        }
+        
+        // Let the background burst occupy the workers
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        
+        auto highStart = std::chrono::high_resolution_clock::now();
+        std::atomic<int32> backgroundDoneAtHigh{-1};
+        FTaskGraph::QueueNamedTask("HighPriority", [&backgroundDone, &backgroundDoneAtHigh]() {
+            backgroundDoneAtHigh.store(backgroundDone.load());
+        }, {}, ETaskPriority::High)->Wait();
+        double highLatencyMs = std::chrono::duration<double, std::milli>(
+            std::chrono::high_resolution_clock::now() - highStart).count();
+        
+        FTaskGraph::WaitForAllTasks();
+        
+        // The high task must run long before the burst drains
+        if (backgroundDoneAtHigh.load() < numBackgroundTasks / 2 && backgroundDone.load() == numBackgroundTasks) {
+            MR_LOG_INFO("Test 13 PASSED: High-priority latency " + std::to_string(highLatencyMs) +
+                       " ms with " + std::to_string(backgroundDoneAtHigh.load()) + " background slices done");
+        } else {
+            MR_LOG_ERROR("Test 13 FAILED: High-priority task ran after " +
+                        std::to_string(backgroundDoneAtHigh.load()) + " background slices");
+        }
+    }
+    
+    // Test 14: Named-thread routing
+    MR_LOG_INFO("\nTest 14: Named-thread tasks");
+    {
+        FTaskGraph::AttachToThread(ENamedThread::GameThread);
+        const std::thread::id gameThreadId = std::this_thread::get_id();
+        
+        std::atomic<int32> numOnGameThread{0};
+        std::atomic<int32> order{0};
+        int32 highOrder = -1;
+        int32 normalOrder = -1;
+        
+        // Queued from a worker; RenderThread is not attached, so it forwards to the game thread
+        FTaskGraph::QueueNamedTask("QueueToNamedThreads", [&]() {
+            FTaskGraph::QueueNamedTask("GameThreadNormal", [&]() {
+                numOnGameThread += std::this_thread::get_id() == gameThreadId ? 1 : 0;
+                normalOrder = order++;
+            }, {}, ETaskPriority::Normal, ENamedThread::GameThread);
+            FTaskGraph::QueueNamedTask("RenderThreadHigh", [&]() {
+                numOnGameThread += std::this_thread::get_id() == gameThreadId ? 1 : 0;
+                highOrder = order++;
+            }, {}, ETaskPriority::High, ENamedThread::RenderThread);
+        })->Wait();
+        
+        const bool queuedBeforeProcessing = FTaskGraph::HasPendingThreadTasks(ENamedThread::GameThread);
+        const uint32 numProcessed = FTaskGraph::ProcessThreadUntilIdle(ENamedThread::GameThread);
+        FTaskGraph::DetachFromThread(ENamedThread::GameThread);
+        
+        if (queuedBeforeProcessing && numProcessed == 2 && numOnGameThread.load() == 2 &&
+            highOrder == 0 && normalOrder == 1) {
+            MR_LOG_INFO("Test 14 PASSED: Named-thread tasks ran on the game thread in priority order");
+        } else {
+            MR_LOG_ERROR("Test 14 FAILED: processed " + std::to_string(numProcessed) +
+                        ", on game thread " + std::to_string(numOnGameThread.load()));
+        }
+    }
+    
+    // Test 15: Task tracing and Chrome trace export
+    MR_LOG_INFO("\nTest 15: Task tracer");
+    {
+        // Overhead of recording empty tasks, tracing off vs on
+        auto timeEmptyTasks = [](int32 NumTasks) {
+            auto start = std::chrono::high_resolution_clock::now();
+            FGraphEventArray events;
+            events.reserve(NumTasks);
+            for (int32 i = 0; i < NumTasks; ++i) {
+                events.push_back(FTaskGraph::QueueNamedTask("EmptyTask", []() {}));
+            }
+            WaitForEvents(events);
+            auto end = std::chrono::high_resolution_clock::now();
+            return std::chrono::duration<double, std::milli>(end - start).count();
+        };
+        
+        const int32 numOverheadTasks = 20000;
+        const double untracedMs = timeEmptyTasks(numOverheadTasks);
+        FTaskTracer::Reset();
+        FTaskTracer::SetEnabled(true);
+        const double tracedMs = timeEmptyTasks(numOverheadTasks);
+        FTaskTracer::Reset();
+        
+        // Diamond: Load and Decode feed Build
+        FGraphEventRef load = FTaskGraph::QueueNamedTask("TraceLoad", []() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        });
+        FGraphEventRef decode = FTaskGraph::QueueNamedTask("TraceDecode", []() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        });
+        FTaskGraph::QueueNamedTask("TraceBuild", []() {
+            MR_TRACE_SCOPE("TraceBuildInner");
+        }, {load, decode})->Wait();
+        
+        FTaskTracer::SetEnabled(false);
+        const uint64 numRecorded = FTaskTracer::GetNumRecordedEvents();
+        
+        const String tracePath = "TestTaskGraph_trace.json";
+        const bool exported = FTaskTracer::ExportChromeTrace(tracePath);
+        
+        std::ifstream traceFile(tracePath);
+        std::stringstream traceStream;
+        traceStream << traceFile.rdbuf();
+        const std::string trace = traceStream.str();
+        traceFile.close();
+        std::remove(tracePath.c_str());
+        
+        auto countOccurrences = [&trace](const char* Needle) {
+            int32 count = 0;
+            for (size_t pos = trace.find(Needle); pos != std::string::npos; pos = trace.find(Needle, pos + 1)) {
+                ++count;
+            }
+            return count;
+        };
+        
+        const bool hasSlices = countOccurrences("\"name\":\"TraceLoad\"") == 1 &&
+                               countOccurrences("\"name\":\"TraceDecode\"") == 1 &&
+                               countOccurrences("\"name\":\"TraceBuild\"") == 1 &&
+                               countOccurrences("\"name\":\"TraceBuildInner\"") == 1;
+        const bool hasFlows = countOccurrences("\"ph\":\"s\"") == 2 && countOccurrences("\"ph\":\"f\"") == 2;
+        const bool hasThreadNames = countOccurrences("TaskWorker 0") == 1;
+        const bool isWellFormed = trace.rfind("{\"displayTimeUnit\"", 0) == 0 && trace.find("\n]}") != std::string::npos;
+        
+        MR_LOG_INFO("  " + std::to_string(numOverheadTasks) + " empty tasks: untraced " +
+                   std::to_string(untracedMs) + "ms, traced " + std::to_string(tracedMs) + "ms");
+        
+        if (exported && numRecorded == 6 && hasSlices && hasFlows && hasThreadNames && isWellFormed) {
+            MR_LOG_INFO("Test 15 PASSED: Trace exported with task slices and dependency flows");
+        } else {
+            MR_LOG_ERROR("Test 15 FAILED: recorded " + std::to_string(numRecorded) +
+                        " events, slices " + std::to_string(hasSlices) +
+                        ", flows " + std::to_string(hasFlows) +
+                        ", thread names " + std::to_string(hasThreadNames));
+        }
+        
+        FTaskTracer::Reset();
+    }
+    
     // Shutdown task graph
     MR_LOG_INFO("\n=== Shutting down task graph ===");
+    const uint32 numBuffersBeforeShutdown = FTaskTracer::GetNumThreadBuffers();
     FTaskGraph::Shutdown();
     
+    // Exited workers' trace buffers and this thread's are released by the tracer shutdown
+    FTaskTracer::Shutdown();
+    const uint32 numBuffersAfterShutdown = FTaskTracer::GetNumThreadBuffers();
+    if (numBuffersBeforeShutdown > 1 && numBuffersAfterShutdown == 0) {
+        MR_LOG_INFO("Tracer shutdown PASSED: released " + std::to_string(numBuffersBeforeShutdown) + " thread buffers");
+    } else {
+        MR_LOG_ERROR("Tracer shutdown FAILED: " + std::to_string(numBuffersAfterShutdown) + " of " +
+                    std::to_string(numBuffersBeforeShutdown) + " thread buffers still allocated");
+    }
+    
+    // Single worker: background work must not hold the only worker against higher priorities
+    MR_LOG_INFO("\n=== Task priorities on a single worker ===");
+    {
+        FTaskGraph::Initialize(1);
+        
+        const int32 numBackgroundTasks = 100;
+        const auto sliceDuration = std::chrono::milliseconds(2);
+        std::atomic<int32> backgroundDone{0};
+        for (int32 i = 0; i < numBackgroundTasks; ++i) {
+            FTaskGraph::QueueNamedTask("BackgroundSlice", [&backgroundDone, sliceDuration]() {
+                std::this_thread::sleep_for(sliceDuration);
+                backgroundDone.fetch_add(1, std::memory_order_relaxed);
+            }, {}, ETaskPriority::Background);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        
+        std::atomic<int32> backgroundDoneAtNormal{-1};
+        FTaskGraph::QueueNamedTask("NormalPriority", [&backgroundDone, &backgroundDoneAtNormal]() {
+            backgroundDoneAtNormal.store(backgroundDone.load());
+        }, {}, ETaskPriority::Normal)->Wait();
+        FTaskGraph::WaitForAllTasks();
+        
+        if (backgroundDoneAtNormal.load() < numBackgroundTasks / 2 && backgroundDone.load() == numBackgroundTasks) {
+            MR_LOG_INFO("Single worker PASSED: normal task ran after " +
+                       std::to_string(backgroundDoneAtNormal.load()) + " background slices, all slices done");
+        } else {
+            MR_LOG_ERROR("Single worker FAILED: normal task ran after " + std::to_string(backgroundDoneAtNormal.load()) +
+                        " background slices, " + std::to_string(backgroundDone.load()) + " slices done");
+        }
+        
+        FTaskGraph::Shutdown();
+    }
+    
+    // Test 16: Scheduler throughput at 1-64 threads
+    MR_LOG_INFO("\nTest 16: Work-stealing benchmark");
+    RunWorkStealingBenchmark();
+    
+    // Test 17: ParallelFor scaling over 10k-1M primitives
+    MR_LOG_INFO("\nTest 17: ParallelFor culling benchmark");
+    RunParallelForBenchmark();
+    
+    // Test 18: Heap allocations per task submission
+    MR_LOG_INFO("\nTest 18: Task allocation benchmark");
+    RunTaskAllocationBenchmark();
+    
+    // Test 19: Radix sort of 10k-500k draw commands
+    MR_LOG_INFO("\nTest 19: Radix sort benchmark");
+    RunRadixSortBenchmark();
+    
     MR_LOG_INFO("\n=== All tests completed successfully ===");
     
     return 0;
@@ -111,7 +111,7 @@ void TestParallelTranslationIntegration() {
         
         // Queue recording task
         FGraphEventRef event = FTaskGraph::QueueNamedTask(
-            "RecordCommands_" + std::to_string(i),
+            "RecordCommands",
             [cmdList, i]() {
                 MR_LOG_DEBUG("Thread " + std::to_string(i) + " recording commands");
                 
@@ -4,14 +4,23 @@
  * @file ContainerTest.cpp
  * @brief Test suite for container implementations
  * 
- * Tests TArray, TMap, TSet basic operations.
+ * Tests TArray, TMap, TSet, TFlatMap, FName, FUtf8String basic operations and
+ * benchmarks the hash containers, multi-threaded FName construction and
+ * FUtf8String against FString.
  * Uses printf for output to avoid potential heap corruption issues with logging system.
  */
 
 #include "Containers/Containers.h"
 #include "Core/CoreTypes.h"
 
+#include <atomic>
+#include <chrono>
 #include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace MonsterEngine
 {
@@ -25,6 +34,294 @@ static int32 TestsFailed = 0;
 
 } // namespace MonsterEngine
 
+// ============================================================================
+// Hash Container Benchmark
+// ============================================================================
+
+/**
+ * Times insert, lookup (hits and misses) and erase of N random int keys in
+ * TSet, TFlatSet and std::unordered_map
+ */
+static void BenchmarkHashContainers(int N)
+{
+    using namespace MonsterEngine;
+    using FClock = std::chrono::high_resolution_clock;
+
+    // Random distinct keys; the misses are the same keys with the low bit flipped
+    TArray<int32> Keys;
+    Keys.Reserve(N);
+    uint32 Seed = 12345;
+    for (int i = 0; i < N; ++i) {
+        Seed = Seed * 1664525u + 1013904223u;
+        Keys.Add(static_cast<int32>(Seed & ~1u));
+    }
+
+    auto Ms = [](FClock::time_point Start) {
+        return std::chrono::duration<double, std::milli>(FClock::now() - Start).count();
+    };
+
+    printf("\n--- Hash Container Benchmark (%d int32 keys) ---\n", N);
+    printf("%-20s %10s %10s %10s %10s\n", "Container", "Insert", "Hit", "Miss", "Erase");
+
+    uint64 Checksum = 0;
+    auto Report = [](const char* Name, double Insert, double Hit, double Miss, double Erase) {
+        printf("%-20s %8.2fms %8.2fms %8.2fms %8.2fms\n", Name, Insert, Hit, Miss, Erase);
+        fflush(stdout);
+    };
+
+    {
+        TSet<int32> Set;
+        auto Start = FClock::now();
+        for (int32 Key : Keys) { Set.Add(Key); }
+        const double Insert = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { Checksum += Set.Contains(Key); }
+        const double Hit = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { Checksum += Set.Contains(Key | 1); }
+        const double Miss = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { Checksum += Set.Remove(Key); }
+        Report("TSet", Insert, Hit, Miss, Ms(Start));
+    }
+
+    {
+        TFlatSet<int32> Set;
+        auto Start = FClock::now();
+        for (int32 Key : Keys) { Set.Add(Key); }
+        const double Insert = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { Checksum += Set.Contains(Key); }
+        const double Hit = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { Checksum += Set.Contains(Key | 1); }
+        const double Miss = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { Checksum += Set.Remove(Key); }
+        Report("TFlatSet", Insert, Hit, Miss, Ms(Start));
+    }
+
+    {
+        TMap<int32, int32> Map;
+        auto Start = FClock::now();
+        for (int32 Key : Keys) { Map.Add(Key, Key); }
+        const double Insert = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { const int32* Value = Map.Find(Key); Checksum += Value ? *Value : 0; }
+        const double Hit = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { Checksum += Map.Contains(Key | 1); }
+        const double Miss = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { Checksum += Map.Remove(Key); }
+        Report("TMap", Insert, Hit, Miss, Ms(Start));
+    }
+
+    {
+        TFlatMap<int32, int32> Map;
+        auto Start = FClock::now();
+        for (int32 Key : Keys) { Map.Add(Key, Key); }
+        const double Insert = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { const int32* Value = Map.Find(Key); Checksum += Value ? *Value : 0; }
+        const double Hit = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { Checksum += Map.Contains(Key | 1); }
+        const double Miss = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { Checksum += Map.Remove(Key); }
+        Report("TFlatMap", Insert, Hit, Miss, Ms(Start));
+    }
+
+    {
+        std::unordered_map<int32, int32> Map;
+        auto Start = FClock::now();
+        for (int32 Key : Keys) { Map.emplace(Key, Key); }
+        const double Insert = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { auto It = Map.find(Key); Checksum += It != Map.end() ? It->second : 0; }
+        const double Hit = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { Checksum += Map.count(Key | 1); }
+        const double Miss = Ms(Start);
+        Start = FClock::now();
+        for (int32 Key : Keys) { Checksum += Map.erase(Key); }
+        Report("std::unordered_map", Insert, Hit, Miss, Ms(Start));
+    }
+
+    printf("(checksum %llu)\n", static_cast<unsigned long long>(Checksum));
+    fflush(stdout);
+}
+
+// ============================================================================
+// FName Construction Benchmark
+// ============================================================================
+
+/**
+ * Constructs FNames from ANSI strings on 1-8 threads, the way worker threads
+ * name material parameters and shaders. "Existing" looks up names already in
+ * the pool (half of them numbered "Shader_<n>"), "New" adds unique names.
+ */
+static void BenchmarkNameConstruction(int NamesPerThread)
+{
+    using namespace MonsterEngine;
+    using FClock = std::chrono::high_resolution_clock;
+
+    std::vector<std::string> Existing;
+    for (int i = 0; i < 4096; ++i) {
+        Existing.push_back((i % 2 ? "MaterialParam" : "Shader_") + std::to_string(i));
+        FName Warm(Existing.back().c_str());
+    }
+
+    printf("\n--- FName Construction Benchmark (%d names per thread) ---\n", NamesPerThread);
+    printf("%-8s %16s %16s\n", "Threads", "Existing", "New");
+
+    static int Round = 0;
+    for (int NumThreads = 1; NumThreads <= 8; NumThreads *= 2) {
+        std::atomic<int64> Checksum{0};
+        double Seconds[2] = {};
+        ++Round;
+
+        for (int Mode = 0; Mode < 2; ++Mode) {
+            // Build the new names up front so only FName construction is timed
+            std::vector<std::vector<std::string>> Fresh(NumThreads);
+            if (Mode == 1) {
+                for (int t = 0; t < NumThreads; ++t) {
+                    for (int i = 0; i < NamesPerThread; ++i) {
+                        Fresh[t].push_back("R" + std::to_string(Round) + "T" + std::to_string(t) + "Name" + std::to_string(i) + "x");
+                    }
+                }
+            }
+
+            std::vector<std::thread> Threads;
+            auto Start = FClock::now();
+            for (int t = 0; t < NumThreads; ++t) {
+                Threads.emplace_back([&, t]() {
+                    int64 Local = 0;
+                    for (int i = 0; i < NamesPerThread; ++i) {
+                        const char* Str = Mode == 0 ? Existing[(i * 7 + t * 131) & 4095].c_str() : Fresh[t][i].c_str();
+                        FName Name(Str);
+                        Local += Name.GetNumber() + Name.GetComparisonIndex().ToUnstableInt();
+                    }
+                    Checksum += Local;
+                });
+            }
+            for (std::thread& Thread : Threads) {
+                Thread.join();
+            }
+            Seconds[Mode] = std::chrono::duration<double>(FClock::now() - Start).count();
+        }
+
+        const double Total = static_cast<double>(NamesPerThread) * NumThreads;
+        printf("%-8d %10.2f M/s   %10.2f M/s\n", NumThreads, Total / Seconds[0] / 1e6, Total / Seconds[1] / 1e6);
+        fflush(stdout);
+    }
+    printf("(%d unique names)\n", FName::GetNumNames());
+    fflush(stdout);
+}
+
+// ============================================================================
+// UTF-8 String Benchmark
+// ============================================================================
+
+/**
+ * Compares FUtf8String with FString on the operations asset paths and log
+ * messages go through: construction from UTF-8 text, appending path
+ * components, and hashing for map lookups. Short strings fit FUtf8String's
+ * inline storage; long ones take the heap path on both sides.
+ */
+static void BenchmarkUtf8String(int N)
+{
+    using namespace MonsterEngine;
+    using FClock = std::chrono::high_resolution_clock;
+
+    std::vector<std::string> Short;
+    std::vector<std::string> Long;
+    for (int i = 0; i < 1024; ++i) {
+        Short.push_back("Mesh_" + std::to_string(i));
+        Long.push_back("Content/Environment/Props/Meshes/SM_Rock_" + std::to_string(i) + ".uasset");
+    }
+
+    printf("\n--- UTF-8 String Benchmark (%d operations) ---\n", N);
+    printf("%-22s %14s %14s\n", "Operation", "FString", "FUtf8String");
+
+    uint64 Checksum = 0;
+    auto Report = [](const char* Operation, int Count, double WideSeconds, double Utf8Seconds) {
+        printf("%-22s %10.2f M/s %10.2f M/s\n", Operation, Count / WideSeconds / 1e6, Count / Utf8Seconds / 1e6);
+        fflush(stdout);
+    };
+
+    for (int Pass = 0; Pass < 2; ++Pass) {
+        const std::vector<std::string>& Source = Pass == 0 ? Short : Long;
+        double Seconds[2] = {};
+
+        auto Start = FClock::now();
+        for (int i = 0; i < N; ++i) {
+            FString Str(Source[i & 1023].c_str());
+            Checksum += Str.Len();
+        }
+        Seconds[0] = std::chrono::duration<double>(FClock::now() - Start).count();
+        Start = FClock::now();
+        for (int i = 0; i < N; ++i) {
+            FUtf8String Str(Source[i & 1023].c_str());
+            Checksum += Str.Len();
+        }
+        Seconds[1] = std::chrono::duration<double>(FClock::now() - Start).count();
+        Report(Pass == 0 ? "Construct (short)" : "Construct (long)", N, Seconds[0], Seconds[1]);
+    }
+
+    {
+        // Build a path from components, the way asset paths are assembled
+        const int Rounds = N / 8;
+        double Seconds[2] = {};
+        auto Start = FClock::now();
+        for (int i = 0; i < Rounds; ++i) {
+            FString Path(TEXT("Content"));
+            for (int Part = 0; Part < 8; ++Part) {
+                Path += TEXT("/Folder");
+            }
+            Checksum += Path.Len();
+        }
+        Seconds[0] = std::chrono::duration<double>(FClock::now() - Start).count();
+        Start = FClock::now();
+        for (int i = 0; i < Rounds; ++i) {
+            FUtf8String Path("Content");
+            for (int Part = 0; Part < 8; ++Part) {
+                Path += "/Folder";
+            }
+            Checksum += Path.Len();
+        }
+        Seconds[1] = std::chrono::duration<double>(FClock::now() - Start).count();
+        Report("Append (8 parts)", Rounds * 8, Seconds[0], Seconds[1]);
+    }
+
+    for (int Pass = 0; Pass < 2; ++Pass) {
+        const std::vector<std::string>& Source = Pass == 0 ? Short : Long;
+        std::vector<FString> Wide;
+        std::vector<FUtf8String> Utf8;
+        for (const std::string& Str : Source) {
+            Wide.emplace_back(Str.c_str());
+            Utf8.emplace_back(Str.c_str());
+        }
+
+        double Seconds[2] = {};
+        auto Start = FClock::now();
+        for (int i = 0; i < N; ++i) {
+            Checksum += GetTypeHash(Wide[i & 1023]);
+        }
+        Seconds[0] = std::chrono::duration<double>(FClock::now() - Start).count();
+        Start = FClock::now();
+        for (int i = 0; i < N; ++i) {
+            Checksum += GetTypeHash(Utf8[i & 1023]);
+        }
+        Seconds[1] = std::chrono::duration<double>(FClock::now() - Start).count();
+        Report(Pass == 0 ? "Hash (short)" : "Hash (long)", N, Seconds[0], Seconds[1]);
+    }
+
+    printf("(checksum %llu)\n", static_cast<unsigned long long>(Checksum));
+    fflush(stdout);
+}
+
 // ============================================================================
 // Container Tests Implementation (using printf to avoid logging system issues)
 // ============================================================================
@@ -239,6 +536,391 @@ void RunContainerTests() {
     }
     printf("Test 9 completed.\n"); fflush(stdout);
     
+    // ------------------------------------------------------------------------
+    // TFlatSet / TFlatMap Tests
+    // ------------------------------------------------------------------------
+    printf("\n--- TFlatSet / TFlatMap Tests ---\n"); fflush(stdout);
+    
+    // Test 10: TFlatSet add, find, remove across growth
+    printf("Test 10: TFlatSet Add/Contains/Remove...\n"); fflush(stdout);
+    {
+        TFlatSet<int32> set;
+        bool ok = true;
+        for (int32 i = 0; i < 10000; ++i) {
+            set.Add(i * 7);
+        }
+        bool bAlreadyInSet = false;
+        set.Add(70, &bAlreadyInSet);
+        ok = ok && bAlreadyInSet && set.Num() == 10000;
+        for (int32 i = 0; i < 10000; ++i) {
+            ok = ok && set.Contains(i * 7) && !set.Contains(i * 7 + 1);
+        }
+        // Remove the odd half, then reinsert through the tombstones
+        for (int32 i = 1; i < 10000; i += 2) {
+            ok = ok && set.Remove(i * 7) == 1;
+        }
+        ok = ok && set.Num() == 5000 && set.Remove(7) == 0;
+        for (int32 i = 0; i < 10000; ++i) {
+            ok = ok && set.Contains(i * 7) == (i % 2 == 0);
+        }
+        for (int32 i = 1; i < 10000; i += 2) {
+            set.Add(i * 7);
+        }
+        int32 count = 0;
+        int64 sum = 0;
+        for (int32 value : set) {
+            ++count;
+            sum += value;
+        }
+        ok = ok && count == 10000 && sum == 7ll * 9999 * 10000 / 2;
+        
+        if (ok) {
+            printf("[PASS] TFlatSet: Add/Contains/Remove\n"); fflush(stdout);
+            passedTests++;
+        } else {
+            printf("[FAIL] TFlatSet: Add/Contains/Remove\n"); fflush(stdout);
+            failedTests++;
+        }
+    }
+    
+    // Test 11: TFlatSet removal while iterating, copy and move
+    printf("Test 11: TFlatSet RemoveCurrent/Copy/Move...\n"); fflush(stdout);
+    {
+        TFlatSet<int32> set;
+        for (int32 i = 0; i < 1000; ++i) {
+            set.Add(i);
+        }
+        for (auto it = set.CreateIterator(); it; ++it) {
+            if (*it % 3 != 0) {
+                it.RemoveCurrent();
+            }
+        }
+        TFlatSet<int32> copy = set;
+        TFlatSet<int32> moved = std::move(copy);
+        bool ok = set.Num() == 334 && moved.Num() == 334 && copy.Num() == 0 && moved == set;
+        for (int32 i = 0; i < 1000; ++i) {
+            ok = ok && moved.Contains(i) == (i % 3 == 0);
+        }
+        set.Empty();
+        ok = ok && set.IsEmpty() && !set.Contains(0);
+        
+        if (ok) {
+            printf("[PASS] TFlatSet: RemoveCurrent/Copy/Move\n"); fflush(stdout);
+            passedTests++;
+        } else {
+            printf("[FAIL] TFlatSet: RemoveCurrent/Copy/Move\n"); fflush(stdout);
+            failedTests++;
+        }
+    }
+    
+    // Test 12: TFlatMap with non-trivial keys and values
+    printf("Test 12: TFlatMap Add/Find/FindOrAdd/Remove...\n"); fflush(stdout);
+    {
+        TFlatMap<FString, TArray<int32>> map;
+        for (int32 i = 0; i < 500; ++i) {
+            TArray<int32> values;
+            values.Add(i);
+            FString key(TEXT("Key"));
+            key += FString::FromInt(i);
+            map.Add(std::move(key), std::move(values));
+        }
+        map.FindOrAdd(FString(TEXT("Key7"))).Add(77);
+        map.Add(FString(TEXT("Key8")), TArray<int32>());
+        map[FString(TEXT("Extra"))].Add(1);
+        
+        const TArray<int32>* key7 = map.Find(FString(TEXT("Key7")));
+        const TArray<int32>* key8 = map.Find(FString(TEXT("Key8")));
+        bool ok = map.Num() == 501 && key7 && key7->Num() == 2 && (*key7)[1] == 77 && key8 && key8->Num() == 0;
+        ok = ok && map.Remove(FString(TEXT("Key9"))) == 1 && !map.Contains(FString(TEXT("Key9")));
+        ok = ok && map.Contains(FString(TEXT("Key499"))) && map.Num() == 500;
+        
+        if (ok) {
+            printf("[PASS] TFlatMap: Add/Find/FindOrAdd/Remove\n"); fflush(stdout);
+            passedTests++;
+        } else {
+            printf("[FAIL] TFlatMap: Add/Find/FindOrAdd/Remove\n"); fflush(stdout);
+            failedTests++;
+        }
+    }
+    printf("Test 12 completed.\n"); fflush(stdout);
+    
+    // ------------------------------------------------------------------------
+    // FName Tests
+    // ------------------------------------------------------------------------
+    printf("\n--- FName Tests ---\n"); fflush(stdout);
+    
+    // Test 13: ANSI and wide construction, case-insensitivity, number suffixes
+    printf("Test 13: FName construction and number suffixes...\n"); fflush(stdout);
+    {
+        FName ansi("MaterialColor");
+        FName wide(TEXT("materialcolor"));
+        FName numbered("Actor_12");
+        FName numbered2(TEXT("actor_3"));
+        FName leadingZero("Actor_012");
+        FName plain("Actor");
+        
+        bool ok = ansi == wide && ansi.ToString() == FString(TEXT("MaterialColor"));
+        ok = ok && numbered.GetComparisonIndex() == plain.GetComparisonIndex() && numbered.GetNumber() == 13;
+        ok = ok && numbered2.GetComparisonIndex() == plain.GetComparisonIndex() && numbered2.GetNumber() == 4;
+        ok = ok && numbered.ToString() == FString(TEXT("Actor_12"));
+        ok = ok && leadingZero.GetNumber() == 0 && leadingZero.ToString() == FString(TEXT("Actor_012"));
+        ok = ok && FName("_5").GetNumber() == 0 && FName("Big_99999999999").GetNumber() == 0;
+        ok = ok && FName("None").IsNone() && FName("").IsNone() && FName().IsNone();
+        
+        // A name that needs wide storage round-trips
+        const wchar_t wideText[] = { L'N', L'a', L'm', L'e', 0x4E2D, 0 };
+        FName wideOnly(wideText);
+        ok = ok && wideOnly.GetEntry()->IsWide() && !ansi.GetEntry()->IsWide();
+        ok = ok && wideOnly.ToString() == FString(wideText);
+        
+        // Numbered names do not add entries
+        const int32 before = FName::GetNumNames();
+        for (int32 i = 0; i < 100; ++i) {
+            std::string str = "Actor_" + std::to_string(i);
+            ok = ok && FName(str).GetComparisonIndex() == plain.GetComparisonIndex();
+        }
+        ok = ok && FName::GetNumNames() == before;
+        
+        if (ok) {
+            printf("[PASS] FName: construction and number suffixes\n"); fflush(stdout);
+            passedTests++;
+        } else {
+            printf("[FAIL] FName: construction and number suffixes\n"); fflush(stdout);
+            failedTests++;
+        }
+    }
+    
+    // Test 14: Concurrent construction of the same names agrees on one entry each
+    printf("Test 14: FName concurrent construction...\n"); fflush(stdout);
+    {
+        constexpr int numThreads = 8;
+        constexpr int numNames = 5000;
+        std::vector<std::vector<uint32>> ids(numThreads, std::vector<uint32>(numNames));
+        std::vector<std::thread> threads;
+        for (int t = 0; t < numThreads; ++t) {
+            threads.emplace_back([&ids, t]() {
+                for (int i = 0; i < numNames; ++i) {
+                    const int index = (i + t * 977) % numNames;
+                    std::string str = "ConcurrentName" + std::to_string(index);
+                    ids[t][index] = FName(str.c_str()).GetComparisonIndex().ToUnstableInt();
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        
+        bool ok = true;
+        for (int i = 0; i < numNames; ++i) {
+            for (int t = 1; t < numThreads; ++t) {
+                ok = ok && ids[t][i] == ids[0][i];
+            }
+            std::string str = "CONCURRENTNAME" + std::to_string(i);
+            ok = ok && FName(str).GetComparisonIndex().ToUnstableInt() == ids[0][i];
+        }
+        
+        if (ok) {
+            printf("[PASS] FName: concurrent construction\n"); fflush(stdout);
+            passedTests++;
+        } else {
+            printf("[FAIL] FName: concurrent construction\n"); fflush(stdout);
+            failedTests++;
+        }
+    }
+    printf("Test 14 completed.\n"); fflush(stdout);
+    
+    // Test 15: FUtf8String inline storage, append and views
+    printf("Test 15: FUtf8String basics...\n"); fflush(stdout);
+    {
+        bool ok = true;
+        FUtf8String empty;
+        ok = ok && empty.IsEmpty() && *empty != nullptr && (*empty)[0] == '\0';
+        
+        // Up to InlineCapacity code units stay inline
+        FUtf8String inlineStr("Textures/Rock.dds");
+        ok = ok && inlineStr.Len() == 17 && inlineStr.GetAllocatedSize() == 0;
+        FUtf8String full(std::string(FUtf8String::InlineCapacity, 'a'));
+        ok = ok && full.GetAllocatedSize() == 0;
+        full += 'b';
+        ok = ok && full.GetAllocatedSize() > 0 && full.Len() == FUtf8String::InlineCapacity + 1 && full.EndsWith("ab");
+        
+        // Append grows through the heap and stays null-terminated
+        FUtf8String path("Content");
+        for (int32 i = 0; i < 20; ++i) {
+            path += "/Folder";
+        }
+        ok = ok && path.Len() == 7 + 20 * 7 && std::strlen(*path) == static_cast<size_t>(path.Len());
+        ok = ok && path.StartsWith("Content/Folder") && path.Find("/Folder", 8) == 14;
+        
+        // Appending a view of itself
+        FUtf8String twice("abc");
+        twice += twice;
+        twice.Append(twice.ToView().Left(3));
+        ok = ok && twice == "abcabcabc";
+        
+        // Copy and move keep the contents; a moved-from string is empty
+        FUtf8String copy(path);
+        FUtf8String moved(std::move(copy));
+        ok = ok && moved == path && copy.IsEmpty();
+        FUtf8String shortCopy(inlineStr);
+        FUtf8String shortMoved(std::move(shortCopy));
+        ok = ok && shortMoved == inlineStr && shortCopy.IsEmpty();
+        moved = inlineStr;
+        ok = ok && moved == inlineStr;
+        moved.Shrink();
+        ok = ok && moved.GetAllocatedSize() == 0 && moved == "Textures/Rock.dds";
+        
+        // Views slice without copying
+        FUtf8StringView view = inlineStr;
+        ok = ok && view.GetData() == *inlineStr && view.Mid(9, 4) == "Rock" && view.RightChop(14) == "dds";
+        ok = ok && view.FindChar('/') == 8 && view.Right(100).Len() == 17 && view.Mid(40).IsEmpty();
+        ok = ok && FUtf8StringView("ROCK").EqualsIgnoreCase(view.Mid(9, 4));
+        ok = ok && inlineStr.Mid(9, 4) + ".png" == "Rock.png";
+        
+        // Hashes match the null-terminated string hash, and TMap keys work
+        ok = ok && GetTypeHash(inlineStr) == GetTypeHash("Textures/Rock.dds");
+        ok = ok && GetTypeHash(view.Left(8)) == GetTypeHash("Textures");
+        TMap<FUtf8String, int32> map;
+        map.Add(FUtf8String("Key"), 1);
+        map.Add(path, 2);
+        const int32* found = map.Find(FUtf8String("Key"));
+        ok = ok && found && *found == 1 && map.Num() == 2;
+        
+        // std::string paths (FAsyncFileIO::FReadRequest::FilePath) and log text take it without re-encoding
+        std::string filePath;
+        filePath = inlineStr;
+        ok = ok && filePath == "Textures/Rock.dds";
+        ok = ok && std::strcmp(::MonsterRender::Private::ToLogString(inlineStr), "Textures/Rock.dds") == 0;
+        
+        if (ok) {
+            printf("[PASS] FUtf8String: inline storage, append and views\n"); fflush(stdout);
+            passedTests++;
+        } else {
+            printf("[FAIL] FUtf8String: inline storage, append and views\n"); fflush(stdout);
+            failedTests++;
+        }
+    }
+    
+    // Test 16: UTF-8 <-> FString conversion
+    printf("Test 16: FUtf8String conversion...\n"); fflush(stdout);
+    {
+        bool ok = true;
+        
+        // U+00E9, U+4E2D and U+1F600 take 2, 3 and 4 bytes
+        const wchar_t wideText[] = { L'a', 0xE9, 0x4E2D, 0 };
+        FUtf8String utf8(wideText);
+        ok = ok && utf8 == "a\xC3\xA9\xE4\xB8\xAD" && utf8.ToString() == FString(wideText);
+        FUtf8String emoji;
+        emoji.AppendCodePoint(0x1F600);
+        ok = ok && emoji == "\xF0\x9F\x98\x80" && FUtf8String(emoji.ToString()) == emoji;
+        ok = ok && FUtf8String(FString(TEXT("Hello"))) == "Hello";
+        
+        // Invalid input decodes to U+FFFD instead of being dropped
+        const FString truncated = FUtf8String("x\xE4\xB8").ToString();
+        ok = ok && truncated.Len() == 3 && truncated[0] == L'x' && truncated[1] == 0xFFFD && truncated[2] == 0xFFFD;
+        const FString overlong = FUtf8String("\xC0\xAF").ToString();
+        ok = ok && overlong.Len() == 2 && overlong[0] == 0xFFFD;
+        const FString surrogate = FUtf8String("\xED\xA0\x80").ToString();
+        ok = ok && surrogate.Len() == 3 && surrogate[0] == 0xFFFD;
+        
+        if (ok) {
+            printf("[PASS] FUtf8String: conversion\n"); fflush(stdout);
+            passedTests++;
+        } else {
+            printf("[FAIL] FUtf8String: conversion\n"); fflush(stdout);
+            failedTests++;
+        }
+    }
+    printf("Test 16 completed.\n"); fflush(stdout);
+    
+    // Test 17: TBitArray word-level operations against a std::vector<bool> reference
+    printf("Test 17: TBitArray bulk operations...\n"); fflush(stdout);
+    {
+        bool ok = true;
+        uint32 seed = 12345;
+        auto nextRandom = [&seed]() { seed = seed * 1664525u + 1013904223u; return seed >> 8; };
+        
+        auto matches = [](const TBitArray<>& bits, const std::vector<bool>& ref)
+        {
+            if (bits.Num() != static_cast<int32>(ref.size())) return false;
+            int32 count = 0;
+            for (int32 i = 0; i < bits.Num(); ++i)
+            {
+                if (bits[i] != ref[i]) return false;
+                count += ref[i] ? 1 : 0;
+            }
+            return bits.CountSetBits() == count;
+        };
+        
+        const int32 sizes[] = { 0, 1, 31, 32, 33, 100, 257 };
+        for (int32 numA : sizes)
+        {
+            for (int32 numB : sizes)
+            {
+                TBitArray<> a, b;
+                std::vector<bool> refA, refB;
+                for (int32 i = 0; i < numA; ++i) { bool v = (nextRandom() & 1) != 0; a.Add(v); refA.push_back(v); }
+                for (int32 i = 0; i < numB; ++i) { bool v = (nextRandom() % 3) != 0; b.Add(v); refB.push_back(v); }
+                auto refBit = [&refB](int32 i) { return i < static_cast<int32>(refB.size()) && refB[i]; };
+                
+                TBitArray<> andBits = a, orBits = a, andNotBits = a;
+                std::vector<bool> refAnd = refA, refOr = refA, refAndNot = refA;
+                andBits.CombineWithBitwiseAND(b);
+                orBits.CombineWithBitwiseOR(b);
+                andNotBits.CombineWithBitwiseANDNOT(b);
+                for (int32 i = 0; i < numA; ++i)
+                {
+                    refAnd[i] = refA[i] && refBit(i);
+                    refOr[i] = refA[i] || refBit(i);
+                    refAndNot[i] = refA[i] && !refBit(i);
+                }
+                ok = ok && matches(andBits, refAnd) && matches(orBits, refOr) && matches(andNotBits, refAndNot);
+                
+                // The iterator visits exactly the set bits, in order, from any start index
+                const int32 start = numA > 0 ? static_cast<int32>(nextRandom() % numA) : 0;
+                int32 expected = start;
+                for (TConstSetBitIterator<> It(orBits, start); It; ++It)
+                {
+                    while (expected < numA && !refOr[expected]) ++expected;
+                    ok = ok && It.GetIndex() == expected;
+                    ++expected;
+                }
+                while (expected < numA && !refOr[expected]) ++expected;
+                ok = ok && expected >= numA;
+            }
+        }
+        
+        // Stale bits past Num() are never counted, found or iterated
+        TBitArray<> shrunk(true, 40);
+        shrunk.RemoveAt(35, 5);
+        shrunk.SetRange(0, 35, false);
+        ok = ok && shrunk.CountSetBits() == 0 && shrunk.FindFirstSetBit() == INDEX_NONE;
+        ok = ok && !TConstSetBitIterator<>(shrunk);
+        shrunk.CombineWithBitwiseOR(TBitArray<>(true, 64));
+        ok = ok && shrunk.CountSetBits() == 35 && shrunk.FindFirstZeroBit() == INDEX_NONE;
+        
+        // SetRange across word boundaries
+        TBitArray<> range(false, 100);
+        range.SetRange(30, 40, true);
+        ok = ok && range.CountSetBits() == 40 && range.FindFirstSetBit() == 30 && !range[29] && range[69] && !range[70];
+        range.SetRange(31, 38, false);
+        ok = ok && range.CountSetBits() == 2 && range[30] && range[69];
+        ok = ok && range.FindFirstZeroBit() == 0;
+        
+        if (ok) {
+            printf("[PASS] TBitArray: bulk operations\n"); fflush(stdout);
+            passedTests++;
+        } else {
+            printf("[FAIL] TBitArray: bulk operations\n"); fflush(stdout);
+            failedTests++;
+        }
+    }
+    printf("Test 17 completed.\n"); fflush(stdout);
+    
+    BenchmarkHashContainers(1 << 20);
+    BenchmarkNameConstruction(1 << 18);
+    BenchmarkUtf8String(1 << 20);
+    
     // ------------------------------------------------------------------------
     // Summary
     // ------------------------------------------------------------------------
@@ -6,12 +6,29 @@
 #include "Core/HAL/FMalloc.h"
 #include "Core/HAL/FMallocBinned2.h"
 #include "Core/HAL/FMemoryManager.h"
+#include "Core/HAL/LowLevelMemTracker.h"
+#include "Core/HAL/MemStack.h"
+#include "Core/HAL/TLSFAllocator.h"
+#include "RHI/RHISubAllocator.h"
+#include "RHI/RHIDefragPlanner.h"
 #include "Core/Log.h"
 #include "Core/Assert.h"
 #include "Containers/Array.h"
+#include "Containers/Set.h"
+#include "Containers/Map.h"
 #include <thread>
 #include <chrono>
 #include <random>
+#include <atomic>
+#include <cstdlib>
+#include <cstdio>
+#include <optional>
+#include <vector>
+#include <cstring>
+
+#if PLATFORM_LINUX
+    #include <unistd.h>
+#endif
 
 namespace MonsterRender {
 namespace FMemorySystemTest {
@@ -195,6 +212,19 @@ void TestFMemoryAllocation() {
         }
 
         FMemory::Free(ptr2);
+
+        // Large and staging blocks honor over-alignment on every platform (texture pool bases rely on it)
+        void* largeAligned = FMemory::Malloc(256 * 1024, 4096);
+        void* stagingAligned = FMemory::MallocStaging(4 * 1024 * 1024, 64 * 1024);
+        const bool bAligned = (reinterpret_cast<uintptr_t>(largeAligned) & 4095) == 0 &&
+                              (reinterpret_cast<uintptr_t>(stagingAligned) & 65535) == 0;
+        FMemory::Free(largeAligned);
+        FMemory::Free(stagingAligned);
+        if (!bAligned) {
+            timer.Failure("Large allocation alignment not honored");
+            return;
+        }
+
         timer.Success();
     }
     catch (const std::exception& e) {
@@ -231,60 +261,534 @@ void TestFMallocBinned2Small() {
     }
 }
 
-void TestMultithreaded() {
-    ScopedTestTimer timer("Multi-threaded Allocations");
+void TestFMallocBinned2SizeClasses() {
+    ScopedTestTimer timer("FMallocBinned2::Size Classes and Waste");
 
     try {
-        const int numThreads = 4;
-        const int allocationsPerThread = 500;
-        std::atomic<bool> failed{false};
-        String errorMsg;
+        TUniquePtr<FMallocBinned2> allocator = MakeUnique<FMallocBinned2>();
 
-        auto workerFunc = [&](int threadId) {
-            try {
-                FMalloc* allocator = FMemoryManager::Get().GetAllocator();
-                TArray<void*> localAllocations;
+        // Every size up to 32KB is binned, rounded to 16 bytes or by at most 25%
+        for (SIZE_T size = 1; size <= 32 * 1024; size += (size < 1024 ? 1 : 61)) {
+            void* ptr = allocator->Malloc(size);
+            const SIZE_T blockSize = allocator->GetAllocationSize(ptr);
+            if (blockSize < size || (blockSize - size >= 16 && blockSize * 4 > size * 5)) {
+                timer.Failure("Size " + std::to_string(size) + " rounded to " + std::to_string(blockSize));
+                return;
+            }
+            if ((reinterpret_cast<uintptr_t>(ptr) & 15) != 0) {
+                timer.Failure("Block of size " + std::to_string(size) + " not 16-byte aligned");
+                return;
+            }
+            allocator->Free(ptr);
+        }
 
-                for (int i = 0; i < allocationsPerThread; ++i) {
-                    SIZE_T size = 16 + (threadId * 16) + (i % 512);
-                    void* ptr = allocator->Malloc(size);
-                    
-                    if (!ptr) {
-                        failed = true;
-                        errorMsg = "Thread " + std::to_string(threadId) + " failed";
-                        return;
-                    }
+        // Over-aligned requests are served from a bin with enough alignment
+        const uint32 alignments[] = {32, 64, 256, 4096};
+        for (uint32 alignment : alignments) {
+            void* ptr = allocator->Malloc(100, alignment);
+            if ((reinterpret_cast<uintptr_t>(ptr) & (alignment - 1)) != 0) {
+                timer.Failure("Alignment " + std::to_string(alignment) + " not honored");
+                return;
+            }
+            allocator->Free(ptr);
+        }
 
-                    FMemory::Memset(ptr, static_cast<uint8>(threadId + 1), size);
-                    localAllocations.Add(ptr);
+        // Mid-size requests that used to fall through to the OS allocator;
+        // fresh instance so the waste estimate only sees these requests
+        allocator = MakeUnique<FMallocBinned2>();
+        TArray<void*> blocks;
+        for (int32 i = 0; i < 64; ++i) {
+            blocks.Add(allocator->Malloc(600));
+            blocks.Add(allocator->Malloc(20000));
+        }
+        if (allocator->GetAllocationSize(blocks[0]) != 640 || allocator->GetAllocationSize(blocks[1]) != 20480) {
+            timer.Failure("Unexpected size classes: 600 -> " + std::to_string(allocator->GetAllocationSize(blocks[0])) +
+                          ", 20000 -> " + std::to_string(allocator->GetAllocationSize(blocks[1])));
+            return;
+        }
 
-                    if (i % 10 == 0 && !localAllocations.IsEmpty()) {
-                        allocator->Free(localAllocations.Last());
-                        localAllocations.Pop();
-                    }
+        FMalloc::FMemoryStats stats;
+        allocator->GetMemoryStats(stats);
+        const uint64 expectedAllocated = 64ull * (640 + 20480);
+        const uint64 expectedInternal = 64ull * (40 + 480);
+        if (stats.TotalAllocated != expectedAllocated || stats.InternalWaste != expectedInternal ||
+            stats.TotalAllocated + stats.ExternalWaste != stats.TotalReserved) {
+            timer.Failure("Waste stats mismatch: allocated " + std::to_string(stats.TotalAllocated) +
+                          ", internal " + std::to_string(stats.InternalWaste) +
+                          ", external " + std::to_string(stats.ExternalWaste) +
+                          ", reserved " + std::to_string(stats.TotalReserved));
+            return;
+        }
+
+        allocator->LogWasteReport();
+
+        for (void* ptr : blocks) {
+            allocator->Free(ptr);
+        }
+
+        if (!allocator->ValidateHeap()) {
+            timer.Failure("Heap validation failed");
+            return;
+        }
+
+        timer.Success();
+    }
+    catch (const std::exception& e) {
+        timer.Failure(String("Exception: ") + e.what());
+    }
+}
+
+#if PLATFORM_LINUX
+// Resident set size of the process, from /proc/self/statm
+uint64 GetResidentBytes() {
+    FILE* file = fopen("/proc/self/statm", "r");
+    if (!file) {
+        return 0;
+    }
+    unsigned long long totalPages = 0;
+    unsigned long long residentPages = 0;
+    const int numRead = fscanf(file, "%llu %llu", &totalPages, &residentPages);
+    fclose(file);
+    return numRead == 2 ? residentPages * static_cast<uint64>(sysconf(_SC_PAGESIZE)) : 0;
+}
+#endif
+
+void TestLargeBlockCache() {
+    ScopedTestTimer timer("FMallocBinned2::Large Block Cache");
+
+    try {
+#if PLATFORM_LINUX
+        TUniquePtr<FMallocBinned2> allocator = MakeUnique<FMallocBinned2>();
+
+        // A freed block is handed out again for the same size bucket
+        void* first = allocator->Malloc(300000);
+        FMemory::Memset(first, 0xAB, 300000);
+        if (allocator->GetAllocationSize(first) < 300000) {
+            timer.Failure("Large block smaller than requested");
+            return;
+        }
+        allocator->Free(first);
+        void* second = allocator->Malloc(290000);
+        FMalloc::FMemoryStats stats;
+        allocator->GetMemoryStats(stats);
+        if (second != first || stats.LargeCacheHits != 1 || stats.LargeCacheMisses != 1) {
+            timer.Failure("Expected a cache hit, got " + std::to_string(stats.LargeCacheHits) + " hits and " +
+                          std::to_string(stats.LargeCacheMisses) + " misses");
+            return;
+        }
+
+        // Growing within the mapping keeps the block
+        if (allocator->Realloc(second, 300000) != second) {
+            timer.Failure("Realloc within the mapping moved the block");
+            return;
+        }
+        allocator->Free(second);
+
+        // Over-aligned large and small requests
+        void* aligned = allocator->Malloc(100000, 65536);
+        void* alignedSmall = allocator->Malloc(64, 8192);
+        if ((reinterpret_cast<uintptr_t>(aligned) & 65535) != 0 || (reinterpret_cast<uintptr_t>(alignedSmall) & 8191) != 0) {
+            timer.Failure("Large block alignment not honored");
+            return;
+        }
+        allocator->Free(aligned);
+        allocator->Free(alignedSmall);
+
+        // Staging buffers are 2MB-aligned and opt in to huge pages when the kernel allows it
+        void* staging = allocator->MallocStaging(8 * 1024 * 1024);
+        FMemory::Memset(staging, 0, 8 * 1024 * 1024);
+        allocator->GetMemoryStats(stats);
+        MR_LOG_INFO("  Staging buffer huge-page bytes: " + std::to_string(stats.HugePageBytes / 1024) + " KB");
+        allocator->Free(staging);
+
+        // Cached blocks beyond the resident budget give their pages back
+        const SIZE_T blockSize = 4 * 1024 * 1024;
+        TArray<void*> blocks;
+        for (int32 i = 0; i < 24; ++i) {
+            void* ptr = allocator->Malloc(blockSize);
+            FMemory::Memset(ptr, static_cast<uint8>(i), blockSize);
+            blocks.Add(ptr);
+        }
+        const uint64 residentBefore = GetResidentBytes();
+        for (void* ptr : blocks) {
+            allocator->Free(ptr);
+        }
+        const uint64 residentAfter = GetResidentBytes();
+
+        allocator->GetMemoryStats(stats);
+        if (stats.LargeCachedBytes == 0 || stats.LargeCacheRssSaved == 0 ||
+            stats.TotalAllocated != 0 || stats.AllocationCount != stats.FreeCount) {
+            timer.Failure("Unexpected cache stats: cached " + std::to_string(stats.LargeCachedBytes) +
+                          ", released " + std::to_string(stats.LargeCacheRssSaved) +
+                          ", live " + std::to_string(stats.TotalAllocated));
+            return;
+        }
+        MR_LOG_INFO("  Cached " + std::to_string(stats.LargeCachedBytes / 1024 / 1024) + " MB, released " +
+                    std::to_string(stats.LargeCacheRssSaved / 1024 / 1024) + " MB, RSS " +
+                    std::to_string(residentBefore / 1024 / 1024) + " -> " + std::to_string(residentAfter / 1024 / 1024) + " MB");
+
+        allocator->Trim();
+        allocator->GetMemoryStats(stats);
+        if (stats.LargeCachedBytes != 0 || stats.TotalReserved != 0) {
+            timer.Failure("Trim left " + std::to_string(stats.TotalReserved) + " bytes reserved");
+            return;
+        }
+#endif
+
+        timer.Success();
+    }
+    catch (const std::exception& e) {
+        timer.Failure(String("Exception: ") + e.what());
+    }
+}
+
+void TestLowLevelMemTracker() {
+    ScopedTestTimer timer("FLowLevelMemTracker::Tagged Allocations");
+
+    try {
+#if MR_LLM_ENABLED
+        using FTagStats = FLowLevelMemTracker::FTagStats;
+        TUniquePtr<FMallocBinned2> allocator = MakeUnique<FMallocBinned2>();
+        FLowLevelMemTracker::SetEnabled(true);
+
+        // Allocations are charged to the innermost scope, by requested size
+        TArray<void*> meshBlocks;
+        meshBlocks.Reserve(64);
+        void* textureBlock = nullptr;
+        {
+            LLM_SCOPE(ELLMTag::Meshes);
+            for (int32 i = 0; i < 64; ++i) {
+                meshBlocks.Add(allocator->Malloc(1000));
+            }
+            {
+                LLM_SCOPE(ELLMTag::Textures);
+                textureBlock = allocator->Malloc(300000);
+            }
+        }
+
+        FTagStats meshStats = FLowLevelMemTracker::GetTagStats(ELLMTracker::Default, ELLMTag::Meshes);
+        FTagStats textureStats = FLowLevelMemTracker::GetTagStats(ELLMTracker::Default, ELLMTag::Textures);
+        const int64 meshBytes = 64 * 1000;
+        if (meshStats.CurrentBytes != meshBytes || meshStats.AllocationCount != 64 ||
+            textureStats.CurrentBytes != 300000 || textureStats.AllocationCount != 1) {
+            timer.Failure("Unexpected tag totals: meshes " + std::to_string(meshStats.CurrentBytes) +
+                          ", textures " + std::to_string(textureStats.CurrentBytes));
+            return;
+        }
+        if (FLowLevelMemTracker::GetActiveTag() != ELLMTag::Untagged) {
+            timer.Failure("Tag stack not restored after scopes");
+            return;
+        }
+
+        // Frees on another thread go back to the allocating tag; the peak stays
+        std::thread freeThread([&]() {
+            for (void* ptr : meshBlocks) {
+                allocator->Free(ptr);
+            }
+        });
+        freeThread.join();
+        allocator->Free(textureBlock);
+
+        meshStats = FLowLevelMemTracker::GetTagStats(ELLMTracker::Default, ELLMTag::Meshes);
+        textureStats = FLowLevelMemTracker::GetTagStats(ELLMTracker::Default, ELLMTag::Textures);
+        if (meshStats.CurrentBytes != 0 || meshStats.PeakBytes != meshBytes || textureStats.CurrentBytes != 0) {
+            timer.Failure("Cross-thread frees not credited: meshes " + std::to_string(meshStats.CurrentBytes) +
+                          ", textures " + std::to_string(textureStats.CurrentBytes));
+            return;
+        }
+
+        // GPU memory is reported by amount with the tag kept by the allocator
+        FLowLevelMemTracker::OnAllocTagged(ELLMTracker::GPU, ELLMTag::Textures, 4 * 1024 * 1024);
+        FTagStats gpuStats = FLowLevelMemTracker::GetTagStats(ELLMTracker::GPU, ELLMTag::Textures);
+        if (gpuStats.CurrentBytes != 4 * 1024 * 1024 ||
+            FLowLevelMemTracker::GetTagStats(ELLMTracker::Default, ELLMTag::Textures).CurrentBytes != 0) {
+            timer.Failure("GPU amount not charged to the GPU tracker");
+            return;
+        }
+
+        // CSV capture writes a header and one row per interval
+        const String csvPath = "LLMCaptureTest.csv";
+        if (!FLowLevelMemTracker::StartCsvCapture(csvPath, 0.05f)) {
+            timer.Failure("Failed to start CSV capture");
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        FLowLevelMemTracker::StopCsvCapture();
+        FLowLevelMemTracker::LogReport();
+        FLowLevelMemTracker::OnFreeTagged(ELLMTracker::GPU, ELLMTag::Textures, 4 * 1024 * 1024);
+
+        FILE* file = nullptr;
+#if defined(_MSC_VER)
+        if (fopen_s(&file, csvPath.c_str(), "r") != 0) {
+            file = nullptr;
+        }
+#else
+        file = fopen(csvPath.c_str(), "r");
+#endif
+        if (!file) {
+            timer.Failure("CSV capture file missing");
+            return;
+        }
+        char line[4096];
+        int32 numRows = 0;
+        bool bHeaderValid = false;
+        bool bGpuColumnSeen = false;
+        while (fgets(line, sizeof(line), file)) {
+            if (numRows == 0) {
+                const String header(line);
+                bHeaderValid = header.rfind("Seconds,", 0) == 0 && header.find("GPU/Textures") != String::npos;
+            } else if (String(line).find(",4194304") != String::npos) {
+                bGpuColumnSeen = true;
+            }
+            ++numRows;
+        }
+        fclose(file);
+        std::remove(csvPath.c_str());
+        if (!bHeaderValid || numRows < 3 || !bGpuColumnSeen) {
+            timer.Failure("Unexpected CSV capture: " + std::to_string(numRows) + " lines");
+            return;
+        }
+
+        FLowLevelMemTracker::SetEnabled(false);
+#endif
+
+        timer.Success();
+    }
+    catch (const std::exception& e) {
+        FLowLevelMemTracker::SetEnabled(false);
+        timer.Failure(String("Exception: ") + e.what());
+    }
+}
+
+void TestMemStack() {
+    ScopedTestTimer timer("FMemStack::Marks, Frames and Containers");
+
+    try {
+        using MonsterEngine::TMemStackAllocator;
+        using MonsterEngine::TSet;
+        using MonsterEngine::DefaultKeyFuncs;
+
+        FMemStack& stack = FMemStack::Get();
+
+        // Marks free everything allocated after them, nested or not
+        {
+            FMemMark mark(stack);
+            const SIZE_T baseBytes = stack.GetByteCount();
+
+            const SIZE_T alignments[] = {1, 16, 64, 4096};
+            for (SIZE_T alignment : alignments) {
+                void* ptr = stack.Alloc(100, alignment);
+                if (!ptr || (reinterpret_cast<uintptr_t>(ptr) & (alignment - 1)) != 0) {
+                    timer.Failure("Misaligned allocation for alignment " + std::to_string(alignment));
+                    return;
                 }
+                FMemory::Memset(ptr, 0xAB, 100);
+            }
 
-                for (void* ptr : localAllocations) {
-                    allocator->Free(ptr);
+            const SIZE_T outerBytes = stack.GetByteCount();
+            {
+                FMemMark innerMark(stack);
+                // Larger than a chunk: gets a chunk of its own
+                auto* big = static_cast<uint8*>(stack.Alloc(3 * FMemStack::CHUNK_SIZE));
+                FMemory::Memset(big, 0xCD, 3 * FMemStack::CHUNK_SIZE);
+                if (stack.GetByteCount() < outerBytes + 3 * FMemStack::CHUNK_SIZE) {
+                    timer.Failure("Oversized allocation not counted");
+                    return;
                 }
             }
-            catch (const std::exception& e) {
-                failed = true;
-                errorMsg = "Thread exception: " + String(e.what());
+            if (stack.GetByteCount() != outerBytes || outerBytes <= baseBytes) {
+                timer.Failure("Inner mark did not restore the stack");
+                return;
+            }
+        }
+        if (stack.GetNumMarks() != 0) {
+            timer.Failure("Marks left active");
+            return;
+        }
+
+        // Memory allocated outside a mark lives until the frame ends, then is reused
+        FMemStack::EndFrame();
+        auto* frameData = static_cast<uint32*>(stack.Alloc(256));
+        frameData[0] = 0xDEADBEEF;
+        {
+            FMemMark mark(stack);
+            FMemory::Memset(stack.Alloc(1024), 0, 1024);
+        }
+        if (frameData[0] != 0xDEADBEEF) {
+            timer.Failure("Mark freed memory allocated before it");
+            return;
+        }
+        const uint64 chunksBefore = FMemStack::GetStats().ChunkAllocations;
+        FMemStack::EndFrame();
+        void* nextFrameData = stack.Alloc(256);
+        if (nextFrameData != frameData || FMemStack::GetStats().ChunkAllocations != chunksBefore) {
+            timer.Failure("Stack did not rewind at the end of the frame");
+            return;
+        }
+
+        // Each thread has a stack of its own
+        std::atomic<bool> threadFailed{false};
+        auto threadFunc = [&](uint8 pattern) {
+            FMemStack& threadStack = FMemStack::Get();
+            if (&threadStack == &stack) {
+                threadFailed = true;
+                return;
+            }
+            FMemMark mark(threadStack);
+            TArray<uint8*> blocks;
+            for (int32 i = 0; i < 200; ++i) {
+                auto* block = static_cast<uint8*>(threadStack.Alloc(512));
+                FMemory::Memset(block, pattern, 512);
+                blocks.Add(block);
+            }
+            for (uint8* block : blocks) {
+                if (block[0] != pattern || block[511] != pattern) {
+                    threadFailed = true;
+                }
             }
         };
+        std::thread threadA(threadFunc, uint8(0x11));
+        std::thread threadB(threadFunc, uint8(0x22));
+        threadA.join();
+        threadB.join();
+        if (threadFailed) {
+            timer.Failure("Thread stacks overlap");
+            return;
+        }
 
-        TArray<std::thread> threads;
-        for (int i = 0; i < numThreads; ++i) {
-            threads.Add(std::thread(workerFunc, i));
+        // Containers on the stack
+        {
+            FMemMark mark(stack);
+
+            TArray<int32, TMemStackAllocator<>> values;
+            values.Reserve(16);
+            const int32* initialData = values.GetData();
+            for (int32 i = 0; i < 1000; ++i) {
+                values.Add(i);
+            }
+            // Latest allocation on the stack: grows in place
+            if (values.GetData() != initialData) {
+                timer.Failure("Array did not grow in place");
+                return;
+            }
+
+            TArray<int32, TMemStackAllocator<>> moved = std::move(values);
+            for (int32 i = 0; i < 1000; ++i) {
+                if (moved[i] != i) {
+                    timer.Failure("Array contents lost");
+                    return;
+                }
+            }
+
+            TSet<int32, DefaultKeyFuncs<int32>, TMemStackAllocator<>> set;
+            for (int32 i = 0; i < 2000; ++i) {
+                set.Add(i * 7);
+            }
+            for (int32 i = 0; i < 2000; i += 2) {
+                set.Remove(i * 7);
+            }
+            if (set.Num() != 1000 || !set.Contains(7) || set.Contains(14)) {
+                timer.Failure("Set contents wrong");
+                return;
+            }
         }
 
-        for (auto& thread : threads) {
-            thread.join();
+        // A container kept across frames is emptied, then refilled from the new frame's stack
+        {
+            TArray<int32, TMemStackAllocator<>> persistent;
+            for (int32 i = 0; i < 100; ++i) {
+                persistent.Add(-1);
+            }
+            FMemStack::EndFrame();
+            persistent.Empty();
+
+            TArray<int32, TMemStackAllocator<>> other;
+            other.Add(-2);
+            for (int32 i = 0; i < 100; ++i) {
+                persistent.Add(i);
+            }
+            if (persistent[0] != 0 || persistent[99] != 99 || other[0] != -2) {
+                timer.Failure("Array refilled in a new frame lost its contents");
+                return;
+            }
         }
 
-        if (failed) {
-            timer.Failure(errorMsg);
+        timer.Success();
+    }
+    catch (const std::exception& e) {
+        timer.Failure(String("Exception: ") + e.what());
+    }
+}
+
+void TestTLSFAllocator() {
+    ScopedTestTimer timer("FTLSFAllocator::Allocation, Alignment and Coalescing");
+
+    try {
+        const uint64 regionSize = 64ull * 1024 * 1024;
+        FTLSFAllocator allocator(regionSize, 256);
+
+        struct FLiveRange {
+            uint64 Offset;
+            uint64 Size;
+            uint32 Handle;
+        };
+        TArray<FLiveRange> live;
+        std::mt19937 rng(1234);
+
+        for (int32 step = 0; step < 20000; ++step) {
+            if (live.IsEmpty() || rng() % 100 < 55) {
+                const uint64 size = 1 + rng() % (512 * 1024);
+                const uint64 alignment = uint64(1) << (rng() % 14);
+                FTLSFAllocation range = allocator.Allocate(size, alignment);
+                if (!range.IsValid()) {
+                    continue;
+                }
+                if (range.Offset % alignment != 0 || range.Offset % 256 != 0 || range.Size < size ||
+                    range.Offset + range.Size > regionSize) {
+                    timer.Failure("Bad range at step " + std::to_string(step));
+                    return;
+                }
+                live.Add({range.Offset, range.Size, range.Handle});
+            } else {
+                const int32 index = static_cast<int32>(rng() % live.Num());
+                allocator.Free(live[index].Handle);
+                live.RemoveAtSwap(index);
+            }
+
+            if (step % 1000 == 0 && !allocator.Validate()) {
+                timer.Failure("Allocator state invalid at step " + std::to_string(step));
+                return;
+            }
+        }
+
+        // Live ranges never overlap
+        live.Sort([](const FLiveRange& A, const FLiveRange& B) { return A.Offset < B.Offset; });
+        for (int32 i = 1; i < live.Num(); ++i) {
+            if (live[i - 1].Offset + live[i - 1].Size > live[i].Offset) {
+                timer.Failure("Overlapping ranges");
+                return;
+            }
+        }
+
+        // Freeing everything merges the region back into one block
+        for (const FLiveRange& range : live) {
+            allocator.Free(range.Handle);
+        }
+        if (!allocator.Validate() || allocator.GetNumFreeBlocks() != 1 ||
+            allocator.GetLargestFreeBlock() != regionSize || allocator.GetUsedSize() != 0) {
+            timer.Failure("Free blocks not coalesced");
+            return;
+        }
+
+        // Exact fit of the whole region, then nothing left
+        FTLSFAllocation whole = allocator.Allocate(regionSize);
+        if (!whole.IsValid() || whole.Offset != 0 || allocator.Allocate(256).IsValid()) {
+            timer.Failure("Whole-region allocation failed");
+            return;
+        }
+        allocator.Reset();
+        if (allocator.GetFreeSize() != regionSize || !allocator.Validate()) {
+            timer.Failure("Reset failed");
             return;
         }
 
@@ -295,23 +799,1114 @@ void TestMultithreaded() {
     }
 }
 
-void runFMemoryTests() {
-    TestRunner::Get().Reset();
+void TestRHISubAllocator() {
+    ScopedTestTimer timer("FRHISubAllocator::TLSF and Ring Modes");
 
-    MR_LOG_INFO("Starting FMemory System Tests...\n");
+    try {
+        using namespace RHI;
+        const uint64 blockSize = 1024 * 1024;
 
-    MR_LOG_INFO("--- FMemory Basic Tests ---");
-    TestFMemoryBasicOperations();
+        // TLSF: individual frees in any order, offsets honour the alignment
+        {
+            FRHISubAllocator allocator(blockSize, ESubAllocatorMode::TLSF);
+            FRHISubAllocation a, b, c;
+            if (!allocator.Allocate(1000, 256, a) || !allocator.Allocate(5000, 64 * 1024, b) ||
+                !allocator.Allocate(300 * 1024, 4096, c)) {
+                timer.Failure("TLSF allocation failed");
+                return;
+            }
+            if (b.Offset % (64 * 1024) != 0 || c.Offset % 4096 != 0 || allocator.GetNumAllocations() != 3) {
+                timer.Failure("TLSF alignment not honoured");
+                return;
+            }
+            allocator.Free(b);
+            allocator.Free(a);
+            allocator.Free(c);
+            if (allocator.GetUsedSize() != 0 || allocator.GetLargestFreeBlock() != blockSize) {
+                timer.Failure("TLSF block not coalesced");
+                return;
+            }
+        }
 
-    MR_LOG_INFO("\n--- FMemoryManager Tests ---");
-    TestFMemoryManagerInit();
-    TestFMemoryAllocation();
+        // Ring: frames are released in order once their fence completes
+        {
+            FRHISubAllocator ring(blockSize, ESubAllocatorMode::Ring);
+            const uint64 chunk = 200 * 1024;
+            FRHISubAllocation range;
+            uint64 fence = 0;
+            for (int32 frame = 0; frame < 2; ++frame) {
+                for (int32 i = 0; i < 2; ++i) {
+                    if (!ring.Allocate(chunk, 256, range)) {
+                        timer.Failure("Ring allocation failed");
+                        return;
+                    }
+                }
+                ring.EndFrame(++fence);
+            }
+            // 800KB live: the 200KB tail still fits, a wrapped allocation must wait for frame 1
+            if (!ring.Allocate(chunk, 256, range) || range.Offset != 4 * chunk || ring.Allocate(chunk, 256, range)) {
+                timer.Failure("Ring did not stop at the oldest live frame");
+                return;
+            }
+            ring.EndFrame(++fence);
 
-    MR_LOG_INFO("\n--- FMallocBinned2 Tests ---");
-    TestFMallocBinned2Small();
+            ring.ReleaseCompletedFrames(1);
+            if (!ring.Allocate(chunk, 256, range) || range.Offset != 0 || ring.GetNumAllocations() != 4) {
+                timer.Failure("Ring did not wrap into the released frame");
+                return;
+            }
+            ring.EndFrame(++fence);
 
-    MR_LOG_INFO("\n--- Stress Tests ---");
-    TestMultithreaded();
+            // Head behind the tail: allocations fill the gap up to the oldest live frame
+            ring.ReleaseCompletedFrames(2);
+            if (!ring.Allocate(chunk + 256, 256, range) || range.Offset != chunk) {
+                timer.Failure("Ring placed an allocation across the wrap");
+                return;
+            }
+            ring.EndFrame(++fence);
+
+            ring.ReleaseCompletedFrames(fence);
+            if (ring.GetUsedSize() != 0 || ring.GetLargestFreeBlock() != blockSize || ring.GetNumAllocations() != 0) {
+                timer.Failure("Ring not empty after all fences completed");
+                return;
+            }
+        }
+
+        timer.Success();
+    }
+    catch (const std::exception& e) {
+        timer.Failure(String("Exception: ") + e.what());
+    }
+}
+
+void TestRHIDefragPlanner() {
+    ScopedTestTimer timer("FRHIDefragPlanner::Budgeted Moves over a Simulated History");
+
+    try {
+        using namespace RHI;
+        const int32 numBlocks = 4;
+        const uint64 blockSize = 16ull * 1024 * 1024;
+        const uint64 stepBudget = 2ull * 1024 * 1024;
+
+        // Blocks with CPU backing memory standing in for device memory
+        TArray<TUniquePtr<FRHISubAllocator>> blocks;
+        TArray<std::vector<uint8>> memory;
+        for (int32 i = 0; i < numBlocks; ++i) {
+            blocks.Add(MakeUnique<FRHISubAllocator>(blockSize, ESubAllocatorMode::TLSF));
+            memory.Add(std::vector<uint8>(blockSize));
+        }
+
+        struct FLiveAllocation {
+            uint64 Id;
+            uint32 Block;
+            FRHISubAllocation Range;
+            uint64 Alignment;
+        };
+        TArray<FLiveAllocation> live;
+        std::mt19937 rng(99);
+        uint64 nextId = 1;
+
+        auto fill = [&](const FLiveAllocation& Entry) {
+            std::memset(memory[Entry.Block].data() + Entry.Range.Offset, static_cast<int>(Entry.Id % 251), Entry.Range.Size);
+        };
+        auto intact = [&](const FLiveAllocation& Entry) {
+            const uint8* data = memory[Entry.Block].data() + Entry.Range.Offset;
+            for (uint64 i = 0; i < Entry.Range.Size; i += 61) {
+                if (data[i] != static_cast<uint8>(Entry.Id % 251)) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        auto freeLive = [&](int32 Index) {
+            blocks[live[Index].Block]->Free(live[Index].Range);
+            live.RemoveAtSwap(Index);
+        };
+
+        // Streaming history: fill to ~75%, then churn and drop half, leaving holes in every block
+        for (int32 step = 0; step < 6000; ++step) {
+            uint64 usedBytes = 0;
+            for (const auto& block : blocks) {
+                usedBytes += block->GetUsedSize();
+            }
+            if (!live.IsEmpty() && (usedBytes > blockSize * numBlocks * 3 / 4 || rng() % 100 < 35)) {
+                freeLive(static_cast<int32>(rng() % live.Num()));
+                continue;
+            }
+            const bool bTexture = rng() % 3 == 0;
+            FLiveAllocation entry;
+            entry.Id = nextId++;
+            entry.Alignment = bTexture ? 64 * 1024 : 256;
+            const uint64 size = bTexture ? (uint64(64 * 1024) << (rng() % 4)) : 256 + rng() % (128 * 1024);
+            for (uint32 block = 0; block < static_cast<uint32>(numBlocks); ++block) {
+                if (blocks[block]->Allocate(size, entry.Alignment, entry.Range)) {
+                    entry.Block = block;
+                    live.Add(entry);
+                    fill(entry);
+                    break;
+                }
+            }
+        }
+        for (int32 i = live.Num() / 2; i > 0; --i) {
+            freeLive(static_cast<int32>(rng() % live.Num()));
+        }
+
+        auto averageFragmentation = [&]() {
+            double sum = 0;
+            int32 count = 0;
+            for (const auto& block : blocks) {
+                if (block->GetUsedSize() > 0) {
+                    sum += block->GetFragmentation();
+                    ++count;
+                }
+            }
+            return count ? sum / count : 0.0;
+        };
+        auto emptyBlocks = [&]() {
+            int32 count = 0;
+            for (const auto& block : blocks) {
+                count += block->GetUsedSize() == 0 ? 1 : 0;
+            }
+            return count;
+        };
+        const double fragmentationBefore = averageFragmentation();
+        const int32 emptyBefore = emptyBlocks();
+
+        FRHIDefragPlanner planner;
+        for (const auto& block : blocks) {
+            planner.AddBlock(block.get());
+        }
+        TMap<uint64, int32> liveIndices;
+        for (int32 i = 0; i < live.Num(); ++i) {
+            planner.AddAllocation(live[i].Id, live[i].Block, live[i].Range, live[i].Alignment);
+            liveIndices.Add(live[i].Id, i);
+        }
+
+        // A cancelled step leaves everything where it was
+        const uint64 usedBeforeCancel = blocks[0]->GetUsedSize() + blocks[1]->GetUsedSize() + blocks[2]->GetUsedSize() + blocks[3]->GetUsedSize();
+        if (planner.PlanStep(stepBudget).IsEmpty()) {
+            timer.Failure("Nothing to defragment in a fragmented history");
+            return;
+        }
+        planner.CancelStep();
+        if (blocks[0]->GetUsedSize() + blocks[1]->GetUsedSize() + blocks[2]->GetUsedSize() + blocks[3]->GetUsedSize() != usedBeforeCancel) {
+            timer.Failure("CancelStep leaked destination ranges");
+            return;
+        }
+
+        int32 steps = 0;
+        uint64 movedBytes = 0;
+        for (; steps < 1000; ++steps) {
+            const TArray<FRHIDefragMove>& moves = planner.PlanStep(stepBudget);
+            if (moves.IsEmpty()) {
+                break;
+            }
+
+            uint64 stepBytes = 0;
+            for (const FRHIDefragMove& move : moves) {
+                stepBytes += move.Size;
+                // The "GPU copy"
+                std::memcpy(memory[move.DstBlock].data() + move.DstAllocation.Offset,
+                            memory[move.SrcBlock].data() + move.SrcOffset, move.Size);
+            }
+            if (stepBytes > stepBudget) {
+                timer.Failure("Step exceeded its byte budget");
+                return;
+            }
+
+            // The application frees a resource while its move is in flight
+            if (steps == 3) {
+                const uint64 id = moves[0].UserId;
+                planner.RemoveAllocation(id);
+                const int32 index = *liveIndices.Find(id);
+                liveIndices.Remove(id);
+                if (index != live.Num() - 1) {
+                    liveIndices.Add(live.Last().Id, index);
+                }
+                freeLive(index);
+            }
+
+            for (const FRHIDefragMove& move : planner.CompleteStep()) {
+                FLiveAllocation& entry = live[*liveIndices.Find(move.UserId)];
+                if (entry.Block != move.SrcBlock || entry.Range.Offset != move.SrcOffset) {
+                    timer.Failure("Move source does not match the allocation");
+                    return;
+                }
+                entry.Block = move.DstBlock;
+                entry.Range = move.DstAllocation;
+            }
+            movedBytes += stepBytes;
+        }
+        if (steps == 1000) {
+            timer.Failure("Planner did not converge");
+            return;
+        }
+
+        // Data survived every move, and the planner agrees with the application
+        uint64 liveBytes = 0;
+        for (const FLiveAllocation& entry : live) {
+            uint32 plannerBlock = 0;
+            const FRHISubAllocation* range = planner.FindAllocation(entry.Id, &plannerBlock);
+            if (!range || plannerBlock != entry.Block || range->Offset != entry.Range.Offset || !intact(entry)) {
+                timer.Failure("Allocation " + std::to_string(entry.Id) + " lost or corrupted");
+                return;
+            }
+            liveBytes += entry.Range.Size;
+        }
+        uint64 usedBytes = 0;
+        for (const auto& block : blocks) {
+            usedBytes += block->GetUsedSize();
+        }
+        if (usedBytes != liveBytes || planner.GetNumAllocations() != live.Num()) {
+            timer.Failure("Block usage does not match live allocations");
+            return;
+        }
+
+        const double fragmentationAfter = averageFragmentation();
+        const int32 emptyAfter = emptyBlocks();
+        MR_LOG_INFO("  " + std::to_string(steps) + " steps moved " + std::to_string(movedBytes / 1024) + "KB; empty blocks " +
+                    std::to_string(emptyBefore) + " -> " + std::to_string(emptyAfter) + ", average fragmentation " +
+                    std::to_string(fragmentationBefore * 100.0) + "% -> " + std::to_string(fragmentationAfter * 100.0) + "%");
+        if (emptyAfter <= emptyBefore || fragmentationAfter >= fragmentationBefore) {
+            timer.Failure("Defragmentation did not free a block or reduce fragmentation");
+            return;
+        }
+
+        timer.Success();
+    }
+    catch (const std::exception& e) {
+        timer.Failure(String("Exception: ") + e.what());
+    }
+}
+
+void TestMultithreaded() {
+    ScopedTestTimer timer("Multi-threaded Allocations");
+
+    try {
+        const int numThreads = 4;
+        const int allocationsPerThread = 500;
+        std::atomic<bool> failed{false};
+        String errorMsg;
+
+        auto workerFunc = [&](int threadId) {
+            try {
+                FMalloc* allocator = FMemoryManager::Get().GetAllocator();
+                TArray<void*> localAllocations;
+
+                for (int i = 0; i < allocationsPerThread; ++i) {
+                    SIZE_T size = 16 + (threadId * 16) + (i % 512);
+                    void* ptr = allocator->Malloc(size);
+                    
+                    if (!ptr) {
+                        failed = true;
+                        errorMsg = "Thread " + std::to_string(threadId) + " failed";
+                        return;
+                    }
+
+                    FMemory::Memset(ptr, static_cast<uint8>(threadId + 1), size);
+                    localAllocations.Add(ptr);
+
+                    if (i % 10 == 0 && !localAllocations.IsEmpty()) {
+                        allocator->Free(localAllocations.Last());
+                        localAllocations.Pop();
+                    }
+                }
+
+                for (void* ptr : localAllocations) {
+                    allocator->Free(ptr);
+                }
+            }
+            catch (const std::exception& e) {
+                failed = true;
+                errorMsg = "Thread exception: " + String(e.what());
+            }
+        };
+
+        TArray<std::thread> threads;
+        for (int i = 0; i < numThreads; ++i) {
+            threads.Add(std::thread(workerFunc, i));
+        }
+
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        if (failed) {
+            timer.Failure(errorMsg);
+            return;
+        }
+
+        timer.Success();
+    }
+    catch (const std::exception& e) {
+        timer.Failure(String("Exception: ") + e.what());
+    }
+}
+
+void TestCrossThreadFrees() {
+    ScopedTestTimer timer("FMallocBinned2::Cross-thread Frees");
+
+    try {
+        TUniquePtr<FMallocBinned2> allocator = MakeUnique<FMallocBinned2>();
+        const int32 numBlocks = 20000;
+        TArray<void*> blocks;
+        blocks.Reserve(numBlocks);
+
+        // Allocate on one thread, free on another, then reuse on the first
+        std::thread producer([&]() {
+            for (int32 i = 0; i < numBlocks; ++i) {
+                void* ptr = allocator->Malloc(16 + (i % 64) * 16);
+                FMemory::Memset(ptr, 0x5A, 16);
+                blocks.Add(ptr);
+            }
+        });
+        producer.join();
+
+        std::thread consumer([&]() {
+            for (void* ptr : blocks) {
+                allocator->Free(ptr);
+            }
+        });
+        consumer.join();
+
+        allocator->Trim();
+
+        FMalloc::FMemoryStats stats;
+        allocator->GetMemoryStats(stats);
+        if (stats.AllocationCount != numBlocks || stats.FreeCount != numBlocks || stats.TotalAllocated != 0) {
+            timer.Failure("Stats mismatch after cross-thread frees: " + std::to_string(stats.AllocationCount) +
+                          " allocs, " + std::to_string(stats.FreeCount) + " frees, " +
+                          std::to_string(stats.TotalAllocated) + " bytes live");
+            return;
+        }
+
+        if (!allocator->ValidateHeap()) {
+            timer.Failure("Heap validation failed after cross-thread frees");
+            return;
+        }
+
+        timer.Success();
+    }
+    catch (const std::exception& e) {
+        timer.Failure(String("Exception: ") + e.what());
+    }
+}
+
+/**
+ * Producer/consumer benchmark: producers allocate, consumers free
+ * Every free is remote, as with render-thread frees of game-thread allocations
+ */
+template<typename AllocFuncType, typename FreeFuncType>
+double RunProducerConsumerBenchmark(int32 NumPairs, int32 NumBlocksPerPair, AllocFuncType&& AllocFunc, FreeFuncType&& FreeFunc) {
+    static constexpr uint32 kRingSize = 1024;
+
+    // Single-producer single-consumer ring per pair
+    struct alignas(64) FRing {
+        std::atomic<void*> Slots[kRingSize];
+        alignas(64) std::atomic<uint32> Head{0};
+        alignas(64) std::atomic<uint32> Tail{0};
+    };
+
+    TArray<TUniquePtr<FRing>> rings;
+    for (int32 i = 0; i < NumPairs; ++i) {
+        rings.Add(MakeUnique<FRing>());
+    }
+
+    const SIZE_T sizes[] = {16, 24, 48, 64, 96, 128, 200, 256, 384, 512, 768, 1024};
+    const uint32 numSizes = sizeof(sizes) / sizeof(sizes[0]);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    TArray<std::thread> threads;
+    for (int32 pair = 0; pair < NumPairs; ++pair) {
+        FRing* ring = rings[pair].get();
+
+        threads.Add(std::thread([=, &AllocFunc]() {
+            for (int32 i = 0; i < NumBlocksPerPair; ++i) {
+                void* ptr = AllocFunc(sizes[(i * 7 + pair) % numSizes]);
+                *static_cast<uint8*>(ptr) = static_cast<uint8>(i);
+
+                const uint32 tail = ring->Tail.load(std::memory_order_relaxed);
+                while (tail - ring->Head.load(std::memory_order_acquire) >= kRingSize) {
+                    std::this_thread::yield();
+                }
+                ring->Slots[tail % kRingSize].store(ptr, std::memory_order_relaxed);
+                ring->Tail.store(tail + 1, std::memory_order_release);
+            }
+        }));
+
+        threads.Add(std::thread([=, &FreeFunc]() {
+            for (int32 i = 0; i < NumBlocksPerPair; ++i) {
+                const uint32 head = ring->Head.load(std::memory_order_relaxed);
+                while (ring->Tail.load(std::memory_order_acquire) == head) {
+                    std::this_thread::yield();
+                }
+                void* ptr = ring->Slots[head % kRingSize].load(std::memory_order_relaxed);
+                ring->Head.store(head + 1, std::memory_order_release);
+                FreeFunc(ptr);
+            }
+        }));
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    const double seconds = std::chrono::duration<double>(end - start).count();
+    return (static_cast<double>(NumPairs) * NumBlocksPerPair) / seconds / 1.0e6;
+}
+
+void BenchmarkCrossThreadAllocations() {
+    ScopedTestTimer timer("Cross-thread Allocation Benchmark");
+
+    try {
+        const int32 numBlocksPerPair = 200000;
+        const int32 pairCounts[] = {1, 2, 4};
+
+        MR_LOG_INFO("  Pairs | FMallocBinned2 (M ops/s) | malloc (M ops/s)");
+        for (int32 numPairs : pairCounts) {
+            TUniquePtr<FMallocBinned2> allocator = MakeUnique<FMallocBinned2>();
+            FMallocBinned2* binned = allocator.get();
+
+            const double binnedRate = RunProducerConsumerBenchmark(numPairs, numBlocksPerPair,
+                [binned](SIZE_T Size) { return binned->Malloc(Size); },
+                [binned](void* Ptr) { binned->Free(Ptr); });
+
+            const double mallocRate = RunProducerConsumerBenchmark(numPairs, numBlocksPerPair,
+                [](SIZE_T Size) { return std::malloc(Size); },
+                [](void* Ptr) { std::free(Ptr); });
+
+            FMalloc::FMemoryStats stats;
+            binned->GetMemoryStats(stats);
+            if (stats.AllocationCount != stats.FreeCount) {
+                timer.Failure("Allocation/free count mismatch: " + std::to_string(stats.AllocationCount) +
+                              " vs " + std::to_string(stats.FreeCount));
+                return;
+            }
+
+            MR_LOG_INFO("  " + std::to_string(numPairs) + "     | " + std::to_string(binnedRate) +
+                        " | " + std::to_string(mallocRate));
+        }
+
+        timer.Success();
+    }
+    catch (const std::exception& e) {
+        timer.Failure(String("Exception: ") + e.what());
+    }
+}
+
+void BenchmarkLargeAllocations() {
+    ScopedTestTimer timer("Large Allocation Benchmark");
+
+    try {
+        const int32 numIterations = 2000;
+        const SIZE_T sizes[] = {256 * 1024, 1024 * 1024, 3 * 1024 * 1024, 8 * 1024 * 1024};
+
+        // Allocate, touch every 4KB page and free, as a streaming staging buffer would
+        auto runChurn = [&](auto&& AllocFunc, auto&& FreeFunc) {
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int32 i = 0; i < numIterations; ++i) {
+                const SIZE_T size = sizes[i % 4];
+                auto* ptr = static_cast<uint8*>(AllocFunc(size));
+                for (SIZE_T offset = 0; offset < size; offset += 4096) {
+                    ptr[offset] = static_cast<uint8>(i);
+                }
+                FreeFunc(ptr);
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            return numIterations / std::chrono::duration<double>(end - start).count();
+        };
+
+        TUniquePtr<FMallocBinned2> allocator = MakeUnique<FMallocBinned2>();
+        FMallocBinned2* binned = allocator.get();
+
+        const double binnedRate = runChurn([binned](SIZE_T Size) { return binned->Malloc(Size); },
+                                           [binned](void* Ptr) { binned->Free(Ptr); });
+        const double mallocRate = runChurn([](SIZE_T Size) { return std::malloc(Size); },
+                                           [](void* Ptr) { std::free(Ptr); });
+
+        FMalloc::FMemoryStats stats;
+        binned->GetMemoryStats(stats);
+        const uint64 largeRequests = stats.LargeCacheHits + stats.LargeCacheMisses;
+        MR_LOG_INFO("  FMallocBinned2: " + std::to_string(binnedRate) + " alloc/free per second, cache hit rate " +
+                    std::to_string(largeRequests ? 100 * stats.LargeCacheHits / largeRequests : 0) + "%");
+        MR_LOG_INFO("  malloc:         " + std::to_string(mallocRate) + " alloc/free per second");
+
+        timer.Success();
+    }
+    catch (const std::exception& e) {
+        timer.Failure(String("Exception: ") + e.what());
+    }
+}
+
+// Heap allocator that counts allocations, standing in for per-frame heap arrays
+struct FCountingHeapAllocator : public MonsterEngine::FHeapAllocator {
+    static inline std::atomic<uint64> NumAllocations{0};
+
+    class ForAnyElementType : public MonsterEngine::FHeapAllocator::ForAnyElementType {
+    public:
+        void ResizeAllocation(SizeType PreviousNumElements, SizeType NumElements, size_t NumBytesPerElement, uint32 AlignmentOfElement = DEFAULT_ALIGNMENT) {
+            if (NumElements > 0) {
+                NumAllocations.fetch_add(1, std::memory_order_relaxed);
+            }
+            MonsterEngine::FHeapAllocator::ForAnyElementType::ResizeAllocation(PreviousNumElements, NumElements, NumBytesPerElement, AlignmentOfElement);
+        }
+    };
+
+    template<typename ElementType>
+    class ForElementType : public ForAnyElementType {
+    public:
+        FORCEINLINE ElementType* GetAllocation() const {
+            return static_cast<ElementType*>(ForAnyElementType::GetAllocation());
+        }
+    };
+};
+
+// Per-view lists of one simulated frame, rebuilt every frame as FSceneRenderer::InitViews does
+template<typename Allocator>
+struct FSimulatedViewLists {
+    TArray<void*, Allocator> VisibleStaticPrimitives;
+    TArray<void*, Allocator> VisibleDynamicPrimitives;
+    TArray<void*, Allocator> VisibleTranslucentPrimitives;
+    TArray<void*, Allocator> VisibleLights;
+};
+
+struct FSimulatedDrawCommand {
+    void* Primitive;
+    uint64 SortKey;
+    int32 MaterialIndex;
+    int32 NumInstances;
+};
+
+// One frame of visibility gathering, translucency sorting and draw command generation
+template<typename Allocator, bool bUseMarks>
+uint64 SimulateRenderFrame(int32 NumViews, int32 NumPrimitives, int32 NumLights, int32 NumPasses) {
+    using MonsterEngine::TPair;
+
+    uint64 checksum = 0;
+    TArray<FSimulatedViewLists<Allocator>> views;
+    views.Reserve(NumViews);
+
+    for (int32 viewIndex = 0; viewIndex < NumViews; ++viewIndex) {
+        FSimulatedViewLists<Allocator>& view = views[views.AddDefaulted()];
+        for (int32 i = 0; i < NumPrimitives; ++i) {
+            void* primitive = reinterpret_cast<void*>(static_cast<uintptr_t>(i + 1) * 64);
+            if (i % 10 == 0) {
+                view.VisibleTranslucentPrimitives.Add(primitive);
+            } else if (i % 4 == 0) {
+                view.VisibleDynamicPrimitives.Add(primitive);
+            } else {
+                view.VisibleStaticPrimitives.Add(primitive);
+            }
+        }
+        for (int32 i = 0; i < NumLights; ++i) {
+            view.VisibleLights.Add(reinterpret_cast<void*>(static_cast<uintptr_t>(i + 1) * 128));
+        }
+
+        // Translucency sort buffer
+        {
+            std::optional<FMemMark> mark;
+            if constexpr (bUseMarks) {
+                mark.emplace(FMemStack::Get());
+            }
+            TArray<TPair<float, void*>, Allocator> sortBuffer;
+            for (void* primitive : view.VisibleTranslucentPrimitives) {
+                const float distance = static_cast<float>((reinterpret_cast<uintptr_t>(primitive) * 2654435761u) & 0xFFFF);
+                sortBuffer.Add(TPair<float, void*>(distance, primitive));
+            }
+            sortBuffer.Sort([](const TPair<float, void*>& A, const TPair<float, void*>& B) { return A.Key > B.Key; });
+            checksum += reinterpret_cast<uintptr_t>(sortBuffer[0].Value);
+        }
+
+        // Draw command lists, one per pass
+        for (int32 pass = 0; pass < NumPasses; ++pass) {
+            std::optional<FMemMark> mark;
+            if constexpr (bUseMarks) {
+                mark.emplace(FMemStack::Get());
+            }
+            TArray<FSimulatedDrawCommand, Allocator> drawCommands;
+            for (void* primitive : view.VisibleStaticPrimitives) {
+                drawCommands.Add({primitive, (reinterpret_cast<uintptr_t>(primitive) >> 6) * 31 + pass, 0, 1});
+            }
+            for (void* primitive : view.VisibleDynamicPrimitives) {
+                drawCommands.Add({primitive, (reinterpret_cast<uintptr_t>(primitive) >> 6) * 17 + pass, 1, 1});
+            }
+            drawCommands.Sort([](const FSimulatedDrawCommand& A, const FSimulatedDrawCommand& B) { return A.SortKey < B.SortKey; });
+            checksum += drawCommands[0].SortKey + drawCommands.Num();
+        }
+    }
+
+    return checksum;
+}
+
+void BenchmarkFrameAllocations() {
+    ScopedTestTimer timer("Per-frame Allocation Benchmark");
+
+    try {
+        using MonsterEngine::TMemStackAllocator;
+
+        const int32 numFrames = 200;
+        const int32 warmupFrames = 5;
+        const int32 numViews = 2;
+        const int32 numPrimitives = 4000;
+        const int32 numLights = 16;
+        const int32 numPasses = 4;
+
+        // Before: every per-frame array on the heap
+        uint64 heapChecksum = 0;
+        const uint64 heapAllocationsStart = FCountingHeapAllocator::NumAllocations.load();
+        auto heapStart = std::chrono::high_resolution_clock::now();
+        for (int32 frame = 0; frame < numFrames; ++frame) {
+            heapChecksum += SimulateRenderFrame<FCountingHeapAllocator, false>(numViews, numPrimitives, numLights, numPasses);
+        }
+        auto heapEnd = std::chrono::high_resolution_clock::now();
+        const uint64 heapAllocations = FCountingHeapAllocator::NumAllocations.load() - heapAllocationsStart;
+
+        // After: the same arrays on the frame stack, which keeps its chunks across frames
+        uint64 stackChecksum = 0;
+        uint64 chunkAllocationsAfterWarmup = 0;
+        auto stackStart = std::chrono::high_resolution_clock::now();
+        for (int32 frame = 0; frame < numFrames; ++frame) {
+            if (frame == warmupFrames) {
+                chunkAllocationsAfterWarmup = FMemStack::GetStats().ChunkAllocations;
+            }
+            stackChecksum += SimulateRenderFrame<TMemStackAllocator<>, true>(numViews, numPrimitives, numLights, numPasses);
+            FMemStack::EndFrame();
+        }
+        auto stackEnd = std::chrono::high_resolution_clock::now();
+        const uint64 steadyChunkAllocations = FMemStack::GetStats().ChunkAllocations - chunkAllocationsAfterWarmup;
+
+        if (heapChecksum != stackChecksum) {
+            timer.Failure("Frame results differ between allocators");
+            return;
+        }
+        if (steadyChunkAllocations != 0) {
+            timer.Failure("Frame stack allocated " + std::to_string(steadyChunkAllocations) + " chunks after warm-up");
+            return;
+        }
+
+        const double heapMs = std::chrono::duration<double, std::milli>(heapEnd - heapStart).count() / numFrames;
+        const double stackMs = std::chrono::duration<double, std::milli>(stackEnd - stackStart).count() / numFrames;
+        MR_LOG_INFO("  Heap arrays:  " + std::to_string(heapAllocations / numFrames) + " heap allocations/frame, " +
+                    std::to_string(heapMs) + " ms/frame");
+        MR_LOG_INFO("  Frame stack:  " + std::to_string(steadyChunkAllocations) + " heap allocations/frame after warm-up, " +
+                    std::to_string(stackMs) + " ms/frame, " +
+                    std::to_string(FMemStack::GetStats().ReservedBytes / 1024) + " KB reserved");
+
+        timer.Success();
+    }
+    catch (const std::exception& e) {
+        timer.Failure(String("Exception: ") + e.what());
+    }
+}
+
+// Sorted first-fit free list with merging, as the texture pools used before FTLSFAllocator
+class FFirstFitRangeList {
+public:
+    explicit FFirstFitRangeList(uint64 Size) {
+        Regions.Add({0, Size});
+    }
+
+    uint64 Allocate(uint64 Size, uint64 Alignment) {
+        for (int32 i = 0; i < Regions.Num(); ++i) {
+            const uint64 offset = Regions[i].Offset;
+            const uint64 regionEnd = offset + Regions[i].Size;
+            const uint64 aligned = (offset + Alignment - 1) & ~(Alignment - 1);
+            if (aligned + Size <= regionEnd) {
+                if (aligned + Size == regionEnd) {
+                    Regions.RemoveAt(i);
+                } else {
+                    Regions[i].Offset = aligned + Size;
+                    Regions[i].Size = regionEnd - (aligned + Size);
+                }
+                if (aligned > offset) {
+                    // Keep the padding free
+                    Regions.Insert({offset, aligned - offset}, i);
+                }
+                return aligned;
+            }
+        }
+        return ~uint64(0);
+    }
+
+    void Free(uint64 Offset, uint64 Size) {
+        int32 index = 0;
+        while (index < Regions.Num() && Regions[index].Offset < Offset) {
+            ++index;
+        }
+        Regions.Insert({Offset, Size}, index);
+        if (index + 1 < Regions.Num() && Offset + Size == Regions[index + 1].Offset) {
+            Regions[index].Size += Regions[index + 1].Size;
+            Regions.RemoveAt(index + 1);
+        }
+        if (index > 0 && Regions[index - 1].Offset + Regions[index - 1].Size == Offset) {
+            Regions[index - 1].Size += Regions[index].Size;
+            Regions.RemoveAt(index);
+        }
+    }
+
+    float GetFragmentation(uint64 FreeSize) const {
+        uint64 largest = 0;
+        for (const FRegion& region : Regions) {
+            largest = region.Size > largest ? region.Size : largest;
+        }
+        return FreeSize ? 1.0f - static_cast<float>(static_cast<double>(largest) / FreeSize) : 0.0f;
+    }
+
+    int32 GetNumRegions() const { return Regions.Num(); }
+
+private:
+    struct FRegion {
+        uint64 Offset;
+        uint64 Size;
+    };
+    TArray<FRegion> Regions;
+};
+
+struct FLatencyPercentiles {
+    double P50 = 0, P99 = 0, P999 = 0, Max = 0;
+};
+
+static FLatencyPercentiles ComputePercentiles(TArray<double>& SamplesNs) {
+    FLatencyPercentiles result;
+    if (SamplesNs.IsEmpty()) {
+        return result;
+    }
+    SamplesNs.Sort();
+    auto at = [&](double Fraction) { return SamplesNs[static_cast<int32>(Fraction * (SamplesNs.Num() - 1))]; };
+    result.P50 = at(0.5);
+    result.P99 = at(0.99);
+    result.P999 = at(0.999);
+    result.Max = SamplesNs.Last();
+    return result;
+}
+
+void BenchmarkTLSFAllocator() {
+    ScopedTestTimer timer("TLSF Texture Pool Benchmark");
+
+    try {
+        const uint64 poolSize = 512ull * 1024 * 1024;
+        const uint64 targetLiveBytes = poolSize * 7 / 10;
+        const int32 numOps = 200000;
+        const uint64 alignment = 256;
+
+        // Random mips of RGBA8 textures from 32x32 to 1024x1024
+        struct FOp {
+            bool bAllocate;
+            uint64 Size;
+            uint32 Pick;
+        };
+        auto makeOps = [&]() {
+            TArray<FOp> ops;
+            ops.Reserve(numOps);
+            std::mt19937 rng(42);
+            for (int32 i = 0; i < numOps; ++i) {
+                const uint32 dim = 32u << (rng() % 6);
+                const uint32 mip = rng() % 6;
+                const uint64 size = std::max<uint64>(uint64(dim >> mip) * (dim >> mip) * 4, 256);
+                ops.Add({rng() % 100 < 52, size, static_cast<uint32>(rng())});
+            }
+            return ops;
+        };
+        const TArray<FOp> ops = makeOps();
+
+        struct FLive {
+            uint64 Offset;
+            uint64 Size;
+            uint32 Handle;
+        };
+
+        auto runTraffic = [&](auto&& AllocFunc, auto&& FreeFunc, auto&& FragmentationFunc,
+                              TArray<double>& AllocNs, TArray<double>& FreeNs, double& AvgFragmentation, int32& Failures) {
+            TArray<FLive> live;
+            uint64 liveBytes = 0;
+            double fragmentationSum = 0;
+            int32 fragmentationSamples = 0;
+            for (int32 i = 0; i < ops.Num(); ++i) {
+                const FOp& op = ops[i];
+                const bool bAllocate = live.IsEmpty() || (liveBytes < targetLiveBytes && op.bAllocate);
+                if (bAllocate) {
+                    auto start = std::chrono::steady_clock::now();
+                    FLive entry = AllocFunc(op.Size);
+                    auto end = std::chrono::steady_clock::now();
+                    AllocNs.Add(std::chrono::duration<double, std::nano>(end - start).count());
+                    if (entry.Size == 0) {
+                        ++Failures;
+                        continue;
+                    }
+                    live.Add(entry);
+                    liveBytes += entry.Size;
+                } else {
+                    const int32 index = static_cast<int32>(op.Pick % live.Num());
+                    const FLive entry = live[index];
+                    live.RemoveAtSwap(index);
+                    auto start = std::chrono::steady_clock::now();
+                    FreeFunc(entry);
+                    auto end = std::chrono::steady_clock::now();
+                    FreeNs.Add(std::chrono::duration<double, std::nano>(end - start).count());
+                    liveBytes -= entry.Size;
+                }
+                if (i % 1000 == 999) {
+                    fragmentationSum += FragmentationFunc(poolSize - liveBytes);
+                    ++fragmentationSamples;
+                }
+            }
+            for (const FLive& entry : live) {
+                FreeFunc(entry);
+            }
+            AvgFragmentation = fragmentationSamples ? fragmentationSum / fragmentationSamples : 0.0;
+        };
+
+        // TLSF
+        FTLSFAllocator tlsf(poolSize, alignment);
+        TArray<double> tlsfAllocNs, tlsfFreeNs;
+        double tlsfFragmentation = 0;
+        int32 tlsfFailures = 0;
+        runTraffic(
+            [&](uint64 Size) {
+                FTLSFAllocation range = tlsf.Allocate(Size, alignment);
+                return range.IsValid() ? FLive{range.Offset, range.Size, range.Handle} : FLive{0, 0, 0};
+            },
+            [&](const FLive& Entry) { tlsf.Free(Entry.Handle); },
+            [&](uint64) { return tlsf.GetFragmentation(); },
+            tlsfAllocNs, tlsfFreeNs, tlsfFragmentation, tlsfFailures);
+
+        if (!tlsf.Validate() || tlsf.GetNumFreeBlocks() != 1) {
+            timer.Failure("TLSF allocator not fully coalesced after the run");
+            return;
+        }
+
+        // First-fit list
+        FFirstFitRangeList firstFit(poolSize);
+        TArray<double> listAllocNs, listFreeNs;
+        double listFragmentation = 0;
+        int32 listFailures = 0;
+        runTraffic(
+            [&](uint64 Size) {
+                const uint64 alignedSize = (Size + alignment - 1) & ~(alignment - 1);
+                const uint64 offset = firstFit.Allocate(alignedSize, alignment);
+                return offset != ~uint64(0) ? FLive{offset, alignedSize, 0} : FLive{0, 0, 0};
+            },
+            [&](const FLive& Entry) { firstFit.Free(Entry.Offset, Entry.Size); },
+            [&](uint64 FreeSize) { return firstFit.GetFragmentation(FreeSize); },
+            listAllocNs, listFreeNs, listFragmentation, listFailures);
+
+        if (firstFit.GetNumRegions() != 1) {
+            timer.Failure("First-fit list not fully merged after the run");
+            return;
+        }
+
+        auto report = [](const char* Name, TArray<double>& AllocNs, TArray<double>& FreeNs, double Fragmentation, int32 Failures) {
+            const FLatencyPercentiles alloc = ComputePercentiles(AllocNs);
+            const FLatencyPercentiles free = ComputePercentiles(FreeNs);
+            MR_LOG_INFO(String("  ") + Name + " alloc ns p50/p99/p99.9/max: " + std::to_string(static_cast<int64>(alloc.P50)) + "/" +
+                        std::to_string(static_cast<int64>(alloc.P99)) + "/" + std::to_string(static_cast<int64>(alloc.P999)) + "/" +
+                        std::to_string(static_cast<int64>(alloc.Max)));
+            MR_LOG_INFO(String("  ") + Name + " free  ns p50/p99/p99.9/max: " + std::to_string(static_cast<int64>(free.P50)) + "/" +
+                        std::to_string(static_cast<int64>(free.P99)) + "/" + std::to_string(static_cast<int64>(free.P999)) + "/" +
+                        std::to_string(static_cast<int64>(free.Max)));
+            MR_LOG_INFO(String("  ") + Name + " average fragmentation " + std::to_string(Fragmentation * 100.0) +
+                        "%, failed allocations " + std::to_string(Failures));
+        };
+        report("TLSF     ", tlsfAllocNs, tlsfFreeNs, tlsfFragmentation, tlsfFailures);
+        report("First-fit", listAllocNs, listFreeNs, listFragmentation, listFailures);
+
+        timer.Success();
+    }
+    catch (const std::exception& e) {
+        timer.Failure(String("Exception: ") + e.what());
+    }
+}
+
+void BenchmarkRHISubAllocator() {
+    ScopedTestTimer timer("GPU Sub-allocator Benchmark");
+
+    try {
+        using namespace RHI;
+
+        // General pool: buffers and textures in a 64MB block, as FVulkanMemoryPool sees them
+        const uint64 poolSize = 64ull * 1024 * 1024;
+        const uint64 targetLiveBytes = poolSize * 7 / 10;
+        const int32 numOps = 100000;
+
+        struct FOp {
+            bool bAllocate;
+            uint64 Size;
+            uint64 Alignment;
+            uint32 Pick;
+        };
+        TArray<FOp> ops;
+        ops.Reserve(numOps);
+        std::mt19937 rng(7);
+        for (int32 i = 0; i < numOps; ++i) {
+            const bool bTexture = rng() % 4 == 0;
+            const uint64 size = bTexture ? (uint64(64 * 1024) << (rng() % 5)) : 256 + rng() % (256 * 1024);
+            ops.Add({rng() % 100 < 52, size, bTexture ? uint64(64 * 1024) : uint64(256), static_cast<uint32>(rng())});
+        }
+
+        struct FLive {
+            FRHISubAllocation Range;
+        };
+
+        auto runPool = [&](auto&& AllocFunc, auto&& FreeFunc, auto&& FragmentationFunc,
+                           TArray<double>& OpNs, double& AvgFragmentation, int32& Failures) {
+            TArray<FLive> live;
+            uint64 liveBytes = 0;
+            double fragmentationSum = 0;
+            int32 fragmentationSamples = 0;
+            for (int32 i = 0; i < ops.Num(); ++i) {
+                const FOp& op = ops[i];
+                auto start = std::chrono::steady_clock::now();
+                if (live.IsEmpty() || (liveBytes < targetLiveBytes && op.bAllocate)) {
+                    FLive entry;
+                    if (!AllocFunc(op.Size, op.Alignment, entry.Range)) {
+                        ++Failures;
+                        continue;
+                    }
+                    live.Add(entry);
+                    liveBytes += entry.Range.Size;
+                } else {
+                    const int32 index = static_cast<int32>(op.Pick % live.Num());
+                    liveBytes -= live[index].Range.Size;
+                    FreeFunc(live[index].Range);
+                    live.RemoveAtSwap(index);
+                }
+                auto end = std::chrono::steady_clock::now();
+                OpNs.Add(std::chrono::duration<double, std::nano>(end - start).count());
+                if (i % 1000 == 999) {
+                    fragmentationSum += FragmentationFunc(poolSize - liveBytes);
+                    ++fragmentationSamples;
+                }
+            }
+            for (const FLive& entry : live) {
+                FreeFunc(entry.Range);
+            }
+            AvgFragmentation = fragmentationSamples ? fragmentationSum / fragmentationSamples : 0.0;
+        };
+
+        FRHISubAllocator subAllocator(poolSize, ESubAllocatorMode::TLSF);
+        TArray<double> tlsfNs;
+        double tlsfFragmentation = 0;
+        int32 tlsfFailures = 0;
+        runPool(
+            [&](uint64 Size, uint64 Alignment, FRHISubAllocation& Out) { return subAllocator.Allocate(Size, Alignment, Out); },
+            [&](const FRHISubAllocation& Range) { subAllocator.Free(Range); },
+            [&](uint64) { return subAllocator.GetFragmentation(); },
+            tlsfNs, tlsfFragmentation, tlsfFailures);
+
+        if (subAllocator.GetUsedSize() != 0 || subAllocator.GetLargestFreeBlock() != poolSize) {
+            timer.Failure("Sub-allocator not empty after the run");
+            return;
+        }
+
+        FFirstFitRangeList firstFit(poolSize);
+        TArray<double> listNs;
+        double listFragmentation = 0;
+        int32 listFailures = 0;
+        runPool(
+            [&](uint64 Size, uint64 Alignment, FRHISubAllocation& Out) {
+                const uint64 alignedSize = (Size + 255) & ~uint64(255);
+                const uint64 offset = firstFit.Allocate(alignedSize, Alignment);
+                if (offset == ~uint64(0)) {
+                    return false;
+                }
+                Out.Offset = offset;
+                Out.Size = alignedSize;
+                return true;
+            },
+            [&](const FRHISubAllocation& Range) { firstFit.Free(Range.Offset, Range.Size); },
+            [&](uint64 FreeSize) { return firstFit.GetFragmentation(FreeSize); },
+            listNs, listFragmentation, listFailures);
+
+        auto report = [](const char* Name, TArray<double>& OpNs, double Fragmentation, int32 Failures) {
+            const FLatencyPercentiles op = ComputePercentiles(OpNs);
+            MR_LOG_INFO(String("  ") + Name + " op ns p50/p99/max: " + std::to_string(static_cast<int64>(op.P50)) + "/" +
+                        std::to_string(static_cast<int64>(op.P99)) + "/" + std::to_string(static_cast<int64>(op.Max)) +
+                        ", average fragmentation " + std::to_string(Fragmentation * 100.0) +
+                        "%, failed allocations " + std::to_string(Failures));
+        };
+        report("TLSF     ", tlsfNs, tlsfFragmentation, tlsfFailures);
+        report("First-fit", listNs, listFragmentation, listFailures);
+
+        // Ring: per-frame constants and dynamic vertices, three frames in flight
+        const uint64 ringSize = 32ull * 1024 * 1024;
+        const int32 numFrames = 500;
+        const int32 allocationsPerFrame = 2000;
+        const uint64 framesInFlight = 3;
+        FRHISubAllocator ring(ringSize, ESubAllocatorMode::Ring);
+        int32 ringFailures = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int32 frame = 1; frame <= numFrames; ++frame) {
+            FRHISubAllocation range;
+            for (int32 i = 0; i < allocationsPerFrame; ++i) {
+                if (!ring.Allocate(256 + (i * 2654435761u) % (4 * 1024), 256, range)) {
+                    ++ringFailures;
+                }
+            }
+            ring.EndFrame(frame);
+            if (frame > static_cast<int32>(framesInFlight)) {
+                ring.ReleaseCompletedFrames(frame - framesInFlight);
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        const double ringNs = std::chrono::duration<double, std::nano>(end - start).count();
+        MR_LOG_INFO("  Ring      " + std::to_string(ringNs / (double(numFrames) * allocationsPerFrame)) +
+                    " ns per transient allocation, failed allocations " + std::to_string(ringFailures));
+
+        ring.ReleaseCompletedFrames(numFrames);
+        if (ringFailures != 0 || ring.GetUsedSize() != 0) {
+            timer.Failure("Ring ran out of space or did not drain");
+            return;
+        }
+
+        timer.Success();
+    }
+    catch (const std::exception& e) {
+        timer.Failure(String("Exception: ") + e.what());
+    }
+}
+
+void runFMemoryTests() {
+    TestRunner::Get().Reset();
+
+    MR_LOG_INFO("Starting FMemory System Tests...\n");
+
+    MR_LOG_INFO("--- FMemory Basic Tests ---");
+    TestFMemoryBasicOperations();
+
+    MR_LOG_INFO("\n--- FMemoryManager Tests ---");
+    TestFMemoryManagerInit();
+    TestFMemoryAllocation();
+
+    MR_LOG_INFO("\n--- FMallocBinned2 Tests ---");
+    TestFMallocBinned2Small();
+    TestFMallocBinned2SizeClasses();
+    TestLargeBlockCache();
+
+    MR_LOG_INFO("\n--- FLowLevelMemTracker Tests ---");
+    TestLowLevelMemTracker();
+
+    MR_LOG_INFO("\n--- FMemStack Tests ---");
+    TestMemStack();
+
+    MR_LOG_INFO("\n--- FTLSFAllocator Tests ---");
+    TestTLSFAllocator();
+
+    MR_LOG_INFO("\n--- FRHISubAllocator Tests ---");
+    TestRHISubAllocator();
+    TestRHIDefragPlanner();
+
+    MR_LOG_INFO("\n--- Stress Tests ---");
+    TestMultithreaded();
+    TestCrossThreadFrees();
+
+    MR_LOG_INFO("\n--- Benchmarks ---");
+    BenchmarkCrossThreadAllocations();
+    BenchmarkLargeAllocations();
+    BenchmarkFrameAllocations();
+    BenchmarkTLSFAllocator();
+    BenchmarkRHISubAllocator();
 
     TestRunner::Get().PrintSummary();
 }
@@ -9,8 +9,17 @@
  */
 
 #include "Math/MonsterMath.h"
+#include "Math/VectorKernels.h"
+#include "Math/RenderTransform.h"
+#include "Core/HAL/PlatformCPUFeatures.h"
 #include <iostream>
 #include <cassert>
+#include <algorithm>
+#include <bitset>
+#include <chrono>
+#include <cmath>
+#include <type_traits>
+#include <vector>
 
 using namespace MonsterEngine;
 using namespace MonsterEngine::Math;
@@ -205,6 +214,938 @@ void TestMatrix()
     std::cout << "TMatrix tests passed!" << std::endl << std::endl;
 }
 
+namespace
+{
+
+/** Scalar reference implementations the vectorized TMatrix paths are checked and timed against */
+template<typename T>
+void ScalarMatrixMultiply(TMatrix<T>& Result, const TMatrix<T>& A, const TMatrix<T>& B)
+{
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        for (int32_t j = 0; j < 4; ++j)
+        {
+            Result.M[i][j] = A.M[i][0] * B.M[0][j] + A.M[i][1] * B.M[1][j] +
+                             A.M[i][2] * B.M[2][j] + A.M[i][3] * B.M[3][j];
+        }
+    }
+}
+
+template<typename T>
+TVector4<T> ScalarTransformFVector4(const TMatrix<T>& Mat, const TVector4<T>& V)
+{
+    const auto& M = Mat.M;
+    return TVector4<T>(
+        M[0][0] * V.X + M[1][0] * V.Y + M[2][0] * V.Z + M[3][0] * V.W,
+        M[0][1] * V.X + M[1][1] * V.Y + M[2][1] * V.Z + M[3][1] * V.W,
+        M[0][2] * V.X + M[1][2] * V.Y + M[2][2] * V.Z + M[3][2] * V.W,
+        M[0][3] * V.X + M[1][3] * V.Y + M[2][3] * V.Z + M[3][3] * V.W);
+}
+
+/** The previous TMatrix::Inverse: cofactor expansion with 3x3 minors recomputed per element */
+template<typename T>
+TMatrix<T> ScalarMatrixInverse(const TMatrix<T>& Mat)
+{
+    const auto& M = Mat.M;
+    const T Det = Mat.Determinant();
+    if (std::abs(Det) < MR_SMALL_NUMBER)
+    {
+        return TMatrix<T>::Identity;
+    }
+
+    const T InvDet = T(1) / Det;
+    TMatrix<T> Result;
+    Result.M[0][0] = InvDet * (M[1][1] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) - M[2][1] * (M[1][2] * M[3][3] - M[1][3] * M[3][2]) + M[3][1] * (M[1][2] * M[2][3] - M[1][3] * M[2][2]));
+    Result.M[0][1] = InvDet * -(M[0][1] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) - M[2][1] * (M[0][2] * M[3][3] - M[0][3] * M[3][2]) + M[3][1] * (M[0][2] * M[2][3] - M[0][3] * M[2][2]));
+    Result.M[0][2] = InvDet * (M[0][1] * (M[1][2] * M[3][3] - M[1][3] * M[3][2]) - M[1][1] * (M[0][2] * M[3][3] - M[0][3] * M[3][2]) + M[3][1] * (M[0][2] * M[1][3] - M[0][3] * M[1][2]));
+    Result.M[0][3] = InvDet * -(M[0][1] * (M[1][2] * M[2][3] - M[1][3] * M[2][2]) - M[1][1] * (M[0][2] * M[2][3] - M[0][3] * M[2][2]) + M[2][1] * (M[0][2] * M[1][3] - M[0][3] * M[1][2]));
+    Result.M[1][0] = InvDet * -(M[1][0] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) - M[2][0] * (M[1][2] * M[3][3] - M[1][3] * M[3][2]) + M[3][0] * (M[1][2] * M[2][3] - M[1][3] * M[2][2]));
+    Result.M[1][1] = InvDet * (M[0][0] * (M[2][2] * M[3][3] - M[2][3] * M[3][2]) - M[2][0] * (M[0][2] * M[3][3] - M[0][3] * M[3][2]) + M[3][0] * (M[0][2] * M[2][3] - M[0][3] * M[2][2]));
+    Result.M[1][2] = InvDet * -(M[0][0] * (M[1][2] * M[3][3] - M[1][3] * M[3][2]) - M[1][0] * (M[0][2] * M[3][3] - M[0][3] * M[3][2]) + M[3][0] * (M[0][2] * M[1][3] - M[0][3] * M[1][2]));
+    Result.M[1][3] = InvDet * (M[0][0] * (M[1][2] * M[2][3] - M[1][3] * M[2][2]) - M[1][0] * (M[0][2] * M[2][3] - M[0][3] * M[2][2]) + M[2][0] * (M[0][2] * M[1][3] - M[0][3] * M[1][2]));
+    Result.M[2][0] = InvDet * (M[1][0] * (M[2][1] * M[3][3] - M[2][3] * M[3][1]) - M[2][0] * (M[1][1] * M[3][3] - M[1][3] * M[3][1]) + M[3][0] * (M[1][1] * M[2][3] - M[1][3] * M[2][1]));
+    Result.M[2][1] = InvDet * -(M[0][0] * (M[2][1] * M[3][3] - M[2][3] * M[3][1]) - M[2][0] * (M[0][1] * M[3][3] - M[0][3] * M[3][1]) + M[3][0] * (M[0][1] * M[2][3] - M[0][3] * M[2][1]));
+    Result.M[2][2] = InvDet * (M[0][0] * (M[1][1] * M[3][3] - M[1][3] * M[3][1]) - M[1][0] * (M[0][1] * M[3][3] - M[0][3] * M[3][1]) + M[3][0] * (M[0][1] * M[1][3] - M[0][3] * M[1][1]));
+    Result.M[2][3] = InvDet * -(M[0][0] * (M[1][1] * M[2][3] - M[1][3] * M[2][1]) - M[1][0] * (M[0][1] * M[2][3] - M[0][3] * M[2][1]) + M[2][0] * (M[0][1] * M[1][3] - M[0][3] * M[1][1]));
+    Result.M[3][0] = InvDet * -(M[1][0] * (M[2][1] * M[3][2] - M[2][2] * M[3][1]) - M[2][0] * (M[1][1] * M[3][2] - M[1][2] * M[3][1]) + M[3][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1]));
+    Result.M[3][1] = InvDet * (M[0][0] * (M[2][1] * M[3][2] - M[2][2] * M[3][1]) - M[2][0] * (M[0][1] * M[3][2] - M[0][2] * M[3][1]) + M[3][0] * (M[0][1] * M[2][2] - M[0][2] * M[2][1]));
+    Result.M[3][2] = InvDet * -(M[0][0] * (M[1][1] * M[3][2] - M[1][2] * M[3][1]) - M[1][0] * (M[0][1] * M[3][2] - M[0][2] * M[3][1]) + M[3][0] * (M[0][1] * M[1][2] - M[0][2] * M[1][1]));
+    Result.M[3][3] = InvDet * (M[0][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1]) - M[1][0] * (M[0][1] * M[2][2] - M[0][2] * M[2][1]) + M[2][0] * (M[0][1] * M[1][2] - M[0][2] * M[1][1]));
+    return Result;
+}
+
+template<typename T>
+TMatrix<T> MakeRandomMatrix(uint32_t& Seed)
+{
+    TMatrix<T> Result;
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        for (int32_t j = 0; j < 4; ++j)
+        {
+            Seed = Seed * 1664525u + 1013904223u;
+            Result.M[i][j] = static_cast<T>(static_cast<double>(Seed >> 8) / double(1 << 24) * 2.0 - 1.0);
+        }
+        // Diagonal dominance keeps the matrices well conditioned
+        Result.M[i][i] += T(4);
+    }
+    return Result;
+}
+
+template<typename T>
+bool CheckMatrixSIMD(const char* TypeName)
+{
+    const T Tolerance = std::is_same_v<T, float> ? T(1e-4) : T(1e-10);
+    uint32_t Seed = 7;
+    bool bOk = true;
+
+    for (int32_t Iteration = 0; Iteration < 1000; ++Iteration)
+    {
+        const TMatrix<T> A = MakeRandomMatrix<T>(Seed);
+        const TMatrix<T> B = MakeRandomMatrix<T>(Seed);
+
+        TMatrix<T> Expected;
+        ScalarMatrixMultiply(Expected, A, B);
+        bOk = bOk && (A * B).Equals(Expected, Tolerance);
+
+        TMatrix<T> InPlace = A;
+        InPlace *= B;
+        bOk = bOk && InPlace.Equals(Expected, Tolerance);
+
+        bOk = bOk && A.Inverse().Equals(ScalarMatrixInverse(A), Tolerance);
+        bOk = bOk && (A * A.Inverse()).Equals(TMatrix<T>::Identity, Tolerance);
+
+        const TMatrix<T> Transposed = A.GetTransposed();
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            for (int32_t j = 0; j < 4; ++j)
+            {
+                bOk = bOk && Transposed.M[i][j] == A.M[j][i];
+            }
+        }
+
+        const TVector4<T> V(B.M[0][0], B.M[1][1], B.M[2][2], B.M[3][3]);
+        const TVector4<T> Got = A.TransformFVector4(V);
+        const TVector4<T> Want = ScalarTransformFVector4(A, V);
+        bOk = bOk && std::abs(Got.X - Want.X) <= Tolerance && std::abs(Got.Y - Want.Y) <= Tolerance &&
+              std::abs(Got.Z - Want.Z) <= Tolerance && std::abs(Got.W - Want.W) <= Tolerance;
+    }
+
+    // Singular matrices still invert to identity
+    TMatrix<T> Singular(ForceInit);
+    Singular.M[0][0] = T(1);
+    bOk = bOk && Singular.Inverse() == TMatrix<T>::Identity;
+
+    std::cout << "TMatrix<" << TypeName << "> SIMD matches scalar: " << (bOk ? "yes" : "no") << std::endl;
+    return bOk;
+}
+
+template<typename FuncType>
+double TimeNanosecondsPerOp(int32_t NumOps, FuncType&& Func)
+{
+    const auto Start = std::chrono::high_resolution_clock::now();
+    Func();
+    const auto End = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(End - Start).count() / NumOps;
+}
+
+template<typename T>
+void BenchmarkMatrixSIMD(const char* TypeName, int32_t NumMatrices, int32_t NumRepeats)
+{
+    uint32_t Seed = 11;
+    std::vector<TMatrix<T>> Matrices(NumMatrices);
+    std::vector<TMatrix<T>> Results(NumMatrices);
+    for (TMatrix<T>& Matrix : Matrices)
+    {
+        Matrix = MakeRandomMatrix<T>(Seed);
+    }
+    const TMatrix<T> Other = MakeRandomMatrix<T>(Seed);
+    const int32_t NumOps = NumMatrices * NumRepeats;
+    T Checksum = T(0);
+
+    const double ScalarMultiply = TimeNanosecondsPerOp(NumOps, [&]()
+    {
+        for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            for (int32_t i = 0; i < NumMatrices; ++i) { ScalarMatrixMultiply(Results[i], Matrices[i], Other); }
+            Checksum += Results[Repeat % NumMatrices].M[0][0];
+        }
+    });
+    const double SimdMultiply = TimeNanosecondsPerOp(NumOps, [&]()
+    {
+        for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            for (int32_t i = 0; i < NumMatrices; ++i) { Results[i] = Matrices[i] * Other; }
+            Checksum += Results[Repeat % NumMatrices].M[0][0];
+        }
+    });
+    const double ScalarInverse = TimeNanosecondsPerOp(NumOps, [&]()
+    {
+        for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            for (int32_t i = 0; i < NumMatrices; ++i) { Results[i] = ScalarMatrixInverse(Matrices[i]); }
+            Checksum += Results[Repeat % NumMatrices].M[0][0];
+        }
+    });
+    const double SimdInverse = TimeNanosecondsPerOp(NumOps, [&]()
+    {
+        for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            for (int32_t i = 0; i < NumMatrices; ++i) { Results[i] = Matrices[i].Inverse(); }
+            Checksum += Results[Repeat % NumMatrices].M[0][0];
+        }
+    });
+    const TVector4<T> Point(T(1), T(2), T(3), T(1));
+    const double ScalarTransform = TimeNanosecondsPerOp(NumOps, [&]()
+    {
+        for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            for (int32_t i = 0; i < NumMatrices; ++i) { Checksum += ScalarTransformFVector4(Matrices[i], Point).X; }
+        }
+    });
+    const double SimdTransform = TimeNanosecondsPerOp(NumOps, [&]()
+    {
+        for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            for (int32_t i = 0; i < NumMatrices; ++i) { Checksum += Matrices[i].TransformFVector4(Point).X; }
+        }
+    });
+
+    std::cout << "TMatrix<" << TypeName << "> ns/op (scalar -> SIMD):"
+              << " Multiply " << ScalarMultiply << " -> " << SimdMultiply
+              << ", Inverse " << ScalarInverse << " -> " << SimdInverse
+              << ", TransformFVector4 " << ScalarTransform << " -> " << SimdTransform
+              << " (checksum " << Checksum << ")" << std::endl;
+}
+
+} // namespace
+
+/**
+ * @brief Test the vectorized TMatrix paths against scalar references and time both
+ */
+void TestMatrixSIMD()
+{
+    std::cout << "=== Testing TMatrix SIMD ===" << std::endl;
+
+    const bool bFloatOk = CheckMatrixSIMD<float>("float");
+    const bool bDoubleOk = CheckMatrixSIMD<double>("double");
+    assert(bFloatOk && bDoubleOk);
+    (void)bFloatOk;
+    (void)bDoubleOk;
+
+    BenchmarkMatrixSIMD<float>("float", 1024, 512);
+    BenchmarkMatrixSIMD<double>("double", 1024, 512);
+
+    std::cout << "TMatrix SIMD tests passed!" << std::endl << std::endl;
+}
+
+namespace
+{
+
+float RandomFloat(uint32_t& Seed, float Min, float Max)
+{
+    Seed = Seed * 1664525u + 1013904223u;
+    return Min + (Max - Min) * static_cast<float>(Seed >> 8) / static_cast<float>(1u << 24);
+}
+
+/** Structure-of-arrays boxes owning their storage */
+struct FTestBoxes
+{
+    std::vector<float> Data[6];
+
+    FTestBoxes(uint32_t& Seed, int32_t Num)
+    {
+        for (int32_t Stream = 0; Stream < 6; ++Stream)
+        {
+            Data[Stream].resize(static_cast<size_t>(Num) + 1);
+            for (float& Value : Data[Stream])
+            {
+                Value = Stream < 3 ? RandomFloat(Seed, -100.0f, 100.0f) : RandomFloat(Seed, 0.0f, 10.0f);
+            }
+        }
+    }
+
+    FBoxStreams Streams()
+    {
+        return FBoxStreams{ { Data[0].data(), Data[1].data(), Data[2].data() }, { Data[3].data(), Data[4].data(), Data[5].data() } };
+    }
+
+    bool NearlyEquals(const FTestBoxes& Other, int32_t Num) const
+    {
+        for (int32_t Stream = 0; Stream < 6; ++Stream)
+        {
+            for (int32_t i = 0; i < Num; ++i)
+            {
+                const float A = Data[Stream][i];
+                const float B = Other.Data[Stream][i];
+                if (std::abs(A - B) > 1e-5f * std::max(1.0f, std::abs(B)))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+/** The first Num boxes in blocks of 8; unused lanes of the last block are zero */
+std::vector<FBoxBlock8> MakeBoxBlocks(const FTestBoxes& Boxes, int32_t Num)
+{
+    std::vector<FBoxBlock8> Blocks((Num + 7) / 8, FBoxBlock8{});
+    for (int32_t i = 0; i < Num; ++i)
+    {
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            Blocks[i / 8].Center[Axis][i % 8] = Boxes.Data[Axis][i];
+            Blocks[i / 8].Extent[Axis][i % 8] = Boxes.Data[3 + Axis][i];
+        }
+    }
+    return Blocks;
+}
+
+/** Six planes of a box-shaped volume of half-size 60 around a random point, slightly rotated */
+std::vector<float> MakeTestPlanes(uint32_t& Seed)
+{
+    std::vector<float> Planes;
+    for (int32_t Axis = 0; Axis < 3; ++Axis)
+    {
+        for (float Sign : { 1.0f, -1.0f })
+        {
+            float Normal[3] = { RandomFloat(Seed, -0.2f, 0.2f), RandomFloat(Seed, -0.2f, 0.2f), RandomFloat(Seed, -0.2f, 0.2f) };
+            Normal[Axis] = Sign;
+            const float Length = std::sqrt(Normal[0] * Normal[0] + Normal[1] * Normal[1] + Normal[2] * Normal[2]);
+            Planes.insert(Planes.end(), { Normal[0] / Length, Normal[1] / Length, Normal[2] / Length, 60.0f + RandomFloat(Seed, -20.0f, 20.0f) });
+        }
+    }
+    return Planes;
+}
+
+bool CheckVectorKernels(const FVectorKernels& Kernels)
+{
+    const FVectorKernels& Scalar = *FVectorKernels::GetForISA(EVectorISA::Scalar);
+    uint32_t Seed = 11;
+    bool bOk = true;
+
+    // Sizes around every vector width and culling word boundary
+    for (int32_t Num : { 0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 1027 })
+    {
+        TMatrix<float> Matrix;
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            for (int32_t j = 0; j < 4; ++j)
+            {
+                Matrix.M[i][j] = RandomFloat(Seed, -2.0f, 2.0f);
+            }
+        }
+        const float* MatrixData = &Matrix.M[0][0];
+
+        FTestBoxes Boxes(Seed, Num);
+        FTestBoxes Expected = Boxes;
+        FTestBoxes Got = Boxes;
+
+        // Positions, in place
+        float* const ExpectedPositions[3] = { Expected.Data[0].data(), Expected.Data[1].data(), Expected.Data[2].data() };
+        float* const GotPositions[3] = { Got.Data[0].data(), Got.Data[1].data(), Got.Data[2].data() };
+        Scalar.TransformPositions(MatrixData, ExpectedPositions, ExpectedPositions, Num);
+        Kernels.TransformPositions(MatrixData, GotPositions, GotPositions, Num);
+        bOk = bOk && Got.NearlyEquals(Expected, Num);
+
+        // Bounds, out of place and in place
+        FTestBoxes GotBounds = Boxes;
+        Expected = Boxes;
+        Got = Boxes;
+        Scalar.TransformBounds(MatrixData, Boxes.Streams(), Expected.Streams(), Num);
+        Kernels.TransformBounds(MatrixData, Boxes.Streams(), GotBounds.Streams(), Num);
+        Kernels.TransformBounds(MatrixData, Got.Streams(), Got.Streams(), Num);
+        bOk = bOk && GotBounds.NearlyEquals(Expected, Num) && Got.NearlyEquals(Expected, Num);
+
+        // Per-box linear transforms, streams of random matrices
+        std::vector<float> Linear(static_cast<size_t>(9) * (Num + 1));
+        for (float& Value : Linear)
+        {
+            Value = RandomFloat(Seed, -2.0f, 2.0f);
+        }
+        const float* LinearStreams[9];
+        for (int32_t Element = 0; Element < 9; ++Element)
+        {
+            LinearStreams[Element] = Linear.data() + Element * (Num + 1);
+        }
+        FTestBoxes GotPerBox = Boxes;
+        Scalar.TransformBoundsPerBox(LinearStreams, Boxes.Streams(), Expected.Streams(), Num);
+        Kernels.TransformBoundsPerBox(LinearStreams, Boxes.Streams(), GotPerBox.Streams(), Num);
+        bOk = bOk && GotPerBox.NearlyEquals(Expected, Num);
+
+        // Writes past the last element would show up in the spare one
+        for (int32_t Stream = 0; Stream < 6; ++Stream)
+        {
+            bOk = bOk && GotBounds.Data[Stream][Num] == Boxes.Data[Stream][Num];
+            bOk = bOk && GotPerBox.Data[Stream][Num] == Boxes.Data[Stream][Num];
+        }
+
+        // Culling must agree exactly, including the partial last word
+        const std::vector<float> Planes = MakeTestPlanes(Seed);
+        const int32_t NumWords = (Num + 31) / 32;
+        std::vector<uint32_t> ExpectedWords(NumWords + 1, 0xDEADBEEFu);
+        std::vector<uint32_t> GotWords(NumWords + 1, 0xDEADBEEFu);
+        Scalar.CullBoxes(Planes.data(), 6, Boxes.Streams(), Num, ExpectedWords.data());
+        Kernels.CullBoxes(Planes.data(), 6, Boxes.Streams(), Num, GotWords.data());
+        bOk = bOk && ExpectedWords == GotWords && GotWords[NumWords] == 0xDEADBEEFu;
+
+        // So must block culling, whatever the unused lanes of the last block hold
+        std::vector<FBoxBlock8> Blocks = MakeBoxBlocks(Boxes, Num);
+        if (Num % 8 != 0)
+        {
+            for (int32_t Lane = Num % 8; Lane < 8; ++Lane)
+            {
+                for (int32_t Axis = 0; Axis < 3; ++Axis)
+                {
+                    Blocks.back().Center[Axis][Lane] = 0.0f;
+                    Blocks.back().Extent[Axis][Lane] = 1.0e6f;
+                }
+            }
+        }
+        std::fill(GotWords.begin(), GotWords.end(), 0xDEADBEEFu);
+        Kernels.CullBoxBlocks(Planes.data(), 6, Blocks.data(), Num, GotWords.data());
+        bOk = bOk && ExpectedWords == GotWords && GotWords[NumWords] == 0xDEADBEEFu;
+    }
+
+    // Downsampling must agree exactly, including clamped 1-wide and 1-tall sources
+    const uint32_t Sizes[][2] = { { 1, 1 }, { 1, 7 }, { 7, 1 }, { 2, 2 }, { 3, 5 }, { 37, 19 }, { 64, 64 }, { 130, 33 } };
+    for (const auto& Size : Sizes)
+    {
+        std::vector<uint8_t> Source(static_cast<size_t>(Size[0]) * Size[1] * 4);
+        for (uint8_t& Byte : Source)
+        {
+            Seed = Seed * 1664525u + 1013904223u;
+            Byte = static_cast<uint8_t>(Seed >> 24);
+        }
+        const size_t DstBytes = static_cast<size_t>(std::max(1u, Size[0] / 2)) * std::max(1u, Size[1] / 2) * 4;
+        std::vector<uint8_t> ExpectedPixels(DstBytes + 4, 0xCD);
+        std::vector<uint8_t> GotPixels(DstBytes + 4, 0xCD);
+        Scalar.DownsampleRGBA8(Source.data(), Size[0], Size[1], ExpectedPixels.data());
+        Kernels.DownsampleRGBA8(Source.data(), Size[0], Size[1], GotPixels.data());
+        bOk = bOk && ExpectedPixels == GotPixels;
+    }
+
+    std::cout << GetVectorISAName(Kernels.ISA) << " kernels match scalar: " << (bOk ? "yes" : "no") << std::endl;
+    return bOk;
+}
+
+void BenchmarkVectorKernels(const FVectorKernels& Kernels, int32_t NumBoxes, uint32_t ImageSize)
+{
+    uint32_t Seed = 3;
+    FTestBoxes Boxes(Seed, NumBoxes);
+    FTestBoxes Transformed = Boxes;
+    const std::vector<float> Planes = MakeTestPlanes(Seed);
+    std::vector<uint32_t> Words((NumBoxes + 31) / 32);
+    std::vector<uint8_t> Image(static_cast<size_t>(ImageSize) * ImageSize * 4, 0x80);
+    std::vector<uint8_t> Mip(Image.size() / 4);
+    const TMatrix<float> Matrix = TMatrix<float>::Identity;
+    constexpr int32_t NumRepeats = 16;
+
+    const double BoundsNs = TimeNanosecondsPerOp(NumBoxes * NumRepeats, [&]()
+    {
+        for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            Kernels.TransformBounds(&Matrix.M[0][0], Boxes.Streams(), Transformed.Streams(), NumBoxes);
+        }
+    });
+    const double CullNs = TimeNanosecondsPerOp(NumBoxes * NumRepeats, [&]()
+    {
+        for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            Kernels.CullBoxes(Planes.data(), 6, Boxes.Streams(), NumBoxes, Words.data());
+        }
+    });
+    const double MipNs = TimeNanosecondsPerOp(static_cast<int32_t>(Mip.size() / 4) * NumRepeats, [&]()
+    {
+        for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            Kernels.DownsampleRGBA8(Image.data(), ImageSize, ImageSize, Mip.data());
+        }
+    });
+
+    std::cout << GetVectorISAName(Kernels.ISA) << " ns/element:"
+              << " TransformBounds " << BoundsNs
+              << ", CullBoxes " << CullNs
+              << ", DownsampleRGBA8 " << MipNs
+              << " (checksum " << Transformed.Data[0][0] + Words[0] + Mip[0] << ")" << std::endl;
+}
+
+/** World bounds as the scene stores them */
+struct FTestWorldBounds
+{
+    FVector Origin;
+    FVector BoxExtent;
+    double SphereRadius;
+};
+
+/** Reference: Arvo's method on each double matrix, inlined into one loop */
+void UpdateBoundsScalar(const std::vector<FMatrix>& Matrices, const std::vector<FBox>& LocalBounds,
+                        std::vector<FMatrix>& OutTransforms, std::vector<FTestWorldBounds>& OutBounds)
+{
+    for (size_t i = 0; i < Matrices.size(); ++i)
+    {
+        const FMatrix& M = Matrices[i];
+        FVector Center;
+        FVector Extent;
+        LocalBounds[i].GetCenterAndExtents(Center, Extent);
+
+        FTestWorldBounds& Bounds = OutBounds[i];
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            Bounds.Origin[Axis] = Center.X * M.M[0][Axis] + Center.Y * M.M[1][Axis] + Center.Z * M.M[2][Axis] + M.M[3][Axis];
+            Bounds.BoxExtent[Axis] = Extent.X * std::abs(M.M[0][Axis]) + Extent.Y * std::abs(M.M[1][Axis]) + Extent.Z * std::abs(M.M[2][Axis]);
+        }
+        Bounds.SphereRadius = Bounds.BoxExtent.Size();
+        OutTransforms[i] = M;
+    }
+}
+
+/** Batched path of FScene::UpdatePrimitiveTransforms: per block, gather to streams, one kernel call, scatter */
+void UpdateBoundsBatched(const std::vector<FMatrix>& Matrices, const std::vector<FBox>& LocalBounds,
+                         std::vector<FMatrix>& OutTransforms, std::vector<FTestWorldBounds>& OutBounds)
+{
+    constexpr int32_t BlockSize = 64;
+    float Local[6][BlockSize];
+    float Linear[9][BlockSize];
+    float World[6][BlockSize];
+    const FConstBoxStreams LocalBoxes = { { Local[0], Local[1], Local[2] }, { Local[3], Local[4], Local[5] } };
+    const FBoxStreams WorldBoxes = { { World[0], World[1], World[2] }, { World[3], World[4], World[5] } };
+    const float* const LinearStreams[9] = { Linear[0], Linear[1], Linear[2], Linear[3], Linear[4], Linear[5], Linear[6], Linear[7], Linear[8] };
+
+    const int32_t Num = static_cast<int32_t>(Matrices.size());
+    for (int32_t BlockStart = 0; BlockStart < Num; BlockStart += BlockSize)
+    {
+        const int32_t NumInBlock = std::min(BlockSize, Num - BlockStart);
+        for (int32_t i = 0; i < NumInBlock; ++i)
+        {
+            FVector Center;
+            FVector Extent;
+            LocalBounds[BlockStart + i].GetCenterAndExtents(Center, Extent);
+            Local[0][i] = static_cast<float>(Center.X);
+            Local[1][i] = static_cast<float>(Center.Y);
+            Local[2][i] = static_cast<float>(Center.Z);
+            Local[3][i] = static_cast<float>(Extent.X);
+            Local[4][i] = static_cast<float>(Extent.Y);
+            Local[5][i] = static_cast<float>(Extent.Z);
+
+            const FMatrix& M = Matrices[BlockStart + i];
+            Linear[0][i] = static_cast<float>(M.M[0][0]);
+            Linear[1][i] = static_cast<float>(M.M[0][1]);
+            Linear[2][i] = static_cast<float>(M.M[0][2]);
+            Linear[3][i] = static_cast<float>(M.M[1][0]);
+            Linear[4][i] = static_cast<float>(M.M[1][1]);
+            Linear[5][i] = static_cast<float>(M.M[1][2]);
+            Linear[6][i] = static_cast<float>(M.M[2][0]);
+            Linear[7][i] = static_cast<float>(M.M[2][1]);
+            Linear[8][i] = static_cast<float>(M.M[2][2]);
+        }
+
+        FVectorKernels::Get().TransformBoundsPerBox(LinearStreams, LocalBoxes, WorldBoxes, NumInBlock);
+
+        for (int32_t i = 0; i < NumInBlock; ++i)
+        {
+            const FMatrix& M = Matrices[BlockStart + i];
+            FTestWorldBounds& Bounds = OutBounds[BlockStart + i];
+            Bounds.Origin = M.GetOrigin() + FVector(World[0][i], World[1][i], World[2][i]);
+            Bounds.BoxExtent = FVector(World[3][i], World[4][i], World[5][i]);
+            Bounds.SphereRadius = Bounds.BoxExtent.Size();
+            OutTransforms[BlockStart + i] = M;
+        }
+    }
+}
+
+bool BenchmarkBoundsUpdate(int32_t NumPrimitives)
+{
+    uint32_t Seed = 5;
+    std::vector<FMatrix> Matrices(NumPrimitives);
+    std::vector<FBox> LocalBounds(NumPrimitives);
+    for (int32_t i = 0; i < NumPrimitives; ++i)
+    {
+        // Rotation and scale near unit size, translation far from the origin
+        for (int32_t Row = 0; Row < 4; ++Row)
+        {
+            for (int32_t Column = 0; Column < 4; ++Column)
+            {
+                Matrices[i].M[Row][Column] = Row < 3 ? RandomFloat(Seed, -1.5f, 1.5f) : RandomFloat(Seed, -1.0e5f, 1.0e5f);
+            }
+        }
+        const FVector Center(RandomFloat(Seed, -1.0f, 1.0f), RandomFloat(Seed, -1.0f, 1.0f), RandomFloat(Seed, -1.0f, 1.0f));
+        const FVector Extent(RandomFloat(Seed, 0.1f, 5.0f), RandomFloat(Seed, 0.1f, 5.0f), RandomFloat(Seed, 0.1f, 5.0f));
+        LocalBounds[i] = FBox(Center - Extent, Center + Extent);
+    }
+
+    std::vector<FMatrix> ScalarTransforms(NumPrimitives);
+    std::vector<FMatrix> BatchedTransforms(NumPrimitives);
+    std::vector<FTestWorldBounds> ScalarBounds(NumPrimitives);
+    std::vector<FTestWorldBounds> BatchedBounds(NumPrimitives);
+    const int32_t NumRepeats = std::max(1, 1000000 / NumPrimitives);
+
+    const double ScalarNs = TimeNanosecondsPerOp(NumPrimitives * NumRepeats, [&]()
+    {
+        for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            UpdateBoundsScalar(Matrices, LocalBounds, ScalarTransforms, ScalarBounds);
+        }
+    });
+    const double BatchedNs = TimeNanosecondsPerOp(NumPrimitives * NumRepeats, [&]()
+    {
+        for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            UpdateBoundsBatched(Matrices, LocalBounds, BatchedTransforms, BatchedBounds);
+        }
+    });
+
+    // The batched path works in float relative to each primitive's origin
+    bool bOk = true;
+    for (int32_t i = 0; i < NumPrimitives; ++i)
+    {
+        bOk = bOk && BatchedBounds[i].Origin.Equals(ScalarBounds[i].Origin, 1e-3) &&
+              BatchedBounds[i].BoxExtent.Equals(ScalarBounds[i].BoxExtent, 1e-3) &&
+              BatchedTransforms[i] == ScalarTransforms[i];
+    }
+
+    std::cout << NumPrimitives << " moving primitives, ns/primitive (scalar double loop -> batched "
+              << GetVectorISAName(FVectorKernels::Get().ISA) << "): " << ScalarNs << " -> " << BatchedNs
+              << (bOk ? "" : " MISMATCH") << std::endl;
+    return bOk;
+}
+
+} // namespace
+
+/**
+ * @brief Test every runtime-dispatched kernel variant this CPU supports against the scalar one
+ */
+void TestVectorKernels()
+{
+    std::cout << "=== Testing Vector Kernels ===" << std::endl;
+    std::cout << "CPU features: " << MonsterRender::FPlatformCPUFeatures::GetFeatureString() << std::endl;
+    std::cout << "Selected: " << GetVectorISAName(FVectorKernels::Get().ISA) << std::endl;
+
+    for (int32_t ISA = 0; ISA < static_cast<int32_t>(EVectorISA::Num); ++ISA)
+    {
+        const FVectorKernels* Kernels = FVectorKernels::GetForISA(static_cast<EVectorISA>(ISA));
+        if (!Kernels)
+        {
+            std::cout << GetVectorISAName(static_cast<EVectorISA>(ISA)) << " not supported, skipped" << std::endl;
+            continue;
+        }
+        const bool bOk = CheckVectorKernels(*Kernels);
+        assert(bOk);
+        (void)bOk;
+        BenchmarkVectorKernels(*Kernels, 64 * 1024, 1024);
+    }
+
+    for (int32_t NumPrimitives : { 1000, 10000, 100000 })
+    {
+        const bool bBoundsOk = BenchmarkBoundsUpdate(NumPrimitives);
+        assert(bBoundsOk);
+        (void)bBoundsOk;
+    }
+
+    std::cout << "Vector kernel tests passed!" << std::endl << std::endl;
+}
+
+namespace
+{
+
+/** Culling bounds as the renderer scene stores them in double (FPrimitiveBounds layout, 64 bytes) */
+struct FTestPrimitiveBounds
+{
+    FVector Origin;
+    FVector BoxExtent;
+    float SphereRadius;
+    float MinDrawDistance;
+    float MaxCullDistance;
+};
+
+/** Sphere then box test of double bounds against world planes, as FFrustumCuller did before render bounds */
+void CullDoubleBounds(const std::vector<FTestPrimitiveBounds>& Bounds, const std::vector<FPlane>& Planes, std::vector<uint32_t>& OutWords)
+{
+    const int32_t Num = static_cast<int32_t>(Bounds.size());
+    for (int32_t WordStart = 0; WordStart < Num; WordStart += 32)
+    {
+        uint32_t VisibleBits = 0;
+        for (int32_t i = WordStart; i < std::min(WordStart + 32, Num); ++i)
+        {
+            const FTestPrimitiveBounds& B = Bounds[i];
+            bool bVisible = true;
+            for (const FPlane& Plane : Planes)
+            {
+                const float Distance = static_cast<float>(Plane.X * B.Origin.X + Plane.Y * B.Origin.Y + Plane.Z * B.Origin.Z - Plane.W);
+                const float PushOut = static_cast<float>(std::abs(Plane.X) * B.BoxExtent.X + std::abs(Plane.Y) * B.BoxExtent.Y + std::abs(Plane.Z) * B.BoxExtent.Z);
+                if (Distance > B.SphereRadius || Distance > PushOut)
+                {
+                    bVisible = false;
+                    break;
+                }
+            }
+            VisibleBits |= bVisible ? 1u << (i - WordStart) : 0u;
+        }
+        OutWords[WordStart / 32] = VisibleBits;
+    }
+}
+
+/** The same test on render-origin-relative float bounds and planes */
+void CullRenderBounds(const std::vector<FRenderBounds>& Bounds, const std::vector<FPlane4f>& Planes, std::vector<uint32_t>& OutWords)
+{
+    const int32_t Num = static_cast<int32_t>(Bounds.size());
+    for (int32_t WordStart = 0; WordStart < Num; WordStart += 32)
+    {
+        uint32_t VisibleBits = 0;
+        for (int32_t i = WordStart; i < std::min(WordStart + 32, Num); ++i)
+        {
+            const FRenderBounds& B = Bounds[i];
+            bool bVisible = true;
+            for (const FPlane4f& Plane : Planes)
+            {
+                const float Distance = Plane.X * B.Origin.X + Plane.Y * B.Origin.Y + Plane.Z * B.Origin.Z - Plane.W;
+                const float PushOut = std::abs(Plane.X) * B.BoxExtent.X + std::abs(Plane.Y) * B.BoxExtent.Y + std::abs(Plane.Z) * B.BoxExtent.Z;
+                if (Distance > B.SphereRadius || Distance > PushOut)
+                {
+                    bVisible = false;
+                    break;
+                }
+            }
+            VisibleBits |= bVisible ? 1u << (i - WordStart) : 0u;
+        }
+        OutWords[WordStart / 32] = VisibleBits;
+    }
+}
+
+/**
+ * Time culling double world bounds against float relative bounds, far from the world origin
+ * Returns false if the results differ on more than boundary cases.
+ */
+bool BenchmarkRenderBoundsCulling(int32_t NumPrimitives)
+{
+    uint32_t Seed = 9;
+    const FVector ViewOrigin(1.0e7 + 1234.5, -3.0e6 + 77.25, 2.5e5);
+    const FVector RenderOrigin = GetRenderTileOrigin(ViewOrigin);
+
+    // A box-shaped volume around the view, planes rebased as FRenderConvexVolume does
+    const std::vector<float> UnitPlanes = MakeTestPlanes(Seed);
+    std::vector<FPlane> WorldPlanes;
+    std::vector<FPlane4f> RelativePlanes;
+    for (size_t p = 0; p < UnitPlanes.size(); p += 4)
+    {
+        const FVector Normal(UnitPlanes[p], UnitPlanes[p + 1], UnitPlanes[p + 2]);
+        const double W = (Normal | ViewOrigin) + UnitPlanes[p + 3] * 200.0;
+        WorldPlanes.push_back(FPlane(Normal, W));
+        RelativePlanes.push_back(FPlane4f(static_cast<float>(Normal.X), static_cast<float>(Normal.Y), static_cast<float>(Normal.Z),
+                                          static_cast<float>(W - (Normal | RenderOrigin))));
+    }
+
+    std::vector<FTestPrimitiveBounds> WorldBounds(NumPrimitives);
+    std::vector<FRenderBounds> RenderBounds(NumPrimitives);
+    for (int32_t i = 0; i < NumPrimitives; ++i)
+    {
+        FTestPrimitiveBounds& B = WorldBounds[i];
+        B.Origin = ViewOrigin + FVector(RandomFloat(Seed, -2.0e4f, 2.0e4f), RandomFloat(Seed, -2.0e4f, 2.0e4f), RandomFloat(Seed, -2.0e4f, 2.0e4f));
+        B.BoxExtent = FVector(RandomFloat(Seed, 1.0f, 500.0f), RandomFloat(Seed, 1.0f, 500.0f), RandomFloat(Seed, 1.0f, 500.0f));
+        B.SphereRadius = static_cast<float>(B.BoxExtent.Size());
+        B.MinDrawDistance = 0.0f;
+        B.MaxCullDistance = FLT_MAX;
+        RenderBounds[i] = FRenderBounds(B.Origin, B.BoxExtent, B.SphereRadius, RenderOrigin);
+    }
+
+    std::vector<uint32_t> DoubleWords((NumPrimitives + 31) / 32);
+    std::vector<uint32_t> RenderWords((NumPrimitives + 31) / 32);
+    const int32_t NumRepeats = std::max(1, 4000000 / NumPrimitives);
+
+    const double DoubleNs = TimeNanosecondsPerOp(NumPrimitives * NumRepeats, [&]()
+    {
+        for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            CullDoubleBounds(WorldBounds, WorldPlanes, DoubleWords);
+        }
+    });
+    const double RenderNs = TimeNanosecondsPerOp(NumPrimitives * NumRepeats, [&]()
+    {
+        for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            CullRenderBounds(RenderBounds, RelativePlanes, RenderWords);
+        }
+    });
+
+    int32_t NumVisible = 0;
+    int32_t NumDifferent = 0;
+    for (size_t w = 0; w < DoubleWords.size(); ++w)
+    {
+        NumVisible += static_cast<int32_t>(std::bitset<32>(DoubleWords[w]).count());
+        NumDifferent += static_cast<int32_t>(std::bitset<32>(DoubleWords[w] ^ RenderWords[w]).count());
+    }
+    const bool bOk = NumDifferent <= NumPrimitives / 10000;
+
+    std::cout << NumPrimitives << " primitives culled (" << NumVisible << " visible), ns/primitive "
+              << "(double " << sizeof(FTestPrimitiveBounds) << " B -> render bounds " << sizeof(FRenderBounds) << " B): "
+              << DoubleNs << " -> " << RenderNs << ", " << NumDifferent << " boundary differences" << std::endl;
+    return bOk;
+}
+
+/** Box test of each primitive's render bounds in turn, as FFrustumCuller did before bounds blocks */
+void CullRenderBoxes(const std::vector<FRenderBounds>& Bounds, const std::vector<FPlane4f>& Planes, std::vector<uint32_t>& OutWords)
+{
+    const int32_t Num = static_cast<int32_t>(Bounds.size());
+    for (int32_t WordStart = 0; WordStart < Num; WordStart += 32)
+    {
+        uint32_t VisibleBits = 0;
+        for (int32_t i = WordStart; i < std::min(WordStart + 32, Num); ++i)
+        {
+            const FRenderBounds& B = Bounds[i];
+            bool bVisible = true;
+            for (const FPlane4f& Plane : Planes)
+            {
+                const float Distance = Plane.X * B.Origin.X + Plane.Y * B.Origin.Y + Plane.Z * B.Origin.Z - Plane.W;
+                const float PushOut = std::abs(Plane.X) * B.BoxExtent.X + std::abs(Plane.Y) * B.BoxExtent.Y + std::abs(Plane.Z) * B.BoxExtent.Z;
+                if (Distance > PushOut)
+                {
+                    bVisible = false;
+                    break;
+                }
+            }
+            VisibleBits |= bVisible ? 1u << (i - WordStart) : 0u;
+        }
+        OutWords[WordStart / 32] = VisibleBits;
+    }
+}
+
+/**
+ * Time per-primitive culling of render bounds against CullBoxBlocks on the same
+ * bounds in blocks of 8, for every instruction set this CPU supports
+ * Returns false if any variant's results differ.
+ */
+bool BenchmarkBoxBlockCulling(int32_t NumPrimitives)
+{
+    uint32_t Seed = 17;
+    const std::vector<float> UnitPlanes = MakeTestPlanes(Seed);
+    std::vector<FPlane4f> Planes;
+    std::vector<float> PlaneData;
+    for (size_t p = 0; p < UnitPlanes.size(); p += 4)
+    {
+        Planes.push_back(FPlane4f(UnitPlanes[p], UnitPlanes[p + 1], UnitPlanes[p + 2], UnitPlanes[p + 3] * 200.0f));
+        PlaneData.insert(PlaneData.end(), { Planes.back().X, Planes.back().Y, Planes.back().Z, Planes.back().W });
+    }
+
+    std::vector<FRenderBounds> Bounds(NumPrimitives);
+    std::vector<FBoxBlock8> Blocks((NumPrimitives + 7) / 8, FBoxBlock8{});
+    for (int32_t i = 0; i < NumPrimitives; ++i)
+    {
+        const FVector Origin(RandomFloat(Seed, -2.0e4f, 2.0e4f), RandomFloat(Seed, -2.0e4f, 2.0e4f), RandomFloat(Seed, -2.0e4f, 2.0e4f));
+        const FVector Extent(RandomFloat(Seed, 1.0f, 500.0f), RandomFloat(Seed, 1.0f, 500.0f), RandomFloat(Seed, 1.0f, 500.0f));
+        Bounds[i] = FRenderBounds(Origin, Extent, Extent.Size(), FVector::ZeroVector);
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            Blocks[i / 8].Center[Axis][i % 8] = Bounds[i].Origin[Axis];
+            Blocks[i / 8].Extent[Axis][i % 8] = Bounds[i].BoxExtent[Axis];
+        }
+    }
+
+    std::vector<uint32_t> ExpectedWords((NumPrimitives + 31) / 32);
+    std::vector<uint32_t> Words(ExpectedWords.size());
+    const int32_t NumRepeats = std::max(1, 4000000 / NumPrimitives);
+
+    const double PerPrimitiveNs = TimeNanosecondsPerOp(NumPrimitives * NumRepeats, [&]()
+    {
+        for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+        {
+            CullRenderBoxes(Bounds, Planes, ExpectedWords);
+        }
+    });
+
+    int32_t NumVisible = 0;
+    for (uint32_t Word : ExpectedWords)
+    {
+        NumVisible += static_cast<int32_t>(std::bitset<32>(Word).count());
+    }
+    std::cout << NumPrimitives << " primitives culled (" << NumVisible << " visible), ns/primitive: per primitive " << PerPrimitiveNs;
+
+    bool bOk = true;
+    for (int32_t ISA = 0; ISA < static_cast<int32_t>(EVectorISA::Num); ++ISA)
+    {
+        const FVectorKernels* Kernels = FVectorKernels::GetForISA(static_cast<EVectorISA>(ISA));
+        if (!Kernels)
+        {
+            continue;
+        }
+        const double BlockNs = TimeNanosecondsPerOp(NumPrimitives * NumRepeats, [&]()
+        {
+            for (int32_t Repeat = 0; Repeat < NumRepeats; ++Repeat)
+            {
+                Kernels->CullBoxBlocks(PlaneData.data(), 6, Blocks.data(), NumPrimitives, Words.data());
+            }
+        });
+        bOk = bOk && Words == ExpectedWords;
+        std::cout << ", " << GetVectorISAName(Kernels->ISA) << " blocks " << BlockNs << " (" << PerPrimitiveNs / BlockNs << "x)";
+    }
+    std::cout << std::endl;
+    return bOk;
+}
+
+} // namespace
+
+/**
+ * @brief Test render-origin-relative transforms and bounds, and culling on them
+ */
+void TestRenderTransform()
+{
+    std::cout << "=== Testing Render Transforms ===" << std::endl;
+
+    // Tile origins keep views within half a tile
+    const FVector ViewOrigin(3.7e7, -123456.0, 131073.0);
+    const FVector TileOrigin = GetRenderTileOrigin(ViewOrigin);
+    for (int32_t Axis = 0; Axis < 3; ++Axis)
+    {
+        assert(std::abs(ViewOrigin[Axis] - TileOrigin[Axis]) <= RenderTileSize * 0.5);
+        assert(std::fmod(TileOrigin[Axis], RenderTileSize) == 0.0);
+    }
+    assert(GetRenderTileOrigin(FVector(100.0, -100.0, 0.0)) == FVector::ZeroVector);
+
+    // A transform far from the world origin keeps float precision near the camera
+    FMatrix LocalToWorld = FMatrix::MakeFromRotator(FRotator(30.0, 45.0, 10.0));
+    LocalToWorld.SetOrigin(ViewOrigin + FVector(10.25, -3.5, 7.0));
+    const FRenderTransform RenderTransform(LocalToWorld, TileOrigin);
+    const FVector3f LocalPosition(1.5f, -2.0f, 0.75f);
+    const FVector3f RelativePosition = RenderTransform.TransformPosition(LocalPosition);
+    const FVector WorldPosition = LocalToWorld.TransformPosition(FVector(LocalPosition)).GetXYZ();
+    assert((FVector(RelativePosition) + TileOrigin).Equals(WorldPosition, 1e-2));
+    const FMatrix44f Matrix44 = RenderTransform.ToMatrix44f();
+    assert(Matrix44.M[3][0] == RenderTransform.Origin.X && Matrix44.M[3][3] == 1.0f && Matrix44.M[0][3] == 0.0f);
+    assert(FRenderTransform().ToMatrix44f() == FMatrix44f::Identity);
+
+    // Float bounds contain the double ones
+    uint32_t Seed = 21;
+    for (int32_t i = 0; i < 1000; ++i)
+    {
+        const FVector Origin = ViewOrigin + FVector(RandomFloat(Seed, -1.0e5f, 1.0e5f), RandomFloat(Seed, -1.0e5f, 1.0e5f), RandomFloat(Seed, -1.0e5f, 1.0e5f));
+        const FVector Extent(RandomFloat(Seed, 0.0f, 10.0f), RandomFloat(Seed, 0.0f, 10.0f), RandomFloat(Seed, 0.0f, 10.0f));
+        const FRenderBounds Bounds(Origin, Extent, Extent.Size(), TileOrigin);
+        for (int32_t Axis = 0; Axis < 3; ++Axis)
+        {
+            const double Relative = Origin[Axis] - TileOrigin[Axis];
+            assert(static_cast<double>(Bounds.Origin[Axis]) - Bounds.BoxExtent[Axis] <= Relative - Extent[Axis]);
+            assert(static_cast<double>(Bounds.Origin[Axis]) + Bounds.BoxExtent[Axis] >= Relative + Extent[Axis]);
+        }
+        assert(Bounds.SphereRadius >= Extent.Size());
+    }
+
+    for (int32_t NumPrimitives : { 1000, 10000, 100000, 1000000 })
+    {
+        const bool bCullOk = BenchmarkRenderBoundsCulling(NumPrimitives);
+        assert(bCullOk);
+        (void)bCullOk;
+    }
+
+    for (int32_t NumPrimitives : { 1000, 10000, 100000, 1000000 })
+    {
+        const bool bBlocksOk = BenchmarkBoxBlockCulling(NumPrimitives);
+        assert(bBlocksOk);
+        (void)bBlocksOk;
+    }
+
+    std::cout << "Render transform tests passed!" << std::endl << std::endl;
+}
+
 /**
  * @brief Test TTransform operations
  */
@@ -374,6 +1315,9 @@ void RunMathLibraryTests()
     TestQuat();
     TestRotator();
     TestMatrix();
+    TestMatrixSIMD();
+    TestVectorKernels();
+    TestRenderTransform();
     TestTransform();
     TestBox();
     TestSphere();
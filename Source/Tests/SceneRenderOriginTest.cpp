@@ -0,0 +1,250 @@
+// Copyright Monster Engine. All Rights Reserved.
+
+/**
+ * @file SceneRenderOriginTest.cpp
+ * @brief Tests for the engine scene's packed render data around its render origin
+ *
+ * Checks that the float transforms and bounds the scene packs relative to its
+ * tiled render origin stay on the tile grid and agree with the proxies'
+ * double precision transforms through world offsets and origin rebases.
+ */
+
+#include "Engine/Scene.h"
+#include "Engine/PrimitiveSceneProxy.h"
+#include "Engine/Components/PrimitiveComponent.h"
+#include "Math/RenderTransform.h"
+#include "Core/Log.h"
+#include <algorithm>
+#include <cmath>
+
+namespace MonsterEngine {
+namespace SceneRenderOriginTest {
+
+namespace {
+    /** Proxy with no render resources, enough for the scene's packed arrays */
+    class FTestSceneProxy : public FPrimitiveSceneProxy
+    {
+    public:
+        explicit FTestSceneProxy(const UPrimitiveComponent* InComponent)
+            : FPrimitiveSceneProxy(InComponent, "TestSceneProxy")
+        {
+        }
+
+        virtual SIZE_T GetTypeHash() const override
+        {
+            static SIZE_T TypeHash = 0x5E0E0001;
+            return TypeHash;
+        }
+    };
+
+    /** Component with a fixed box around its location */
+    class UTestPrimitiveComponent : public UPrimitiveComponent
+    {
+    public:
+        virtual FPrimitiveSceneProxy* CreateSceneProxy() override
+        {
+            return new FTestSceneProxy(this);
+        }
+
+        virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override
+        {
+            const FVector Extent(50.0, 50.0, 50.0);
+            return FBoxSphereBounds(LocalToWorld.GetLocation(), Extent, Extent.Size());
+        }
+    };
+
+    /** Positions match to a few float ulps at their distance from the render origin */
+    bool IsNear(const FVector& A, const FVector& B, const FVector& RenderOrigin)
+    {
+        const FVector Relative = B - RenderOrigin;
+        const double Tolerance = 0.05 + 1e-6 * std::max({std::abs(Relative.X), std::abs(Relative.Y), std::abs(Relative.Z)});
+        return std::abs(A.X - B.X) <= Tolerance && std::abs(A.Y - B.Y) <= Tolerance && std::abs(A.Z - B.Z) <= Tolerance;
+    }
+
+    FVector ToWorld(const Math::FVector3f& Relative, const FVector& RenderOrigin)
+    {
+        return FVector(Relative.X, Relative.Y, Relative.Z) + RenderOrigin;
+    }
+
+    /** Packed transforms and bounds agree with the proxies, and with the expected positions */
+    bool CheckPackedData(const FScene& Scene, const FVector* ExpectedPositions, int32 NumPrimitives, const char* Stage)
+    {
+        const FVector& RenderOrigin = Scene.GetRenderOrigin();
+        if (Math::GetRenderTileOrigin(RenderOrigin) != RenderOrigin)
+        {
+            MR_LOG_ERROR(String("  ") + Stage + ": render origin is off the tile grid");
+            return false;
+        }
+
+        for (int32 i = 0; i < NumPrimitives; ++i)
+        {
+            const FVector ProxyPosition = Scene.GetPrimitiveSceneProxies()[i]->GetLocalToWorld().GetOrigin();
+            const FVector TransformPosition = ToWorld(Scene.GetPrimitiveTransforms()[i].Origin, RenderOrigin);
+            const FVector BoundsPosition = ToWorld(Scene.GetPrimitiveRenderBounds()[i].Origin, RenderOrigin);
+            const FVector& DoubleBoundsPosition = Scene.GetPrimitiveBounds()[i].BoxSphereBounds.Origin;
+
+            const FVector& Expected = ExpectedPositions[i];
+            if (!IsNear(ProxyPosition, Expected, RenderOrigin) || !IsNear(DoubleBoundsPosition, Expected, RenderOrigin) ||
+                !IsNear(TransformPosition, Expected, RenderOrigin) || !IsNear(BoundsPosition, Expected, RenderOrigin))
+            {
+                MR_LOG_ERROR(String("  ") + Stage + ": primitive " + std::to_string(i) +
+                             " transform and bounds disagree");
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+/**
+ * A world offset followed by a render origin update keeps transforms and bounds together
+ */
+bool TestApplyWorldOffset()
+{
+    MR_LOG_INFO("[Test] ApplyWorldOffset then UpdateRenderOrigin");
+
+    constexpr int32 NumPrimitives = 2;
+    FVector Positions[NumPrimitives] = {
+        FVector(10000123.25, -3000000.5, 500000.0),
+        FVector(-250000.0, 40.0, 12.0)
+    };
+
+    FScene* Scene = new FScene();
+    UTestPrimitiveComponent Components[NumPrimitives];
+    for (int32 i = 0; i < NumPrimitives; ++i)
+    {
+        Components[i].SetWorldLocation(Positions[i]);
+        Components[i].UpdateComponentToWorld();
+        Components[i].UpdateBounds();
+        Scene->AddPrimitive(&Components[i]);
+    }
+
+    bool bPassed = Scene->GetPrimitiveSceneProxies().Num() == NumPrimitives;
+    Scene->UpdateRenderOrigin(Positions[0]);
+    bPassed = bPassed && CheckPackedData(*Scene, Positions, NumPrimitives, "Initial");
+
+    // Not a whole number of tiles, so the origin has to be snapped back to the grid
+    const FVector Offset(-10000000.0 + 0.5, 123456.75, -777.25);
+    Scene->ApplyWorldOffset(Offset);
+    for (int32 i = 0; i < NumPrimitives; ++i)
+    {
+        Positions[i] = Positions[i] + Offset;
+    }
+    bPassed = bPassed && CheckPackedData(*Scene, Positions, NumPrimitives, "After ApplyWorldOffset");
+
+    // The per-frame rebase repacks from the proxies, which must already be offset
+    Scene->UpdateRenderOrigin(Positions[0]);
+    bPassed = bPassed && CheckPackedData(*Scene, Positions, NumPrimitives, "After UpdateRenderOrigin");
+    Scene->UpdateRenderOrigin(Positions[1]);
+    bPassed = bPassed && CheckPackedData(*Scene, Positions, NumPrimitives, "After moving the view");
+
+    // The scene owns and deletes the scene infos and proxies
+    delete Scene;
+
+    if (bPassed)
+    {
+        MR_LOG_INFO("  PASSED");
+    }
+    return bPassed;
+}
+
+/**
+ * The batched and single transform update paths store the same bounds on the proxy and in the packed arrays
+ */
+bool TestUpdatePrimitiveTransforms()
+{
+    MR_LOG_INFO("[Test] UpdatePrimitiveTransforms");
+
+    constexpr int32 NumPrimitives = 2;
+    FVector Positions[NumPrimitives] = {
+        FVector(2000000.0, 10.0, -5.0),
+        FVector(-35.5, 700.0, 80000.25)
+    };
+
+    FScene* Scene = new FScene();
+    UTestPrimitiveComponent Components[NumPrimitives];
+    for (int32 i = 0; i < NumPrimitives; ++i)
+    {
+        Components[i].SetWorldLocation(Positions[i]);
+        Components[i].UpdateComponentToWorld();
+        Components[i].UpdateBounds();
+        Scene->AddPrimitive(&Components[i]);
+    }
+    Scene->UpdateRenderOrigin(Positions[0]);
+
+    // Batched path: twice the scale, moved by the same amount
+    const FVector Move(1000.0, -250.0, 3.5);
+    TArray<FPrimitiveTransformUpdate> Updates;
+    for (int32 i = 0; i < NumPrimitives; ++i)
+    {
+        Positions[i] = Positions[i] + Move;
+        FPrimitiveTransformUpdate Update;
+        Update.PackedIndex = i;
+        Update.LocalToWorld = FMatrix::MakeScale(2.0) * FMatrix::MakeTranslation(Positions[i]);
+        Updates.Add(Update);
+    }
+    Scene->UpdatePrimitiveTransforms(Updates);
+
+    bool bPassed = CheckPackedData(*Scene, Positions, NumPrimitives, "After UpdatePrimitiveTransforms");
+    for (int32 i = 0; i < NumPrimitives && bPassed; ++i)
+    {
+        const FPrimitiveSceneProxy* Proxy = Scene->GetPrimitiveSceneProxies()[i];
+        const FBoxSphereBounds& ProxyBounds = Proxy->GetBounds();
+        const FBoxSphereBounds& SceneBounds = Scene->GetPrimitiveBounds()[i].BoxSphereBounds;
+        const FVector RoundTrip = Proxy->GetWorldToLocal().TransformPosition(Positions[i]).GetXYZ();
+
+        bPassed = ProxyBounds.Origin == SceneBounds.Origin && ProxyBounds.BoxExtent == SceneBounds.BoxExtent &&
+                  ProxyBounds.SphereRadius == SceneBounds.SphereRadius &&
+                  SceneBounds.SphereRadius == SceneBounds.BoxExtent.Size() &&
+                  RoundTrip.Size() < 1e-6;
+        if (!bPassed)
+        {
+            MR_LOG_ERROR("  Batched update: proxy bounds or inverse disagree with the scene for primitive " + std::to_string(i));
+        }
+    }
+
+    // Single path: the component's own bounds, with the same sphere rule
+    Components[1].SetWorldLocation(Positions[1]);
+    Components[1].UpdateComponentToWorld();
+    Components[1].UpdateBounds();
+    Scene->UpdatePrimitiveTransform(&Components[1]);
+    if (bPassed)
+    {
+        const FBoxSphereBounds& ProxyBounds = Scene->GetPrimitiveSceneProxies()[1]->GetBounds();
+        const FBoxSphereBounds& SceneBounds = Scene->GetPrimitiveBounds()[1].BoxSphereBounds;
+        bPassed = ProxyBounds.SphereRadius == SceneBounds.SphereRadius &&
+                  SceneBounds.SphereRadius == SceneBounds.BoxExtent.Size();
+        if (!bPassed)
+        {
+            MR_LOG_ERROR("  Single update: sphere radius does not enclose the box");
+        }
+    }
+
+    delete Scene;
+
+    if (bPassed)
+    {
+        MR_LOG_INFO("  PASSED");
+    }
+    return bPassed;
+}
+
+/**
+ * Run all scene render origin tests
+ */
+bool RunAllTests()
+{
+    MR_LOG_INFO("========================================");
+    MR_LOG_INFO("  Scene Render Origin Tests");
+    MR_LOG_INFO("========================================");
+
+    bool bAllPassed = true;
+    bAllPassed &= TestApplyWorldOffset();
+    bAllPassed &= TestUpdatePrimitiveTransforms();
+
+    MR_LOG_INFO(bAllPassed ? "All scene render origin tests passed" : "Scene render origin tests FAILED");
+    return bAllPassed;
+}
+
+} // namespace SceneRenderOriginTest
+} // namespace MonsterEngine
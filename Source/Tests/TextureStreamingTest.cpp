@@ -58,6 +58,18 @@ void RunAllTests() {
         pool.Free(ptr3);
         pool.Free(ptr4);
         
+        // Sizes below the pool granularity are accounted as the whole block reserved for them
+        void* small = pool.Allocate(1000, 16);
+        const SIZE_T smallBlock = pool.GetAllocationSize(small);
+        const bool bAccounted = smallBlock == 1024 && pool.GetUsedSize() == smallBlock;
+        pool.Free(small);
+        if (bAccounted && pool.GetUsedSize() == 0) {
+            MR_LOG_INFO("  [OK] Used size tracks reserved blocks");
+        } else {
+            MR_LOG_ERROR("  [FAIL] Used size " + std::to_string(pool.GetUsedSize()) +
+                         " does not match the reserved block of " + std::to_string(smallBlock) + " bytes");
+        }
+        
         MR_LOG_INFO("  [OK] Test 1 completed\n");
     }
 